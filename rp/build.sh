@@ -64,6 +64,19 @@ else
     export DEBUG_MODE=1
 fi
 
+# Generate the 4-bit packed sheets (tiles are drawn from RAM every frame)
+echo "Generating packed sprites"
+python sprite_packer.py --input=src/include/data/loserboy.h \
+    --output=src/include/data/loserboy_packed.h --name=loserboy
+python sprite_packer.py --input=src/include/data/tiles.h \
+    --output=src/include/data/tiles_packed.h --name=tiles --ram
+
+# Generate the compiled sprites (standing frames only, they live in flash)
+echo "Generating compiled sprites"
+python sprite_compiler.py --input=src/include/data/loserboy.h \
+    --output=src/include/data/loserboy_compiled.h --name=loserboy \
+    --frames=10,21
+
 # Set the build directory. Delete previous contents if any
 echo "Deleting previous build directory"
 rm -rf build
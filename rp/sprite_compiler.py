@@ -0,0 +1,212 @@
+import argparse
+import re
+
+BLOCK_PIXELS = 16
+NUM_PHASES = 16
+TRANSPARENT_PIXEL = 0xCC
+
+
+def read_sprite_header(input_file, name):
+    with open(input_file, "r") as file:
+        text = file.read()
+
+    def define(field):
+        match = re.search(rf"#define img_{name}_{field}\s+(\d+)", text)
+        if match is None:
+            raise ValueError(f"img_{name}_{field} not found in {input_file}")
+        return int(match.group(1))
+
+    body = text[text.index(f"img_{name}_data[]") :]
+    body = body[body.index("{") + 1 : body.index("};")]
+    words = [int(word, 16) for word in re.findall(r"0x[0-9a-fA-F]+", body)]
+    return (
+        define("width"),
+        define("height"),
+        define("stride"),
+        define("num_spr"),
+        words,
+    )
+
+
+def read_rgb2index(draw_file):
+    # Keep the palette mapping in sync with the rgb2index LUT in vga_draw.c
+    with open(draw_file, "r") as file:
+        text = file.read()
+    body = text[text.index("rgb2index[64]") :]
+    body = body[body.index("{") + 1 : body.index("};")]
+    values = [int(value) for value in re.findall(r"^\s*(\d+),", body, re.M)]
+    if len(values) != 64:
+        raise ValueError(f"Expected 64 rgb2index entries, found {len(values)}")
+    return values
+
+
+def frame_to_planar(words, frame, width, height, stride, rgb2index):
+    # Returns per row a list of (mask, [plane0..plane3]) 16-bit blocks
+    blocks = (width + BLOCK_PIXELS - 1) // BLOCK_PIXELS
+    base = frame * stride * height
+    rows = []
+    for y in range(height):
+        row_words = words[base + y * stride : base + (y + 1) * stride]
+        pixels = []
+        for word in row_words:
+            pixels += [(word >> (8 * i)) & 0xFF for i in range(4)]
+        row = []
+        for b in range(blocks):
+            mask = 0
+            planes = [0, 0, 0, 0]
+            for p in range(BLOCK_PIXELS):
+                x = b * BLOCK_PIXELS + p
+                if x >= width or pixels[x] == TRANSPARENT_PIXEL:
+                    continue
+                bit = 0x8000 >> p
+                index = rgb2index[pixels[x] & 0x3F]
+                mask |= bit
+                for plane in range(4):
+                    if index & (1 << plane):
+                        planes[plane] |= bit
+            row.append((mask, planes))
+        rows.append(row)
+    return rows
+
+
+def shift_row(row, shift):
+    # Shift a planar row right by `shift` pixels, spilling into a new block
+    out = []
+    prev = (0, [0, 0, 0, 0])
+    for mask, planes in row + [(0, [0, 0, 0, 0])]:
+        out_mask = (((prev[0] << 16) | mask) >> shift) & 0xFFFF
+        out_planes = [
+            (((prev[1][i] << 16) | planes[i]) >> shift) & 0xFFFF for i in range(4)
+        ]
+        out.append((out_mask, out_planes))
+        prev = (mask, planes)
+    return out
+
+
+def emit_store(lines, index, mask, value):
+    # One 32-bit store covers two planes of a block; pick the cheapest form
+    if mask == 0xFFFFFFFF:
+        lines.append(f"  dst[{index}] = 0x{value:08X}u;")
+    elif value == mask:
+        lines.append(f"  dst[{index}] |= 0x{mask:08X}u;")
+    elif value == 0:
+        lines.append(f"  dst[{index}] &= 0x{(~mask) & 0xFFFFFFFF:08X}u;")
+    else:
+        lines.append(
+            f"  dst[{index}] = (dst[{index}] & 0x{(~mask) & 0xFFFFFFFF:08X}u) | "
+            f"0x{value:08X}u;"
+        )
+
+
+def emit_function(name, rows, shift, line_words, ram):
+    if ram:
+        lines = [f"static void __not_in_flash_func({name})(uint32_t *dst) {{"]
+    else:
+        lines = [f"static void {name}(uint32_t *dst) {{"]
+    for y, row in enumerate(rows):
+        for b, (mask, planes) in enumerate(shift_row(row, shift)):
+            if mask == 0:
+                continue
+            mask32 = mask | (mask << 16)
+            for pair in range(2):
+                value = planes[2 * pair] | (planes[2 * pair + 1] << 16)
+                emit_store(lines, y * line_words + b * 2 + pair, mask32, value)
+    lines.append("}")
+    return lines
+
+
+def generate(args):
+    width, height, stride, num_spr, words = read_sprite_header(args.input, args.name)
+    rgb2index = read_rgb2index(args.rgb2index)
+    if args.frames == "all":
+        frames = list(range(num_spr))
+    else:
+        frames = [int(frame) for frame in args.frames.split(",")]
+    line_words = args.screen_width // BLOCK_PIXELS * 2
+
+    guard = f"{args.name.upper()}_COMPILED_H"
+    out = [
+        f"/* File generated automatically by sprite_compiler.py from "
+        f"{args.input.split('/')[-1]} */",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "vga/draw.h"',
+        "",
+        f"#define img_{args.name}_compiled_screen_width {args.screen_width}",
+        f"#define img_{args.name}_compiled_num {len(frames)}",
+        "",
+    ]
+    for frame in frames:
+        rows = frame_to_planar(words, frame, width, height, stride, rgb2index)
+        for shift in range(NUM_PHASES):
+            name = f"img_{args.name}_f{frame}_s{shift}"
+            out += emit_function(name, rows, shift, line_words, args.ram)
+            out.append("")
+        out.append(
+            f"static const compiled_sprite_func img_{args.name}_f{frame}"
+            f"[VGA_BLOCK_PIXELS] = {{"
+        )
+        out += [f"    img_{args.name}_f{frame}_s{shift}," for shift in range(NUM_PHASES)]
+        out.append("};")
+        out.append("")
+
+    out.append(
+        f"static const struct COMPILED_SPRITE img_{args.name}_compiled[] = {{"
+    )
+    out += [f"    {{{frame}, img_{args.name}_f{frame}}}," for frame in frames]
+    out.append("};")
+    out.append("")
+    out.append(f"#endif  // {guard}")
+
+    with open(args.output, "w") as file:
+        file.write("\n".join(out) + "\n")
+    print(f"{args.output} generated successfully!")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Generate straight-line C blitters (one per 16-pixel "
+        "phase) for the frames of a sprite sheet header."
+    )
+    parser.add_argument(
+        "--input",
+        required=True,
+        help="Sprite sheet header, e.g. src/include/data/loserboy.h.",
+    )
+    parser.add_argument(
+        "--output",
+        required=True,
+        help="Output .h (header) file with the compiled sprites.",
+    )
+    parser.add_argument(
+        "--name",
+        required=True,
+        help="Sheet name used in the img_<name>_* identifiers.",
+    )
+    parser.add_argument(
+        "--rgb2index",
+        required=False,
+        default="src/vga_draw.c",
+        help="Source file holding the rgb2index palette LUT.",
+    )
+    parser.add_argument(
+        "--frames",
+        required=False,
+        default="all",
+        help="Comma separated frame numbers to compile, or 'all'.",
+    )
+    parser.add_argument(
+        "--screen_width",
+        required=False,
+        type=int,
+        default=320,
+        help="Framebuffer width in pixels the code is compiled for.",
+    )
+    parser.add_argument(
+        "--ram",
+        action="store_true",
+        help="Place the compiled code in RAM instead of flash.",
+    )
+
+    generate(parser.parse_args())
@@ -0,0 +1,106 @@
+import argparse
+
+from sprite_compiler import TRANSPARENT_PIXEL, read_rgb2index, read_sprite_header
+
+PACKED_PIXELS = 8
+# Palette index the chunky transparent key maps to, reserved in packed data
+PACKED_TRANSPARENT = 12
+WORDS_PER_LINE = 6
+
+
+def pack_sheet(words, width, height, stride, num_spr, rgb2index):
+    # Two palette indices per byte, pixel 0 in the low nibble of each word
+    packed_stride = (width + PACKED_PIXELS - 1) // PACKED_PIXELS
+    out = []
+    for y in range(height * num_spr):
+        pixels = []
+        for word in words[y * stride : (y + 1) * stride]:
+            pixels += [(word >> (8 * i)) & 0xFF for i in range(4)]
+        for w in range(packed_stride):
+            value = 0
+            for p in range(PACKED_PIXELS):
+                x = w * PACKED_PIXELS + p
+                if x >= width or pixels[x] == TRANSPARENT_PIXEL:
+                    index = PACKED_TRANSPARENT
+                else:
+                    index = rgb2index[pixels[x] & 0x3F]
+                    if index == PACKED_TRANSPARENT:
+                        raise ValueError(
+                            f"Opaque pixel {x},{y} uses the transparent index "
+                            f"{PACKED_TRANSPARENT}"
+                        )
+                value |= index << (4 * p)
+            out.append(value)
+    return packed_stride, out
+
+
+def generate(args):
+    width, height, stride, num_spr, words = read_sprite_header(args.input, args.name)
+    rgb2index = read_rgb2index(args.rgb2index)
+    packed_stride, data = pack_sheet(words, width, height, stride, num_spr, rgb2index)
+
+    prefix = f"img_{args.name}_packed"
+    guard = f"{args.name.upper()}_PACKED_H"
+    if args.ram:
+        placement = f'__not_in_flash("{prefix}_data") '
+    else:
+        placement = ""
+    out = [
+        f"/* File generated automatically by sprite_packer.py from "
+        f"{args.input.split('/')[-1]} */",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        f"#define {prefix}_width {width}",
+        f"#define {prefix}_height {height}",
+        f"#define {prefix}_stride {packed_stride}",
+        f"#define {prefix}_num_spr {num_spr}",
+        "",
+        f"const unsigned int {prefix}_data[]",
+        f"    {placement}__attribute__((aligned(4))) = {{",
+    ]
+    for i in range(0, len(data), WORDS_PER_LINE):
+        line = ", ".join(f"0x{word:08x}" for word in data[i : i + WORDS_PER_LINE])
+        out.append(f"        {line},")
+    out.append("};")
+    out.append("")
+    out.append(f"#endif  // {guard}")
+
+    with open(args.output, "w") as file:
+        file.write("\n".join(out) + "\n")
+    print(f"{args.output} generated successfully!")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Convert a chunky sprite sheet header into 4-bit packed "
+        "palette indices, two pixels per byte."
+    )
+    parser.add_argument(
+        "--input",
+        required=True,
+        help="Sprite sheet header, e.g. src/include/data/tiles.h.",
+    )
+    parser.add_argument(
+        "--output",
+        required=True,
+        help="Output .h (header) file with the packed sheet.",
+    )
+    parser.add_argument(
+        "--name",
+        required=True,
+        help="Sheet name used in the img_<name>_* identifiers.",
+    )
+    parser.add_argument(
+        "--rgb2index",
+        required=False,
+        default="src/vga_draw.c",
+        help="Source file holding the rgb2index palette LUT.",
+    )
+    parser.add_argument(
+        "--ram",
+        action="store_true",
+        help="Place the packed data in RAM instead of flash.",
+    )
+
+    generate(parser.parse_args())
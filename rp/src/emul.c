@@ -9,8 +9,9 @@
 #include "emul.h"
 
 #include "data/font6x8.h"
-#include "data/loserboy.h"
-#include "data/tiles.h"
+#include "data/loserboy_compiled.h"
+#include "data/loserboy_packed.h"
+#include "data/tiles_packed.h"
 #include "target_firmware.h"
 
 #define CUSTOM_FRAMEBUFFER_INDEX 0x5fc
@@ -21,9 +22,27 @@
 #define REMOTE_ATARI_ST_SCREEN_B_ADDRESS_512KB 0x78000
 #define REMOTE_ATARI_ST_SCREEN_ADDRESS_1MB 0xF8000
 
-struct SPRITE bg_tiles[img_tiles_num_spr];
-struct SPRITE char_frames[img_loserboy_num_spr];
+struct SPRITE bg_tiles[img_tiles_packed_num_spr];
+// Word-copy copies of the tiles for block-aligned positions
+static struct PLANAR_TILE bg_tiles_planar[img_tiles_packed_num_spr];
+struct SPRITE char_frames[img_loserboy_packed_num_spr];
+// Planar copies of the right-facing frames only, bank after bank
+static struct PLANAR_SPRITE
+    char_frames_planar[img_loserboy_packed_num_spr / 2];
+
+// Frames that get 16 pre-shifted copies (about 26 KB each), indexed in
+// char_frames_planar. Check the memory report in the debug output before
+// adding more. Mirrored frames never use them.
+static const struct PLANAR_PRESHIFT_CONFIG char_preshift_config = {
+    .frame_mask = 1ull << loserboy_stand_frame,
+    .budget_bytes = 28 * 1024,
+};
 struct CHARACTER characters[NUM_SPRITES];
+// The characters of a frame, drawn back to front
+static struct DISPLAY_LIST char_list;
+// Speech bubbles, rendered once with their border; not used without memory
+static struct VGA_SURFACE msg_surfaces[count_of(loserboy_messages)];
+static bool msg_surfaces_ready = false;
 
 static semaphore_t draw_sem;
 static semaphore_t start_demo_sem;
@@ -58,26 +77,66 @@ static inline int count_fps(void) {
 static void init_sprites(void) {
   for (int i = 0; i < count_of(bg_tiles); i++) {
     struct SPRITE *spr = &bg_tiles[i];
-    spr->width = img_tiles_width;
-    spr->height = img_tiles_height;
-    spr->stride = img_tiles_stride;
-    spr->data = (unsigned int
-                     *)&img_tiles_data[i * img_tiles_stride * img_tiles_height];
+    spr->width = img_tiles_packed_width;
+    spr->height = img_tiles_packed_height;
+    spr->stride = img_tiles_packed_stride;
+    spr->format = SPRITE_FORMAT_PACKED4;
+    spr->data = &img_tiles_packed_data[i * img_tiles_packed_stride *
+                                       img_tiles_packed_height];
+  }
+  if (sprite_tile_build(bg_tiles, bg_tiles_planar, count_of(bg_tiles)) < 0) {
+    DPRINTF("Planar tiles not available. Using packed tiles\n");
   }
 
-  for (int i = 0; i < count_of(char_frames); i++) {
-    struct SPRITE *spr = &char_frames[i];
-    spr->width = img_loserboy_width;
-    spr->height = img_loserboy_height;
-    spr->stride = img_loserboy_stride;
-    spr->data = (unsigned int *)&img_loserboy_data[i * img_loserboy_stride *
-                                                   img_loserboy_height];
+  // Each bank of the sheet holds the right-facing frames followed by their
+  // mirror images. Only the right-facing ones get a planar copy; the
+  // left-facing frames share it and are drawn flipped.
+  bool planar_ready = true;
+  for (int bank = 0; bank < count_of(char_frames);
+       bank += loserboy_bank_frames) {
+    struct SPRITE *right = &char_frames[bank];
+    for (int i = 0; i < loserboy_mirror_frame_start; i++) {
+      struct SPRITE *spr = &right[i];
+      spr->width = img_loserboy_packed_width;
+      spr->height = img_loserboy_packed_height;
+      spr->stride = img_loserboy_packed_stride;
+      spr->format = SPRITE_FORMAT_PACKED4;
+      spr->data =
+          &img_loserboy_packed_data[(bank + i) * img_loserboy_packed_stride *
+                                    img_loserboy_packed_height];
+    }
+    // The packed frames stay in flash; draw from the pre-masked planar copy
+    if (sprite_planar_build(right, &char_frames_planar[bank / 2],
+                            loserboy_mirror_frame_start) < 0) {
+      DPRINTF("Planar sprites not available. Using packed frames\n");
+      planar_ready = false;
+    }
+    for (int i = 0; i < loserboy_mirror_frame_start; i++) {
+      struct SPRITE *spr = &right[loserboy_mirror_frame_start + i];
+      *spr = right[i];
+      spr->flip_x = true;
+    }
+  }
+  if (planar_ready) {
+    sprite_preshift_build(char_frames_planar, count_of(char_frames_planar),
+                          &char_preshift_config);
+    sprite_preshift_report(char_frames_planar, count_of(char_frames_planar));
+  }
+
+  // Compiled frames bake the framebuffer line length in their code. The
+  // planar copies come first, so they only draw when those could not be
+  // built (the compositor then hands the frames to draw_sprite too).
+  if (vga_screen.width == img_loserboy_compiled_screen_width) {
+    for (int i = 0; i < img_loserboy_compiled_num; i++) {
+      char_frames[img_loserboy_compiled[i].frame].compiled =
+          img_loserboy_compiled[i].phases;
+    }
   }
 
   for (int i = 0; i < NUM_SPRITES; i++) {
     struct CHARACTER *ch = &characters[i];
-    ch->x = rand() % (vga_screen.width - img_loserboy_width);
-    ch->y = rand() % (vga_screen.height - img_loserboy_height);
+    ch->x = rand() % (vga_screen.width - img_loserboy_packed_width);
+    ch->y = rand() % (vga_screen.height - img_loserboy_packed_height);
     ch->dx = (1 + rand() % 3) * ((rand() & 1) ? -1 : 1);
     ch->dy = (1 + rand() % 2) * ((rand() & 1) ? -1 : 1);
     ch->frame = i + i * loserboy_walk_frame_delay;
@@ -87,6 +146,24 @@ static void init_sprites(void) {
   }
 }
 
+// Render each message with its border into a surface keyed on index 0
+static void init_messages(void) {
+  for (int i = 0; i < (int)count_of(loserboy_messages); i++) {
+    const int width = (int)strlen(loserboy_messages[i]) * font->w + 2;
+    if (surface_init(&msg_surfaces[i], width, font->h + 2, 0) != 0) {
+      while (i-- > 0) surface_free(&msg_surfaces[i]);
+      return;
+    }
+    surface_begin(&msg_surfaces[i]);
+    font_align(FONT_ALIGN_LEFT);
+    font_set_border(true, 8);
+    font_move(1, 1);
+    font_print(loserboy_messages[i]);
+    surface_end();
+  }
+  msg_surfaces_ready = true;
+}
+
 static void __not_in_flash_func(move_character)(struct CHARACTER *ch) {
   if (ch->message_frame-- < 0) {
     ch->message_index = -1;
@@ -120,6 +197,37 @@ static void __not_in_flash_func(move_character)(struct CHARACTER *ch) {
   }
 }
 
+static const struct TILEMAP_ANIM bg_anims[] = {
+    {bg_torch_frames, count_of(bg_torch_frames), BG_TORCH_FRAME_TICKS},
+};
+static const struct TILEMAP bg_tilemap = {
+    .width = BG_MAP_COLUMNS,
+    .height = BG_MAP_ROWS,
+    .cells = bg_map,
+    .tiles = bg_tiles,
+    .num_tiles = count_of(bg_tiles),
+    .anims = bg_anims,
+    .num_anims = count_of(bg_anims),
+};
+static struct TILEMAP_VIEW bg_view;
+
+// Redraw the still background (camera at the origin, first animation
+// frame), all of it or only inside `rect`. Used when there is no memory
+// for the tilemap view; flip Y needs the view and is ignored here.
+static void __not_in_flash_func(draw_background)(const struct VGA_RECT *rect) {
+  for (int ty = 0; ty < BG_MAP_ROWS; ty++) {
+    for (int tx = 0; tx < BG_MAP_COLUMNS; tx++) {
+      uint16_t cell = tilemap_cell(&bg_tilemap, tx, ty, 0);
+      struct SPRITE tile = bg_tiles[cell & TILEMAP_CELL_INDEX];
+      tile.flip_x = (cell & TILEMAP_CELL_FLIP_X) != 0;
+      if (rect)
+        draw_tile_rect(&tile, tx * tile.width, ty * tile.height, rect);
+      else
+        draw_tile(&tile, tx * tile.width, ty * tile.height);
+    }
+  }
+}
+
 // Interrupt handler for DMA completion
 void __not_in_flash_func(emul_dma_irq_handler_lookup)(void) {
   // Which channels triggered IRQ1?
@@ -324,22 +432,42 @@ void __not_in_flash_func(emul_start)() {
   DPRINTF("Font color set to 15\n");
   init_sprites();
   DPRINTF("Sprites initialized\n");
+  init_messages();
+  if (!msg_surfaces_ready)
+    DPRINTF("Message surfaces not available. Printing the messages\n");
+#if VGA_ENABLE_BENCHMARKS
+  bench_sprite_formats(&char_frames[loserboy_stand_frame]);
+  bench_tile_formats(&bg_tiles[0]);
+  bench_blitter_ops();
+  bench_mesh();
+  bench_chunky_frames(&char_frames[loserboy_stand_frame]);
+  bench_effects(&bg_tiles[0]);
+  bench_sprite_affine(&char_frames[loserboy_stand_frame]);
+#endif
 
   // draw keyboard shortcuts
   font_align(FONT_ALIGN_LEFT);
   font_set_border(false, 8);
   font_set_color(15);
 
+  // The status bar is below the drawable screen: print it through a viewport
+  // over the bar alone, then go back to the default one
+  const struct VGA_RECT status_bar = {
+      0, (int16_t)(vga_screen.height - VGA_STATUS_BAR_OFFSET),
+      (int16_t)vga_screen.width, (int16_t)vga_screen.height};
+  draw_set_viewport(&status_bar, 0, status_bar.y0);
+
   vga_swap_framebuffers();
-  font_move(0, 192);
+  font_move(0, 0);
   font_printf(" Press any key to boot GEM. ");
   font_printf("ESC to return to Booster.");
 
   // We do it twice because it does not change in the framebuffer
   vga_swap_framebuffers();
-  font_move(0, 192);
+  font_move(0, 0);
   font_printf(" Press any key to boot GEM. ");
   font_printf("ESC to return to Booster.");
+  draw_reset_viewport();
 
   // 9. Start the main loop
   // The main loop is the core of the app. It is responsible for running the
@@ -347,38 +475,92 @@ void __not_in_flash_func(emul_start)() {
   // The main loop runs until the user decides to exit.
   // For testing purposes, this app only shows commands to manage the settings
   DPRINTF("Start the app loop here\n");
+  // The background scrolls through the tilemap view. Without memory for
+  // it, the background stands still: render it once and restore it by DMA
+  // every frame, or else restore the areas drawn over from the tiles.
+  const bool bg_scroll = tilemap_view_init(&bg_view, &bg_tilemap) == 0;
+  const bool bg_snapshot = !bg_scroll && background_init() == 0;
+  const bool bg_dirty = !bg_scroll && !bg_snapshot;
+  if (bg_snapshot) {
+    draw_background(NULL);
+    background_capture();
+  } else if (bg_dirty) {
+    DPRINTF("Background snapshot not available. Using dirty rectangles\n");
+  }
+  dirty_reset();
+#if VGA_COMPOSITOR
+  // Sprites and text go through the tile-binned compositor when it has
+  // memory; otherwise the compose_* calls draw directly
+  if (compose_init() != 0)
+    DPRINTF("Compositor not available. Drawing directly\n");
+#if VGA_ENABLE_BENCHMARKS
+  bench_compose_modes(&char_frames[loserboy_stand_frame]);
+#endif
+#if VGA_COMPOSE_SCANLINES
+  compose_set_mode(COMPOSE_SCANLINES);
+#endif
+#endif
+  dlist_init(&char_list);
+  unsigned int bg_frame = 0;
   while (1) {
     sem_acquire_blocking(&draw_sem);
     if (startBooster) break;
 
+    // The copy runs while the characters move
+    if (bg_snapshot) background_restore_start();
+
     unsigned int start_ms = to_ms_since_boot(get_absolute_time());
     for (int i = 0; i < sprite_count; i++) {
       move_character(&characters[i]);
     }
 
-    // draw background
-    for (int ty = 0; ty < 3; ty++) {
-      for (int tx = 0; tx < 5; tx++) {
-        struct SPRITE *tile = &bg_tiles[bg_map[ty * 5 + tx]];
-        draw_tile(tile, tx * tile->width, ty * tile->height);
+    // restore the background where this framebuffer was drawn over
+    if (bg_scroll) {
+      bg_frame++;
+      tilemap_view_update(&bg_view, (int)(bg_frame / BG_SCROLL_X_FRAMES),
+                          (int)(bg_frame / BG_SCROLL_Y_FRAMES));
+    } else if (bg_snapshot) {
+      background_restore_wait();
+    } else {
+      const struct DIRTY_LIST *restore = dirty_begin_frame();
+      if (restore->full) {
+        draw_background(NULL);
+      } else {
+        for (int i = 0; i < restore->count; i++)
+          draw_background(&restore->rects[i]);
       }
     }
-    // draw sprites
+    // draw sprites, over the view when scrolling
+    compose_begin(bg_scroll ? &bg_view : NULL);
     int msg_index = -1;
     int msg_x, msg_y;
+    dlist_begin(&char_list);
     for (int i = 0; i < sprite_count; i++) {
       struct CHARACTER *ch = &characters[i];
-      draw_sprite(ch->sprite, ch->x, ch->y, true);
+      dlist_add(&char_list, ch->sprite, ch->x, ch->y, (uint8_t)i);
+      if (bg_dirty)
+        dirty_add(ch->x, ch->y, ch->x + ch->sprite->width,
+                  ch->y + ch->sprite->height);
       if (ch->message_index >= 0) {
         msg_x = ch->x + ch->sprite->width / 2;
         msg_y = ch->y - 10;
         msg_index = ch->message_index;
       }
     }
-    if (msg_index >= 0) {
+    dlist_execute(&char_list);
+    if (msg_index >= 0 && msg_surfaces_ready) {
+      const struct VGA_SURFACE *bubble = &msg_surfaces[msg_index];
+      const int x = msg_x -
+                    (int)strlen(loserboy_messages[msg_index]) * font->w / 2 -
+                    1;
+      compose_sprite(&bubble->sprite, x, msg_y - 1);
+      if (bg_dirty)
+        dirty_add(x, msg_y - 1, x + bubble->width, msg_y - 1 + bubble->height);
+    } else if (msg_index >= 0) {
       font_align(FONT_ALIGN_CENTER);
       font_move(msg_x, msg_y);
-      font_print(loserboy_messages[msg_index]);
+      compose_print(loserboy_messages[msg_index]);
+      if (bg_dirty) dirty_add_rect(&font_last_rect);
     }
 
     // draw fps counter
@@ -386,10 +568,13 @@ void __not_in_flash_func(emul_start)() {
     font_set_border(true, 8);
     int fps = count_fps();
     font_move(0, 0);
-    font_printf("%04d fps", fps);
+    compose_printf("%04d fps", fps);
+    if (bg_dirty) dirty_add_rect(&font_last_rect);
 
     font_move(0, 8);
-    font_printf("Sprites: %d", sprite_count);
+    compose_printf("Sprites: %d", sprite_count);
+    if (bg_dirty) dirty_add_rect(&font_last_rect);
+    compose_end();
 
     // font_move(0, 16);
     // font_printf("Millisecs: %d", end_ms - start_ms);
@@ -0,0 +1,6189 @@
+/* File generated automatically by sprite_compiler.py from loserboy.h */
+#ifndef LOSERBOY_COMPILED_H
+#define LOSERBOY_COMPILED_H
+
+#include "vga/draw.h"
+
+#define img_loserboy_compiled_screen_width 320
+#define img_loserboy_compiled_num 2
+
+static void img_loserboy_f10_s0(uint32_t *dst) {
+  dst[44] &= 0x01FF01FFu;
+  dst[45] &= 0x01FF01FFu;
+  dst[82] &= 0xFFF8FFF8u;
+  dst[83] &= 0xFFF8FFF8u;
+  dst[84] = (dst[84] & 0x007F007Fu) | 0xFE000000u;
+  dst[85] = (dst[85] & 0x007F007Fu) | 0xFE000000u;
+  dst[122] = (dst[122] & 0xFFE0FFE0u) | 0x00030000u;
+  dst[123] = (dst[123] & 0xFFE0FFE0u) | 0x00030000u;
+  dst[124] = (dst[124] & 0x003F003Fu) | 0xFF800000u;
+  dst[125] = (dst[125] & 0x003F003Fu) | 0xFF800000u;
+  dst[162] = (dst[162] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[163] = (dst[163] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[164] = (dst[164] & 0x001F001Fu) | 0xFFC00000u;
+  dst[165] = (dst[165] & 0x001F001Fu) | 0xFFC00000u;
+  dst[202] = (dst[202] & 0xFF80FF80u) | 0x003F0000u;
+  dst[203] = (dst[203] & 0xFF80FF80u) | 0x003F0000u;
+  dst[204] = (dst[204] & 0x000F000Fu) | 0xFFE00000u;
+  dst[205] = (dst[205] & 0x000F000Fu) | 0xFFE00000u;
+  dst[242] = (dst[242] & 0xFF80FF80u) | 0x003F0000u;
+  dst[243] = (dst[243] & 0xFF80FF80u) | 0x003F0000u;
+  dst[244] = (dst[244] & 0x000F000Fu) | 0xFFE00000u;
+  dst[245] = (dst[245] & 0x000F000Fu) | 0xFFE00000u;
+  dst[282] = (dst[282] & 0xFF80FF80u) | 0x00310000u;
+  dst[283] = (dst[283] & 0xFF80FF80u) | 0x00310000u;
+  dst[284] = (dst[284] & 0x000F000Fu) | 0xC7E00000u;
+  dst[285] = (dst[285] & 0x000F000Fu) | 0xC7E00000u;
+  dst[322] = (dst[322] & 0xFF80FF80u) | 0x002D0000u;
+  dst[323] = (dst[323] & 0xFF80FF80u) | 0x002D000Cu;
+  dst[324] = (dst[324] & 0x000F000Fu) | 0x33A01000u;
+  dst[325] = (dst[325] & 0x000F000Fu) | 0x33A03000u;
+  dst[362] = (dst[362] & 0xFF80FF80u) | 0x001C0000u;
+  dst[363] = (dst[363] & 0xFF80FF80u) | 0x001C001Cu;
+  dst[364] = (dst[364] & 0x001F001Fu) | 0xF1403400u;
+  dst[365] = (dst[365] & 0x001F001Fu) | 0x7540F400u;
+  dst[402] = (dst[402] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[403] = (dst[403] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[404] = (dst[404] & 0x001F001Fu) | 0xF2403400u;
+  dst[405] = (dst[405] & 0x001F001Fu) | 0xF640F600u;
+  dst[442] = (dst[442] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[443] = (dst[443] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[444] = (dst[444] & 0x001F001Fu) | 0xFB603580u;
+  dst[445] = (dst[445] & 0x001F001Fu) | 0xFFC0F7A0u;
+  dst[482] = (dst[482] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[483] = (dst[483] & 0xFFC0FFC0u) | 0x000F000Fu;
+  dst[484] = (dst[484] & 0x001F001Fu) | 0xFFE01CC0u;
+  dst[485] = (dst[485] & 0x001F001Fu) | 0xFFC0FFE0u;
+  dst[522] = (dst[522] & 0xFF80FF80u) | 0x00030000u;
+  dst[523] = (dst[523] & 0xFF80FF80u) | 0x00030003u;
+  dst[524] = (dst[524] & 0x001F001Fu) | 0xFFE00000u;
+  dst[525] = (dst[525] & 0x001F001Fu) | 0xE7C0FFE0u;
+  dst[562] = (dst[562] & 0xFF00FF00u) | 0x00010008u;
+  dst[563] = (dst[563] & 0xFF00FF00u) | 0x006C0001u;
+  dst[564] = (dst[564] & 0x003F003Fu) | 0xFFC00000u;
+  dst[565] = (dst[565] & 0x003F003Fu) | 0xFB80FFC0u;
+  dst[602] = (dst[602] & 0xFE00FE00u) | 0x00000026u;
+  dst[603] = (dst[603] & 0xFE00FE00u) | 0x00F60000u;
+  dst[604] = (dst[604] & 0x007F007Fu) | 0xFF800000u;
+  dst[605] = (dst[605] & 0x007F007Fu) | 0x3E00FF80u;
+  dst[642] = (dst[642] & 0xFC00FC00u) | 0x00000064u;
+  dst[643] = (dst[643] & 0xFC00FC00u) | 0x00F70000u;
+  dst[644] = (dst[644] & 0x01FF01FFu) | 0x60000000u;
+  dst[645] = (dst[645] & 0x01FF01FFu) | 0x00006000u;
+  dst[682] = (dst[682] & 0xF800F800u) | 0x00000130u;
+  dst[683] = (dst[683] & 0xF800F800u) | 0x01300000u;
+  dst[684] = (dst[684] & 0x01FF01FFu) | 0x70000400u;
+  dst[685] = (dst[685] & 0x01FF01FFu) | 0x04007000u;
+  dst[722] = (dst[722] & 0xF000F000u) | 0x01800640u;
+  dst[723] = (dst[723] & 0xF000F000u) | 0x07D60000u;
+  dst[724] = (dst[724] & 0x01E301E3u) | 0x00008400u;
+  dst[725] = (dst[725] & 0x01E301E3u) | 0x84008000u;
+  dst[762] = (dst[762] & 0xF000F000u) | 0x03C00420u;
+  dst[763] = (dst[763] & 0xF000F000u) | 0x07E60000u;
+  dst[764] = (dst[764] & 0x00010001u) | 0x001CF400u;
+  dst[765] = (dst[765] & 0x00010001u) | 0xF41CF01Cu;
+  dst[802] = (dst[802] & 0xF000F000u) | 0x01E00200u;
+  dst[803] = (dst[803] & 0xF000F000u) | 0x03EE0000u;
+  dst[804] = 0x00BEF600u;
+  dst[805] = 0xF6BEF0BEu;
+  dst[842] = (dst[842] & 0xE000E000u) | 0x0C4000A1u;
+  dst[843] = (dst[843] & 0xE000E000u) | 0x0CED0C01u;
+  dst[844] = 0x00BEF600u;
+  dst[845] = 0xF6BEF0BEu;
+  dst[882] = (dst[882] & 0xE000E000u) | 0x0F000061u;
+  dst[883] = (dst[883] & 0xE000E000u) | 0x0F6D0F01u;
+  dst[884] = 0x00DEF600u;
+  dst[885] = 0xF6DEF0DEu;
+  dst[922] = (dst[922] & 0xC080C080u) | 0x1E000001u;
+  dst[923] = (dst[923] & 0xC080C080u) | 0x1E1D1E01u;
+  dst[924] = 0x001EF600u;
+  dst[925] = 0xF61EF01Eu;
+  dst[962] = (dst[962] & 0xC1C0C1C0u) | 0x1C000001u;
+  dst[963] = (dst[963] & 0xC1C0C1C0u) | 0x1C1D1C01u;
+  dst[964] = (dst[964] & 0x00610061u) | 0x0000FA00u;
+  dst[965] = (dst[965] & 0x00610061u) | 0xFB00F800u;
+  dst[1002] = (dst[1002] & 0x80808080u) | 0x3E000003u;
+  dst[1003] = (dst[1003] & 0x80808080u) | 0x3E3B3E03u;
+  dst[1004] = (dst[1004] & 0x007F007Fu) | 0x0000FA00u;
+  dst[1005] = (dst[1005] & 0x007F007Fu) | 0xFB00F800u;
+  dst[1042] = (dst[1042] & 0x80008000u) | 0x3E000003u;
+  dst[1043] = (dst[1043] & 0x80008000u) | 0x3E7B3E03u;
+  dst[1044] = (dst[1044] & 0x007F007Fu) | 0x0000FA00u;
+  dst[1045] = (dst[1045] & 0x007F007Fu) | 0xFB00F800u;
+  dst[1082] = (dst[1082] & 0x80008000u) | 0x3F000007u;
+  dst[1083] = (dst[1083] & 0x80008000u) | 0x3F773F07u;
+  dst[1084] = (dst[1084] & 0x003F003Fu) | 0x0000F800u;
+  dst[1085] = (dst[1085] & 0x003F003Fu) | 0xFB80F800u;
+  dst[1122] = (dst[1122] & 0xC000C000u) | 0x1E00000Fu;
+  dst[1123] = (dst[1123] & 0xC000C000u) | 0x1E0F1E0Fu;
+  dst[1124] = (dst[1124] & 0x003F003Fu) | 0x0000FC00u;
+  dst[1125] = (dst[1125] & 0x003F003Fu) | 0xFC00FC00u;
+  dst[1162] = (dst[1162] & 0xE000E000u) | 0x01E00007u;
+  dst[1163] = (dst[1163] & 0xE000E000u) | 0x01E70007u;
+  dst[1164] = (dst[1164] & 0x003F003Fu) | 0x0380F000u;
+  dst[1165] = (dst[1165] & 0x003F003Fu) | 0xF380F000u;
+  dst[1202] = (dst[1202] & 0xF800F800u) | 0x03980060u;
+  dst[1203] = (dst[1203] & 0xF800F800u) | 0x03F80060u;
+  dst[1204] = (dst[1204] & 0x001F001Fu) | 0x0EC00100u;
+  dst[1205] = (dst[1205] & 0x001F001Fu) | 0x0FC00100u;
+  dst[1242] = (dst[1242] & 0xF003F003u) | 0x070800F0u;
+  dst[1243] = (dst[1243] & 0xF003F003u) | 0x07F800F0u;
+  dst[1244] = (dst[1244] & 0xC01FC01Fu) | 0x1C400380u;
+  dst[1245] = (dst[1245] & 0xC01FC01Fu) | 0x1FC00380u;
+  dst[1282] = (dst[1282] & 0xE003E003u) | 0x0F0800F0u;
+  dst[1283] = (dst[1283] & 0xE003E003u) | 0x0FF800F0u;
+  dst[1284] = (dst[1284] & 0xC00FC00Fu) | 0x1C600380u;
+  dst[1285] = (dst[1285] & 0xC00FC00Fu) | 0x1FE00380u;
+  dst[1322] = (dst[1322] & 0xC003C003u) | 0x1F0800F0u;
+  dst[1323] = (dst[1323] & 0xC003C003u) | 0x1FF800F0u;
+  dst[1324] = (dst[1324] & 0x80078007u) | 0x3CE00300u;
+  dst[1325] = (dst[1325] & 0x80078007u) | 0x3FE00300u;
+  dst[1362] = (dst[1362] & 0x00070007u) | 0x3F900060u;
+  dst[1363] = (dst[1363] & 0x00070007u) | 0x3FF00060u;
+  dst[1364] = (dst[1364] & 0x80018001u) | 0x3FF80000u;
+  dst[1365] = (dst[1365] & 0x80018001u) | 0x3FF80000u;
+  dst[1400] &= 0xFFFCFFFCu;
+  dst[1401] &= 0xFFFCFFFCu;
+  dst[1402] = (dst[1402] & 0x00070007u) | 0xFFF00000u;
+  dst[1403] = (dst[1403] & 0x00070007u) | 0xFFF00000u;
+  dst[1404] = (dst[1404] & 0x80008000u) | 0x3F0E00F0u;
+  dst[1405] = (dst[1405] & 0x80008000u) | 0x3FFE00F0u;
+  dst[1406] &= 0x7FFF7FFFu;
+  dst[1407] &= 0x7FFF7FFFu;
+  dst[1440] = (dst[1440] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1441] = (dst[1441] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1442] = (dst[1442] & 0x00070007u) | 0xC3F03C00u;
+  dst[1443] = (dst[1443] & 0x00070007u) | 0xFFF03C00u;
+  dst[1444] = (dst[1444] & 0x80008000u) | 0x3F83007Cu;
+  dst[1445] = (dst[1445] & 0x80008000u) | 0x3FFF007Cu;
+  dst[1446] = (dst[1446] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1447] = (dst[1447] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1480] = (dst[1480] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1481] = (dst[1481] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1482] = (dst[1482] & 0x000F000Fu) | 0x81E07E00u;
+  dst[1483] = (dst[1483] & 0x000F000Fu) | 0xFFE07E00u;
+  dst[1484] = (dst[1484] & 0x80008000u) | 0x3FFF0000u;
+  dst[1485] = (dst[1485] & 0x80008000u) | 0x3FFF0000u;
+  dst[1486] = (dst[1486] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1487] = (dst[1487] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1520] = (dst[1520] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1521] = (dst[1521] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1522] = (dst[1522] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1523] = (dst[1523] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1524] = (dst[1524] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1525] = (dst[1525] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1526] = (dst[1526] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1527] = (dst[1527] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1560] &= 0xFFC0FFC0u;
+  dst[1561] &= 0xFFC0FFC0u;
+  dst[1562] &= 0x000F000Fu;
+  dst[1563] &= 0x000F000Fu;
+  dst[1564] &= 0xE000E000u;
+  dst[1565] &= 0xE000E000u;
+  dst[1566] &= 0x3FFF3FFFu;
+  dst[1567] &= 0x3FFF3FFFu;
+}
+
+static void img_loserboy_f10_s1(uint32_t *dst) {
+  dst[44] &= 0x80FF80FFu;
+  dst[45] &= 0x80FF80FFu;
+  dst[82] &= 0xFFFCFFFCu;
+  dst[83] &= 0xFFFCFFFCu;
+  dst[84] = (dst[84] & 0x003F003Fu) | 0x7F000000u;
+  dst[85] = (dst[85] & 0x003F003Fu) | 0x7F000000u;
+  dst[122] = (dst[122] & 0xFFF0FFF0u) | 0x00010000u;
+  dst[123] = (dst[123] & 0xFFF0FFF0u) | 0x00010000u;
+  dst[124] = (dst[124] & 0x001F001Fu) | 0xFFC00000u;
+  dst[125] = (dst[125] & 0x001F001Fu) | 0xFFC00000u;
+  dst[162] = (dst[162] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[163] = (dst[163] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[164] = (dst[164] & 0x000F000Fu) | 0xFFE00000u;
+  dst[165] = (dst[165] & 0x000F000Fu) | 0xFFE00000u;
+  dst[202] = (dst[202] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[203] = (dst[203] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[204] = (dst[204] & 0x00070007u) | 0xFFF00000u;
+  dst[205] = (dst[205] & 0x00070007u) | 0xFFF00000u;
+  dst[242] = (dst[242] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[243] = (dst[243] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[244] = (dst[244] & 0x00070007u) | 0xFFF00000u;
+  dst[245] = (dst[245] & 0x00070007u) | 0xFFF00000u;
+  dst[282] = (dst[282] & 0xFFC0FFC0u) | 0x00180000u;
+  dst[283] = (dst[283] & 0xFFC0FFC0u) | 0x00180000u;
+  dst[284] = (dst[284] & 0x00070007u) | 0xE3F00000u;
+  dst[285] = (dst[285] & 0x00070007u) | 0xE3F00000u;
+  dst[322] = (dst[322] & 0xFFC0FFC0u) | 0x00160000u;
+  dst[323] = (dst[323] & 0xFFC0FFC0u) | 0x00160006u;
+  dst[324] = (dst[324] & 0x00070007u) | 0x99D00800u;
+  dst[325] = (dst[325] & 0x00070007u) | 0x99D01800u;
+  dst[362] = (dst[362] & 0xFFC0FFC0u) | 0x000E0000u;
+  dst[363] = (dst[363] & 0xFFC0FFC0u) | 0x000E000Eu;
+  dst[364] = (dst[364] & 0x000F000Fu) | 0x78A01A00u;
+  dst[365] = (dst[365] & 0x000F000Fu) | 0x3AA07A00u;
+  dst[402] = (dst[402] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[403] = (dst[403] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[404] = (dst[404] & 0x000F000Fu) | 0xF9201A00u;
+  dst[405] = (dst[405] & 0x000F000Fu) | 0xFB20FB00u;
+  dst[442] = (dst[442] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[443] = (dst[443] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[444] = (dst[444] & 0x000F000Fu) | 0xFDB01AC0u;
+  dst[445] = (dst[445] & 0x000F000Fu) | 0xFFE0FBD0u;
+  dst[482] = (dst[482] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[483] = (dst[483] & 0xFFE0FFE0u) | 0x00070007u;
+  dst[484] = (dst[484] & 0x000F000Fu) | 0xFFF00E60u;
+  dst[485] = (dst[485] & 0x000F000Fu) | 0xFFE0FFF0u;
+  dst[522] = (dst[522] & 0xFFC0FFC0u) | 0x00010000u;
+  dst[523] = (dst[523] & 0xFFC0FFC0u) | 0x00010001u;
+  dst[524] = (dst[524] & 0x000F000Fu) | 0xFFF00000u;
+  dst[525] = (dst[525] & 0x000F000Fu) | 0xF3E0FFF0u;
+  dst[562] = (dst[562] & 0xFF80FF80u) | 0x00000004u;
+  dst[563] = (dst[563] & 0xFF80FF80u) | 0x00360000u;
+  dst[564] = (dst[564] & 0x001F001Fu) | 0xFFE00000u;
+  dst[565] = (dst[565] & 0x001F001Fu) | 0x7DC0FFE0u;
+  dst[602] = (dst[602] & 0xFF00FF00u) | 0x00000013u;
+  dst[603] = (dst[603] & 0xFF00FF00u) | 0x007B0000u;
+  dst[604] = (dst[604] & 0x003F003Fu) | 0x7FC00000u;
+  dst[605] = (dst[605] & 0x003F003Fu) | 0x1F007FC0u;
+  dst[642] = (dst[642] & 0xFE00FE00u) | 0x00000032u;
+  dst[643] = (dst[643] & 0xFE00FE00u) | 0x007B0000u;
+  dst[644] = (dst[644] & 0x00FF00FFu) | 0x30000000u;
+  dst[645] = (dst[645] & 0x00FF00FFu) | 0x80003000u;
+  dst[682] = (dst[682] & 0xFC00FC00u) | 0x00000098u;
+  dst[683] = (dst[683] & 0xFC00FC00u) | 0x00980000u;
+  dst[684] = (dst[684] & 0x00FF00FFu) | 0x38000200u;
+  dst[685] = (dst[685] & 0x00FF00FFu) | 0x02003800u;
+  dst[722] = (dst[722] & 0xF800F800u) | 0x00C00320u;
+  dst[723] = (dst[723] & 0xF800F800u) | 0x03EB0000u;
+  dst[724] = (dst[724] & 0x00F100F1u) | 0x00004200u;
+  dst[725] = (dst[725] & 0x00F100F1u) | 0x42004000u;
+  dst[762] = (dst[762] & 0xF800F800u) | 0x01E00210u;
+  dst[763] = (dst[763] & 0xF800F800u) | 0x03F30000u;
+  dst[764] = 0x000E7A00u;
+  dst[765] = 0x7A0E780Eu;
+  dst[802] = (dst[802] & 0xF800F800u) | 0x00F00100u;
+  dst[803] = (dst[803] & 0xF800F800u) | 0x01F70000u;
+  dst[804] = 0x005F7B00u;
+  dst[805] = 0x7B5F785Fu;
+  dst[806] &= 0x7FFF7FFFu;
+  dst[807] &= 0x7FFF7FFFu;
+  dst[842] = (dst[842] & 0xF000F000u) | 0x06200050u;
+  dst[843] = (dst[843] & 0xF000F000u) | 0x06760600u;
+  dst[844] = 0x005FFB00u;
+  dst[845] = 0xFB5FF85Fu;
+  dst[846] &= 0x7FFF7FFFu;
+  dst[847] &= 0x7FFF7FFFu;
+  dst[882] = (dst[882] & 0xF000F000u) | 0x07800030u;
+  dst[883] = (dst[883] & 0xF000F000u) | 0x07B60780u;
+  dst[884] = 0x006FFB00u;
+  dst[885] = 0xFB6FF86Fu;
+  dst[886] &= 0x7FFF7FFFu;
+  dst[887] &= 0x7FFF7FFFu;
+  dst[922] = (dst[922] & 0xE040E040u) | 0x0F000000u;
+  dst[923] = (dst[923] & 0xE040E040u) | 0x0F0E0F00u;
+  dst[924] = 0x000FFB00u;
+  dst[925] = 0xFB0FF80Fu;
+  dst[926] &= 0x7FFF7FFFu;
+  dst[927] &= 0x7FFF7FFFu;
+  dst[962] = (dst[962] & 0xE0E0E0E0u) | 0x0E000000u;
+  dst[963] = (dst[963] & 0xE0E0E0E0u) | 0x0E0E0E00u;
+  dst[964] = (dst[964] & 0x00300030u) | 0x0000FD00u;
+  dst[965] = (dst[965] & 0x00300030u) | 0xFD80FC00u;
+  dst[1002] = (dst[1002] & 0xC040C040u) | 0x1F000001u;
+  dst[1003] = (dst[1003] & 0xC040C040u) | 0x1F1D1F01u;
+  dst[1004] = (dst[1004] & 0x003F003Fu) | 0x0000FD00u;
+  dst[1005] = (dst[1005] & 0x003F003Fu) | 0xFD80FC00u;
+  dst[1042] = (dst[1042] & 0xC000C000u) | 0x1F000001u;
+  dst[1043] = (dst[1043] & 0xC000C000u) | 0x1F3D1F01u;
+  dst[1044] = (dst[1044] & 0x003F003Fu) | 0x0000FD00u;
+  dst[1045] = (dst[1045] & 0x003F003Fu) | 0xFD80FC00u;
+  dst[1082] = (dst[1082] & 0xC000C000u) | 0x1F800003u;
+  dst[1083] = (dst[1083] & 0xC000C000u) | 0x1FBB1F83u;
+  dst[1084] = (dst[1084] & 0x001F001Fu) | 0x0000FC00u;
+  dst[1085] = (dst[1085] & 0x001F001Fu) | 0xFDC0FC00u;
+  dst[1122] = (dst[1122] & 0xE000E000u) | 0x0F000007u;
+  dst[1123] = (dst[1123] & 0xE000E000u) | 0x0F070F07u;
+  dst[1124] = (dst[1124] & 0x001F001Fu) | 0x0000FE00u;
+  dst[1125] = (dst[1125] & 0x001F001Fu) | 0xFE00FE00u;
+  dst[1162] = (dst[1162] & 0xF000F000u) | 0x00F00003u;
+  dst[1163] = (dst[1163] & 0xF000F000u) | 0x00F30003u;
+  dst[1164] = (dst[1164] & 0x001F001Fu) | 0x01C0F800u;
+  dst[1165] = (dst[1165] & 0x001F001Fu) | 0xF9C0F800u;
+  dst[1202] = (dst[1202] & 0xFC00FC00u) | 0x01CC0030u;
+  dst[1203] = (dst[1203] & 0xFC00FC00u) | 0x01FC0030u;
+  dst[1204] = (dst[1204] & 0x000F000Fu) | 0x07600080u;
+  dst[1205] = (dst[1205] & 0x000F000Fu) | 0x07E00080u;
+  dst[1242] = (dst[1242] & 0xF801F801u) | 0x03840078u;
+  dst[1243] = (dst[1243] & 0xF801F801u) | 0x03FC0078u;
+  dst[1244] = (dst[1244] & 0xE00FE00Fu) | 0x0E2001C0u;
+  dst[1245] = (dst[1245] & 0xE00FE00Fu) | 0x0FE001C0u;
+  dst[1282] = (dst[1282] & 0xF001F001u) | 0x07840078u;
+  dst[1283] = (dst[1283] & 0xF001F001u) | 0x07FC0078u;
+  dst[1284] = (dst[1284] & 0xE007E007u) | 0x0E3001C0u;
+  dst[1285] = (dst[1285] & 0xE007E007u) | 0x0FF001C0u;
+  dst[1322] = (dst[1322] & 0xE001E001u) | 0x0F840078u;
+  dst[1323] = (dst[1323] & 0xE001E001u) | 0x0FFC0078u;
+  dst[1324] = (dst[1324] & 0xC003C003u) | 0x1E700180u;
+  dst[1325] = (dst[1325] & 0xC003C003u) | 0x1FF00180u;
+  dst[1362] = (dst[1362] & 0x80038003u) | 0x1FC80030u;
+  dst[1363] = (dst[1363] & 0x80038003u) | 0x1FF80030u;
+  dst[1364] = (dst[1364] & 0xC000C000u) | 0x1FFC0000u;
+  dst[1365] = (dst[1365] & 0xC000C000u) | 0x1FFC0000u;
+  dst[1400] &= 0xFFFEFFFEu;
+  dst[1401] &= 0xFFFEFFFEu;
+  dst[1402] = (dst[1402] & 0x00030003u) | 0x7FF80000u;
+  dst[1403] = (dst[1403] & 0x00030003u) | 0x7FF80000u;
+  dst[1404] = (dst[1404] & 0xC000C000u) | 0x1F870078u;
+  dst[1405] = (dst[1405] & 0xC000C000u) | 0x1FFF0078u;
+  dst[1406] &= 0x3FFF3FFFu;
+  dst[1407] &= 0x3FFF3FFFu;
+  dst[1440] = (dst[1440] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1441] = (dst[1441] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1442] = (dst[1442] & 0x00030003u) | 0xE1F81E00u;
+  dst[1443] = (dst[1443] & 0x00030003u) | 0xFFF81E00u;
+  dst[1444] = (dst[1444] & 0xC000C000u) | 0x1FC1003Eu;
+  dst[1445] = (dst[1445] & 0xC000C000u) | 0x1FFF003Eu;
+  dst[1446] = (dst[1446] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1447] = (dst[1447] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1480] = (dst[1480] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1481] = (dst[1481] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1482] = (dst[1482] & 0x00070007u) | 0xC0F03F00u;
+  dst[1483] = (dst[1483] & 0x00070007u) | 0xFFF03F00u;
+  dst[1484] = (dst[1484] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1485] = (dst[1485] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1486] = (dst[1486] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1487] = (dst[1487] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1520] = (dst[1520] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1521] = (dst[1521] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1522] = (dst[1522] & 0x00070007u) | 0xFFF00000u;
+  dst[1523] = (dst[1523] & 0x00070007u) | 0xFFF00000u;
+  dst[1524] = (dst[1524] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1525] = (dst[1525] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1526] = (dst[1526] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1527] = (dst[1527] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1560] &= 0xFFE0FFE0u;
+  dst[1561] &= 0xFFE0FFE0u;
+  dst[1562] &= 0x00070007u;
+  dst[1563] &= 0x00070007u;
+  dst[1564] &= 0xF000F000u;
+  dst[1565] &= 0xF000F000u;
+  dst[1566] &= 0x1FFF1FFFu;
+  dst[1567] &= 0x1FFF1FFFu;
+}
+
+static void img_loserboy_f10_s2(uint32_t *dst) {
+  dst[44] &= 0xC07FC07Fu;
+  dst[45] &= 0xC07FC07Fu;
+  dst[82] &= 0xFFFEFFFEu;
+  dst[83] &= 0xFFFEFFFEu;
+  dst[84] = (dst[84] & 0x001F001Fu) | 0x3F800000u;
+  dst[85] = (dst[85] & 0x001F001Fu) | 0x3F800000u;
+  dst[122] &= 0xFFF8FFF8u;
+  dst[123] &= 0xFFF8FFF8u;
+  dst[124] = (dst[124] & 0x000F000Fu) | 0xFFE00000u;
+  dst[125] = (dst[125] & 0x000F000Fu) | 0xFFE00000u;
+  dst[162] = (dst[162] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[163] = (dst[163] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[164] = (dst[164] & 0x00070007u) | 0xFFF00000u;
+  dst[165] = (dst[165] & 0x00070007u) | 0xFFF00000u;
+  dst[202] = (dst[202] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[203] = (dst[203] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[204] = (dst[204] & 0x00030003u) | 0xFFF80000u;
+  dst[205] = (dst[205] & 0x00030003u) | 0xFFF80000u;
+  dst[242] = (dst[242] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[243] = (dst[243] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[244] = (dst[244] & 0x00030003u) | 0xFFF80000u;
+  dst[245] = (dst[245] & 0x00030003u) | 0xFFF80000u;
+  dst[282] = (dst[282] & 0xFFE0FFE0u) | 0x000C0000u;
+  dst[283] = (dst[283] & 0xFFE0FFE0u) | 0x000C0000u;
+  dst[284] = (dst[284] & 0x00030003u) | 0x71F80000u;
+  dst[285] = (dst[285] & 0x00030003u) | 0x71F80000u;
+  dst[322] = (dst[322] & 0xFFE0FFE0u) | 0x000B0000u;
+  dst[323] = (dst[323] & 0xFFE0FFE0u) | 0x000B0003u;
+  dst[324] = (dst[324] & 0x00030003u) | 0x4CE80400u;
+  dst[325] = (dst[325] & 0x00030003u) | 0x4CE80C00u;
+  dst[362] = (dst[362] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[363] = (dst[363] & 0xFFE0FFE0u) | 0x00070007u;
+  dst[364] = (dst[364] & 0x00070007u) | 0x3C500D00u;
+  dst[365] = (dst[365] & 0x00070007u) | 0x1D503D00u;
+  dst[402] = (dst[402] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[403] = (dst[403] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[404] = (dst[404] & 0x00070007u) | 0xFC900D00u;
+  dst[405] = (dst[405] & 0x00070007u) | 0xFD90FD80u;
+  dst[442] = (dst[442] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[443] = (dst[443] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[444] = (dst[444] & 0x00070007u) | 0xFED80D60u;
+  dst[445] = (dst[445] & 0x00070007u) | 0xFFF0FDE8u;
+  dst[482] = (dst[482] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[483] = (dst[483] & 0xFFF0FFF0u) | 0x00030003u;
+  dst[484] = (dst[484] & 0x00070007u) | 0xFFF80730u;
+  dst[485] = (dst[485] & 0x00070007u) | 0xFFF0FFF8u;
+  dst[522] &= 0xFFE0FFE0u;
+  dst[523] &= 0xFFE0FFE0u;
+  dst[524] = (dst[524] & 0x00070007u) | 0xFFF80000u;
+  dst[525] = (dst[525] & 0x00070007u) | 0xF9F0FFF8u;
+  dst[562] = (dst[562] & 0xFFC0FFC0u) | 0x00000002u;
+  dst[563] = (dst[563] & 0xFFC0FFC0u) | 0x001B0000u;
+  dst[564] = (dst[564] & 0x000F000Fu) | 0x7FF00000u;
+  dst[565] = (dst[565] & 0x000F000Fu) | 0x3EE07FF0u;
+  dst[602] = (dst[602] & 0xFF80FF80u) | 0x00000009u;
+  dst[603] = (dst[603] & 0xFF80FF80u) | 0x003D0000u;
+  dst[604] = (dst[604] & 0x001F001Fu) | 0x3FE08000u;
+  dst[605] = (dst[605] & 0x001F001Fu) | 0x8F803FE0u;
+  dst[642] = (dst[642] & 0xFF00FF00u) | 0x00000019u;
+  dst[643] = (dst[643] & 0xFF00FF00u) | 0x003D0000u;
+  dst[644] = (dst[644] & 0x007F007Fu) | 0x18000000u;
+  dst[645] = (dst[645] & 0x007F007Fu) | 0xC0001800u;
+  dst[682] = (dst[682] & 0xFE00FE00u) | 0x0000004Cu;
+  dst[683] = (dst[683] & 0xFE00FE00u) | 0x004C0000u;
+  dst[684] = (dst[684] & 0x007F007Fu) | 0x1C000100u;
+  dst[685] = (dst[685] & 0x007F007Fu) | 0x01001C00u;
+  dst[722] = (dst[722] & 0xFC00FC00u) | 0x00600190u;
+  dst[723] = (dst[723] & 0xFC00FC00u) | 0x01F50000u;
+  dst[724] = (dst[724] & 0x00780078u) | 0x00002100u;
+  dst[725] = (dst[725] & 0x00780078u) | 0xA1002000u;
+  dst[762] = (dst[762] & 0xFC00FC00u) | 0x00F00108u;
+  dst[763] = (dst[763] & 0xFC00FC00u) | 0x01F90000u;
+  dst[764] = 0x00073D00u;
+  dst[765] = 0xBD073C07u;
+  dst[766] &= 0x7FFF7FFFu;
+  dst[767] &= 0x7FFF7FFFu;
+  dst[802] = (dst[802] & 0xFC00FC00u) | 0x00780080u;
+  dst[803] = (dst[803] & 0xFC00FC00u) | 0x00FB0000u;
+  dst[804] = 0x002F3D80u;
+  dst[805] = 0xBDAF3C2Fu;
+  dst[806] = (dst[806] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[807] = (dst[807] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[842] = (dst[842] & 0xF800F800u) | 0x03100028u;
+  dst[843] = (dst[843] & 0xF800F800u) | 0x033B0300u;
+  dst[844] = 0x002F7D80u;
+  dst[845] = 0x7DAF7C2Fu;
+  dst[846] = (dst[846] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[847] = (dst[847] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[882] = (dst[882] & 0xF800F800u) | 0x03C00018u;
+  dst[883] = (dst[883] & 0xF800F800u) | 0x03DB03C0u;
+  dst[884] = 0x00377D80u;
+  dst[885] = 0x7DB77C37u;
+  dst[886] = (dst[886] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[887] = (dst[887] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[922] = (dst[922] & 0xF020F020u) | 0x07800000u;
+  dst[923] = (dst[923] & 0xF020F020u) | 0x07870780u;
+  dst[924] = 0x00077D80u;
+  dst[925] = 0x7D877C07u;
+  dst[926] = (dst[926] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[927] = (dst[927] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[962] = (dst[962] & 0xF070F070u) | 0x07000000u;
+  dst[963] = (dst[963] & 0xF070F070u) | 0x07070700u;
+  dst[964] = (dst[964] & 0x00180018u) | 0x00007E80u;
+  dst[965] = (dst[965] & 0x00180018u) | 0x7EC07E00u;
+  dst[966] &= 0x7FFF7FFFu;
+  dst[967] &= 0x7FFF7FFFu;
+  dst[1002] = (dst[1002] & 0xE020E020u) | 0x0F800000u;
+  dst[1003] = (dst[1003] & 0xE020E020u) | 0x0F8E0F80u;
+  dst[1004] = (dst[1004] & 0x001F001Fu) | 0x0000FE80u;
+  dst[1005] = (dst[1005] & 0x001F001Fu) | 0xFEC0FE00u;
+  dst[1042] = (dst[1042] & 0xE000E000u) | 0x0F800000u;
+  dst[1043] = (dst[1043] & 0xE000E000u) | 0x0F9E0F80u;
+  dst[1044] = (dst[1044] & 0x001F001Fu) | 0x0000FE80u;
+  dst[1045] = (dst[1045] & 0x001F001Fu) | 0xFEC0FE00u;
+  dst[1082] = (dst[1082] & 0xE000E000u) | 0x0FC00001u;
+  dst[1083] = (dst[1083] & 0xE000E000u) | 0x0FDD0FC1u;
+  dst[1084] = (dst[1084] & 0x000F000Fu) | 0x0000FE00u;
+  dst[1085] = (dst[1085] & 0x000F000Fu) | 0xFEE0FE00u;
+  dst[1122] = (dst[1122] & 0xF000F000u) | 0x07800003u;
+  dst[1123] = (dst[1123] & 0xF000F000u) | 0x07830783u;
+  dst[1124] = (dst[1124] & 0x000F000Fu) | 0x0000FF00u;
+  dst[1125] = (dst[1125] & 0x000F000Fu) | 0xFF00FF00u;
+  dst[1162] = (dst[1162] & 0xF800F800u) | 0x00780001u;
+  dst[1163] = (dst[1163] & 0xF800F800u) | 0x00790001u;
+  dst[1164] = (dst[1164] & 0x000F000Fu) | 0x00E0FC00u;
+  dst[1165] = (dst[1165] & 0x000F000Fu) | 0xFCE0FC00u;
+  dst[1202] = (dst[1202] & 0xFE00FE00u) | 0x00E60018u;
+  dst[1203] = (dst[1203] & 0xFE00FE00u) | 0x00FE0018u;
+  dst[1204] = (dst[1204] & 0x00070007u) | 0x03B00040u;
+  dst[1205] = (dst[1205] & 0x00070007u) | 0x03F00040u;
+  dst[1242] = (dst[1242] & 0xFC00FC00u) | 0x01C2003Cu;
+  dst[1243] = (dst[1243] & 0xFC00FC00u) | 0x01FE003Cu;
+  dst[1244] = (dst[1244] & 0xF007F007u) | 0x071000E0u;
+  dst[1245] = (dst[1245] & 0xF007F007u) | 0x07F000E0u;
+  dst[1282] = (dst[1282] & 0xF800F800u) | 0x03C2003Cu;
+  dst[1283] = (dst[1283] & 0xF800F800u) | 0x03FE003Cu;
+  dst[1284] = (dst[1284] & 0xF003F003u) | 0x071800E0u;
+  dst[1285] = (dst[1285] & 0xF003F003u) | 0x07F800E0u;
+  dst[1322] = (dst[1322] & 0xF000F000u) | 0x07C2003Cu;
+  dst[1323] = (dst[1323] & 0xF000F000u) | 0x07FE003Cu;
+  dst[1324] = (dst[1324] & 0xE001E001u) | 0x0F3800C0u;
+  dst[1325] = (dst[1325] & 0xE001E001u) | 0x0FF800C0u;
+  dst[1362] = (dst[1362] & 0xC001C001u) | 0x0FE40018u;
+  dst[1363] = (dst[1363] & 0xC001C001u) | 0x0FFC0018u;
+  dst[1364] = (dst[1364] & 0xE000E000u) | 0x0FFE0000u;
+  dst[1365] = (dst[1365] & 0xE000E000u) | 0x0FFE0000u;
+  dst[1366] &= 0x7FFF7FFFu;
+  dst[1367] &= 0x7FFF7FFFu;
+  dst[1402] = (dst[1402] & 0x00010001u) | 0x3FFC0000u;
+  dst[1403] = (dst[1403] & 0x00010001u) | 0x3FFC0000u;
+  dst[1404] = (dst[1404] & 0xE000E000u) | 0x0FC3003Cu;
+  dst[1405] = (dst[1405] & 0xE000E000u) | 0x0FFF003Cu;
+  dst[1406] = (dst[1406] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1407] = (dst[1407] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1440] &= 0xFFFCFFFCu;
+  dst[1441] &= 0xFFFCFFFCu;
+  dst[1442] = (dst[1442] & 0x00010001u) | 0xF0FC0F00u;
+  dst[1443] = (dst[1443] & 0x00010001u) | 0xFFFC0F00u;
+  dst[1444] = (dst[1444] & 0xE000E000u) | 0x0FE0001Fu;
+  dst[1445] = (dst[1445] & 0xE000E000u) | 0x0FFF001Fu;
+  dst[1446] = (dst[1446] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1447] = (dst[1447] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1480] = (dst[1480] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1481] = (dst[1481] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1482] = (dst[1482] & 0x00030003u) | 0xE0781F80u;
+  dst[1483] = (dst[1483] & 0x00030003u) | 0xFFF81F80u;
+  dst[1484] = (dst[1484] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1485] = (dst[1485] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1486] = (dst[1486] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1487] = (dst[1487] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1520] = (dst[1520] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1521] = (dst[1521] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1522] = (dst[1522] & 0x00030003u) | 0xFFF80000u;
+  dst[1523] = (dst[1523] & 0x00030003u) | 0xFFF80000u;
+  dst[1524] = (dst[1524] & 0xF000F000u) | 0x07FF0000u;
+  dst[1525] = (dst[1525] & 0xF000F000u) | 0x07FF0000u;
+  dst[1526] = (dst[1526] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1527] = (dst[1527] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1560] &= 0xFFF0FFF0u;
+  dst[1561] &= 0xFFF0FFF0u;
+  dst[1562] &= 0x00030003u;
+  dst[1563] &= 0x00030003u;
+  dst[1564] &= 0xF800F800u;
+  dst[1565] &= 0xF800F800u;
+  dst[1566] &= 0x0FFF0FFFu;
+  dst[1567] &= 0x0FFF0FFFu;
+}
+
+static void img_loserboy_f10_s3(uint32_t *dst) {
+  dst[44] &= 0xE03FE03Fu;
+  dst[45] &= 0xE03FE03Fu;
+  dst[84] = (dst[84] & 0x000F000Fu) | 0x1FC00000u;
+  dst[85] = (dst[85] & 0x000F000Fu) | 0x1FC00000u;
+  dst[122] &= 0xFFFCFFFCu;
+  dst[123] &= 0xFFFCFFFCu;
+  dst[124] = (dst[124] & 0x00070007u) | 0x7FF00000u;
+  dst[125] = (dst[125] & 0x00070007u) | 0x7FF00000u;
+  dst[162] = (dst[162] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[163] = (dst[163] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[164] = (dst[164] & 0x00030003u) | 0xFFF80000u;
+  dst[165] = (dst[165] & 0x00030003u) | 0xFFF80000u;
+  dst[202] = (dst[202] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[203] = (dst[203] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[204] = (dst[204] & 0x00010001u) | 0xFFFC0000u;
+  dst[205] = (dst[205] & 0x00010001u) | 0xFFFC0000u;
+  dst[242] = (dst[242] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[243] = (dst[243] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[244] = (dst[244] & 0x00010001u) | 0xFFFC0000u;
+  dst[245] = (dst[245] & 0x00010001u) | 0xFFFC0000u;
+  dst[282] = (dst[282] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[283] = (dst[283] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[284] = (dst[284] & 0x00010001u) | 0x38FC0000u;
+  dst[285] = (dst[285] & 0x00010001u) | 0x38FC0000u;
+  dst[322] = (dst[322] & 0xFFF0FFF0u) | 0x00050000u;
+  dst[323] = (dst[323] & 0xFFF0FFF0u) | 0x00050001u;
+  dst[324] = (dst[324] & 0x00010001u) | 0xA6740200u;
+  dst[325] = (dst[325] & 0x00010001u) | 0xA6748600u;
+  dst[362] = (dst[362] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[363] = (dst[363] & 0xFFF0FFF0u) | 0x00030003u;
+  dst[364] = (dst[364] & 0x00030003u) | 0x9E280680u;
+  dst[365] = (dst[365] & 0x00030003u) | 0x8EA89E80u;
+  dst[402] = (dst[402] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[403] = (dst[403] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[404] = (dst[404] & 0x00030003u) | 0xFE480680u;
+  dst[405] = (dst[405] & 0x00030003u) | 0xFEC8FEC0u;
+  dst[442] = (dst[442] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[443] = (dst[443] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[444] = (dst[444] & 0x00030003u) | 0xFF6C06B0u;
+  dst[445] = (dst[445] & 0x00030003u) | 0xFFF8FEF4u;
+  dst[482] = (dst[482] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[483] = (dst[483] & 0xFFF8FFF8u) | 0x00010001u;
+  dst[484] = (dst[484] & 0x00030003u) | 0xFFFC0398u;
+  dst[485] = (dst[485] & 0x00030003u) | 0xFFF8FFFCu;
+  dst[522] &= 0xFFF0FFF0u;
+  dst[523] &= 0xFFF0FFF0u;
+  dst[524] = (dst[524] & 0x00030003u) | 0x7FFC0000u;
+  dst[525] = (dst[525] & 0x00030003u) | 0x7CF87FFCu;
+  dst[562] = (dst[562] & 0xFFE0FFE0u) | 0x00000001u;
+  dst[563] = (dst[563] & 0xFFE0FFE0u) | 0x000D0000u;
+  dst[564] = (dst[564] & 0x00070007u) | 0x3FF80000u;
+  dst[565] = (dst[565] & 0x00070007u) | 0x9F703FF8u;
+  dst[602] = (dst[602] & 0xFFC0FFC0u) | 0x00000004u;
+  dst[603] = (dst[603] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[604] = (dst[604] & 0x000F000Fu) | 0x1FF0C000u;
+  dst[605] = (dst[605] & 0x000F000Fu) | 0xC7C01FF0u;
+  dst[642] = (dst[642] & 0xFF80FF80u) | 0x0000000Cu;
+  dst[643] = (dst[643] & 0xFF80FF80u) | 0x001E0000u;
+  dst[644] = (dst[644] & 0x003F003Fu) | 0x0C008000u;
+  dst[645] = (dst[645] & 0x003F003Fu) | 0xE0000C00u;
+  dst[682] = (dst[682] & 0xFF00FF00u) | 0x00000026u;
+  dst[683] = (dst[683] & 0xFF00FF00u) | 0x00260000u;
+  dst[684] = (dst[684] & 0x003F003Fu) | 0x0E000080u;
+  dst[685] = (dst[685] & 0x003F003Fu) | 0x00800E00u;
+  dst[722] = (dst[722] & 0xFE00FE00u) | 0x003000C8u;
+  dst[723] = (dst[723] & 0xFE00FE00u) | 0x00FA0000u;
+  dst[724] = (dst[724] & 0x003C003Cu) | 0x00001080u;
+  dst[725] = (dst[725] & 0x003C003Cu) | 0xD0801000u;
+  dst[726] &= 0x7FFF7FFFu;
+  dst[727] &= 0x7FFF7FFFu;
+  dst[762] = (dst[762] & 0xFE00FE00u) | 0x00780084u;
+  dst[763] = (dst[763] & 0xFE00FE00u) | 0x00FC0000u;
+  dst[764] = 0x00031E80u;
+  dst[765] = 0xDE831E03u;
+  dst[766] = (dst[766] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[767] = (dst[767] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[802] = (dst[802] & 0xFE00FE00u) | 0x003C0040u;
+  dst[803] = (dst[803] & 0xFE00FE00u) | 0x007D0000u;
+  dst[804] = 0x00171EC0u;
+  dst[805] = 0xDED71E17u;
+  dst[806] = (dst[806] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[807] = (dst[807] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[842] = (dst[842] & 0xFC00FC00u) | 0x01880014u;
+  dst[843] = (dst[843] & 0xFC00FC00u) | 0x019D0180u;
+  dst[844] = 0x00173EC0u;
+  dst[845] = 0xBED73E17u;
+  dst[846] = (dst[846] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[847] = (dst[847] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[882] = (dst[882] & 0xFC00FC00u) | 0x01E0000Cu;
+  dst[883] = (dst[883] & 0xFC00FC00u) | 0x01ED01E0u;
+  dst[884] = 0x001B3EC0u;
+  dst[885] = 0xBEDB3E1Bu;
+  dst[886] = (dst[886] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[887] = (dst[887] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[922] = (dst[922] & 0xF810F810u) | 0x03C00000u;
+  dst[923] = (dst[923] & 0xF810F810u) | 0x03C303C0u;
+  dst[924] = 0x00033EC0u;
+  dst[925] = 0xBEC33E03u;
+  dst[926] = (dst[926] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[927] = (dst[927] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[962] = (dst[962] & 0xF838F838u) | 0x03800000u;
+  dst[963] = (dst[963] & 0xF838F838u) | 0x03830380u;
+  dst[964] = (dst[964] & 0x000C000Cu) | 0x00003F40u;
+  dst[965] = (dst[965] & 0x000C000Cu) | 0xBF603F00u;
+  dst[966] &= 0x3FFF3FFFu;
+  dst[967] &= 0x3FFF3FFFu;
+  dst[1002] = (dst[1002] & 0xF010F010u) | 0x07C00000u;
+  dst[1003] = (dst[1003] & 0xF010F010u) | 0x07C707C0u;
+  dst[1004] = (dst[1004] & 0x000F000Fu) | 0x00007F40u;
+  dst[1005] = (dst[1005] & 0x000F000Fu) | 0x7F607F00u;
+  dst[1042] = (dst[1042] & 0xF000F000u) | 0x07C00000u;
+  dst[1043] = (dst[1043] & 0xF000F000u) | 0x07CF07C0u;
+  dst[1044] = (dst[1044] & 0x000F000Fu) | 0x00007F40u;
+  dst[1045] = (dst[1045] & 0x000F000Fu) | 0x7F607F00u;
+  dst[1082] = (dst[1082] & 0xF000F000u) | 0x07E00000u;
+  dst[1083] = (dst[1083] & 0xF000F000u) | 0x07EE07E0u;
+  dst[1084] = (dst[1084] & 0x00070007u) | 0x0000FF00u;
+  dst[1085] = (dst[1085] & 0x00070007u) | 0xFF70FF00u;
+  dst[1122] = (dst[1122] & 0xF800F800u) | 0x03C00001u;
+  dst[1123] = (dst[1123] & 0xF800F800u) | 0x03C103C1u;
+  dst[1124] = (dst[1124] & 0x00070007u) | 0x0000FF80u;
+  dst[1125] = (dst[1125] & 0x00070007u) | 0xFF80FF80u;
+  dst[1162] = (dst[1162] & 0xFC00FC00u) | 0x003C0000u;
+  dst[1163] = (dst[1163] & 0xFC00FC00u) | 0x003C0000u;
+  dst[1164] = (dst[1164] & 0x00070007u) | 0x0070FE00u;
+  dst[1165] = (dst[1165] & 0x00070007u) | 0xFE70FE00u;
+  dst[1202] = (dst[1202] & 0xFF00FF00u) | 0x0073000Cu;
+  dst[1203] = (dst[1203] & 0xFF00FF00u) | 0x007F000Cu;
+  dst[1204] = (dst[1204] & 0x00030003u) | 0x01D80020u;
+  dst[1205] = (dst[1205] & 0x00030003u) | 0x01F80020u;
+  dst[1242] = (dst[1242] & 0xFE00FE00u) | 0x00E1001Eu;
+  dst[1243] = (dst[1243] & 0xFE00FE00u) | 0x00FF001Eu;
+  dst[1244] = (dst[1244] & 0x78037803u) | 0x03880070u;
+  dst[1245] = (dst[1245] & 0x78037803u) | 0x03F80070u;
+  dst[1282] = (dst[1282] & 0xFC00FC00u) | 0x01E1001Eu;
+  dst[1283] = (dst[1283] & 0xFC00FC00u) | 0x01FF001Eu;
+  dst[1284] = (dst[1284] & 0x78017801u) | 0x038C0070u;
+  dst[1285] = (dst[1285] & 0x78017801u) | 0x03FC0070u;
+  dst[1322] = (dst[1322] & 0xF800F800u) | 0x03E1001Eu;
+  dst[1323] = (dst[1323] & 0xF800F800u) | 0x03FF001Eu;
+  dst[1324] = (dst[1324] & 0x70007000u) | 0x079C0060u;
+  dst[1325] = (dst[1325] & 0x70007000u) | 0x07FC0060u;
+  dst[1362] = (dst[1362] & 0xE000E000u) | 0x07F2000Cu;
+  dst[1363] = (dst[1363] & 0xE000E000u) | 0x07FE000Cu;
+  dst[1364] = (dst[1364] & 0xF000F000u) | 0x07FF0000u;
+  dst[1365] = (dst[1365] & 0xF000F000u) | 0x07FF0000u;
+  dst[1366] &= 0x3FFF3FFFu;
+  dst[1367] &= 0x3FFF3FFFu;
+  dst[1402] = (dst[1402] & 0x80008000u) | 0x1FFE0000u;
+  dst[1403] = (dst[1403] & 0x80008000u) | 0x1FFE0000u;
+  dst[1404] = (dst[1404] & 0xF000F000u) | 0x07E1001Eu;
+  dst[1405] = (dst[1405] & 0xF000F000u) | 0x07FF001Eu;
+  dst[1406] = (dst[1406] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1407] = (dst[1407] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1440] &= 0xFFFEFFFEu;
+  dst[1441] &= 0xFFFEFFFEu;
+  dst[1442] = 0x787E0780u;
+  dst[1443] = 0x7FFE0780u;
+  dst[1444] = (dst[1444] & 0xF000F000u) | 0x07F0000Fu;
+  dst[1445] = (dst[1445] & 0xF000F000u) | 0x07FF000Fu;
+  dst[1446] = (dst[1446] & 0x07FF07FFu) | 0x70008000u;
+  dst[1447] = (dst[1447] & 0x07FF07FFu) | 0xF0008000u;
+  dst[1480] = (dst[1480] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1481] = (dst[1481] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1482] = (dst[1482] & 0x00010001u) | 0xF03C0FC0u;
+  dst[1483] = (dst[1483] & 0x00010001u) | 0xFFFC0FC0u;
+  dst[1484] = (dst[1484] & 0xF000F000u) | 0x07FF0000u;
+  dst[1485] = (dst[1485] & 0xF000F000u) | 0x07FF0000u;
+  dst[1486] = (dst[1486] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1487] = (dst[1487] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1520] = (dst[1520] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1521] = (dst[1521] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1522] = (dst[1522] & 0x00010001u) | 0xFFFC0000u;
+  dst[1523] = (dst[1523] & 0x00010001u) | 0xFFFC0000u;
+  dst[1524] = (dst[1524] & 0xF800F800u) | 0x03FF0000u;
+  dst[1525] = (dst[1525] & 0xF800F800u) | 0x03FF0000u;
+  dst[1526] = (dst[1526] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1527] = (dst[1527] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1560] &= 0xFFF8FFF8u;
+  dst[1561] &= 0xFFF8FFF8u;
+  dst[1562] &= 0x00010001u;
+  dst[1563] &= 0x00010001u;
+  dst[1564] &= 0xFC00FC00u;
+  dst[1565] &= 0xFC00FC00u;
+  dst[1566] &= 0x07FF07FFu;
+  dst[1567] &= 0x07FF07FFu;
+}
+
+static void img_loserboy_f10_s4(uint32_t *dst) {
+  dst[44] &= 0xF01FF01Fu;
+  dst[45] &= 0xF01FF01Fu;
+  dst[84] = (dst[84] & 0x80078007u) | 0x0FE00000u;
+  dst[85] = (dst[85] & 0x80078007u) | 0x0FE00000u;
+  dst[122] &= 0xFFFEFFFEu;
+  dst[123] &= 0xFFFEFFFEu;
+  dst[124] = (dst[124] & 0x00030003u) | 0x3FF80000u;
+  dst[125] = (dst[125] & 0x00030003u) | 0x3FF80000u;
+  dst[162] = (dst[162] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[163] = (dst[163] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[164] = (dst[164] & 0x00010001u) | 0xFFFC0000u;
+  dst[165] = (dst[165] & 0x00010001u) | 0xFFFC0000u;
+  dst[202] = (dst[202] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[203] = (dst[203] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[204] = 0xFFFE0000u;
+  dst[205] = 0xFFFE0000u;
+  dst[242] = (dst[242] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[243] = (dst[243] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[244] = 0xFFFE0000u;
+  dst[245] = 0xFFFE0000u;
+  dst[282] = (dst[282] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[283] = (dst[283] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[284] = 0x1C7E0000u;
+  dst[285] = 0x1C7E0000u;
+  dst[322] = (dst[322] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[323] = (dst[323] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[324] = 0xD33A0100u;
+  dst[325] = 0xD33AC300u;
+  dst[362] = (dst[362] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[363] = (dst[363] & 0xFFF8FFF8u) | 0x00010001u;
+  dst[364] = (dst[364] & 0x00010001u) | 0xCF140340u;
+  dst[365] = (dst[365] & 0x00010001u) | 0xC754CF40u;
+  dst[402] = (dst[402] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[403] = (dst[403] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[404] = (dst[404] & 0x00010001u) | 0xFF240340u;
+  dst[405] = (dst[405] & 0x00010001u) | 0xFF64FF60u;
+  dst[442] = (dst[442] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[443] = (dst[443] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[444] = (dst[444] & 0x00010001u) | 0xFFB60358u;
+  dst[445] = (dst[445] & 0x00010001u) | 0xFFFCFF7Au;
+  dst[482] &= 0xFFFCFFFCu;
+  dst[483] &= 0xFFFCFFFCu;
+  dst[484] = (dst[484] & 0x00010001u) | 0xFFFE01CCu;
+  dst[485] = (dst[485] & 0x00010001u) | 0xFFFCFFFEu;
+  dst[522] &= 0xFFF8FFF8u;
+  dst[523] &= 0xFFF8FFF8u;
+  dst[524] = (dst[524] & 0x00010001u) | 0x3FFE0000u;
+  dst[525] = (dst[525] & 0x00010001u) | 0x3E7C3FFEu;
+  dst[562] &= 0xFFF0FFF0u;
+  dst[563] = (dst[563] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[564] = (dst[564] & 0x00030003u) | 0x1FFC8000u;
+  dst[565] = (dst[565] & 0x00030003u) | 0xCFB81FFCu;
+  dst[602] = (dst[602] & 0xFFE0FFE0u) | 0x00000002u;
+  dst[603] = (dst[603] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[604] = (dst[604] & 0x00070007u) | 0x0FF86000u;
+  dst[605] = (dst[605] & 0x00070007u) | 0x63E00FF8u;
+  dst[642] = (dst[642] & 0xFFC0FFC0u) | 0x00000006u;
+  dst[643] = (dst[643] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[644] = (dst[644] & 0x001F001Fu) | 0x06004000u;
+  dst[645] = (dst[645] & 0x001F001Fu) | 0x70000600u;
+  dst[682] = (dst[682] & 0xFF80FF80u) | 0x00000013u;
+  dst[683] = (dst[683] & 0xFF80FF80u) | 0x00130000u;
+  dst[684] = (dst[684] & 0x001F001Fu) | 0x07000040u;
+  dst[685] = (dst[685] & 0x001F001Fu) | 0x00400700u;
+  dst[722] = (dst[722] & 0xFF00FF00u) | 0x00180064u;
+  dst[723] = (dst[723] & 0xFF00FF00u) | 0x007D0000u;
+  dst[724] = (dst[724] & 0x001E001Eu) | 0x00000840u;
+  dst[725] = (dst[725] & 0x001E001Eu) | 0x68400800u;
+  dst[726] &= 0x3FFF3FFFu;
+  dst[727] &= 0x3FFF3FFFu;
+  dst[762] = (dst[762] & 0xFF00FF00u) | 0x003C0042u;
+  dst[763] = (dst[763] & 0xFF00FF00u) | 0x007E0000u;
+  dst[764] = 0x00010F40u;
+  dst[765] = 0x6F410F01u;
+  dst[766] = (dst[766] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[767] = (dst[767] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[802] = (dst[802] & 0xFF00FF00u) | 0x001E0020u;
+  dst[803] = (dst[803] & 0xFF00FF00u) | 0x003E0000u;
+  dst[804] = 0x000B0F60u;
+  dst[805] = 0xEF6B0F0Bu;
+  dst[806] = (dst[806] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[807] = (dst[807] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[842] = (dst[842] & 0xFE00FE00u) | 0x00C4000Au;
+  dst[843] = (dst[843] & 0xFE00FE00u) | 0x00CE00C0u;
+  dst[844] = 0x000B1F60u;
+  dst[845] = 0xDF6B1F0Bu;
+  dst[846] = (dst[846] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[847] = (dst[847] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[882] = (dst[882] & 0xFE00FE00u) | 0x00F00006u;
+  dst[883] = (dst[883] & 0xFE00FE00u) | 0x00F600F0u;
+  dst[884] = 0x000D1F60u;
+  dst[885] = 0xDF6D1F0Du;
+  dst[886] = (dst[886] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[887] = (dst[887] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[922] = (dst[922] & 0xFC08FC08u) | 0x01E00000u;
+  dst[923] = (dst[923] & 0xFC08FC08u) | 0x01E101E0u;
+  dst[924] = 0x00011F60u;
+  dst[925] = 0xDF611F01u;
+  dst[926] = (dst[926] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[927] = (dst[927] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[962] = (dst[962] & 0xFC1CFC1Cu) | 0x01C00000u;
+  dst[963] = (dst[963] & 0xFC1CFC1Cu) | 0x01C101C0u;
+  dst[964] = (dst[964] & 0x00060006u) | 0x00001FA0u;
+  dst[965] = (dst[965] & 0x00060006u) | 0xDFB01F80u;
+  dst[966] &= 0x1FFF1FFFu;
+  dst[967] &= 0x1FFF1FFFu;
+  dst[1002] = (dst[1002] & 0xF808F808u) | 0x03E00000u;
+  dst[1003] = (dst[1003] & 0xF808F808u) | 0x03E303E0u;
+  dst[1004] = (dst[1004] & 0x00070007u) | 0x00003FA0u;
+  dst[1005] = (dst[1005] & 0x00070007u) | 0xBFB03F80u;
+  dst[1042] = (dst[1042] & 0xF800F800u) | 0x03E00000u;
+  dst[1043] = (dst[1043] & 0xF800F800u) | 0x03E703E0u;
+  dst[1044] = (dst[1044] & 0x00070007u) | 0x00003FA0u;
+  dst[1045] = (dst[1045] & 0x00070007u) | 0xBFB03F80u;
+  dst[1082] = (dst[1082] & 0xF800F800u) | 0x03F00000u;
+  dst[1083] = (dst[1083] & 0xF800F800u) | 0x03F703F0u;
+  dst[1084] = (dst[1084] & 0x00030003u) | 0x00007F80u;
+  dst[1085] = (dst[1085] & 0x00030003u) | 0x7FB87F80u;
+  dst[1122] = (dst[1122] & 0xFC00FC00u) | 0x01E00000u;
+  dst[1123] = (dst[1123] & 0xFC00FC00u) | 0x01E001E0u;
+  dst[1124] = (dst[1124] & 0x00030003u) | 0x0000FFC0u;
+  dst[1125] = (dst[1125] & 0x00030003u) | 0xFFC0FFC0u;
+  dst[1162] = (dst[1162] & 0xFE00FE00u) | 0x001E0000u;
+  dst[1163] = (dst[1163] & 0xFE00FE00u) | 0x001E0000u;
+  dst[1164] = (dst[1164] & 0x00030003u) | 0x00387F00u;
+  dst[1165] = (dst[1165] & 0x00030003u) | 0x7F387F00u;
+  dst[1202] = (dst[1202] & 0xFF80FF80u) | 0x00390006u;
+  dst[1203] = (dst[1203] & 0xFF80FF80u) | 0x003F0006u;
+  dst[1204] = (dst[1204] & 0x00010001u) | 0x80EC0010u;
+  dst[1205] = (dst[1205] & 0x00010001u) | 0x80FC0010u;
+  dst[1242] = (dst[1242] & 0xFF00FF00u) | 0x0070000Fu;
+  dst[1243] = (dst[1243] & 0xFF00FF00u) | 0x007F000Fu;
+  dst[1244] = (dst[1244] & 0x3C013C01u) | 0x81C40038u;
+  dst[1245] = (dst[1245] & 0x3C013C01u) | 0x81FC0038u;
+  dst[1282] = (dst[1282] & 0xFE00FE00u) | 0x00F0000Fu;
+  dst[1283] = (dst[1283] & 0xFE00FE00u) | 0x00FF000Fu;
+  dst[1284] = (dst[1284] & 0x3C003C00u) | 0x81C60038u;
+  dst[1285] = (dst[1285] & 0x3C003C00u) | 0x81FE0038u;
+  dst[1322] = (dst[1322] & 0xFC00FC00u) | 0x01F0000Fu;
+  dst[1323] = (dst[1323] & 0xFC00FC00u) | 0x01FF000Fu;
+  dst[1324] = (dst[1324] & 0x38003800u) | 0x83CE0030u;
+  dst[1325] = (dst[1325] & 0x38003800u) | 0x83FE0030u;
+  dst[1326] &= 0x7FFF7FFFu;
+  dst[1327] &= 0x7FFF7FFFu;
+  dst[1362] = (dst[1362] & 0xF000F000u) | 0x03F90006u;
+  dst[1363] = (dst[1363] & 0xF000F000u) | 0x03FF0006u;
+  dst[1364] = (dst[1364] & 0x78007800u) | 0x03FF0000u;
+  dst[1365] = (dst[1365] & 0x78007800u) | 0x03FF0000u;
+  dst[1366] = (dst[1366] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1367] = (dst[1367] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1402] = (dst[1402] & 0xC000C000u) | 0x0FFF0000u;
+  dst[1403] = (dst[1403] & 0xC000C000u) | 0x0FFF0000u;
+  dst[1404] = (dst[1404] & 0x78007800u) | 0x03F0000Fu;
+  dst[1405] = (dst[1405] & 0x78007800u) | 0x03FF000Fu;
+  dst[1406] = (dst[1406] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1407] = (dst[1407] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1442] = 0x3C3F03C0u;
+  dst[1443] = 0x3FFF03C0u;
+  dst[1444] = (dst[1444] & 0x78007800u) | 0x03F80007u;
+  dst[1445] = (dst[1445] & 0x78007800u) | 0x03FF0007u;
+  dst[1446] = (dst[1446] & 0x03FF03FFu) | 0x3800C000u;
+  dst[1447] = (dst[1447] & 0x03FF03FFu) | 0xF800C000u;
+  dst[1480] &= 0xFFFEFFFEu;
+  dst[1481] &= 0xFFFEFFFEu;
+  dst[1482] = 0xF81E07E0u;
+  dst[1483] = 0xFFFE07E0u;
+  dst[1484] = (dst[1484] & 0xF800F800u) | 0x03FF0000u;
+  dst[1485] = (dst[1485] & 0xF800F800u) | 0x03FF0000u;
+  dst[1486] = (dst[1486] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1487] = (dst[1487] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1520] = (dst[1520] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1521] = (dst[1521] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1522] = 0xFFFE0000u;
+  dst[1523] = 0xFFFE0000u;
+  dst[1524] = (dst[1524] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1525] = (dst[1525] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1526] = (dst[1526] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1527] = (dst[1527] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1560] &= 0xFFFCFFFCu;
+  dst[1561] &= 0xFFFCFFFCu;
+  dst[1562] = 0x00000000u;
+  dst[1563] = 0x00000000u;
+  dst[1564] &= 0xFE00FE00u;
+  dst[1565] &= 0xFE00FE00u;
+  dst[1566] &= 0x03FF03FFu;
+  dst[1567] &= 0x03FF03FFu;
+}
+
+static void img_loserboy_f10_s5(uint32_t *dst) {
+  dst[44] &= 0xF80FF80Fu;
+  dst[45] &= 0xF80FF80Fu;
+  dst[84] = (dst[84] & 0xC003C003u) | 0x07F00000u;
+  dst[85] = (dst[85] & 0xC003C003u) | 0x07F00000u;
+  dst[124] = (dst[124] & 0x00010001u) | 0x1FFC0000u;
+  dst[125] = (dst[125] & 0x00010001u) | 0x1FFC0000u;
+  dst[162] &= 0xFFFEFFFEu;
+  dst[163] &= 0xFFFEFFFEu;
+  dst[164] = 0xFFFE0000u;
+  dst[165] = 0xFFFE0000u;
+  dst[202] = (dst[202] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[203] = (dst[203] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[204] = 0xFFFF0000u;
+  dst[205] = 0xFFFF0000u;
+  dst[206] &= 0x7FFF7FFFu;
+  dst[207] &= 0x7FFF7FFFu;
+  dst[242] = (dst[242] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[243] = (dst[243] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[244] = 0xFFFF0000u;
+  dst[245] = 0xFFFF0000u;
+  dst[246] &= 0x7FFF7FFFu;
+  dst[247] &= 0x7FFF7FFFu;
+  dst[282] = (dst[282] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[283] = (dst[283] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[284] = 0x8E3F0000u;
+  dst[285] = 0x8E3F0000u;
+  dst[286] &= 0x7FFF7FFFu;
+  dst[287] &= 0x7FFF7FFFu;
+  dst[322] = (dst[322] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[323] = (dst[323] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[324] = 0x699D0080u;
+  dst[325] = 0x699D6180u;
+  dst[326] &= 0x7FFF7FFFu;
+  dst[327] &= 0x7FFF7FFFu;
+  dst[362] &= 0xFFFCFFFCu;
+  dst[363] &= 0xFFFCFFFCu;
+  dst[364] = 0xE78A01A0u;
+  dst[365] = 0xE3AAE7A0u;
+  dst[402] &= 0xFFFEFFFEu;
+  dst[403] &= 0xFFFEFFFEu;
+  dst[404] = 0xFF9201A0u;
+  dst[405] = 0xFFB2FFB0u;
+  dst[442] &= 0xFFFEFFFEu;
+  dst[443] &= 0xFFFEFFFEu;
+  dst[444] = 0xFFDB01ACu;
+  dst[445] = 0xFFFEFFBDu;
+  dst[482] &= 0xFFFEFFFEu;
+  dst[483] &= 0xFFFEFFFEu;
+  dst[484] = 0x7FFF00E6u;
+  dst[485] = 0x7FFE7FFFu;
+  dst[522] &= 0xFFFCFFFCu;
+  dst[523] &= 0xFFFCFFFCu;
+  dst[524] = 0x1FFF0000u;
+  dst[525] = 0x1F3E1FFFu;
+  dst[562] &= 0xFFF8FFF8u;
+  dst[563] = (dst[563] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[564] = (dst[564] & 0x00010001u) | 0x0FFE4000u;
+  dst[565] = (dst[565] & 0x00010001u) | 0x67DC0FFEu;
+  dst[602] = (dst[602] & 0xFFF0FFF0u) | 0x00000001u;
+  dst[603] = (dst[603] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[604] = (dst[604] & 0x00030003u) | 0x07FC3000u;
+  dst[605] = (dst[605] & 0x00030003u) | 0xB1F007FCu;
+  dst[642] = (dst[642] & 0xFFE0FFE0u) | 0x00000003u;
+  dst[643] = (dst[643] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[644] = (dst[644] & 0x000F000Fu) | 0x03002000u;
+  dst[645] = (dst[645] & 0x000F000Fu) | 0xB8000300u;
+  dst[682] = (dst[682] & 0xFFC0FFC0u) | 0x00000009u;
+  dst[683] = (dst[683] & 0xFFC0FFC0u) | 0x00090000u;
+  dst[684] = (dst[684] & 0x000F000Fu) | 0x03808020u;
+  dst[685] = (dst[685] & 0x000F000Fu) | 0x80200380u;
+  dst[722] = (dst[722] & 0xFF80FF80u) | 0x000C0032u;
+  dst[723] = (dst[723] & 0xFF80FF80u) | 0x003E0000u;
+  dst[724] = (dst[724] & 0x000F000Fu) | 0x00000420u;
+  dst[725] = (dst[725] & 0x000F000Fu) | 0xB4200400u;
+  dst[726] &= 0x1FFF1FFFu;
+  dst[727] &= 0x1FFF1FFFu;
+  dst[762] = (dst[762] & 0xFF80FF80u) | 0x001E0021u;
+  dst[763] = (dst[763] & 0xFF80FF80u) | 0x003F0000u;
+  dst[764] = 0x000007A0u;
+  dst[765] = 0x37A00780u;
+  dst[766] = (dst[766] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[767] = (dst[767] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[802] = (dst[802] & 0xFF80FF80u) | 0x000F0010u;
+  dst[803] = (dst[803] & 0xFF80FF80u) | 0x001F0000u;
+  dst[804] = 0x000507B0u;
+  dst[805] = 0x77B50785u;
+  dst[806] = (dst[806] & 0x07FF07FFu) | 0xF0000000u;
+  dst[807] = (dst[807] & 0x07FF07FFu) | 0xF000F000u;
+  dst[842] = (dst[842] & 0xFF00FF00u) | 0x00620005u;
+  dst[843] = (dst[843] & 0xFF00FF00u) | 0x00670060u;
+  dst[844] = 0x00050FB0u;
+  dst[845] = 0x6FB50F85u;
+  dst[846] = (dst[846] & 0x07FF07FFu) | 0xF0000000u;
+  dst[847] = (dst[847] & 0x07FF07FFu) | 0xF000F000u;
+  dst[882] = (dst[882] & 0xFF00FF00u) | 0x00780003u;
+  dst[883] = (dst[883] & 0xFF00FF00u) | 0x007B0078u;
+  dst[884] = 0x00060FB0u;
+  dst[885] = 0x6FB60F86u;
+  dst[886] = (dst[886] & 0x07FF07FFu) | 0xF0000000u;
+  dst[887] = (dst[887] & 0x07FF07FFu) | 0xF000F000u;
+  dst[922] = (dst[922] & 0xFE04FE04u) | 0x00F00000u;
+  dst[923] = (dst[923] & 0xFE04FE04u) | 0x00F000F0u;
+  dst[924] = 0x00000FB0u;
+  dst[925] = 0xEFB00F80u;
+  dst[926] = (dst[926] & 0x07FF07FFu) | 0xF0000000u;
+  dst[927] = (dst[927] & 0x07FF07FFu) | 0xF000F000u;
+  dst[962] = (dst[962] & 0xFE0EFE0Eu) | 0x00E00000u;
+  dst[963] = (dst[963] & 0xFE0EFE0Eu) | 0x00E000E0u;
+  dst[964] = (dst[964] & 0x00030003u) | 0x00000FD0u;
+  dst[965] = (dst[965] & 0x00030003u) | 0xEFD80FC0u;
+  dst[966] &= 0x0FFF0FFFu;
+  dst[967] &= 0x0FFF0FFFu;
+  dst[1002] = (dst[1002] & 0xFC04FC04u) | 0x01F00000u;
+  dst[1003] = (dst[1003] & 0xFC04FC04u) | 0x01F101F0u;
+  dst[1004] = (dst[1004] & 0x00030003u) | 0x00001FD0u;
+  dst[1005] = (dst[1005] & 0x00030003u) | 0xDFD81FC0u;
+  dst[1042] = (dst[1042] & 0xFC00FC00u) | 0x01F00000u;
+  dst[1043] = (dst[1043] & 0xFC00FC00u) | 0x01F301F0u;
+  dst[1044] = (dst[1044] & 0x00030003u) | 0x00001FD0u;
+  dst[1045] = (dst[1045] & 0x00030003u) | 0xDFD81FC0u;
+  dst[1082] = (dst[1082] & 0xFC00FC00u) | 0x01F80000u;
+  dst[1083] = (dst[1083] & 0xFC00FC00u) | 0x01FB01F8u;
+  dst[1084] = (dst[1084] & 0x00010001u) | 0x00003FC0u;
+  dst[1085] = (dst[1085] & 0x00010001u) | 0xBFDC3FC0u;
+  dst[1122] = (dst[1122] & 0xFE00FE00u) | 0x00F00000u;
+  dst[1123] = (dst[1123] & 0xFE00FE00u) | 0x00F000F0u;
+  dst[1124] = (dst[1124] & 0x00010001u) | 0x00007FE0u;
+  dst[1125] = (dst[1125] & 0x00010001u) | 0x7FE07FE0u;
+  dst[1162] = (dst[1162] & 0xFF00FF00u) | 0x000F0000u;
+  dst[1163] = (dst[1163] & 0xFF00FF00u) | 0x000F0000u;
+  dst[1164] = (dst[1164] & 0x00010001u) | 0x001C3F80u;
+  dst[1165] = (dst[1165] & 0x00010001u) | 0x3F9C3F80u;
+  dst[1202] = (dst[1202] & 0xFFC0FFC0u) | 0x001C0003u;
+  dst[1203] = (dst[1203] & 0xFFC0FFC0u) | 0x001F0003u;
+  dst[1204] = 0xC0760008u;
+  dst[1205] = 0xC07E0008u;
+  dst[1242] = (dst[1242] & 0xFF80FF80u) | 0x00380007u;
+  dst[1243] = (dst[1243] & 0xFF80FF80u) | 0x003F0007u;
+  dst[1244] = (dst[1244] & 0x1E001E00u) | 0x40E2801Cu;
+  dst[1245] = (dst[1245] & 0x1E001E00u) | 0xC0FE801Cu;
+  dst[1282] = (dst[1282] & 0xFF00FF00u) | 0x00780007u;
+  dst[1283] = (dst[1283] & 0xFF00FF00u) | 0x007F0007u;
+  dst[1284] = (dst[1284] & 0x1E001E00u) | 0x40E3801Cu;
+  dst[1285] = (dst[1285] & 0x1E001E00u) | 0xC0FF801Cu;
+  dst[1286] &= 0x7FFF7FFFu;
+  dst[1287] &= 0x7FFF7FFFu;
+  dst[1322] = (dst[1322] & 0xFE00FE00u) | 0x00F80007u;
+  dst[1323] = (dst[1323] & 0xFE00FE00u) | 0x00FF0007u;
+  dst[1324] = (dst[1324] & 0x1C001C00u) | 0x41E78018u;
+  dst[1325] = (dst[1325] & 0x1C001C00u) | 0xC1FF8018u;
+  dst[1326] &= 0x3FFF3FFFu;
+  dst[1327] &= 0x3FFF3FFFu;
+  dst[1362] = (dst[1362] & 0xF800F800u) | 0x01FC0003u;
+  dst[1363] = (dst[1363] & 0xF800F800u) | 0x01FF0003u;
+  dst[1364] = (dst[1364] & 0x3C003C00u) | 0x81FF0000u;
+  dst[1365] = (dst[1365] & 0x3C003C00u) | 0x81FF0000u;
+  dst[1366] = (dst[1366] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1367] = (dst[1367] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1402] = (dst[1402] & 0xE000E000u) | 0x07FF0000u;
+  dst[1403] = (dst[1403] & 0xE000E000u) | 0x07FF0000u;
+  dst[1404] = (dst[1404] & 0x3C003C00u) | 0x81F80007u;
+  dst[1405] = (dst[1405] & 0x3C003C00u) | 0x81FF0007u;
+  dst[1406] = (dst[1406] & 0x03FF03FFu) | 0x70008000u;
+  dst[1407] = (dst[1407] & 0x03FF03FFu) | 0xF0008000u;
+  dst[1442] = (dst[1442] & 0x80008000u) | 0x1E1F01E0u;
+  dst[1443] = (dst[1443] & 0x80008000u) | 0x1FFF01E0u;
+  dst[1444] = (dst[1444] & 0x3C003C00u) | 0x81FC0003u;
+  dst[1445] = (dst[1445] & 0x3C003C00u) | 0x81FF0003u;
+  dst[1446] = (dst[1446] & 0x01FF01FFu) | 0x1C00E000u;
+  dst[1447] = (dst[1447] & 0x01FF01FFu) | 0xFC00E000u;
+  dst[1482] = 0x7C0F03F0u;
+  dst[1483] = 0x7FFF03F0u;
+  dst[1484] = (dst[1484] & 0x7C007C00u) | 0x01FF0000u;
+  dst[1485] = (dst[1485] & 0x7C007C00u) | 0x01FF0000u;
+  dst[1486] = (dst[1486] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1487] = (dst[1487] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1520] &= 0xFFFEFFFEu;
+  dst[1521] &= 0xFFFEFFFEu;
+  dst[1522] = 0xFFFF0000u;
+  dst[1523] = 0xFFFF0000u;
+  dst[1524] = (dst[1524] & 0x7E007E00u) | 0x00FF0000u;
+  dst[1525] = (dst[1525] & 0x7E007E00u) | 0x00FF0000u;
+  dst[1526] = (dst[1526] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1527] = (dst[1527] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1560] &= 0xFFFEFFFEu;
+  dst[1561] &= 0xFFFEFFFEu;
+  dst[1562] = 0x00000000u;
+  dst[1563] = 0x00000000u;
+  dst[1564] &= 0x7F007F00u;
+  dst[1565] &= 0x7F007F00u;
+  dst[1566] &= 0x01FF01FFu;
+  dst[1567] &= 0x01FF01FFu;
+}
+
+static void img_loserboy_f10_s6(uint32_t *dst) {
+  dst[44] &= 0xFC07FC07u;
+  dst[45] &= 0xFC07FC07u;
+  dst[84] = (dst[84] & 0xE001E001u) | 0x03F80000u;
+  dst[85] = (dst[85] & 0xE001E001u) | 0x03F80000u;
+  dst[124] = (dst[124] & 0x80008000u) | 0x0FFE0000u;
+  dst[125] = (dst[125] & 0x80008000u) | 0x0FFE0000u;
+  dst[164] = 0x7FFF0000u;
+  dst[165] = 0x7FFF0000u;
+  dst[166] &= 0x7FFF7FFFu;
+  dst[167] &= 0x7FFF7FFFu;
+  dst[202] &= 0xFFFEFFFEu;
+  dst[203] &= 0xFFFEFFFEu;
+  dst[204] = 0xFFFF0000u;
+  dst[205] = 0xFFFF0000u;
+  dst[206] = (dst[206] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[207] = (dst[207] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[242] &= 0xFFFEFFFEu;
+  dst[243] &= 0xFFFEFFFEu;
+  dst[244] = 0xFFFF0000u;
+  dst[245] = 0xFFFF0000u;
+  dst[246] = (dst[246] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[247] = (dst[247] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[282] &= 0xFFFEFFFEu;
+  dst[283] &= 0xFFFEFFFEu;
+  dst[284] = 0xC71F0000u;
+  dst[285] = 0xC71F0000u;
+  dst[286] = (dst[286] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[287] = (dst[287] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[322] &= 0xFFFEFFFEu;
+  dst[323] &= 0xFFFEFFFEu;
+  dst[324] = 0xB4CE0040u;
+  dst[325] = 0xB4CE30C0u;
+  dst[326] = (dst[326] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[327] = (dst[327] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[362] &= 0xFFFEFFFEu;
+  dst[363] &= 0xFFFEFFFEu;
+  dst[364] = 0x73C500D0u;
+  dst[365] = 0x71D573D0u;
+  dst[366] &= 0x7FFF7FFFu;
+  dst[367] &= 0x7FFF7FFFu;
+  dst[404] = 0x7FC900D0u;
+  dst[405] = 0x7FD97FD8u;
+  dst[406] &= 0x7FFF7FFFu;
+  dst[407] &= 0x7FFF7FFFu;
+  dst[444] = 0x7FED00D6u;
+  dst[445] = 0x7FFF7FDEu;
+  dst[446] = (dst[446] & 0x7FFF7FFFu) | 0x80000000u;
+  dst[447] = (dst[447] & 0x7FFF7FFFu) | 0x00008000u;
+  dst[484] = 0x3FFF0073u;
+  dst[485] = 0x3FFF3FFFu;
+  dst[486] = (dst[486] & 0x7FFF7FFFu) | 0x80000000u;
+  dst[487] = (dst[487] & 0x7FFF7FFFu) | 0x00008000u;
+  dst[522] &= 0xFFFEFFFEu;
+  dst[523] &= 0xFFFEFFFEu;
+  dst[524] = 0x0FFF0000u;
+  dst[525] = 0x0F9F0FFFu;
+  dst[526] = (dst[526] & 0x7FFF7FFFu) | 0x80000000u;
+  dst[527] = (dst[527] & 0x7FFF7FFFu) | 0x00008000u;
+  dst[562] &= 0xFFFCFFFCu;
+  dst[563] = (dst[563] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[564] = 0x07FF2000u;
+  dst[565] = 0xB3EE07FFu;
+  dst[602] &= 0xFFF8FFF8u;
+  dst[603] = (dst[603] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[604] = (dst[604] & 0x00010001u) | 0x03FE9800u;
+  dst[605] = (dst[605] & 0x00010001u) | 0xD8F803FEu;
+  dst[642] = (dst[642] & 0xFFF0FFF0u) | 0x00000001u;
+  dst[643] = (dst[643] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[644] = (dst[644] & 0x00070007u) | 0x01809000u;
+  dst[645] = (dst[645] & 0x00070007u) | 0xDC000180u;
+  dst[682] = (dst[682] & 0xFFE0FFE0u) | 0x00000004u;
+  dst[683] = (dst[683] & 0xFFE0FFE0u) | 0x00040000u;
+  dst[684] = (dst[684] & 0x00070007u) | 0x01C0C010u;
+  dst[685] = (dst[685] & 0x00070007u) | 0xC01001C0u;
+  dst[722] = (dst[722] & 0xFFC0FFC0u) | 0x00060019u;
+  dst[723] = (dst[723] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[724] = (dst[724] & 0x00070007u) | 0x00000210u;
+  dst[725] = (dst[725] & 0x00070007u) | 0x5A100200u;
+  dst[726] &= 0x8FFF8FFFu;
+  dst[727] &= 0x8FFF8FFFu;
+  dst[762] = (dst[762] & 0xFFC0FFC0u) | 0x000F0010u;
+  dst[763] = (dst[763] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[764] = 0x000083D0u;
+  dst[765] = 0x9BD003C0u;
+  dst[766] = (dst[766] & 0x07FF07FFu) | 0x70000000u;
+  dst[767] = (dst[767] & 0x07FF07FFu) | 0x70007000u;
+  dst[802] = (dst[802] & 0xFFC0FFC0u) | 0x00070008u;
+  dst[803] = (dst[803] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[804] = 0x800203D8u;
+  dst[805] = 0xBBDA03C2u;
+  dst[806] = (dst[806] & 0x03FF03FFu) | 0xF8000000u;
+  dst[807] = (dst[807] & 0x03FF03FFu) | 0xF800F800u;
+  dst[842] = (dst[842] & 0xFF80FF80u) | 0x00310002u;
+  dst[843] = (dst[843] & 0xFF80FF80u) | 0x00330030u;
+  dst[844] = 0x000287D8u;
+  dst[845] = 0xB7DA07C2u;
+  dst[846] = (dst[846] & 0x03FF03FFu) | 0xF8000000u;
+  dst[847] = (dst[847] & 0x03FF03FFu) | 0xF800F800u;
+  dst[882] = (dst[882] & 0xFF80FF80u) | 0x003C0001u;
+  dst[883] = (dst[883] & 0xFF80FF80u) | 0x003D003Cu;
+  dst[884] = 0x000387D8u;
+  dst[885] = 0xB7DB07C3u;
+  dst[886] = (dst[886] & 0x03FF03FFu) | 0x78000000u;
+  dst[887] = (dst[887] & 0x03FF03FFu) | 0x78007800u;
+  dst[922] = (dst[922] & 0xFF02FF02u) | 0x00780000u;
+  dst[923] = (dst[923] & 0xFF02FF02u) | 0x00780078u;
+  dst[924] = 0x000007D8u;
+  dst[925] = 0x77D807C0u;
+  dst[926] = (dst[926] & 0x03FF03FFu) | 0x78000000u;
+  dst[927] = (dst[927] & 0x03FF03FFu) | 0x78007800u;
+  dst[962] = (dst[962] & 0xFF07FF07u) | 0x00700000u;
+  dst[963] = (dst[963] & 0xFF07FF07u) | 0x00700070u;
+  dst[964] = (dst[964] & 0x00010001u) | 0x000007E8u;
+  dst[965] = (dst[965] & 0x00010001u) | 0x77EC07E0u;
+  dst[966] &= 0x87FF87FFu;
+  dst[967] &= 0x87FF87FFu;
+  dst[1002] = (dst[1002] & 0xFE02FE02u) | 0x00F80000u;
+  dst[1003] = (dst[1003] & 0xFE02FE02u) | 0x00F800F8u;
+  dst[1004] = (dst[1004] & 0x00010001u) | 0x00000FE8u;
+  dst[1005] = (dst[1005] & 0x00010001u) | 0xEFEC0FE0u;
+  dst[1042] = (dst[1042] & 0xFE00FE00u) | 0x00F80000u;
+  dst[1043] = (dst[1043] & 0xFE00FE00u) | 0x00F900F8u;
+  dst[1044] = (dst[1044] & 0x00010001u) | 0x00000FE8u;
+  dst[1045] = (dst[1045] & 0x00010001u) | 0xEFEC0FE0u;
+  dst[1082] = (dst[1082] & 0xFE00FE00u) | 0x00FC0000u;
+  dst[1083] = (dst[1083] & 0xFE00FE00u) | 0x00FD00FCu;
+  dst[1084] = 0x00001FE0u;
+  dst[1085] = 0xDFEE1FE0u;
+  dst[1122] = (dst[1122] & 0xFF00FF00u) | 0x00780000u;
+  dst[1123] = (dst[1123] & 0xFF00FF00u) | 0x00780078u;
+  dst[1124] = 0x00003FF0u;
+  dst[1125] = 0x3FF03FF0u;
+  dst[1162] = (dst[1162] & 0xFF80FF80u) | 0x00070000u;
+  dst[1163] = (dst[1163] & 0xFF80FF80u) | 0x00070000u;
+  dst[1164] = 0x800E1FC0u;
+  dst[1165] = 0x9FCE1FC0u;
+  dst[1202] = (dst[1202] & 0xFFE0FFE0u) | 0x000E0001u;
+  dst[1203] = (dst[1203] & 0xFFE0FFE0u) | 0x000F0001u;
+  dst[1204] = 0x603B8004u;
+  dst[1205] = 0xE03F8004u;
+  dst[1206] &= 0x7FFF7FFFu;
+  dst[1207] &= 0x7FFF7FFFu;
+  dst[1242] = (dst[1242] & 0xFFC0FFC0u) | 0x001C0003u;
+  dst[1243] = (dst[1243] & 0xFFC0FFC0u) | 0x001F0003u;
+  dst[1244] = (dst[1244] & 0x0F000F00u) | 0x2071C00Eu;
+  dst[1245] = (dst[1245] & 0x0F000F00u) | 0xE07FC00Eu;
+  dst[1246] &= 0x7FFF7FFFu;
+  dst[1247] &= 0x7FFF7FFFu;
+  dst[1282] = (dst[1282] & 0xFF80FF80u) | 0x003C0003u;
+  dst[1283] = (dst[1283] & 0xFF80FF80u) | 0x003F0003u;
+  dst[1284] = (dst[1284] & 0x0F000F00u) | 0x2071C00Eu;
+  dst[1285] = (dst[1285] & 0x0F000F00u) | 0xE07FC00Eu;
+  dst[1286] = (dst[1286] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1287] = (dst[1287] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1322] = (dst[1322] & 0xFF00FF00u) | 0x007C0003u;
+  dst[1323] = (dst[1323] & 0xFF00FF00u) | 0x007F0003u;
+  dst[1324] = (dst[1324] & 0x0E000E00u) | 0x20F3C00Cu;
+  dst[1325] = (dst[1325] & 0x0E000E00u) | 0xE0FFC00Cu;
+  dst[1326] = (dst[1326] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1327] = (dst[1327] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1362] = (dst[1362] & 0xFC00FC00u) | 0x00FE0001u;
+  dst[1363] = (dst[1363] & 0xFC00FC00u) | 0x00FF0001u;
+  dst[1364] = (dst[1364] & 0x1E001E00u) | 0x40FF8000u;
+  dst[1365] = (dst[1365] & 0x1E001E00u) | 0xC0FF8000u;
+  dst[1366] = (dst[1366] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1367] = (dst[1367] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1402] = (dst[1402] & 0xF000F000u) | 0x03FF0000u;
+  dst[1403] = (dst[1403] & 0xF000F000u) | 0x03FF0000u;
+  dst[1404] = (dst[1404] & 0x1E001E00u) | 0xC0FC0003u;
+  dst[1405] = (dst[1405] & 0x1E001E00u) | 0xC0FF0003u;
+  dst[1406] = (dst[1406] & 0x01FF01FFu) | 0x3800C000u;
+  dst[1407] = (dst[1407] & 0x01FF01FFu) | 0xF800C000u;
+  dst[1442] = (dst[1442] & 0xC000C000u) | 0x0F0F00F0u;
+  dst[1443] = (dst[1443] & 0xC000C000u) | 0x0FFF00F0u;
+  dst[1444] = (dst[1444] & 0x1E001E00u) | 0xC0FE0001u;
+  dst[1445] = (dst[1445] & 0x1E001E00u) | 0xC0FF0001u;
+  dst[1446] = (dst[1446] & 0x00FF00FFu) | 0x0E00F000u;
+  dst[1447] = (dst[1447] & 0x00FF00FFu) | 0xFE00F000u;
+  dst[1482] = (dst[1482] & 0x80008000u) | 0x3E0701F8u;
+  dst[1483] = (dst[1483] & 0x80008000u) | 0x3FFF01F8u;
+  dst[1484] = (dst[1484] & 0x3E003E00u) | 0x80FF0000u;
+  dst[1485] = (dst[1485] & 0x3E003E00u) | 0x80FF0000u;
+  dst[1486] = (dst[1486] & 0x007F007Fu) | 0xFF000000u;
+  dst[1487] = (dst[1487] & 0x007F007Fu) | 0xFF000000u;
+  dst[1522] = 0x7FFF0000u;
+  dst[1523] = 0x7FFF0000u;
+  dst[1524] = (dst[1524] & 0x3F003F00u) | 0x807F0000u;
+  dst[1525] = (dst[1525] & 0x3F003F00u) | 0x807F0000u;
+  dst[1526] = (dst[1526] & 0x007F007Fu) | 0xFF000000u;
+  dst[1527] = (dst[1527] & 0x007F007Fu) | 0xFF000000u;
+  dst[1562] = 0x00000000u;
+  dst[1563] = 0x00000000u;
+  dst[1564] &= 0x3F803F80u;
+  dst[1565] &= 0x3F803F80u;
+  dst[1566] &= 0x00FF00FFu;
+  dst[1567] &= 0x00FF00FFu;
+}
+
+static void img_loserboy_f10_s7(uint32_t *dst) {
+  dst[44] &= 0xFE03FE03u;
+  dst[45] &= 0xFE03FE03u;
+  dst[84] = (dst[84] & 0xF000F000u) | 0x01FC0000u;
+  dst[85] = (dst[85] & 0xF000F000u) | 0x01FC0000u;
+  dst[124] = (dst[124] & 0xC000C000u) | 0x07FF0000u;
+  dst[125] = (dst[125] & 0xC000C000u) | 0x07FF0000u;
+  dst[126] &= 0x7FFF7FFFu;
+  dst[127] &= 0x7FFF7FFFu;
+  dst[164] = (dst[164] & 0x80008000u) | 0x3FFF0000u;
+  dst[165] = (dst[165] & 0x80008000u) | 0x3FFF0000u;
+  dst[166] = (dst[166] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[167] = (dst[167] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[204] = 0x7FFF0000u;
+  dst[205] = 0x7FFF0000u;
+  dst[206] = (dst[206] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[207] = (dst[207] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[244] = 0x7FFF0000u;
+  dst[245] = 0x7FFF0000u;
+  dst[246] = (dst[246] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[247] = (dst[247] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[284] = 0x638F0000u;
+  dst[285] = 0x638F0000u;
+  dst[286] = (dst[286] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[287] = (dst[287] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[324] = 0x5A670020u;
+  dst[325] = 0x5A671860u;
+  dst[326] = (dst[326] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[327] = (dst[327] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[364] = 0x39E20068u;
+  dst[365] = 0x38EA39E8u;
+  dst[366] = (dst[366] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[367] = (dst[367] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[404] = (dst[404] & 0x80008000u) | 0x3FE40068u;
+  dst[405] = (dst[405] & 0x80008000u) | 0x3FEC3FECu;
+  dst[406] = (dst[406] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[407] = (dst[407] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[444] = (dst[444] & 0x80008000u) | 0x3FF6006Bu;
+  dst[445] = (dst[445] & 0x80008000u) | 0x3FFF3FEFu;
+  dst[446] = (dst[446] & 0x3FFF3FFFu) | 0xC0000000u;
+  dst[447] = (dst[447] & 0x3FFF3FFFu) | 0x80004000u;
+  dst[484] = (dst[484] & 0x80008000u) | 0x1FFF0039u;
+  dst[485] = (dst[485] & 0x80008000u) | 0x1FFF1FFFu;
+  dst[486] = (dst[486] & 0x3FFF3FFFu) | 0xC0008000u;
+  dst[487] = (dst[487] & 0x3FFF3FFFu) | 0x8000C000u;
+  dst[524] = 0x07FF0000u;
+  dst[525] = 0x07CF07FFu;
+  dst[526] = (dst[526] & 0x3FFF3FFFu) | 0xC0000000u;
+  dst[527] = (dst[527] & 0x3FFF3FFFu) | 0x8000C000u;
+  dst[562] &= 0xFFFEFFFEu;
+  dst[563] &= 0xFFFEFFFEu;
+  dst[564] = 0x03FF1000u;
+  dst[565] = 0xD9F703FFu;
+  dst[566] = (dst[566] & 0x7FFF7FFFu) | 0x80000000u;
+  dst[567] = (dst[567] & 0x7FFF7FFFu) | 0x00008000u;
+  dst[602] &= 0xFFFCFFFCu;
+  dst[603] = (dst[603] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[604] = 0x01FF4C00u;
+  dst[605] = 0xEC7C01FFu;
+  dst[642] &= 0xFFF8FFF8u;
+  dst[643] = (dst[643] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[644] = (dst[644] & 0x00030003u) | 0x00C0C800u;
+  dst[645] = (dst[645] & 0x00030003u) | 0xEE0000C0u;
+  dst[682] = (dst[682] & 0xFFF0FFF0u) | 0x00000002u;
+  dst[683] = (dst[683] & 0xFFF0FFF0u) | 0x00020000u;
+  dst[684] = (dst[684] & 0x00030003u) | 0x00E06008u;
+  dst[685] = (dst[685] & 0x00030003u) | 0x600800E0u;
+  dst[722] = (dst[722] & 0xFFE0FFE0u) | 0x0003000Cu;
+  dst[723] = (dst[723] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[724] = (dst[724] & 0x00030003u) | 0x00008108u;
+  dst[725] = (dst[725] & 0x00030003u) | 0xAD080100u;
+  dst[726] &= 0xC7FFC7FFu;
+  dst[727] &= 0xC7FFC7FFu;
+  dst[762] = (dst[762] & 0xFFE0FFE0u) | 0x00070008u;
+  dst[763] = (dst[763] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[764] = 0x800041E8u;
+  dst[765] = 0xCDE801E0u;
+  dst[766] = (dst[766] & 0x03FF03FFu) | 0x38000000u;
+  dst[767] = (dst[767] & 0x03FF03FFu) | 0x38003800u;
+  dst[802] = (dst[802] & 0xFFE0FFE0u) | 0x00030004u;
+  dst[803] = (dst[803] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[804] = 0xC00101ECu;
+  dst[805] = 0xDDED01E1u;
+  dst[806] = (dst[806] & 0x01FF01FFu) | 0x7C000000u;
+  dst[807] = (dst[807] & 0x01FF01FFu) | 0x7C007C00u;
+  dst[842] = (dst[842] & 0xFFC0FFC0u) | 0x00180001u;
+  dst[843] = (dst[843] & 0xFFC0FFC0u) | 0x00190018u;
+  dst[844] = 0x800143ECu;
+  dst[845] = 0xDBED03E1u;
+  dst[846] = (dst[846] & 0x01FF01FFu) | 0x7C000000u;
+  dst[847] = (dst[847] & 0x01FF01FFu) | 0x7C007C00u;
+  dst[882] = (dst[882] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[883] = (dst[883] & 0xFFC0FFC0u) | 0x001E001Eu;
+  dst[884] = 0x0001C3ECu;
+  dst[885] = 0xDBED03E1u;
+  dst[886] = (dst[886] & 0x01FF01FFu) | 0xBC000000u;
+  dst[887] = (dst[887] & 0x01FF01FFu) | 0xBC00BC00u;
+  dst[922] = (dst[922] & 0xFF81FF81u) | 0x003C0000u;
+  dst[923] = (dst[923] & 0xFF81FF81u) | 0x003C003Cu;
+  dst[924] = 0x000003ECu;
+  dst[925] = 0x3BEC03E0u;
+  dst[926] = (dst[926] & 0x01FF01FFu) | 0x3C000000u;
+  dst[927] = (dst[927] & 0x01FF01FFu) | 0x3C003C00u;
+  dst[962] = (dst[962] & 0xFF83FF83u) | 0x00380000u;
+  dst[963] = (dst[963] & 0xFF83FF83u) | 0x00380038u;
+  dst[964] = (dst[964] & 0x80008000u) | 0x000003F4u;
+  dst[965] = (dst[965] & 0x80008000u) | 0x3BF603F0u;
+  dst[966] &= 0xC3FFC3FFu;
+  dst[967] &= 0xC3FFC3FFu;
+  dst[1002] = (dst[1002] & 0xFF01FF01u) | 0x007C0000u;
+  dst[1003] = (dst[1003] & 0xFF01FF01u) | 0x007C007Cu;
+  dst[1004] = 0x000007F4u;
+  dst[1005] = 0x77F607F0u;
+  dst[1042] = (dst[1042] & 0xFF00FF00u) | 0x007C0000u;
+  dst[1043] = (dst[1043] & 0xFF00FF00u) | 0x007C007Cu;
+  dst[1044] = 0x000007F4u;
+  dst[1045] = 0xF7F607F0u;
+  dst[1082] = (dst[1082] & 0xFF00FF00u) | 0x007E0000u;
+  dst[1083] = (dst[1083] & 0xFF00FF00u) | 0x007E007Eu;
+  dst[1084] = 0x00000FF0u;
+  dst[1085] = 0xEFF70FF0u;
+  dst[1086] &= 0x7FFF7FFFu;
+  dst[1087] &= 0x7FFF7FFFu;
+  dst[1122] = (dst[1122] & 0xFF80FF80u) | 0x003C0000u;
+  dst[1123] = (dst[1123] & 0xFF80FF80u) | 0x003C003Cu;
+  dst[1124] = 0x00001FF8u;
+  dst[1125] = 0x1FF81FF8u;
+  dst[1126] &= 0x7FFF7FFFu;
+  dst[1127] &= 0x7FFF7FFFu;
+  dst[1162] = (dst[1162] & 0xFFC0FFC0u) | 0x00030000u;
+  dst[1163] = (dst[1163] & 0xFFC0FFC0u) | 0x00030000u;
+  dst[1164] = 0xC0070FE0u;
+  dst[1165] = 0xCFE70FE0u;
+  dst[1166] &= 0x7FFF7FFFu;
+  dst[1167] &= 0x7FFF7FFFu;
+  dst[1202] = (dst[1202] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1203] = (dst[1203] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1204] = 0x301DC002u;
+  dst[1205] = 0xF01FC002u;
+  dst[1206] = (dst[1206] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1207] = (dst[1207] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1242] = (dst[1242] & 0xFFE0FFE0u) | 0x000E0001u;
+  dst[1243] = (dst[1243] & 0xFFE0FFE0u) | 0x000F0001u;
+  dst[1244] = (dst[1244] & 0x07800780u) | 0x1038E007u;
+  dst[1245] = (dst[1245] & 0x07800780u) | 0xF03FE007u;
+  dst[1246] = (dst[1246] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1247] = (dst[1247] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1282] = (dst[1282] & 0xFFC0FFC0u) | 0x001E0001u;
+  dst[1283] = (dst[1283] & 0xFFC0FFC0u) | 0x001F0001u;
+  dst[1284] = (dst[1284] & 0x07800780u) | 0x1038E007u;
+  dst[1285] = (dst[1285] & 0x07800780u) | 0xF03FE007u;
+  dst[1286] = (dst[1286] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1287] = (dst[1287] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1322] = (dst[1322] & 0xFF80FF80u) | 0x003E0001u;
+  dst[1323] = (dst[1323] & 0xFF80FF80u) | 0x003F0001u;
+  dst[1324] = (dst[1324] & 0x07000700u) | 0x1079E006u;
+  dst[1325] = (dst[1325] & 0x07000700u) | 0xF07FE006u;
+  dst[1326] = (dst[1326] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1327] = (dst[1327] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1362] = (dst[1362] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1363] = (dst[1363] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1364] = (dst[1364] & 0x0F000F00u) | 0x207FC000u;
+  dst[1365] = (dst[1365] & 0x0F000F00u) | 0xE07FC000u;
+  dst[1366] = (dst[1366] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1367] = (dst[1367] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1402] = (dst[1402] & 0xF800F800u) | 0x01FF0000u;
+  dst[1403] = (dst[1403] & 0xF800F800u) | 0x01FF0000u;
+  dst[1404] = (dst[1404] & 0x0F000F00u) | 0xE07E0001u;
+  dst[1405] = (dst[1405] & 0x0F000F00u) | 0xE07F0001u;
+  dst[1406] = (dst[1406] & 0x00FF00FFu) | 0x1C00E000u;
+  dst[1407] = (dst[1407] & 0x00FF00FFu) | 0xFC00E000u;
+  dst[1442] = (dst[1442] & 0xE000E000u) | 0x07870078u;
+  dst[1443] = (dst[1443] & 0xE000E000u) | 0x07FF0078u;
+  dst[1444] = (dst[1444] & 0x0F000F00u) | 0xE07F0000u;
+  dst[1445] = (dst[1445] & 0x0F000F00u) | 0xE07F0000u;
+  dst[1446] = (dst[1446] & 0x007F007Fu) | 0x0700F800u;
+  dst[1447] = (dst[1447] & 0x007F007Fu) | 0xFF00F800u;
+  dst[1482] = (dst[1482] & 0xC000C000u) | 0x1F0300FCu;
+  dst[1483] = (dst[1483] & 0xC000C000u) | 0x1FFF00FCu;
+  dst[1484] = (dst[1484] & 0x1F001F00u) | 0xC07F0000u;
+  dst[1485] = (dst[1485] & 0x1F001F00u) | 0xC07F0000u;
+  dst[1486] = (dst[1486] & 0x003F003Fu) | 0xFF800000u;
+  dst[1487] = (dst[1487] & 0x003F003Fu) | 0xFF800000u;
+  dst[1522] = (dst[1522] & 0x80008000u) | 0x3FFF0000u;
+  dst[1523] = (dst[1523] & 0x80008000u) | 0x3FFF0000u;
+  dst[1524] = (dst[1524] & 0x1F801F80u) | 0xC03F0000u;
+  dst[1525] = (dst[1525] & 0x1F801F80u) | 0xC03F0000u;
+  dst[1526] = (dst[1526] & 0x003F003Fu) | 0xFF800000u;
+  dst[1527] = (dst[1527] & 0x003F003Fu) | 0xFF800000u;
+  dst[1562] &= 0x80008000u;
+  dst[1563] &= 0x80008000u;
+  dst[1564] &= 0x1FC01FC0u;
+  dst[1565] &= 0x1FC01FC0u;
+  dst[1566] &= 0x007F007Fu;
+  dst[1567] &= 0x007F007Fu;
+}
+
+static void img_loserboy_f10_s8(uint32_t *dst) {
+  dst[44] &= 0xFF01FF01u;
+  dst[45] &= 0xFF01FF01u;
+  dst[84] = (dst[84] & 0xF800F800u) | 0x00FE0000u;
+  dst[85] = (dst[85] & 0xF800F800u) | 0x00FE0000u;
+  dst[86] &= 0x7FFF7FFFu;
+  dst[87] &= 0x7FFF7FFFu;
+  dst[124] = (dst[124] & 0xE000E000u) | 0x03FF0000u;
+  dst[125] = (dst[125] & 0xE000E000u) | 0x03FF0000u;
+  dst[126] = (dst[126] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[127] = (dst[127] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[164] = (dst[164] & 0xC000C000u) | 0x1FFF0000u;
+  dst[165] = (dst[165] & 0xC000C000u) | 0x1FFF0000u;
+  dst[166] = (dst[166] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[167] = (dst[167] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[204] = (dst[204] & 0x80008000u) | 0x3FFF0000u;
+  dst[205] = (dst[205] & 0x80008000u) | 0x3FFF0000u;
+  dst[206] = (dst[206] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[207] = (dst[207] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[244] = (dst[244] & 0x80008000u) | 0x3FFF0000u;
+  dst[245] = (dst[245] & 0x80008000u) | 0x3FFF0000u;
+  dst[246] = (dst[246] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[247] = (dst[247] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[284] = (dst[284] & 0x80008000u) | 0x31C70000u;
+  dst[285] = (dst[285] & 0x80008000u) | 0x31C70000u;
+  dst[286] = (dst[286] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[287] = (dst[287] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[324] = (dst[324] & 0x80008000u) | 0x2D330010u;
+  dst[325] = (dst[325] & 0x80008000u) | 0x2D330C30u;
+  dst[326] = (dst[326] & 0x0FFF0FFFu) | 0xA0000000u;
+  dst[327] = (dst[327] & 0x0FFF0FFFu) | 0xA0000000u;
+  dst[364] = (dst[364] & 0x80008000u) | 0x1CF10034u;
+  dst[365] = (dst[365] & 0x80008000u) | 0x1C751CF4u;
+  dst[366] = (dst[366] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[367] = (dst[367] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[404] = (dst[404] & 0xC000C000u) | 0x1FF20034u;
+  dst[405] = (dst[405] & 0xC000C000u) | 0x1FF61FF6u;
+  dst[406] = (dst[406] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[407] = (dst[407] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[444] = (dst[444] & 0xC000C000u) | 0x1FFB0035u;
+  dst[445] = (dst[445] & 0xC000C000u) | 0x1FFF1FF7u;
+  dst[446] = (dst[446] & 0x1FFF1FFFu) | 0x60008000u;
+  dst[447] = (dst[447] & 0x1FFF1FFFu) | 0xC000A000u;
+  dst[484] = (dst[484] & 0xC000C000u) | 0x0FFF001Cu;
+  dst[485] = (dst[485] & 0xC000C000u) | 0x0FFF0FFFu;
+  dst[486] = (dst[486] & 0x1FFF1FFFu) | 0xE000C000u;
+  dst[487] = (dst[487] & 0x1FFF1FFFu) | 0xC000E000u;
+  dst[524] = (dst[524] & 0x80008000u) | 0x03FF0000u;
+  dst[525] = (dst[525] & 0x80008000u) | 0x03E703FFu;
+  dst[526] = (dst[526] & 0x1FFF1FFFu) | 0xE0000000u;
+  dst[527] = (dst[527] & 0x1FFF1FFFu) | 0xC000E000u;
+  dst[564] = 0x01FF0800u;
+  dst[565] = 0x6CFB01FFu;
+  dst[566] = (dst[566] & 0x3FFF3FFFu) | 0xC0000000u;
+  dst[567] = (dst[567] & 0x3FFF3FFFu) | 0x8000C000u;
+  dst[602] &= 0xFFFEFFFEu;
+  dst[603] &= 0xFFFEFFFEu;
+  dst[604] = 0x00FF2600u;
+  dst[605] = 0xF63E00FFu;
+  dst[606] = (dst[606] & 0x7FFF7FFFu) | 0x80000000u;
+  dst[607] = (dst[607] & 0x7FFF7FFFu) | 0x00008000u;
+  dst[642] &= 0xFFFCFFFCu;
+  dst[643] &= 0xFFFCFFFCu;
+  dst[644] = (dst[644] & 0x00010001u) | 0x00606400u;
+  dst[645] = (dst[645] & 0x00010001u) | 0xF7000060u;
+  dst[682] = (dst[682] & 0xFFF8FFF8u) | 0x00000001u;
+  dst[683] = (dst[683] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[684] = (dst[684] & 0x00010001u) | 0x00703004u;
+  dst[685] = (dst[685] & 0x00010001u) | 0x30040070u;
+  dst[722] = (dst[722] & 0xFFF0FFF0u) | 0x00010006u;
+  dst[723] = (dst[723] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[724] = (dst[724] & 0x00010001u) | 0x80004084u;
+  dst[725] = (dst[725] & 0x00010001u) | 0xD6840080u;
+  dst[726] &= 0xE3FFE3FFu;
+  dst[727] &= 0xE3FFE3FFu;
+  dst[762] = (dst[762] & 0xFFF0FFF0u) | 0x00030004u;
+  dst[763] = (dst[763] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[764] = 0xC00020F4u;
+  dst[765] = 0xE6F400F0u;
+  dst[766] = (dst[766] & 0x01FF01FFu) | 0x1C000000u;
+  dst[767] = (dst[767] & 0x01FF01FFu) | 0x1C001C00u;
+  dst[802] = (dst[802] & 0xFFF0FFF0u) | 0x00010002u;
+  dst[803] = (dst[803] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[804] = 0xE00000F6u;
+  dst[805] = 0xEEF600F0u;
+  dst[806] = (dst[806] & 0x00FF00FFu) | 0xBE000000u;
+  dst[807] = (dst[807] & 0x00FF00FFu) | 0xBE00BE00u;
+  dst[842] = (dst[842] & 0xFFE0FFE0u) | 0x000C0000u;
+  dst[843] = (dst[843] & 0xFFE0FFE0u) | 0x000C000Cu;
+  dst[844] = 0x4000A1F6u;
+  dst[845] = 0xEDF601F0u;
+  dst[846] = (dst[846] & 0x00FF00FFu) | 0xBE000000u;
+  dst[847] = (dst[847] & 0x00FF00FFu) | 0xBE00BE00u;
+  dst[882] = (dst[882] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[883] = (dst[883] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[884] = 0x000061F6u;
+  dst[885] = 0x6DF601F0u;
+  dst[886] = (dst[886] & 0x00FF00FFu) | 0xDE000000u;
+  dst[887] = (dst[887] & 0x00FF00FFu) | 0xDE00DE00u;
+  dst[922] = (dst[922] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[923] = (dst[923] & 0xFFC0FFC0u) | 0x001E001Eu;
+  dst[924] = (dst[924] & 0x80008000u) | 0x000001F6u;
+  dst[925] = (dst[925] & 0x80008000u) | 0x1DF601F0u;
+  dst[926] = (dst[926] & 0x00FF00FFu) | 0x1E000000u;
+  dst[927] = (dst[927] & 0x00FF00FFu) | 0x1E001E00u;
+  dst[962] = (dst[962] & 0xFFC1FFC1u) | 0x001C0000u;
+  dst[963] = (dst[963] & 0xFFC1FFC1u) | 0x001C001Cu;
+  dst[964] = (dst[964] & 0xC000C000u) | 0x000001FAu;
+  dst[965] = (dst[965] & 0xC000C000u) | 0x1DFB01F8u;
+  dst[966] &= 0x61FF61FFu;
+  dst[967] &= 0x61FF61FFu;
+  dst[1002] = (dst[1002] & 0xFF80FF80u) | 0x003E0000u;
+  dst[1003] = (dst[1003] & 0xFF80FF80u) | 0x003E003Eu;
+  dst[1004] = (dst[1004] & 0x80008000u) | 0x000003FAu;
+  dst[1005] = (dst[1005] & 0x80008000u) | 0x3BFB03F8u;
+  dst[1006] &= 0x7FFF7FFFu;
+  dst[1007] &= 0x7FFF7FFFu;
+  dst[1042] = (dst[1042] & 0xFF80FF80u) | 0x003E0000u;
+  dst[1043] = (dst[1043] & 0xFF80FF80u) | 0x003E003Eu;
+  dst[1044] = 0x000003FAu;
+  dst[1045] = 0x7BFB03F8u;
+  dst[1046] &= 0x7FFF7FFFu;
+  dst[1047] &= 0x7FFF7FFFu;
+  dst[1082] = (dst[1082] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1083] = (dst[1083] & 0xFF80FF80u) | 0x003F003Fu;
+  dst[1084] = 0x000007F8u;
+  dst[1085] = 0x77FB07F8u;
+  dst[1086] &= 0x3FFF3FFFu;
+  dst[1087] = (dst[1087] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1122] = (dst[1122] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[1123] = (dst[1123] & 0xFFC0FFC0u) | 0x001E001Eu;
+  dst[1124] = 0x00000FFCu;
+  dst[1125] = 0x0FFC0FFCu;
+  dst[1126] &= 0x3FFF3FFFu;
+  dst[1127] &= 0x3FFF3FFFu;
+  dst[1162] = (dst[1162] & 0xFFE0FFE0u) | 0x00010000u;
+  dst[1163] = (dst[1163] & 0xFFE0FFE0u) | 0x00010000u;
+  dst[1164] = 0xE00307F0u;
+  dst[1165] = 0xE7F307F0u;
+  dst[1166] = (dst[1166] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1167] = (dst[1167] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1202] = (dst[1202] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1203] = (dst[1203] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1204] = 0x980E6001u;
+  dst[1205] = 0xF80F6001u;
+  dst[1206] = (dst[1206] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1207] = (dst[1207] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1242] = (dst[1242] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1243] = (dst[1243] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1244] = (dst[1244] & 0x03C003C0u) | 0x081CF003u;
+  dst[1245] = (dst[1245] & 0x03C003C0u) | 0xF81FF003u;
+  dst[1246] = (dst[1246] & 0x1FFF1FFFu) | 0x40008000u;
+  dst[1247] = (dst[1247] & 0x1FFF1FFFu) | 0xC0008000u;
+  dst[1282] = (dst[1282] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1283] = (dst[1283] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1284] = (dst[1284] & 0x03C003C0u) | 0x081CF003u;
+  dst[1285] = (dst[1285] & 0x03C003C0u) | 0xF81FF003u;
+  dst[1286] = (dst[1286] & 0x0FFF0FFFu) | 0x60008000u;
+  dst[1287] = (dst[1287] & 0x0FFF0FFFu) | 0xE0008000u;
+  dst[1322] = (dst[1322] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1323] = (dst[1323] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1324] = (dst[1324] & 0x03800380u) | 0x083CF003u;
+  dst[1325] = (dst[1325] & 0x03800380u) | 0xF83FF003u;
+  dst[1326] = (dst[1326] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1327] = (dst[1327] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1362] = (dst[1362] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1363] = (dst[1363] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1364] = (dst[1364] & 0x07800780u) | 0x903F6000u;
+  dst[1365] = (dst[1365] & 0x07800780u) | 0xF03F6000u;
+  dst[1366] = (dst[1366] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1367] = (dst[1367] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1402] = (dst[1402] & 0xFC00FC00u) | 0x00FF0000u;
+  dst[1403] = (dst[1403] & 0xFC00FC00u) | 0x00FF0000u;
+  dst[1404] = (dst[1404] & 0x07800780u) | 0xF03F0000u;
+  dst[1405] = (dst[1405] & 0x07800780u) | 0xF03F0000u;
+  dst[1406] = (dst[1406] & 0x007F007Fu) | 0x0E00F000u;
+  dst[1407] = (dst[1407] & 0x007F007Fu) | 0xFE00F000u;
+  dst[1442] = (dst[1442] & 0xF000F000u) | 0x03C3003Cu;
+  dst[1443] = (dst[1443] & 0xF000F000u) | 0x03FF003Cu;
+  dst[1444] = (dst[1444] & 0x07800780u) | 0xF03F0000u;
+  dst[1445] = (dst[1445] & 0x07800780u) | 0xF03F0000u;
+  dst[1446] = (dst[1446] & 0x003F003Fu) | 0x83807C00u;
+  dst[1447] = (dst[1447] & 0x003F003Fu) | 0xFF807C00u;
+  dst[1482] = (dst[1482] & 0xE000E000u) | 0x0F81007Eu;
+  dst[1483] = (dst[1483] & 0xE000E000u) | 0x0FFF007Eu;
+  dst[1484] = (dst[1484] & 0x0F800F80u) | 0xE03F0000u;
+  dst[1485] = (dst[1485] & 0x0F800F80u) | 0xE03F0000u;
+  dst[1486] = (dst[1486] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1487] = (dst[1487] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1522] = (dst[1522] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1523] = (dst[1523] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1524] = (dst[1524] & 0x0FC00FC0u) | 0xE01F0000u;
+  dst[1525] = (dst[1525] & 0x0FC00FC0u) | 0xE01F0000u;
+  dst[1526] = (dst[1526] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1527] = (dst[1527] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1562] &= 0xC000C000u;
+  dst[1563] &= 0xC000C000u;
+  dst[1564] &= 0x0FE00FE0u;
+  dst[1565] &= 0x0FE00FE0u;
+  dst[1566] &= 0x003F003Fu;
+  dst[1567] &= 0x003F003Fu;
+}
+
+static void img_loserboy_f10_s9(uint32_t *dst) {
+  dst[44] &= 0xFF80FF80u;
+  dst[45] &= 0xFF80FF80u;
+  dst[84] = (dst[84] & 0xFC00FC00u) | 0x007F0000u;
+  dst[85] = (dst[85] & 0xFC00FC00u) | 0x007F0000u;
+  dst[86] &= 0x3FFF3FFFu;
+  dst[87] &= 0x3FFF3FFFu;
+  dst[124] = (dst[124] & 0xF000F000u) | 0x01FF0000u;
+  dst[125] = (dst[125] & 0xF000F000u) | 0x01FF0000u;
+  dst[126] = (dst[126] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[127] = (dst[127] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[164] = (dst[164] & 0xE000E000u) | 0x0FFF0000u;
+  dst[165] = (dst[165] & 0xE000E000u) | 0x0FFF0000u;
+  dst[166] = (dst[166] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[167] = (dst[167] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[204] = (dst[204] & 0xC000C000u) | 0x1FFF0000u;
+  dst[205] = (dst[205] & 0xC000C000u) | 0x1FFF0000u;
+  dst[206] = (dst[206] & 0x07FF07FFu) | 0xF0000000u;
+  dst[207] = (dst[207] & 0x07FF07FFu) | 0xF0000000u;
+  dst[244] = (dst[244] & 0xC000C000u) | 0x1FFF0000u;
+  dst[245] = (dst[245] & 0xC000C000u) | 0x1FFF0000u;
+  dst[246] = (dst[246] & 0x07FF07FFu) | 0xF0000000u;
+  dst[247] = (dst[247] & 0x07FF07FFu) | 0xF0000000u;
+  dst[284] = (dst[284] & 0xC000C000u) | 0x18E30000u;
+  dst[285] = (dst[285] & 0xC000C000u) | 0x18E30000u;
+  dst[286] = (dst[286] & 0x07FF07FFu) | 0xF0000000u;
+  dst[287] = (dst[287] & 0x07FF07FFu) | 0xF0000000u;
+  dst[324] = (dst[324] & 0xC000C000u) | 0x16990008u;
+  dst[325] = (dst[325] & 0xC000C000u) | 0x16990618u;
+  dst[326] = (dst[326] & 0x07FF07FFu) | 0xD0000000u;
+  dst[327] = (dst[327] & 0x07FF07FFu) | 0xD0000000u;
+  dst[364] = (dst[364] & 0xC000C000u) | 0x0E78001Au;
+  dst[365] = (dst[365] & 0xC000C000u) | 0x0E3A0E7Au;
+  dst[366] = (dst[366] & 0x0FFF0FFFu) | 0xA0000000u;
+  dst[367] = (dst[367] & 0x0FFF0FFFu) | 0xA0000000u;
+  dst[404] = (dst[404] & 0xE000E000u) | 0x0FF9001Au;
+  dst[405] = (dst[405] & 0xE000E000u) | 0x0FFB0FFBu;
+  dst[406] = (dst[406] & 0x0FFF0FFFu) | 0x20000000u;
+  dst[407] = (dst[407] & 0x0FFF0FFFu) | 0x20000000u;
+  dst[444] = (dst[444] & 0xE000E000u) | 0x0FFD001Au;
+  dst[445] = (dst[445] & 0xE000E000u) | 0x0FFF0FFBu;
+  dst[446] = (dst[446] & 0x0FFF0FFFu) | 0xB000C000u;
+  dst[447] = (dst[447] & 0x0FFF0FFFu) | 0xE000D000u;
+  dst[484] = (dst[484] & 0xE000E000u) | 0x07FF000Eu;
+  dst[485] = (dst[485] & 0xE000E000u) | 0x07FF07FFu;
+  dst[486] = (dst[486] & 0x0FFF0FFFu) | 0xF0006000u;
+  dst[487] = (dst[487] & 0x0FFF0FFFu) | 0xE000F000u;
+  dst[524] = (dst[524] & 0xC000C000u) | 0x01FF0000u;
+  dst[525] = (dst[525] & 0xC000C000u) | 0x01F301FFu;
+  dst[526] = (dst[526] & 0x0FFF0FFFu) | 0xF0000000u;
+  dst[527] = (dst[527] & 0x0FFF0FFFu) | 0xE000F000u;
+  dst[564] = (dst[564] & 0x80008000u) | 0x00FF0400u;
+  dst[565] = (dst[565] & 0x80008000u) | 0x367D00FFu;
+  dst[566] = (dst[566] & 0x1FFF1FFFu) | 0xE0000000u;
+  dst[567] = (dst[567] & 0x1FFF1FFFu) | 0xC000E000u;
+  dst[604] = 0x007F1300u;
+  dst[605] = 0x7B1F007Fu;
+  dst[606] = (dst[606] & 0x3FFF3FFFu) | 0xC0000000u;
+  dst[607] = (dst[607] & 0x3FFF3FFFu) | 0x0000C000u;
+  dst[642] &= 0xFFFEFFFEu;
+  dst[643] &= 0xFFFEFFFEu;
+  dst[644] = 0x00303200u;
+  dst[645] = 0x7B800030u;
+  dst[682] &= 0xFFFCFFFCu;
+  dst[683] &= 0xFFFCFFFCu;
+  dst[684] = 0x00389802u;
+  dst[685] = 0x98020038u;
+  dst[722] = (dst[722] & 0xFFF8FFF8u) | 0x00000003u;
+  dst[723] = (dst[723] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[724] = 0xC0002042u;
+  dst[725] = 0xEB420040u;
+  dst[726] &= 0xF1FFF1FFu;
+  dst[727] &= 0xF1FFF1FFu;
+  dst[762] = (dst[762] & 0xFFF8FFF8u) | 0x00010002u;
+  dst[763] = (dst[763] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[764] = 0xE000107Au;
+  dst[765] = 0xF37A0078u;
+  dst[766] = (dst[766] & 0x00FF00FFu) | 0x0E000000u;
+  dst[767] = (dst[767] & 0x00FF00FFu) | 0x0E000E00u;
+  dst[802] = (dst[802] & 0xFFF8FFF8u) | 0x00000001u;
+  dst[803] = (dst[803] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[804] = 0xF000007Bu;
+  dst[805] = 0xF77B0078u;
+  dst[806] = (dst[806] & 0x007F007Fu) | 0x5F000000u;
+  dst[807] = (dst[807] & 0x007F007Fu) | 0x5F005F00u;
+  dst[842] = (dst[842] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[843] = (dst[843] & 0xFFF0FFF0u) | 0x00060006u;
+  dst[844] = 0x200050FBu;
+  dst[845] = 0x76FB00F8u;
+  dst[846] = (dst[846] & 0x007F007Fu) | 0x5F000000u;
+  dst[847] = (dst[847] & 0x007F007Fu) | 0x5F005F00u;
+  dst[882] = (dst[882] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[883] = (dst[883] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[884] = 0x800030FBu;
+  dst[885] = 0xB6FB80F8u;
+  dst[886] = (dst[886] & 0x007F007Fu) | 0x6F000000u;
+  dst[887] = (dst[887] & 0x007F007Fu) | 0x6F006F00u;
+  dst[922] = (dst[922] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[923] = (dst[923] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[924] = (dst[924] & 0x40004000u) | 0x000000FBu;
+  dst[925] = (dst[925] & 0x40004000u) | 0x0EFB00F8u;
+  dst[926] = (dst[926] & 0x007F007Fu) | 0x0F000000u;
+  dst[927] = (dst[927] & 0x007F007Fu) | 0x0F000F00u;
+  dst[962] = (dst[962] & 0xFFE0FFE0u) | 0x000E0000u;
+  dst[963] = (dst[963] & 0xFFE0FFE0u) | 0x000E000Eu;
+  dst[964] = (dst[964] & 0xE000E000u) | 0x000000FDu;
+  dst[965] = (dst[965] & 0xE000E000u) | 0x0EFD00FCu;
+  dst[966] &= 0x30FF30FFu;
+  dst[967] = (dst[967] & 0x30FF30FFu) | 0x80000000u;
+  dst[1002] = (dst[1002] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1003] = (dst[1003] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[1004] = (dst[1004] & 0x40004000u) | 0x000001FDu;
+  dst[1005] = (dst[1005] & 0x40004000u) | 0x1DFD01FCu;
+  dst[1006] &= 0x3FFF3FFFu;
+  dst[1007] = (dst[1007] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1042] = (dst[1042] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1043] = (dst[1043] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[1044] = 0x000001FDu;
+  dst[1045] = 0x3DFD01FCu;
+  dst[1046] &= 0x3FFF3FFFu;
+  dst[1047] = (dst[1047] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1082] = (dst[1082] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1083] = (dst[1083] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[1084] = 0x800003FCu;
+  dst[1085] = 0xBBFD83FCu;
+  dst[1086] &= 0x1FFF1FFFu;
+  dst[1087] = (dst[1087] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1122] = (dst[1122] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1123] = (dst[1123] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[1124] = 0x000007FEu;
+  dst[1125] = 0x07FE07FEu;
+  dst[1126] &= 0x1FFF1FFFu;
+  dst[1127] &= 0x1FFF1FFFu;
+  dst[1162] &= 0xFFF0FFF0u;
+  dst[1163] &= 0xFFF0FFF0u;
+  dst[1164] = 0xF00103F8u;
+  dst[1165] = 0xF3F903F8u;
+  dst[1166] = (dst[1166] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1167] = (dst[1167] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1202] = (dst[1202] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1203] = (dst[1203] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1204] = 0xCC073000u;
+  dst[1205] = 0xFC073000u;
+  dst[1206] = (dst[1206] & 0x0FFF0FFFu) | 0x60008000u;
+  dst[1207] = (dst[1207] & 0x0FFF0FFFu) | 0xE0008000u;
+  dst[1242] = (dst[1242] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1243] = (dst[1243] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1244] = (dst[1244] & 0x01E001E0u) | 0x840E7801u;
+  dst[1245] = (dst[1245] & 0x01E001E0u) | 0xFC0F7801u;
+  dst[1246] = (dst[1246] & 0x0FFF0FFFu) | 0x2000C000u;
+  dst[1247] = (dst[1247] & 0x0FFF0FFFu) | 0xE000C000u;
+  dst[1282] = (dst[1282] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1283] = (dst[1283] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1284] = (dst[1284] & 0x01E001E0u) | 0x840E7801u;
+  dst[1285] = (dst[1285] & 0x01E001E0u) | 0xFC0F7801u;
+  dst[1286] = (dst[1286] & 0x07FF07FFu) | 0x3000C000u;
+  dst[1287] = (dst[1287] & 0x07FF07FFu) | 0xF000C000u;
+  dst[1322] = (dst[1322] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1323] = (dst[1323] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1324] = (dst[1324] & 0x01C001C0u) | 0x841E7801u;
+  dst[1325] = (dst[1325] & 0x01C001C0u) | 0xFC1F7801u;
+  dst[1326] = (dst[1326] & 0x03FF03FFu) | 0x70008000u;
+  dst[1327] = (dst[1327] & 0x03FF03FFu) | 0xF0008000u;
+  dst[1362] = (dst[1362] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1363] = (dst[1363] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1364] = (dst[1364] & 0x03C003C0u) | 0xC81F3000u;
+  dst[1365] = (dst[1365] & 0x03C003C0u) | 0xF81F3000u;
+  dst[1366] = (dst[1366] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1367] = (dst[1367] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1402] = (dst[1402] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1403] = (dst[1403] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1404] = (dst[1404] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1405] = (dst[1405] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1406] = (dst[1406] & 0x003F003Fu) | 0x87007800u;
+  dst[1407] = (dst[1407] & 0x003F003Fu) | 0xFF007800u;
+  dst[1442] = (dst[1442] & 0xF800F800u) | 0x01E1001Eu;
+  dst[1443] = (dst[1443] & 0xF800F800u) | 0x01FF001Eu;
+  dst[1444] = (dst[1444] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1445] = (dst[1445] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1446] = (dst[1446] & 0x001F001Fu) | 0xC1C03E00u;
+  dst[1447] = (dst[1447] & 0x001F001Fu) | 0xFFC03E00u;
+  dst[1482] = (dst[1482] & 0xF000F000u) | 0x07C0003Fu;
+  dst[1483] = (dst[1483] & 0xF000F000u) | 0x07FF003Fu;
+  dst[1484] = (dst[1484] & 0x07C007C0u) | 0xF01F0000u;
+  dst[1485] = (dst[1485] & 0x07C007C0u) | 0xF01F0000u;
+  dst[1486] = (dst[1486] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1487] = (dst[1487] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1522] = (dst[1522] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1523] = (dst[1523] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1524] = (dst[1524] & 0x07E007E0u) | 0xF00F0000u;
+  dst[1525] = (dst[1525] & 0x07E007E0u) | 0xF00F0000u;
+  dst[1526] = (dst[1526] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1527] = (dst[1527] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1562] &= 0xE000E000u;
+  dst[1563] &= 0xE000E000u;
+  dst[1564] &= 0x07F007F0u;
+  dst[1565] &= 0x07F007F0u;
+  dst[1566] &= 0x001F001Fu;
+  dst[1567] &= 0x001F001Fu;
+}
+
+static void img_loserboy_f10_s10(uint32_t *dst) {
+  dst[44] &= 0xFFC0FFC0u;
+  dst[45] &= 0xFFC0FFC0u;
+  dst[46] &= 0x7FFF7FFFu;
+  dst[47] &= 0x7FFF7FFFu;
+  dst[84] = (dst[84] & 0xFE00FE00u) | 0x003F0000u;
+  dst[85] = (dst[85] & 0xFE00FE00u) | 0x003F0000u;
+  dst[86] = (dst[86] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[87] = (dst[87] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[124] = (dst[124] & 0xF800F800u) | 0x00FF0000u;
+  dst[125] = (dst[125] & 0xF800F800u) | 0x00FF0000u;
+  dst[126] = (dst[126] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[127] = (dst[127] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[164] = (dst[164] & 0xF000F000u) | 0x07FF0000u;
+  dst[165] = (dst[165] & 0xF000F000u) | 0x07FF0000u;
+  dst[166] = (dst[166] & 0x07FF07FFu) | 0xF0000000u;
+  dst[167] = (dst[167] & 0x07FF07FFu) | 0xF0000000u;
+  dst[204] = (dst[204] & 0xE000E000u) | 0x0FFF0000u;
+  dst[205] = (dst[205] & 0xE000E000u) | 0x0FFF0000u;
+  dst[206] = (dst[206] & 0x03FF03FFu) | 0xF8000000u;
+  dst[207] = (dst[207] & 0x03FF03FFu) | 0xF8000000u;
+  dst[244] = (dst[244] & 0xE000E000u) | 0x0FFF0000u;
+  dst[245] = (dst[245] & 0xE000E000u) | 0x0FFF0000u;
+  dst[246] = (dst[246] & 0x03FF03FFu) | 0xF8000000u;
+  dst[247] = (dst[247] & 0x03FF03FFu) | 0xF8000000u;
+  dst[284] = (dst[284] & 0xE000E000u) | 0x0C710000u;
+  dst[285] = (dst[285] & 0xE000E000u) | 0x0C710000u;
+  dst[286] = (dst[286] & 0x03FF03FFu) | 0xF8000000u;
+  dst[287] = (dst[287] & 0x03FF03FFu) | 0xF8000000u;
+  dst[324] = (dst[324] & 0xE000E000u) | 0x0B4C0004u;
+  dst[325] = (dst[325] & 0xE000E000u) | 0x0B4C030Cu;
+  dst[326] = (dst[326] & 0x03FF03FFu) | 0xE8000000u;
+  dst[327] = (dst[327] & 0x03FF03FFu) | 0xE8000000u;
+  dst[364] = (dst[364] & 0xE000E000u) | 0x073C000Du;
+  dst[365] = (dst[365] & 0xE000E000u) | 0x071D073Du;
+  dst[366] = (dst[366] & 0x07FF07FFu) | 0x50000000u;
+  dst[367] = (dst[367] & 0x07FF07FFu) | 0x50000000u;
+  dst[404] = (dst[404] & 0xF000F000u) | 0x07FC000Du;
+  dst[405] = (dst[405] & 0xF000F000u) | 0x07FD07FDu;
+  dst[406] = (dst[406] & 0x07FF07FFu) | 0x90000000u;
+  dst[407] = (dst[407] & 0x07FF07FFu) | 0x90008000u;
+  dst[444] = (dst[444] & 0xF000F000u) | 0x07FE000Du;
+  dst[445] = (dst[445] & 0xF000F000u) | 0x07FF07FDu;
+  dst[446] = (dst[446] & 0x07FF07FFu) | 0xD8006000u;
+  dst[447] = (dst[447] & 0x07FF07FFu) | 0xF000E800u;
+  dst[484] = (dst[484] & 0xF000F000u) | 0x03FF0007u;
+  dst[485] = (dst[485] & 0xF000F000u) | 0x03FF03FFu;
+  dst[486] = (dst[486] & 0x07FF07FFu) | 0xF8003000u;
+  dst[487] = (dst[487] & 0x07FF07FFu) | 0xF000F800u;
+  dst[524] = (dst[524] & 0xE000E000u) | 0x00FF0000u;
+  dst[525] = (dst[525] & 0xE000E000u) | 0x00F900FFu;
+  dst[526] = (dst[526] & 0x07FF07FFu) | 0xF8000000u;
+  dst[527] = (dst[527] & 0x07FF07FFu) | 0xF000F800u;
+  dst[564] = (dst[564] & 0xC000C000u) | 0x007F0200u;
+  dst[565] = (dst[565] & 0xC000C000u) | 0x1B3E007Fu;
+  dst[566] = (dst[566] & 0x0FFF0FFFu) | 0xF0000000u;
+  dst[567] = (dst[567] & 0x0FFF0FFFu) | 0xE000F000u;
+  dst[604] = (dst[604] & 0x80008000u) | 0x003F0980u;
+  dst[605] = (dst[605] & 0x80008000u) | 0x3D8F003Fu;
+  dst[606] = (dst[606] & 0x1FFF1FFFu) | 0xE0000000u;
+  dst[607] = (dst[607] & 0x1FFF1FFFu) | 0x8000E000u;
+  dst[644] = 0x00181900u;
+  dst[645] = 0x3DC00018u;
+  dst[646] &= 0x7FFF7FFFu;
+  dst[647] &= 0x7FFF7FFFu;
+  dst[682] &= 0xFFFEFFFEu;
+  dst[683] &= 0xFFFEFFFEu;
+  dst[684] = 0x001C4C01u;
+  dst[685] = 0x4C01001Cu;
+  dst[686] &= 0x7FFF7FFFu;
+  dst[687] &= 0x7FFF7FFFu;
+  dst[722] = (dst[722] & 0xFFFCFFFCu) | 0x00000001u;
+  dst[723] = (dst[723] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[724] = 0x60009021u;
+  dst[725] = 0xF5A10020u;
+  dst[726] &= 0x78FF78FFu;
+  dst[727] &= 0x78FF78FFu;
+  dst[762] = (dst[762] & 0xFFFCFFFCu) | 0x00000001u;
+  dst[763] = (dst[763] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[764] = 0xF000083Du;
+  dst[765] = 0xF9BD003Cu;
+  dst[766] = (dst[766] & 0x007F007Fu) | 0x07000000u;
+  dst[767] = (dst[767] & 0x007F007Fu) | 0x07000700u;
+  dst[802] &= 0xFFFCFFFCu;
+  dst[803] &= 0xFFFCFFFCu;
+  dst[804] = 0x7800803Du;
+  dst[805] = 0xFBBD003Cu;
+  dst[806] = (dst[806] & 0x003F003Fu) | 0x2F808000u;
+  dst[807] = (dst[807] & 0x003F003Fu) | 0xAF802F80u;
+  dst[842] = (dst[842] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[843] = (dst[843] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[844] = 0x1000287Du;
+  dst[845] = 0x3B7D007Cu;
+  dst[846] = (dst[846] & 0x003F003Fu) | 0x2F808000u;
+  dst[847] = (dst[847] & 0x003F003Fu) | 0xAF802F80u;
+  dst[882] = (dst[882] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[883] = (dst[883] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[884] = 0xC000187Du;
+  dst[885] = 0xDB7DC07Cu;
+  dst[886] = (dst[886] & 0x003F003Fu) | 0x37808000u;
+  dst[887] = (dst[887] & 0x003F003Fu) | 0xB7803780u;
+  dst[922] = (dst[922] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[923] = (dst[923] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[924] = (dst[924] & 0x20002000u) | 0x8000007Du;
+  dst[925] = (dst[925] & 0x20002000u) | 0x877D807Cu;
+  dst[926] = (dst[926] & 0x003F003Fu) | 0x07808000u;
+  dst[927] = (dst[927] & 0x003F003Fu) | 0x87800780u;
+  dst[962] = (dst[962] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[963] = (dst[963] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[964] = (dst[964] & 0x70007000u) | 0x0000007Eu;
+  dst[965] = (dst[965] & 0x70007000u) | 0x077E007Eu;
+  dst[966] = (dst[966] & 0x187F187Fu) | 0x00008000u;
+  dst[967] = (dst[967] & 0x187F187Fu) | 0xC0000000u;
+  dst[1002] = (dst[1002] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1003] = (dst[1003] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[1004] = (dst[1004] & 0x20002000u) | 0x800000FEu;
+  dst[1005] = (dst[1005] & 0x20002000u) | 0x8EFE80FEu;
+  dst[1006] = (dst[1006] & 0x1FFF1FFFu) | 0x00008000u;
+  dst[1007] = (dst[1007] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1042] = (dst[1042] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1043] = (dst[1043] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[1044] = 0x800000FEu;
+  dst[1045] = 0x9EFE80FEu;
+  dst[1046] = (dst[1046] & 0x1FFF1FFFu) | 0x00008000u;
+  dst[1047] = (dst[1047] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1082] = (dst[1082] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1083] = (dst[1083] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[1084] = 0xC00001FEu;
+  dst[1085] = 0xDDFEC1FEu;
+  dst[1086] &= 0x0FFF0FFFu;
+  dst[1087] = (dst[1087] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1122] = (dst[1122] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1123] = (dst[1123] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[1124] = 0x800003FFu;
+  dst[1125] = 0x83FF83FFu;
+  dst[1126] &= 0x0FFF0FFFu;
+  dst[1127] &= 0x0FFF0FFFu;
+  dst[1162] &= 0xFFF8FFF8u;
+  dst[1163] &= 0xFFF8FFF8u;
+  dst[1164] = 0x780001FCu;
+  dst[1165] = 0x79FC01FCu;
+  dst[1166] = (dst[1166] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1167] = (dst[1167] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1202] &= 0xFFFEFFFEu;
+  dst[1203] &= 0xFFFEFFFEu;
+  dst[1204] = 0xE6031800u;
+  dst[1205] = 0xFE031800u;
+  dst[1206] = (dst[1206] & 0x07FF07FFu) | 0xB0004000u;
+  dst[1207] = (dst[1207] & 0x07FF07FFu) | 0xF0004000u;
+  dst[1242] = (dst[1242] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1243] = (dst[1243] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1244] = (dst[1244] & 0x00F000F0u) | 0xC2073C00u;
+  dst[1245] = (dst[1245] & 0x00F000F0u) | 0xFE073C00u;
+  dst[1246] = (dst[1246] & 0x07FF07FFu) | 0x1000E000u;
+  dst[1247] = (dst[1247] & 0x07FF07FFu) | 0xF000E000u;
+  dst[1282] = (dst[1282] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1283] = (dst[1283] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1284] = (dst[1284] & 0x00F000F0u) | 0xC2073C00u;
+  dst[1285] = (dst[1285] & 0x00F000F0u) | 0xFE073C00u;
+  dst[1286] = (dst[1286] & 0x03FF03FFu) | 0x1800E000u;
+  dst[1287] = (dst[1287] & 0x03FF03FFu) | 0xF800E000u;
+  dst[1322] = (dst[1322] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1323] = (dst[1323] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1324] = (dst[1324] & 0x00E000E0u) | 0xC20F3C00u;
+  dst[1325] = (dst[1325] & 0x00E000E0u) | 0xFE0F3C00u;
+  dst[1326] = (dst[1326] & 0x01FF01FFu) | 0x3800C000u;
+  dst[1327] = (dst[1327] & 0x01FF01FFu) | 0xF800C000u;
+  dst[1362] = (dst[1362] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1363] = (dst[1363] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1364] = (dst[1364] & 0x01E001E0u) | 0xE40F1800u;
+  dst[1365] = (dst[1365] & 0x01E001E0u) | 0xFC0F1800u;
+  dst[1366] = (dst[1366] & 0x007F007Fu) | 0xFE000000u;
+  dst[1367] = (dst[1367] & 0x007F007Fu) | 0xFE000000u;
+  dst[1402] = (dst[1402] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1403] = (dst[1403] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1404] = (dst[1404] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1405] = (dst[1405] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1406] = (dst[1406] & 0x001F001Fu) | 0xC3803C00u;
+  dst[1407] = (dst[1407] & 0x001F001Fu) | 0xFF803C00u;
+  dst[1442] = (dst[1442] & 0xFC00FC00u) | 0x00F0000Fu;
+  dst[1443] = (dst[1443] & 0xFC00FC00u) | 0x00FF000Fu;
+  dst[1444] = (dst[1444] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1445] = (dst[1445] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1446] = (dst[1446] & 0x000F000Fu) | 0xE0E01F00u;
+  dst[1447] = (dst[1447] & 0x000F000Fu) | 0xFFE01F00u;
+  dst[1482] = (dst[1482] & 0xF800F800u) | 0x03E0001Fu;
+  dst[1483] = (dst[1483] & 0xF800F800u) | 0x03FF001Fu;
+  dst[1484] = (dst[1484] & 0x03E003E0u) | 0x780F8000u;
+  dst[1485] = (dst[1485] & 0x03E003E0u) | 0xF80F8000u;
+  dst[1486] = (dst[1486] & 0x00070007u) | 0xFFF00000u;
+  dst[1487] = (dst[1487] & 0x00070007u) | 0xFFF00000u;
+  dst[1522] = (dst[1522] & 0xF000F000u) | 0x07FF0000u;
+  dst[1523] = (dst[1523] & 0xF000F000u) | 0x07FF0000u;
+  dst[1524] = (dst[1524] & 0x03F003F0u) | 0xF8070000u;
+  dst[1525] = (dst[1525] & 0x03F003F0u) | 0xF8070000u;
+  dst[1526] = (dst[1526] & 0x00070007u) | 0xFFF00000u;
+  dst[1527] = (dst[1527] & 0x00070007u) | 0xFFF00000u;
+  dst[1562] &= 0xF000F000u;
+  dst[1563] &= 0xF000F000u;
+  dst[1564] &= 0x03F803F8u;
+  dst[1565] &= 0x03F803F8u;
+  dst[1566] &= 0x000F000Fu;
+  dst[1567] &= 0x000F000Fu;
+}
+
+static void img_loserboy_f10_s11(uint32_t *dst) {
+  dst[44] &= 0xFFE0FFE0u;
+  dst[45] &= 0xFFE0FFE0u;
+  dst[46] &= 0x3FFF3FFFu;
+  dst[47] &= 0x3FFF3FFFu;
+  dst[84] = (dst[84] & 0xFF00FF00u) | 0x001F0000u;
+  dst[85] = (dst[85] & 0xFF00FF00u) | 0x001F0000u;
+  dst[86] = (dst[86] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[87] = (dst[87] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[124] = (dst[124] & 0xFC00FC00u) | 0x007F0000u;
+  dst[125] = (dst[125] & 0xFC00FC00u) | 0x007F0000u;
+  dst[126] = (dst[126] & 0x07FF07FFu) | 0xF0000000u;
+  dst[127] = (dst[127] & 0x07FF07FFu) | 0xF0000000u;
+  dst[164] = (dst[164] & 0xF800F800u) | 0x03FF0000u;
+  dst[165] = (dst[165] & 0xF800F800u) | 0x03FF0000u;
+  dst[166] = (dst[166] & 0x03FF03FFu) | 0xF8000000u;
+  dst[167] = (dst[167] & 0x03FF03FFu) | 0xF8000000u;
+  dst[204] = (dst[204] & 0xF000F000u) | 0x07FF0000u;
+  dst[205] = (dst[205] & 0xF000F000u) | 0x07FF0000u;
+  dst[206] = (dst[206] & 0x01FF01FFu) | 0xFC000000u;
+  dst[207] = (dst[207] & 0x01FF01FFu) | 0xFC000000u;
+  dst[244] = (dst[244] & 0xF000F000u) | 0x07FF0000u;
+  dst[245] = (dst[245] & 0xF000F000u) | 0x07FF0000u;
+  dst[246] = (dst[246] & 0x01FF01FFu) | 0xFC000000u;
+  dst[247] = (dst[247] & 0x01FF01FFu) | 0xFC000000u;
+  dst[284] = (dst[284] & 0xF000F000u) | 0x06380000u;
+  dst[285] = (dst[285] & 0xF000F000u) | 0x06380000u;
+  dst[286] = (dst[286] & 0x01FF01FFu) | 0xFC000000u;
+  dst[287] = (dst[287] & 0x01FF01FFu) | 0xFC000000u;
+  dst[324] = (dst[324] & 0xF000F000u) | 0x05A60002u;
+  dst[325] = (dst[325] & 0xF000F000u) | 0x05A60186u;
+  dst[326] = (dst[326] & 0x01FF01FFu) | 0x74000000u;
+  dst[327] = (dst[327] & 0x01FF01FFu) | 0x74000000u;
+  dst[364] = (dst[364] & 0xF000F000u) | 0x039E0006u;
+  dst[365] = (dst[365] & 0xF000F000u) | 0x038E039Eu;
+  dst[366] = (dst[366] & 0x03FF03FFu) | 0x28008000u;
+  dst[367] = (dst[367] & 0x03FF03FFu) | 0xA8008000u;
+  dst[404] = (dst[404] & 0xF800F800u) | 0x03FE0006u;
+  dst[405] = (dst[405] & 0xF800F800u) | 0x03FE03FEu;
+  dst[406] = (dst[406] & 0x03FF03FFu) | 0x48008000u;
+  dst[407] = (dst[407] & 0x03FF03FFu) | 0xC800C000u;
+  dst[444] = (dst[444] & 0xF800F800u) | 0x03FF0006u;
+  dst[445] = (dst[445] & 0xF800F800u) | 0x03FF03FEu;
+  dst[446] = (dst[446] & 0x03FF03FFu) | 0x6C00B000u;
+  dst[447] = (dst[447] & 0x03FF03FFu) | 0xF800F400u;
+  dst[484] = (dst[484] & 0xF800F800u) | 0x01FF0003u;
+  dst[485] = (dst[485] & 0xF800F800u) | 0x01FF01FFu;
+  dst[486] = (dst[486] & 0x03FF03FFu) | 0xFC009800u;
+  dst[487] = (dst[487] & 0x03FF03FFu) | 0xF800FC00u;
+  dst[524] = (dst[524] & 0xF000F000u) | 0x007F0000u;
+  dst[525] = (dst[525] & 0xF000F000u) | 0x007C007Fu;
+  dst[526] = (dst[526] & 0x03FF03FFu) | 0xFC000000u;
+  dst[527] = (dst[527] & 0x03FF03FFu) | 0xF800FC00u;
+  dst[564] = (dst[564] & 0xE000E000u) | 0x003F0100u;
+  dst[565] = (dst[565] & 0xE000E000u) | 0x0D9F003Fu;
+  dst[566] = (dst[566] & 0x07FF07FFu) | 0xF8000000u;
+  dst[567] = (dst[567] & 0x07FF07FFu) | 0x7000F800u;
+  dst[604] = (dst[604] & 0xC000C000u) | 0x001F04C0u;
+  dst[605] = (dst[605] & 0xC000C000u) | 0x1EC7001Fu;
+  dst[606] = (dst[606] & 0x0FFF0FFFu) | 0xF0000000u;
+  dst[607] = (dst[607] & 0x0FFF0FFFu) | 0xC000F000u;
+  dst[644] = (dst[644] & 0x80008000u) | 0x000C0C80u;
+  dst[645] = (dst[645] & 0x80008000u) | 0x1EE0000Cu;
+  dst[646] &= 0x3FFF3FFFu;
+  dst[647] &= 0x3FFF3FFFu;
+  dst[684] = 0x000E2600u;
+  dst[685] = 0x2600000Eu;
+  dst[686] = (dst[686] & 0x3FFF3FFFu) | 0x00008000u;
+  dst[687] = (dst[687] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[722] &= 0xFFFEFFFEu;
+  dst[723] &= 0xFFFEFFFEu;
+  dst[724] = 0x3000C810u;
+  dst[725] = 0xFAD00010u;
+  dst[726] = (dst[726] & 0x3C7F3C7Fu) | 0x00008000u;
+  dst[727] = (dst[727] & 0x3C7F3C7Fu) | 0x80000000u;
+  dst[762] &= 0xFFFEFFFEu;
+  dst[763] &= 0xFFFEFFFEu;
+  dst[764] = 0x7800841Eu;
+  dst[765] = 0xFCDE001Eu;
+  dst[766] = (dst[766] & 0x003F003Fu) | 0x03808000u;
+  dst[767] = (dst[767] & 0x003F003Fu) | 0x83800380u;
+  dst[802] &= 0xFFFEFFFEu;
+  dst[803] &= 0xFFFEFFFEu;
+  dst[804] = 0x3C00401Eu;
+  dst[805] = 0x7DDE001Eu;
+  dst[806] = (dst[806] & 0x001F001Fu) | 0x17C0C000u;
+  dst[807] = (dst[807] & 0x001F001Fu) | 0xD7C017C0u;
+  dst[842] = (dst[842] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[843] = (dst[843] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[844] = 0x8800143Eu;
+  dst[845] = 0x9DBE803Eu;
+  dst[846] = (dst[846] & 0x001F001Fu) | 0x17C0C000u;
+  dst[847] = (dst[847] & 0x001F001Fu) | 0xD7C017C0u;
+  dst[882] = (dst[882] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[883] = (dst[883] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[884] = 0xE0000C3Eu;
+  dst[885] = 0xEDBEE03Eu;
+  dst[886] = (dst[886] & 0x001F001Fu) | 0x1BC0C000u;
+  dst[887] = (dst[887] & 0x001F001Fu) | 0xDBC01BC0u;
+  dst[922] = (dst[922] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[923] = (dst[923] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[924] = (dst[924] & 0x10001000u) | 0xC000003Eu;
+  dst[925] = (dst[925] & 0x10001000u) | 0xC3BEC03Eu;
+  dst[926] = (dst[926] & 0x001F001Fu) | 0x03C0C000u;
+  dst[927] = (dst[927] & 0x001F001Fu) | 0xC3C003C0u;
+  dst[962] = (dst[962] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[963] = (dst[963] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[964] = (dst[964] & 0x38003800u) | 0x8000003Fu;
+  dst[965] = (dst[965] & 0x38003800u) | 0x83BF803Fu;
+  dst[966] = (dst[966] & 0x0C3F0C3Fu) | 0x00004000u;
+  dst[967] = (dst[967] & 0x0C3F0C3Fu) | 0x60000000u;
+  dst[1002] = (dst[1002] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1003] = (dst[1003] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[1004] = (dst[1004] & 0x10001000u) | 0xC000007Fu;
+  dst[1005] = (dst[1005] & 0x10001000u) | 0xC77FC07Fu;
+  dst[1006] = (dst[1006] & 0x0FFF0FFFu) | 0x00004000u;
+  dst[1007] = (dst[1007] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[1042] = (dst[1042] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1043] = (dst[1043] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[1044] = 0xC000007Fu;
+  dst[1045] = 0xCF7FC07Fu;
+  dst[1046] = (dst[1046] & 0x0FFF0FFFu) | 0x00004000u;
+  dst[1047] = (dst[1047] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[1082] = (dst[1082] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1083] = (dst[1083] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[1084] = 0xE00000FFu;
+  dst[1085] = 0xEEFFE0FFu;
+  dst[1086] &= 0x07FF07FFu;
+  dst[1087] = (dst[1087] & 0x07FF07FFu) | 0x70000000u;
+  dst[1122] = (dst[1122] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1123] = (dst[1123] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[1124] = 0xC00001FFu;
+  dst[1125] = 0xC1FFC1FFu;
+  dst[1126] = (dst[1126] & 0x07FF07FFu) | 0x00008000u;
+  dst[1127] = (dst[1127] & 0x07FF07FFu) | 0x80008000u;
+  dst[1162] &= 0xFFFCFFFCu;
+  dst[1163] &= 0xFFFCFFFCu;
+  dst[1164] = 0x3C0000FEu;
+  dst[1165] = 0x3CFE00FEu;
+  dst[1166] = (dst[1166] & 0x07FF07FFu) | 0x70000000u;
+  dst[1167] = (dst[1167] & 0x07FF07FFu) | 0x70000000u;
+  dst[1204] = 0x73010C00u;
+  dst[1205] = 0x7F010C00u;
+  dst[1206] = (dst[1206] & 0x03FF03FFu) | 0xD8002000u;
+  dst[1207] = (dst[1207] & 0x03FF03FFu) | 0xF8002000u;
+  dst[1242] &= 0xFFFEFFFEu;
+  dst[1243] &= 0xFFFEFFFEu;
+  dst[1244] = (dst[1244] & 0x00780078u) | 0xE1031E00u;
+  dst[1245] = (dst[1245] & 0x00780078u) | 0xFF031E00u;
+  dst[1246] = (dst[1246] & 0x03FF03FFu) | 0x88007000u;
+  dst[1247] = (dst[1247] & 0x03FF03FFu) | 0xF8007000u;
+  dst[1282] = (dst[1282] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1283] = (dst[1283] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1284] = (dst[1284] & 0x00780078u) | 0xE1031E00u;
+  dst[1285] = (dst[1285] & 0x00780078u) | 0xFF031E00u;
+  dst[1286] = (dst[1286] & 0x01FF01FFu) | 0x8C007000u;
+  dst[1287] = (dst[1287] & 0x01FF01FFu) | 0xFC007000u;
+  dst[1322] = (dst[1322] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1323] = (dst[1323] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1324] = (dst[1324] & 0x00700070u) | 0xE1071E00u;
+  dst[1325] = (dst[1325] & 0x00700070u) | 0xFF071E00u;
+  dst[1326] = (dst[1326] & 0x00FF00FFu) | 0x9C006000u;
+  dst[1327] = (dst[1327] & 0x00FF00FFu) | 0xFC006000u;
+  dst[1362] = (dst[1362] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1363] = (dst[1363] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1364] = (dst[1364] & 0x00F000F0u) | 0xF2070C00u;
+  dst[1365] = (dst[1365] & 0x00F000F0u) | 0xFE070C00u;
+  dst[1366] = (dst[1366] & 0x003F003Fu) | 0xFF000000u;
+  dst[1367] = (dst[1367] & 0x003F003Fu) | 0xFF000000u;
+  dst[1402] = (dst[1402] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1403] = (dst[1403] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1404] = (dst[1404] & 0x00F000F0u) | 0xFE070000u;
+  dst[1405] = (dst[1405] & 0x00F000F0u) | 0xFE070000u;
+  dst[1406] = (dst[1406] & 0x000F000Fu) | 0xE1C01E00u;
+  dst[1407] = (dst[1407] & 0x000F000Fu) | 0xFFC01E00u;
+  dst[1442] = (dst[1442] & 0xFE00FE00u) | 0x00780007u;
+  dst[1443] = (dst[1443] & 0xFE00FE00u) | 0x007F0007u;
+  dst[1444] = (dst[1444] & 0x00F000F0u) | 0x7E078000u;
+  dst[1445] = (dst[1445] & 0x00F000F0u) | 0xFE078000u;
+  dst[1446] = (dst[1446] & 0x00070007u) | 0xF0700F80u;
+  dst[1447] = (dst[1447] & 0x00070007u) | 0xFFF00F80u;
+  dst[1482] = (dst[1482] & 0xFC00FC00u) | 0x01F0000Fu;
+  dst[1483] = (dst[1483] & 0xFC00FC00u) | 0x01FF000Fu;
+  dst[1484] = (dst[1484] & 0x01F001F0u) | 0x3C07C000u;
+  dst[1485] = (dst[1485] & 0x01F001F0u) | 0xFC07C000u;
+  dst[1486] = (dst[1486] & 0x00030003u) | 0xFFF80000u;
+  dst[1487] = (dst[1487] & 0x00030003u) | 0xFFF80000u;
+  dst[1522] = (dst[1522] & 0xF800F800u) | 0x03FF0000u;
+  dst[1523] = (dst[1523] & 0xF800F800u) | 0x03FF0000u;
+  dst[1524] = (dst[1524] & 0x01F801F8u) | 0xFC030000u;
+  dst[1525] = (dst[1525] & 0x01F801F8u) | 0xFC030000u;
+  dst[1526] = (dst[1526] & 0x00030003u) | 0xFFF80000u;
+  dst[1527] = (dst[1527] & 0x00030003u) | 0xFFF80000u;
+  dst[1562] &= 0xF800F800u;
+  dst[1563] &= 0xF800F800u;
+  dst[1564] &= 0x01FC01FCu;
+  dst[1565] &= 0x01FC01FCu;
+  dst[1566] &= 0x00070007u;
+  dst[1567] &= 0x00070007u;
+}
+
+static void img_loserboy_f10_s12(uint32_t *dst) {
+  dst[44] &= 0xFFF0FFF0u;
+  dst[45] &= 0xFFF0FFF0u;
+  dst[46] &= 0x1FFF1FFFu;
+  dst[47] &= 0x1FFF1FFFu;
+  dst[84] = (dst[84] & 0xFF80FF80u) | 0x000F0000u;
+  dst[85] = (dst[85] & 0xFF80FF80u) | 0x000F0000u;
+  dst[86] = (dst[86] & 0x07FF07FFu) | 0xE0000000u;
+  dst[87] = (dst[87] & 0x07FF07FFu) | 0xE0000000u;
+  dst[124] = (dst[124] & 0xFE00FE00u) | 0x003F0000u;
+  dst[125] = (dst[125] & 0xFE00FE00u) | 0x003F0000u;
+  dst[126] = (dst[126] & 0x03FF03FFu) | 0xF8000000u;
+  dst[127] = (dst[127] & 0x03FF03FFu) | 0xF8000000u;
+  dst[164] = (dst[164] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[165] = (dst[165] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[166] = (dst[166] & 0x01FF01FFu) | 0xFC000000u;
+  dst[167] = (dst[167] & 0x01FF01FFu) | 0xFC000000u;
+  dst[204] = (dst[204] & 0xF800F800u) | 0x03FF0000u;
+  dst[205] = (dst[205] & 0xF800F800u) | 0x03FF0000u;
+  dst[206] = (dst[206] & 0x00FF00FFu) | 0xFE000000u;
+  dst[207] = (dst[207] & 0x00FF00FFu) | 0xFE000000u;
+  dst[244] = (dst[244] & 0xF800F800u) | 0x03FF0000u;
+  dst[245] = (dst[245] & 0xF800F800u) | 0x03FF0000u;
+  dst[246] = (dst[246] & 0x00FF00FFu) | 0xFE000000u;
+  dst[247] = (dst[247] & 0x00FF00FFu) | 0xFE000000u;
+  dst[284] = (dst[284] & 0xF800F800u) | 0x031C0000u;
+  dst[285] = (dst[285] & 0xF800F800u) | 0x031C0000u;
+  dst[286] = (dst[286] & 0x00FF00FFu) | 0x7E000000u;
+  dst[287] = (dst[287] & 0x00FF00FFu) | 0x7E000000u;
+  dst[324] = (dst[324] & 0xF800F800u) | 0x02D30001u;
+  dst[325] = (dst[325] & 0xF800F800u) | 0x02D300C3u;
+  dst[326] = (dst[326] & 0x00FF00FFu) | 0x3A000000u;
+  dst[327] = (dst[327] & 0x00FF00FFu) | 0x3A000000u;
+  dst[364] = (dst[364] & 0xF800F800u) | 0x01CF0003u;
+  dst[365] = (dst[365] & 0xF800F800u) | 0x01C701CFu;
+  dst[366] = (dst[366] & 0x01FF01FFu) | 0x14004000u;
+  dst[367] = (dst[367] & 0x01FF01FFu) | 0x54004000u;
+  dst[404] = (dst[404] & 0xFC00FC00u) | 0x01FF0003u;
+  dst[405] = (dst[405] & 0xFC00FC00u) | 0x01FF01FFu;
+  dst[406] = (dst[406] & 0x01FF01FFu) | 0x24004000u;
+  dst[407] = (dst[407] & 0x01FF01FFu) | 0x64006000u;
+  dst[444] = (dst[444] & 0xFC00FC00u) | 0x01FF0003u;
+  dst[445] = (dst[445] & 0xFC00FC00u) | 0x01FF01FFu;
+  dst[446] = (dst[446] & 0x01FF01FFu) | 0xB6005800u;
+  dst[447] = (dst[447] & 0x01FF01FFu) | 0xFC007A00u;
+  dst[484] = (dst[484] & 0xFC00FC00u) | 0x00FF0001u;
+  dst[485] = (dst[485] & 0xFC00FC00u) | 0x00FF00FFu;
+  dst[486] = (dst[486] & 0x01FF01FFu) | 0xFE00CC00u;
+  dst[487] = (dst[487] & 0x01FF01FFu) | 0xFC00FE00u;
+  dst[524] = (dst[524] & 0xF800F800u) | 0x003F0000u;
+  dst[525] = (dst[525] & 0xF800F800u) | 0x003E003Fu;
+  dst[526] = (dst[526] & 0x01FF01FFu) | 0xFE000000u;
+  dst[527] = (dst[527] & 0x01FF01FFu) | 0x7C00FE00u;
+  dst[564] = (dst[564] & 0xF000F000u) | 0x001F0080u;
+  dst[565] = (dst[565] & 0xF000F000u) | 0x06CF001Fu;
+  dst[566] = (dst[566] & 0x03FF03FFu) | 0xFC000000u;
+  dst[567] = (dst[567] & 0x03FF03FFu) | 0xB800FC00u;
+  dst[604] = (dst[604] & 0xE000E000u) | 0x000F0260u;
+  dst[605] = (dst[605] & 0xE000E000u) | 0x0F63000Fu;
+  dst[606] = (dst[606] & 0x07FF07FFu) | 0xF8000000u;
+  dst[607] = (dst[607] & 0x07FF07FFu) | 0xE000F800u;
+  dst[644] = (dst[644] & 0xC000C000u) | 0x00060640u;
+  dst[645] = (dst[645] & 0xC000C000u) | 0x0F700006u;
+  dst[646] &= 0x1FFF1FFFu;
+  dst[647] &= 0x1FFF1FFFu;
+  dst[684] = (dst[684] & 0x80008000u) | 0x00071300u;
+  dst[685] = (dst[685] & 0x80008000u) | 0x13000007u;
+  dst[686] = (dst[686] & 0x1FFF1FFFu) | 0x00004000u;
+  dst[687] = (dst[687] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[724] = 0x18006408u;
+  dst[725] = 0x7D680008u;
+  dst[726] = (dst[726] & 0x1E3F1E3Fu) | 0x00004000u;
+  dst[727] = (dst[727] & 0x1E3F1E3Fu) | 0x40000000u;
+  dst[764] = 0x3C00420Fu;
+  dst[765] = 0x7E6F000Fu;
+  dst[766] = (dst[766] & 0x001F001Fu) | 0x01C04000u;
+  dst[767] = (dst[767] & 0x001F001Fu) | 0x41C001C0u;
+  dst[804] = 0x1E00200Fu;
+  dst[805] = 0x3EEF000Fu;
+  dst[806] = (dst[806] & 0x000F000Fu) | 0x0BE06000u;
+  dst[807] = (dst[807] & 0x000F000Fu) | 0x6BE00BE0u;
+  dst[842] &= 0xFFFEFFFEu;
+  dst[843] &= 0xFFFEFFFEu;
+  dst[844] = 0xC4000A1Fu;
+  dst[845] = 0xCEDFC01Fu;
+  dst[846] = (dst[846] & 0x000F000Fu) | 0x0BE06000u;
+  dst[847] = (dst[847] & 0x000F000Fu) | 0x6BE00BE0u;
+  dst[882] &= 0xFFFEFFFEu;
+  dst[883] &= 0xFFFEFFFEu;
+  dst[884] = 0xF000061Fu;
+  dst[885] = 0xF6DFF01Fu;
+  dst[886] = (dst[886] & 0x000F000Fu) | 0x0DE06000u;
+  dst[887] = (dst[887] & 0x000F000Fu) | 0x6DE00DE0u;
+  dst[922] = (dst[922] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[923] = (dst[923] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[924] = (dst[924] & 0x08000800u) | 0xE000001Fu;
+  dst[925] = (dst[925] & 0x08000800u) | 0xE1DFE01Fu;
+  dst[926] = (dst[926] & 0x000F000Fu) | 0x01E06000u;
+  dst[927] = (dst[927] & 0x000F000Fu) | 0x61E001E0u;
+  dst[962] = (dst[962] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[963] = (dst[963] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[964] = (dst[964] & 0x1C001C00u) | 0xC000001Fu;
+  dst[965] = (dst[965] & 0x1C001C00u) | 0xC1DFC01Fu;
+  dst[966] = (dst[966] & 0x061F061Fu) | 0x0000A000u;
+  dst[967] = (dst[967] & 0x061F061Fu) | 0xB0008000u;
+  dst[1002] = (dst[1002] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1003] = (dst[1003] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[1004] = (dst[1004] & 0x08000800u) | 0xE000003Fu;
+  dst[1005] = (dst[1005] & 0x08000800u) | 0xE3BFE03Fu;
+  dst[1006] = (dst[1006] & 0x07FF07FFu) | 0x0000A000u;
+  dst[1007] = (dst[1007] & 0x07FF07FFu) | 0xB0008000u;
+  dst[1042] = (dst[1042] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1043] = (dst[1043] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[1044] = 0xE000003Fu;
+  dst[1045] = 0xE7BFE03Fu;
+  dst[1046] = (dst[1046] & 0x07FF07FFu) | 0x0000A000u;
+  dst[1047] = (dst[1047] & 0x07FF07FFu) | 0xB0008000u;
+  dst[1082] = (dst[1082] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1083] = (dst[1083] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[1084] = 0xF000007Fu;
+  dst[1085] = 0xF77FF07Fu;
+  dst[1086] = (dst[1086] & 0x03FF03FFu) | 0x00008000u;
+  dst[1087] = (dst[1087] & 0x03FF03FFu) | 0xB8008000u;
+  dst[1122] = (dst[1122] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1123] = (dst[1123] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[1124] = 0xE00000FFu;
+  dst[1125] = 0xE0FFE0FFu;
+  dst[1126] = (dst[1126] & 0x03FF03FFu) | 0x0000C000u;
+  dst[1127] = (dst[1127] & 0x03FF03FFu) | 0xC000C000u;
+  dst[1162] &= 0xFFFEFFFEu;
+  dst[1163] &= 0xFFFEFFFEu;
+  dst[1164] = 0x1E00007Fu;
+  dst[1165] = 0x1E7F007Fu;
+  dst[1166] = (dst[1166] & 0x03FF03FFu) | 0x38000000u;
+  dst[1167] = (dst[1167] & 0x03FF03FFu) | 0x38000000u;
+  dst[1204] = (dst[1204] & 0x80008000u) | 0x39800600u;
+  dst[1205] = (dst[1205] & 0x80008000u) | 0x3F800600u;
+  dst[1206] = (dst[1206] & 0x01FF01FFu) | 0xEC001000u;
+  dst[1207] = (dst[1207] & 0x01FF01FFu) | 0xFC001000u;
+  dst[1244] = (dst[1244] & 0x003C003Cu) | 0x70810F00u;
+  dst[1245] = (dst[1245] & 0x003C003Cu) | 0x7F810F00u;
+  dst[1246] = (dst[1246] & 0x01FF01FFu) | 0xC4003800u;
+  dst[1247] = (dst[1247] & 0x01FF01FFu) | 0xFC003800u;
+  dst[1282] &= 0xFFFEFFFEu;
+  dst[1283] &= 0xFFFEFFFEu;
+  dst[1284] = (dst[1284] & 0x003C003Cu) | 0xF0810F00u;
+  dst[1285] = (dst[1285] & 0x003C003Cu) | 0xFF810F00u;
+  dst[1286] = (dst[1286] & 0x00FF00FFu) | 0xC6003800u;
+  dst[1287] = (dst[1287] & 0x00FF00FFu) | 0xFE003800u;
+  dst[1322] = (dst[1322] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1323] = (dst[1323] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1324] = (dst[1324] & 0x00380038u) | 0xF0830F00u;
+  dst[1325] = (dst[1325] & 0x00380038u) | 0xFF830F00u;
+  dst[1326] = (dst[1326] & 0x007F007Fu) | 0xCE003000u;
+  dst[1327] = (dst[1327] & 0x007F007Fu) | 0xFE003000u;
+  dst[1362] = (dst[1362] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1363] = (dst[1363] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1364] = (dst[1364] & 0x00780078u) | 0xF9030600u;
+  dst[1365] = (dst[1365] & 0x00780078u) | 0xFF030600u;
+  dst[1366] = (dst[1366] & 0x001F001Fu) | 0xFF800000u;
+  dst[1367] = (dst[1367] & 0x001F001Fu) | 0xFF800000u;
+  dst[1402] = (dst[1402] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1403] = (dst[1403] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1404] = (dst[1404] & 0x00780078u) | 0xFF030000u;
+  dst[1405] = (dst[1405] & 0x00780078u) | 0xFF030000u;
+  dst[1406] = (dst[1406] & 0x00070007u) | 0xF0E00F00u;
+  dst[1407] = (dst[1407] & 0x00070007u) | 0xFFE00F00u;
+  dst[1442] = (dst[1442] & 0xFF00FF00u) | 0x003C0003u;
+  dst[1443] = (dst[1443] & 0xFF00FF00u) | 0x003F0003u;
+  dst[1444] = (dst[1444] & 0x00780078u) | 0x3F03C000u;
+  dst[1445] = (dst[1445] & 0x00780078u) | 0xFF03C000u;
+  dst[1446] = (dst[1446] & 0x00030003u) | 0xF83807C0u;
+  dst[1447] = (dst[1447] & 0x00030003u) | 0xFFF807C0u;
+  dst[1482] = (dst[1482] & 0xFE00FE00u) | 0x00F80007u;
+  dst[1483] = (dst[1483] & 0xFE00FE00u) | 0x00FF0007u;
+  dst[1484] = (dst[1484] & 0x00F800F8u) | 0x1E03E000u;
+  dst[1485] = (dst[1485] & 0x00F800F8u) | 0xFE03E000u;
+  dst[1486] = (dst[1486] & 0x00010001u) | 0xFFFC0000u;
+  dst[1487] = (dst[1487] & 0x00010001u) | 0xFFFC0000u;
+  dst[1522] = (dst[1522] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1523] = (dst[1523] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1524] = (dst[1524] & 0x00FC00FCu) | 0xFE010000u;
+  dst[1525] = (dst[1525] & 0x00FC00FCu) | 0xFE010000u;
+  dst[1526] = (dst[1526] & 0x00010001u) | 0xFFFC0000u;
+  dst[1527] = (dst[1527] & 0x00010001u) | 0xFFFC0000u;
+  dst[1562] &= 0xFC00FC00u;
+  dst[1563] &= 0xFC00FC00u;
+  dst[1564] &= 0x00FE00FEu;
+  dst[1565] &= 0x00FE00FEu;
+  dst[1566] &= 0x00030003u;
+  dst[1567] &= 0x00030003u;
+}
+
+static void img_loserboy_f10_s13(uint32_t *dst) {
+  dst[44] &= 0xFFF8FFF8u;
+  dst[45] &= 0xFFF8FFF8u;
+  dst[46] &= 0x0FFF0FFFu;
+  dst[47] &= 0x0FFF0FFFu;
+  dst[84] = (dst[84] & 0xFFC0FFC0u) | 0x00070000u;
+  dst[85] = (dst[85] & 0xFFC0FFC0u) | 0x00070000u;
+  dst[86] = (dst[86] & 0x03FF03FFu) | 0xF0000000u;
+  dst[87] = (dst[87] & 0x03FF03FFu) | 0xF0000000u;
+  dst[124] = (dst[124] & 0xFF00FF00u) | 0x001F0000u;
+  dst[125] = (dst[125] & 0xFF00FF00u) | 0x001F0000u;
+  dst[126] = (dst[126] & 0x01FF01FFu) | 0xFC000000u;
+  dst[127] = (dst[127] & 0x01FF01FFu) | 0xFC000000u;
+  dst[164] = (dst[164] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[165] = (dst[165] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[166] = (dst[166] & 0x00FF00FFu) | 0xFE000000u;
+  dst[167] = (dst[167] & 0x00FF00FFu) | 0xFE000000u;
+  dst[204] = (dst[204] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[205] = (dst[205] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[206] = (dst[206] & 0x007F007Fu) | 0xFF000000u;
+  dst[207] = (dst[207] & 0x007F007Fu) | 0xFF000000u;
+  dst[244] = (dst[244] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[245] = (dst[245] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[246] = (dst[246] & 0x007F007Fu) | 0xFF000000u;
+  dst[247] = (dst[247] & 0x007F007Fu) | 0xFF000000u;
+  dst[284] = (dst[284] & 0xFC00FC00u) | 0x018E0000u;
+  dst[285] = (dst[285] & 0xFC00FC00u) | 0x018E0000u;
+  dst[286] = (dst[286] & 0x007F007Fu) | 0x3F000000u;
+  dst[287] = (dst[287] & 0x007F007Fu) | 0x3F000000u;
+  dst[324] = (dst[324] & 0xFC00FC00u) | 0x01690000u;
+  dst[325] = (dst[325] & 0xFC00FC00u) | 0x01690061u;
+  dst[326] = (dst[326] & 0x007F007Fu) | 0x9D008000u;
+  dst[327] = (dst[327] & 0x007F007Fu) | 0x9D008000u;
+  dst[364] = (dst[364] & 0xFC00FC00u) | 0x00E70001u;
+  dst[365] = (dst[365] & 0xFC00FC00u) | 0x00E300E7u;
+  dst[366] = (dst[366] & 0x00FF00FFu) | 0x8A00A000u;
+  dst[367] = (dst[367] & 0x00FF00FFu) | 0xAA00A000u;
+  dst[404] = (dst[404] & 0xFE00FE00u) | 0x00FF0001u;
+  dst[405] = (dst[405] & 0xFE00FE00u) | 0x00FF00FFu;
+  dst[406] = (dst[406] & 0x00FF00FFu) | 0x9200A000u;
+  dst[407] = (dst[407] & 0x00FF00FFu) | 0xB200B000u;
+  dst[444] = (dst[444] & 0xFE00FE00u) | 0x00FF0001u;
+  dst[445] = (dst[445] & 0xFE00FE00u) | 0x00FF00FFu;
+  dst[446] = (dst[446] & 0x00FF00FFu) | 0xDB00AC00u;
+  dst[447] = (dst[447] & 0x00FF00FFu) | 0xFE00BD00u;
+  dst[484] = (dst[484] & 0xFE00FE00u) | 0x007F0000u;
+  dst[485] = (dst[485] & 0xFE00FE00u) | 0x007F007Fu;
+  dst[486] = (dst[486] & 0x00FF00FFu) | 0xFF00E600u;
+  dst[487] = (dst[487] & 0x00FF00FFu) | 0xFE00FF00u;
+  dst[524] = (dst[524] & 0xFC00FC00u) | 0x001F0000u;
+  dst[525] = (dst[525] & 0xFC00FC00u) | 0x001F001Fu;
+  dst[526] = (dst[526] & 0x00FF00FFu) | 0xFF000000u;
+  dst[527] = (dst[527] & 0x00FF00FFu) | 0x3E00FF00u;
+  dst[564] = (dst[564] & 0xF800F800u) | 0x000F0040u;
+  dst[565] = (dst[565] & 0xF800F800u) | 0x0367000Fu;
+  dst[566] = (dst[566] & 0x01FF01FFu) | 0xFE000000u;
+  dst[567] = (dst[567] & 0x01FF01FFu) | 0xDC00FE00u;
+  dst[604] = (dst[604] & 0xF000F000u) | 0x00070130u;
+  dst[605] = (dst[605] & 0xF000F000u) | 0x07B10007u;
+  dst[606] = (dst[606] & 0x03FF03FFu) | 0xFC000000u;
+  dst[607] = (dst[607] & 0x03FF03FFu) | 0xF000FC00u;
+  dst[644] = (dst[644] & 0xE000E000u) | 0x00030320u;
+  dst[645] = (dst[645] & 0xE000E000u) | 0x07B80003u;
+  dst[646] &= 0x0FFF0FFFu;
+  dst[647] &= 0x0FFF0FFFu;
+  dst[684] = (dst[684] & 0xC000C000u) | 0x00030980u;
+  dst[685] = (dst[685] & 0xC000C000u) | 0x09800003u;
+  dst[686] = (dst[686] & 0x0FFF0FFFu) | 0x80002000u;
+  dst[687] = (dst[687] & 0x0FFF0FFFu) | 0x20008000u;
+  dst[724] = (dst[724] & 0x80008000u) | 0x0C003204u;
+  dst[725] = (dst[725] & 0x80008000u) | 0x3EB40004u;
+  dst[726] = (dst[726] & 0x0F1F0F1Fu) | 0x00002000u;
+  dst[727] = (dst[727] & 0x0F1F0F1Fu) | 0x20000000u;
+  dst[764] = (dst[764] & 0x80008000u) | 0x1E002107u;
+  dst[765] = (dst[765] & 0x80008000u) | 0x3F370007u;
+  dst[766] = (dst[766] & 0x000F000Fu) | 0x00E0A000u;
+  dst[767] = (dst[767] & 0x000F000Fu) | 0xA0E080E0u;
+  dst[804] = (dst[804] & 0x80008000u) | 0x0F001007u;
+  dst[805] = (dst[805] & 0x80008000u) | 0x1F770007u;
+  dst[806] = (dst[806] & 0x00070007u) | 0x05F0B000u;
+  dst[807] = (dst[807] & 0x00070007u) | 0xB5F085F0u;
+  dst[844] = 0x6200050Fu;
+  dst[845] = 0x676F600Fu;
+  dst[846] = (dst[846] & 0x00070007u) | 0x05F0B000u;
+  dst[847] = (dst[847] & 0x00070007u) | 0xB5F085F0u;
+  dst[884] = 0x7800030Fu;
+  dst[885] = 0x7B6F780Fu;
+  dst[886] = (dst[886] & 0x00070007u) | 0x06F0B000u;
+  dst[887] = (dst[887] & 0x00070007u) | 0xB6F086F0u;
+  dst[922] &= 0xFFFEFFFEu;
+  dst[923] &= 0xFFFEFFFEu;
+  dst[924] = (dst[924] & 0x04000400u) | 0xF000000Fu;
+  dst[925] = (dst[925] & 0x04000400u) | 0xF0EFF00Fu;
+  dst[926] = (dst[926] & 0x00070007u) | 0x00F0B000u;
+  dst[927] = (dst[927] & 0x00070007u) | 0xB0F080F0u;
+  dst[962] &= 0xFFFEFFFEu;
+  dst[963] &= 0xFFFEFFFEu;
+  dst[964] = (dst[964] & 0x0E000E00u) | 0xE000000Fu;
+  dst[965] = (dst[965] & 0x0E000E00u) | 0xE0EFE00Fu;
+  dst[966] = (dst[966] & 0x030F030Fu) | 0x0000D000u;
+  dst[967] = (dst[967] & 0x030F030Fu) | 0xD800C000u;
+  dst[1002] = (dst[1002] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1003] = (dst[1003] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[1004] = (dst[1004] & 0x04000400u) | 0xF000001Fu;
+  dst[1005] = (dst[1005] & 0x04000400u) | 0xF1DFF01Fu;
+  dst[1006] = (dst[1006] & 0x03FF03FFu) | 0x0000D000u;
+  dst[1007] = (dst[1007] & 0x03FF03FFu) | 0xD800C000u;
+  dst[1042] = (dst[1042] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1043] = (dst[1043] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[1044] = 0xF000001Fu;
+  dst[1045] = 0xF3DFF01Fu;
+  dst[1046] = (dst[1046] & 0x03FF03FFu) | 0x0000D000u;
+  dst[1047] = (dst[1047] & 0x03FF03FFu) | 0xD800C000u;
+  dst[1082] = (dst[1082] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1083] = (dst[1083] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[1084] = 0xF800003Fu;
+  dst[1085] = 0xFBBFF83Fu;
+  dst[1086] = (dst[1086] & 0x01FF01FFu) | 0x0000C000u;
+  dst[1087] = (dst[1087] & 0x01FF01FFu) | 0xDC00C000u;
+  dst[1122] &= 0xFFFEFFFEu;
+  dst[1123] &= 0xFFFEFFFEu;
+  dst[1124] = 0xF000007Fu;
+  dst[1125] = 0xF07FF07Fu;
+  dst[1126] = (dst[1126] & 0x01FF01FFu) | 0x0000E000u;
+  dst[1127] = (dst[1127] & 0x01FF01FFu) | 0xE000E000u;
+  dst[1164] = 0x0F00003Fu;
+  dst[1165] = 0x0F3F003Fu;
+  dst[1166] = (dst[1166] & 0x01FF01FFu) | 0x1C008000u;
+  dst[1167] = (dst[1167] & 0x01FF01FFu) | 0x9C008000u;
+  dst[1204] = (dst[1204] & 0xC000C000u) | 0x1CC00300u;
+  dst[1205] = (dst[1205] & 0xC000C000u) | 0x1FC00300u;
+  dst[1206] = (dst[1206] & 0x00FF00FFu) | 0x76000800u;
+  dst[1207] = (dst[1207] & 0x00FF00FFu) | 0x7E000800u;
+  dst[1244] = (dst[1244] & 0x801E801Eu) | 0x38400780u;
+  dst[1245] = (dst[1245] & 0x801E801Eu) | 0x3FC00780u;
+  dst[1246] = (dst[1246] & 0x00FF00FFu) | 0xE2001C00u;
+  dst[1247] = (dst[1247] & 0x00FF00FFu) | 0xFE001C00u;
+  dst[1284] = (dst[1284] & 0x001E001Eu) | 0x78400780u;
+  dst[1285] = (dst[1285] & 0x001E001Eu) | 0x7FC00780u;
+  dst[1286] = (dst[1286] & 0x007F007Fu) | 0xE3001C00u;
+  dst[1287] = (dst[1287] & 0x007F007Fu) | 0xFF001C00u;
+  dst[1322] &= 0xFFFEFFFEu;
+  dst[1323] &= 0xFFFEFFFEu;
+  dst[1324] = (dst[1324] & 0x001C001Cu) | 0xF8410780u;
+  dst[1325] = (dst[1325] & 0x001C001Cu) | 0xFFC10780u;
+  dst[1326] = (dst[1326] & 0x003F003Fu) | 0xE7001800u;
+  dst[1327] = (dst[1327] & 0x003F003Fu) | 0xFF001800u;
+  dst[1362] = (dst[1362] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1363] = (dst[1363] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1364] = (dst[1364] & 0x003C003Cu) | 0xFC810300u;
+  dst[1365] = (dst[1365] & 0x003C003Cu) | 0xFF810300u;
+  dst[1366] = (dst[1366] & 0x000F000Fu) | 0xFFC00000u;
+  dst[1367] = (dst[1367] & 0x000F000Fu) | 0xFFC00000u;
+  dst[1402] = (dst[1402] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1403] = (dst[1403] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1404] = (dst[1404] & 0x003C003Cu) | 0xFF810000u;
+  dst[1405] = (dst[1405] & 0x003C003Cu) | 0xFF810000u;
+  dst[1406] = (dst[1406] & 0x00030003u) | 0xF8700780u;
+  dst[1407] = (dst[1407] & 0x00030003u) | 0xFFF00780u;
+  dst[1442] = (dst[1442] & 0xFF80FF80u) | 0x001E0001u;
+  dst[1443] = (dst[1443] & 0xFF80FF80u) | 0x001F0001u;
+  dst[1444] = (dst[1444] & 0x003C003Cu) | 0x1F81E000u;
+  dst[1445] = (dst[1445] & 0x003C003Cu) | 0xFF81E000u;
+  dst[1446] = (dst[1446] & 0x00010001u) | 0xFC1C03E0u;
+  dst[1447] = (dst[1447] & 0x00010001u) | 0xFFFC03E0u;
+  dst[1482] = (dst[1482] & 0xFF00FF00u) | 0x007C0003u;
+  dst[1483] = (dst[1483] & 0xFF00FF00u) | 0x007F0003u;
+  dst[1484] = (dst[1484] & 0x007C007Cu) | 0x0F01F000u;
+  dst[1485] = (dst[1485] & 0x007C007Cu) | 0xFF01F000u;
+  dst[1486] = 0xFFFE0000u;
+  dst[1487] = 0xFFFE0000u;
+  dst[1522] = (dst[1522] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1523] = (dst[1523] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1524] = (dst[1524] & 0x007E007Eu) | 0xFF000000u;
+  dst[1525] = (dst[1525] & 0x007E007Eu) | 0xFF000000u;
+  dst[1526] = 0xFFFE0000u;
+  dst[1527] = 0xFFFE0000u;
+  dst[1562] &= 0xFE00FE00u;
+  dst[1563] &= 0xFE00FE00u;
+  dst[1564] &= 0x007F007Fu;
+  dst[1565] &= 0x007F007Fu;
+  dst[1566] &= 0x00010001u;
+  dst[1567] &= 0x00010001u;
+}
+
+static void img_loserboy_f10_s14(uint32_t *dst) {
+  dst[44] &= 0xFFFCFFFCu;
+  dst[45] &= 0xFFFCFFFCu;
+  dst[46] &= 0x07FF07FFu;
+  dst[47] &= 0x07FF07FFu;
+  dst[84] = (dst[84] & 0xFFE0FFE0u) | 0x00030000u;
+  dst[85] = (dst[85] & 0xFFE0FFE0u) | 0x00030000u;
+  dst[86] = (dst[86] & 0x01FF01FFu) | 0xF8000000u;
+  dst[87] = (dst[87] & 0x01FF01FFu) | 0xF8000000u;
+  dst[124] = (dst[124] & 0xFF80FF80u) | 0x000F0000u;
+  dst[125] = (dst[125] & 0xFF80FF80u) | 0x000F0000u;
+  dst[126] = (dst[126] & 0x00FF00FFu) | 0xFE000000u;
+  dst[127] = (dst[127] & 0x00FF00FFu) | 0xFE000000u;
+  dst[164] = (dst[164] & 0xFF00FF00u) | 0x007F0000u;
+  dst[165] = (dst[165] & 0xFF00FF00u) | 0x007F0000u;
+  dst[166] = (dst[166] & 0x007F007Fu) | 0xFF000000u;
+  dst[167] = (dst[167] & 0x007F007Fu) | 0xFF000000u;
+  dst[204] = (dst[204] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[205] = (dst[205] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[206] = (dst[206] & 0x003F003Fu) | 0xFF800000u;
+  dst[207] = (dst[207] & 0x003F003Fu) | 0xFF800000u;
+  dst[244] = (dst[244] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[245] = (dst[245] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[246] = (dst[246] & 0x003F003Fu) | 0xFF800000u;
+  dst[247] = (dst[247] & 0x003F003Fu) | 0xFF800000u;
+  dst[284] = (dst[284] & 0xFE00FE00u) | 0x00C70000u;
+  dst[285] = (dst[285] & 0xFE00FE00u) | 0x00C70000u;
+  dst[286] = (dst[286] & 0x003F003Fu) | 0x1F800000u;
+  dst[287] = (dst[287] & 0x003F003Fu) | 0x1F800000u;
+  dst[324] = (dst[324] & 0xFE00FE00u) | 0x00B40000u;
+  dst[325] = (dst[325] & 0xFE00FE00u) | 0x00B40030u;
+  dst[326] = (dst[326] & 0x003F003Fu) | 0xCE804000u;
+  dst[327] = (dst[327] & 0x003F003Fu) | 0xCE80C000u;
+  dst[364] = (dst[364] & 0xFE00FE00u) | 0x00730000u;
+  dst[365] = (dst[365] & 0xFE00FE00u) | 0x00710073u;
+  dst[366] = (dst[366] & 0x007F007Fu) | 0xC500D000u;
+  dst[367] = (dst[367] & 0x007F007Fu) | 0xD500D000u;
+  dst[404] = (dst[404] & 0xFF00FF00u) | 0x007F0000u;
+  dst[405] = (dst[405] & 0xFF00FF00u) | 0x007F007Fu;
+  dst[406] = (dst[406] & 0x007F007Fu) | 0xC900D000u;
+  dst[407] = (dst[407] & 0x007F007Fu) | 0xD900D800u;
+  dst[444] = (dst[444] & 0xFF00FF00u) | 0x007F0000u;
+  dst[445] = (dst[445] & 0xFF00FF00u) | 0x007F007Fu;
+  dst[446] = (dst[446] & 0x007F007Fu) | 0xED80D600u;
+  dst[447] = (dst[447] & 0x007F007Fu) | 0xFF00DE80u;
+  dst[484] = (dst[484] & 0xFF00FF00u) | 0x003F0000u;
+  dst[485] = (dst[485] & 0xFF00FF00u) | 0x003F003Fu;
+  dst[486] = (dst[486] & 0x007F007Fu) | 0xFF807300u;
+  dst[487] = (dst[487] & 0x007F007Fu) | 0xFF00FF80u;
+  dst[524] = (dst[524] & 0xFE00FE00u) | 0x000F0000u;
+  dst[525] = (dst[525] & 0xFE00FE00u) | 0x000F000Fu;
+  dst[526] = (dst[526] & 0x007F007Fu) | 0xFF800000u;
+  dst[527] = (dst[527] & 0x007F007Fu) | 0x9F00FF80u;
+  dst[564] = (dst[564] & 0xFC00FC00u) | 0x00070020u;
+  dst[565] = (dst[565] & 0xFC00FC00u) | 0x01B30007u;
+  dst[566] = (dst[566] & 0x00FF00FFu) | 0xFF000000u;
+  dst[567] = (dst[567] & 0x00FF00FFu) | 0xEE00FF00u;
+  dst[604] = (dst[604] & 0xF800F800u) | 0x00030098u;
+  dst[605] = (dst[605] & 0xF800F800u) | 0x03D80003u;
+  dst[606] = (dst[606] & 0x01FF01FFu) | 0xFE000000u;
+  dst[607] = (dst[607] & 0x01FF01FFu) | 0xF800FE00u;
+  dst[644] = (dst[644] & 0xF000F000u) | 0x00010190u;
+  dst[645] = (dst[645] & 0xF000F000u) | 0x03DC0001u;
+  dst[646] = (dst[646] & 0x07FF07FFu) | 0x80000000u;
+  dst[647] = (dst[647] & 0x07FF07FFu) | 0x00008000u;
+  dst[684] = (dst[684] & 0xE000E000u) | 0x000104C0u;
+  dst[685] = (dst[685] & 0xE000E000u) | 0x04C00001u;
+  dst[686] = (dst[686] & 0x07FF07FFu) | 0xC0001000u;
+  dst[687] = (dst[687] & 0x07FF07FFu) | 0x1000C000u;
+  dst[724] = (dst[724] & 0xC000C000u) | 0x06001902u;
+  dst[725] = (dst[725] & 0xC000C000u) | 0x1F5A0002u;
+  dst[726] = (dst[726] & 0x078F078Fu) | 0x00001000u;
+  dst[727] = (dst[727] & 0x078F078Fu) | 0x10000000u;
+  dst[764] = (dst[764] & 0xC000C000u) | 0x0F001083u;
+  dst[765] = (dst[765] & 0xC000C000u) | 0x1F9B0003u;
+  dst[766] = (dst[766] & 0x00070007u) | 0x0070D000u;
+  dst[767] = (dst[767] & 0x00070007u) | 0xD070C070u;
+  dst[804] = (dst[804] & 0xC000C000u) | 0x07800803u;
+  dst[805] = (dst[805] & 0xC000C000u) | 0x0FBB0003u;
+  dst[806] = (dst[806] & 0x00030003u) | 0x02F8D800u;
+  dst[807] = (dst[807] & 0x00030003u) | 0xDAF8C2F8u;
+  dst[844] = (dst[844] & 0x80008000u) | 0x31000287u;
+  dst[845] = (dst[845] & 0x80008000u) | 0x33B73007u;
+  dst[846] = (dst[846] & 0x00030003u) | 0x02F8D800u;
+  dst[847] = (dst[847] & 0x00030003u) | 0xDAF8C2F8u;
+  dst[884] = (dst[884] & 0x80008000u) | 0x3C000187u;
+  dst[885] = (dst[885] & 0x80008000u) | 0x3DB73C07u;
+  dst[886] = (dst[886] & 0x00030003u) | 0x0378D800u;
+  dst[887] = (dst[887] & 0x00030003u) | 0xDB78C378u;
+  dst[924] = (dst[924] & 0x02000200u) | 0x78000007u;
+  dst[925] = (dst[925] & 0x02000200u) | 0x78777807u;
+  dst[926] = (dst[926] & 0x00030003u) | 0x0078D800u;
+  dst[927] = (dst[927] & 0x00030003u) | 0xD878C078u;
+  dst[964] = (dst[964] & 0x07000700u) | 0x70000007u;
+  dst[965] = (dst[965] & 0x07000700u) | 0x70777007u;
+  dst[966] = (dst[966] & 0x01870187u) | 0x0000E800u;
+  dst[967] = (dst[967] & 0x01870187u) | 0xEC00E000u;
+  dst[1002] &= 0xFFFEFFFEu;
+  dst[1003] &= 0xFFFEFFFEu;
+  dst[1004] = (dst[1004] & 0x02000200u) | 0xF800000Fu;
+  dst[1005] = (dst[1005] & 0x02000200u) | 0xF8EFF80Fu;
+  dst[1006] = (dst[1006] & 0x01FF01FFu) | 0x0000E800u;
+  dst[1007] = (dst[1007] & 0x01FF01FFu) | 0xEC00E000u;
+  dst[1042] &= 0xFFFEFFFEu;
+  dst[1043] &= 0xFFFEFFFEu;
+  dst[1044] = 0xF800000Fu;
+  dst[1045] = 0xF9EFF80Fu;
+  dst[1046] = (dst[1046] & 0x01FF01FFu) | 0x0000E800u;
+  dst[1047] = (dst[1047] & 0x01FF01FFu) | 0xEC00E000u;
+  dst[1082] &= 0xFFFEFFFEu;
+  dst[1083] &= 0xFFFEFFFEu;
+  dst[1084] = 0xFC00001Fu;
+  dst[1085] = 0xFDDFFC1Fu;
+  dst[1086] = (dst[1086] & 0x00FF00FFu) | 0x0000E000u;
+  dst[1087] = (dst[1087] & 0x00FF00FFu) | 0xEE00E000u;
+  dst[1124] = 0x7800003Fu;
+  dst[1125] = 0x783F783Fu;
+  dst[1126] = (dst[1126] & 0x00FF00FFu) | 0x0000F000u;
+  dst[1127] = (dst[1127] & 0x00FF00FFu) | 0xF000F000u;
+  dst[1164] = (dst[1164] & 0x80008000u) | 0x0780001Fu;
+  dst[1165] = (dst[1165] & 0x80008000u) | 0x079F001Fu;
+  dst[1166] = (dst[1166] & 0x00FF00FFu) | 0x0E00C000u;
+  dst[1167] = (dst[1167] & 0x00FF00FFu) | 0xCE00C000u;
+  dst[1204] = (dst[1204] & 0xE000E000u) | 0x0E600180u;
+  dst[1205] = (dst[1205] & 0xE000E000u) | 0x0FE00180u;
+  dst[1206] = (dst[1206] & 0x007F007Fu) | 0x3B000400u;
+  dst[1207] = (dst[1207] & 0x007F007Fu) | 0x3F000400u;
+  dst[1244] = (dst[1244] & 0xC00FC00Fu) | 0x1C2003C0u;
+  dst[1245] = (dst[1245] & 0xC00FC00Fu) | 0x1FE003C0u;
+  dst[1246] = (dst[1246] & 0x007F007Fu) | 0x71000E00u;
+  dst[1247] = (dst[1247] & 0x007F007Fu) | 0x7F000E00u;
+  dst[1284] = (dst[1284] & 0x800F800Fu) | 0x3C2003C0u;
+  dst[1285] = (dst[1285] & 0x800F800Fu) | 0x3FE003C0u;
+  dst[1286] = (dst[1286] & 0x003F003Fu) | 0x71800E00u;
+  dst[1287] = (dst[1287] & 0x003F003Fu) | 0x7F800E00u;
+  dst[1324] = (dst[1324] & 0x000E000Eu) | 0x7C2003C0u;
+  dst[1325] = (dst[1325] & 0x000E000Eu) | 0x7FE003C0u;
+  dst[1326] = (dst[1326] & 0x001F001Fu) | 0xF3800C00u;
+  dst[1327] = (dst[1327] & 0x001F001Fu) | 0xFF800C00u;
+  dst[1362] &= 0xFFFCFFFCu;
+  dst[1363] &= 0xFFFCFFFCu;
+  dst[1364] = (dst[1364] & 0x001E001Eu) | 0xFE400180u;
+  dst[1365] = (dst[1365] & 0x001E001Eu) | 0xFFC00180u;
+  dst[1366] = (dst[1366] & 0x00070007u) | 0xFFE00000u;
+  dst[1367] = (dst[1367] & 0x00070007u) | 0xFFE00000u;
+  dst[1402] = (dst[1402] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1403] = (dst[1403] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1404] = (dst[1404] & 0x001E001Eu) | 0xFFC00000u;
+  dst[1405] = (dst[1405] & 0x001E001Eu) | 0xFFC00000u;
+  dst[1406] = (dst[1406] & 0x00010001u) | 0xFC3803C0u;
+  dst[1407] = (dst[1407] & 0x00010001u) | 0xFFF803C0u;
+  dst[1442] = (dst[1442] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1443] = (dst[1443] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1444] = (dst[1444] & 0x001E001Eu) | 0x0FC0F000u;
+  dst[1445] = (dst[1445] & 0x001E001Eu) | 0xFFC0F000u;
+  dst[1446] = 0xFE0E01F0u;
+  dst[1447] = 0xFFFE01F0u;
+  dst[1482] = (dst[1482] & 0xFF80FF80u) | 0x003E0001u;
+  dst[1483] = (dst[1483] & 0xFF80FF80u) | 0x003F0001u;
+  dst[1484] = (dst[1484] & 0x003E003Eu) | 0x0780F800u;
+  dst[1485] = (dst[1485] & 0x003E003Eu) | 0xFF80F800u;
+  dst[1486] = 0xFFFF0000u;
+  dst[1487] = 0xFFFF0000u;
+  dst[1488] &= 0x7FFF7FFFu;
+  dst[1489] &= 0x7FFF7FFFu;
+  dst[1522] = (dst[1522] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1523] = (dst[1523] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1524] = (dst[1524] & 0x003F003Fu) | 0xFF800000u;
+  dst[1525] = (dst[1525] & 0x003F003Fu) | 0xFF800000u;
+  dst[1526] = 0x7FFF0000u;
+  dst[1527] = 0x7FFF0000u;
+  dst[1528] &= 0x7FFF7FFFu;
+  dst[1529] &= 0x7FFF7FFFu;
+  dst[1562] &= 0xFF00FF00u;
+  dst[1563] &= 0xFF00FF00u;
+  dst[1564] &= 0x003F003Fu;
+  dst[1565] &= 0x003F003Fu;
+  dst[1566] &= 0x80008000u;
+  dst[1567] &= 0x80008000u;
+}
+
+static void img_loserboy_f10_s15(uint32_t *dst) {
+  dst[44] &= 0xFFFEFFFEu;
+  dst[45] &= 0xFFFEFFFEu;
+  dst[46] &= 0x03FF03FFu;
+  dst[47] &= 0x03FF03FFu;
+  dst[84] = (dst[84] & 0xFFF0FFF0u) | 0x00010000u;
+  dst[85] = (dst[85] & 0xFFF0FFF0u) | 0x00010000u;
+  dst[86] = (dst[86] & 0x00FF00FFu) | 0xFC000000u;
+  dst[87] = (dst[87] & 0x00FF00FFu) | 0xFC000000u;
+  dst[124] = (dst[124] & 0xFFC0FFC0u) | 0x00070000u;
+  dst[125] = (dst[125] & 0xFFC0FFC0u) | 0x00070000u;
+  dst[126] = (dst[126] & 0x007F007Fu) | 0xFF000000u;
+  dst[127] = (dst[127] & 0x007F007Fu) | 0xFF000000u;
+  dst[164] = (dst[164] & 0xFF80FF80u) | 0x003F0000u;
+  dst[165] = (dst[165] & 0xFF80FF80u) | 0x003F0000u;
+  dst[166] = (dst[166] & 0x003F003Fu) | 0xFF800000u;
+  dst[167] = (dst[167] & 0x003F003Fu) | 0xFF800000u;
+  dst[204] = (dst[204] & 0xFF00FF00u) | 0x007F0000u;
+  dst[205] = (dst[205] & 0xFF00FF00u) | 0x007F0000u;
+  dst[206] = (dst[206] & 0x001F001Fu) | 0xFFC00000u;
+  dst[207] = (dst[207] & 0x001F001Fu) | 0xFFC00000u;
+  dst[244] = (dst[244] & 0xFF00FF00u) | 0x007F0000u;
+  dst[245] = (dst[245] & 0xFF00FF00u) | 0x007F0000u;
+  dst[246] = (dst[246] & 0x001F001Fu) | 0xFFC00000u;
+  dst[247] = (dst[247] & 0x001F001Fu) | 0xFFC00000u;
+  dst[284] = (dst[284] & 0xFF00FF00u) | 0x00630000u;
+  dst[285] = (dst[285] & 0xFF00FF00u) | 0x00630000u;
+  dst[286] = (dst[286] & 0x001F001Fu) | 0x8FC00000u;
+  dst[287] = (dst[287] & 0x001F001Fu) | 0x8FC00000u;
+  dst[324] = (dst[324] & 0xFF00FF00u) | 0x005A0000u;
+  dst[325] = (dst[325] & 0xFF00FF00u) | 0x005A0018u;
+  dst[326] = (dst[326] & 0x001F001Fu) | 0x67402000u;
+  dst[327] = (dst[327] & 0x001F001Fu) | 0x67406000u;
+  dst[364] = (dst[364] & 0xFF00FF00u) | 0x00390000u;
+  dst[365] = (dst[365] & 0xFF00FF00u) | 0x00380039u;
+  dst[366] = (dst[366] & 0x003F003Fu) | 0xE2806800u;
+  dst[367] = (dst[367] & 0x003F003Fu) | 0xEA80E800u;
+  dst[404] = (dst[404] & 0xFF80FF80u) | 0x003F0000u;
+  dst[405] = (dst[405] & 0xFF80FF80u) | 0x003F003Fu;
+  dst[406] = (dst[406] & 0x003F003Fu) | 0xE4806800u;
+  dst[407] = (dst[407] & 0x003F003Fu) | 0xEC80EC00u;
+  dst[444] = (dst[444] & 0xFF80FF80u) | 0x003F0000u;
+  dst[445] = (dst[445] & 0xFF80FF80u) | 0x003F003Fu;
+  dst[446] = (dst[446] & 0x003F003Fu) | 0xF6C06B00u;
+  dst[447] = (dst[447] & 0x003F003Fu) | 0xFF80EF40u;
+  dst[484] = (dst[484] & 0xFF80FF80u) | 0x001F0000u;
+  dst[485] = (dst[485] & 0xFF80FF80u) | 0x001F001Fu;
+  dst[486] = (dst[486] & 0x003F003Fu) | 0xFFC03980u;
+  dst[487] = (dst[487] & 0x003F003Fu) | 0xFF80FFC0u;
+  dst[524] = (dst[524] & 0xFF00FF00u) | 0x00070000u;
+  dst[525] = (dst[525] & 0xFF00FF00u) | 0x00070007u;
+  dst[526] = (dst[526] & 0x003F003Fu) | 0xFFC00000u;
+  dst[527] = (dst[527] & 0x003F003Fu) | 0xCF80FFC0u;
+  dst[564] = (dst[564] & 0xFE00FE00u) | 0x00030010u;
+  dst[565] = (dst[565] & 0xFE00FE00u) | 0x00D90003u;
+  dst[566] = (dst[566] & 0x007F007Fu) | 0xFF800000u;
+  dst[567] = (dst[567] & 0x007F007Fu) | 0xF700FF80u;
+  dst[604] = (dst[604] & 0xFC00FC00u) | 0x0001004Cu;
+  dst[605] = (dst[605] & 0xFC00FC00u) | 0x01EC0001u;
+  dst[606] = (dst[606] & 0x00FF00FFu) | 0xFF000000u;
+  dst[607] = (dst[607] & 0x00FF00FFu) | 0x7C00FF00u;
+  dst[644] = (dst[644] & 0xF800F800u) | 0x000000C8u;
+  dst[645] = (dst[645] & 0xF800F800u) | 0x01EE0000u;
+  dst[646] = (dst[646] & 0x03FF03FFu) | 0xC0000000u;
+  dst[647] = (dst[647] & 0x03FF03FFu) | 0x0000C000u;
+  dst[684] = (dst[684] & 0xF000F000u) | 0x00000260u;
+  dst[685] = (dst[685] & 0xF000F000u) | 0x02600000u;
+  dst[686] = (dst[686] & 0x03FF03FFu) | 0xE0000800u;
+  dst[687] = (dst[687] & 0x03FF03FFu) | 0x0800E000u;
+  dst[724] = (dst[724] & 0xE000E000u) | 0x03000C81u;
+  dst[725] = (dst[725] & 0xE000E000u) | 0x0FAD0001u;
+  dst[726] = (dst[726] & 0x03C703C7u) | 0x00000800u;
+  dst[727] = (dst[727] & 0x03C703C7u) | 0x08000000u;
+  dst[764] = (dst[764] & 0xE000E000u) | 0x07800841u;
+  dst[765] = (dst[765] & 0xE000E000u) | 0x0FCD0001u;
+  dst[766] = (dst[766] & 0x00030003u) | 0x0038E800u;
+  dst[767] = (dst[767] & 0x00030003u) | 0xE838E038u;
+  dst[804] = (dst[804] & 0xE000E000u) | 0x03C00401u;
+  dst[805] = (dst[805] & 0xE000E000u) | 0x07DD0001u;
+  dst[806] = (dst[806] & 0x00010001u) | 0x017CEC00u;
+  dst[807] = (dst[807] & 0x00010001u) | 0xED7CE17Cu;
+  dst[844] = (dst[844] & 0xC000C000u) | 0x18800143u;
+  dst[845] = (dst[845] & 0xC000C000u) | 0x19DB1803u;
+  dst[846] = (dst[846] & 0x00010001u) | 0x017CEC00u;
+  dst[847] = (dst[847] & 0x00010001u) | 0xED7CE17Cu;
+  dst[884] = (dst[884] & 0xC000C000u) | 0x1E0000C3u;
+  dst[885] = (dst[885] & 0xC000C000u) | 0x1EDB1E03u;
+  dst[886] = (dst[886] & 0x00010001u) | 0x01BCEC00u;
+  dst[887] = (dst[887] & 0x00010001u) | 0xEDBCE1BCu;
+  dst[924] = (dst[924] & 0x81008100u) | 0x3C000003u;
+  dst[925] = (dst[925] & 0x81008100u) | 0x3C3B3C03u;
+  dst[926] = (dst[926] & 0x00010001u) | 0x003CEC00u;
+  dst[927] = (dst[927] & 0x00010001u) | 0xEC3CE03Cu;
+  dst[964] = (dst[964] & 0x83808380u) | 0x38000003u;
+  dst[965] = (dst[965] & 0x83808380u) | 0x383B3803u;
+  dst[966] = (dst[966] & 0x00C300C3u) | 0x0000F400u;
+  dst[967] = (dst[967] & 0x00C300C3u) | 0xF600F000u;
+  dst[1004] = (dst[1004] & 0x01000100u) | 0x7C000007u;
+  dst[1005] = (dst[1005] & 0x01000100u) | 0x7C777C07u;
+  dst[1006] = (dst[1006] & 0x00FF00FFu) | 0x0000F400u;
+  dst[1007] = (dst[1007] & 0x00FF00FFu) | 0xF600F000u;
+  dst[1044] = 0x7C000007u;
+  dst[1045] = 0x7CF77C07u;
+  dst[1046] = (dst[1046] & 0x00FF00FFu) | 0x0000F400u;
+  dst[1047] = (dst[1047] & 0x00FF00FFu) | 0xF600F000u;
+  dst[1084] = 0x7E00000Fu;
+  dst[1085] = 0x7EEF7E0Fu;
+  dst[1086] = (dst[1086] & 0x007F007Fu) | 0x0000F000u;
+  dst[1087] = (dst[1087] & 0x007F007Fu) | 0xF700F000u;
+  dst[1124] = (dst[1124] & 0x80008000u) | 0x3C00001Fu;
+  dst[1125] = (dst[1125] & 0x80008000u) | 0x3C1F3C1Fu;
+  dst[1126] = (dst[1126] & 0x007F007Fu) | 0x0000F800u;
+  dst[1127] = (dst[1127] & 0x007F007Fu) | 0xF800F800u;
+  dst[1164] = (dst[1164] & 0xC000C000u) | 0x03C0000Fu;
+  dst[1165] = (dst[1165] & 0xC000C000u) | 0x03CF000Fu;
+  dst[1166] = (dst[1166] & 0x007F007Fu) | 0x0700E000u;
+  dst[1167] = (dst[1167] & 0x007F007Fu) | 0xE700E000u;
+  dst[1204] = (dst[1204] & 0xF000F000u) | 0x073000C0u;
+  dst[1205] = (dst[1205] & 0xF000F000u) | 0x07F000C0u;
+  dst[1206] = (dst[1206] & 0x003F003Fu) | 0x1D800200u;
+  dst[1207] = (dst[1207] & 0x003F003Fu) | 0x1F800200u;
+  dst[1244] = (dst[1244] & 0xE007E007u) | 0x0E1001E0u;
+  dst[1245] = (dst[1245] & 0xE007E007u) | 0x0FF001E0u;
+  dst[1246] = (dst[1246] & 0x803F803Fu) | 0x38800700u;
+  dst[1247] = (dst[1247] & 0x803F803Fu) | 0x3F800700u;
+  dst[1284] = (dst[1284] & 0xC007C007u) | 0x1E1001E0u;
+  dst[1285] = (dst[1285] & 0xC007C007u) | 0x1FF001E0u;
+  dst[1286] = (dst[1286] & 0x801F801Fu) | 0x38C00700u;
+  dst[1287] = (dst[1287] & 0x801F801Fu) | 0x3FC00700u;
+  dst[1324] = (dst[1324] & 0x80078007u) | 0x3E1001E0u;
+  dst[1325] = (dst[1325] & 0x80078007u) | 0x3FF001E0u;
+  dst[1326] = (dst[1326] & 0x000F000Fu) | 0x79C00600u;
+  dst[1327] = (dst[1327] & 0x000F000Fu) | 0x7FC00600u;
+  dst[1362] &= 0xFFFEFFFEu;
+  dst[1363] &= 0xFFFEFFFEu;
+  dst[1364] = (dst[1364] & 0x000F000Fu) | 0x7F2000C0u;
+  dst[1365] = (dst[1365] & 0x000F000Fu) | 0x7FE000C0u;
+  dst[1366] = (dst[1366] & 0x00030003u) | 0x7FF00000u;
+  dst[1367] = (dst[1367] & 0x00030003u) | 0x7FF00000u;
+  dst[1402] = (dst[1402] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1403] = (dst[1403] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1404] = (dst[1404] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1405] = (dst[1405] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1406] = 0x7E1C01E0u;
+  dst[1407] = 0x7FFC01E0u;
+  dst[1442] = (dst[1442] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1443] = (dst[1443] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1444] = (dst[1444] & 0x000F000Fu) | 0x87E07800u;
+  dst[1445] = (dst[1445] & 0x000F000Fu) | 0xFFE07800u;
+  dst[1446] = 0x7F0700F8u;
+  dst[1447] = 0x7FFF00F8u;
+  dst[1448] &= 0x7FFF7FFFu;
+  dst[1449] &= 0x7FFF7FFFu;
+  dst[1482] = (dst[1482] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1483] = (dst[1483] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1484] = (dst[1484] & 0x001F001Fu) | 0x03C0FC00u;
+  dst[1485] = (dst[1485] & 0x001F001Fu) | 0xFFC0FC00u;
+  dst[1486] = 0x7FFF0000u;
+  dst[1487] = 0x7FFF0000u;
+  dst[1488] = (dst[1488] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1489] = (dst[1489] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1522] = (dst[1522] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1523] = (dst[1523] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1524] = (dst[1524] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1525] = (dst[1525] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1526] = (dst[1526] & 0x80008000u) | 0x3FFF0000u;
+  dst[1527] = (dst[1527] & 0x80008000u) | 0x3FFF0000u;
+  dst[1528] = (dst[1528] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1529] = (dst[1529] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1562] &= 0xFF80FF80u;
+  dst[1563] &= 0xFF80FF80u;
+  dst[1564] &= 0x001F001Fu;
+  dst[1565] &= 0x001F001Fu;
+  dst[1566] &= 0xC000C000u;
+  dst[1567] &= 0xC000C000u;
+  dst[1568] &= 0x7FFF7FFFu;
+  dst[1569] &= 0x7FFF7FFFu;
+}
+
+static const compiled_sprite_func img_loserboy_f10[VGA_BLOCK_PIXELS] = {
+    img_loserboy_f10_s0,
+    img_loserboy_f10_s1,
+    img_loserboy_f10_s2,
+    img_loserboy_f10_s3,
+    img_loserboy_f10_s4,
+    img_loserboy_f10_s5,
+    img_loserboy_f10_s6,
+    img_loserboy_f10_s7,
+    img_loserboy_f10_s8,
+    img_loserboy_f10_s9,
+    img_loserboy_f10_s10,
+    img_loserboy_f10_s11,
+    img_loserboy_f10_s12,
+    img_loserboy_f10_s13,
+    img_loserboy_f10_s14,
+    img_loserboy_f10_s15,
+};
+
+static void img_loserboy_f21_s0(uint32_t *dst) {
+  dst[40] &= 0xFFF0FFF0u;
+  dst[41] &= 0xFFF0FFF0u;
+  dst[42] &= 0x1FFF1FFFu;
+  dst[43] &= 0x1FFF1FFFu;
+  dst[80] = (dst[80] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[81] = (dst[81] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[82] = (dst[82] & 0x03FF03FFu) | 0xE0000000u;
+  dst[83] = (dst[83] & 0x03FF03FFu) | 0xE0000000u;
+  dst[120] = (dst[120] & 0xFF80FF80u) | 0x003F0000u;
+  dst[121] = (dst[121] & 0xFF80FF80u) | 0x003F0000u;
+  dst[122] = (dst[122] & 0x00FF00FFu) | 0xF8000000u;
+  dst[123] = (dst[123] & 0x00FF00FFu) | 0xF8000000u;
+  dst[160] = (dst[160] & 0xFF00FF00u) | 0x007F0000u;
+  dst[161] = (dst[161] & 0xFF00FF00u) | 0x007F0000u;
+  dst[162] = (dst[162] & 0x007F007Fu) | 0xFF000000u;
+  dst[163] = (dst[163] & 0x007F007Fu) | 0xFF000000u;
+  dst[200] = (dst[200] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[201] = (dst[201] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[202] = (dst[202] & 0x003F003Fu) | 0xFF800000u;
+  dst[203] = (dst[203] & 0x003F003Fu) | 0xFF800000u;
+  dst[240] = (dst[240] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[241] = (dst[241] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[242] = (dst[242] & 0x003F003Fu) | 0xFF800000u;
+  dst[243] = (dst[243] & 0x003F003Fu) | 0xFF800000u;
+  dst[280] = (dst[280] & 0xFE00FE00u) | 0x00FC0000u;
+  dst[281] = (dst[281] & 0xFE00FE00u) | 0x00FC0000u;
+  dst[282] = (dst[282] & 0x003F003Fu) | 0x71800000u;
+  dst[283] = (dst[283] & 0x003F003Fu) | 0x71800000u;
+  dst[320] = (dst[320] & 0xFE00FE00u) | 0x00B90001u;
+  dst[321] = (dst[321] & 0xFE00FE00u) | 0x00B90001u;
+  dst[322] = (dst[322] & 0x003F003Fu) | 0x96800000u;
+  dst[323] = (dst[323] & 0x003F003Fu) | 0x96808600u;
+  dst[360] = (dst[360] & 0xFF00FF00u) | 0x00510005u;
+  dst[361] = (dst[361] & 0xFF00FF00u) | 0x00550005u;
+  dst[362] = (dst[362] & 0x003F003Fu) | 0xE7008000u;
+  dst[363] = (dst[363] & 0x003F003Fu) | 0xC700E700u;
+  dst[400] = (dst[400] & 0xFF00FF00u) | 0x00490005u;
+  dst[401] = (dst[401] & 0xFF00FF00u) | 0x004D000Du;
+  dst[402] = (dst[402] & 0x007F007Fu) | 0xFF008000u;
+  dst[403] = (dst[403] & 0x007F007Fu) | 0xFF00FF00u;
+  dst[440] = (dst[440] & 0xFF00FF00u) | 0x00DB0035u;
+  dst[441] = (dst[441] & 0xFF00FF00u) | 0x007F00BDu;
+  dst[442] = (dst[442] & 0x007F007Fu) | 0xFF008000u;
+  dst[443] = (dst[443] & 0x007F007Fu) | 0xFF00FF00u;
+  dst[480] = (dst[480] & 0xFF00FF00u) | 0x00FF0067u;
+  dst[481] = (dst[481] & 0xFF00FF00u) | 0x007F00FFu;
+  dst[482] = (dst[482] & 0x007F007Fu) | 0xFE000000u;
+  dst[483] = (dst[483] & 0x007F007Fu) | 0xFE00FE00u;
+  dst[520] = (dst[520] & 0xFF00FF00u) | 0x00FF0000u;
+  dst[521] = (dst[521] & 0xFF00FF00u) | 0x007C00FFu;
+  dst[522] = (dst[522] & 0x003F003Fu) | 0xF8000000u;
+  dst[523] = (dst[523] & 0x003F003Fu) | 0xF800F800u;
+  dst[560] = (dst[560] & 0xFF80FF80u) | 0x007F0000u;
+  dst[561] = (dst[561] & 0xFF80FF80u) | 0x003B007Fu;
+  dst[562] = (dst[562] & 0x001F001Fu) | 0xF0000200u;
+  dst[563] = (dst[563] & 0x001F001Fu) | 0xE6C0F000u;
+  dst[600] = (dst[600] & 0xFFC0FFC0u) | 0x003F0000u;
+  dst[601] = (dst[601] & 0xFFC0FFC0u) | 0x000F003Fu;
+  dst[602] = (dst[602] & 0x000F000Fu) | 0xE0000C80u;
+  dst[603] = (dst[603] & 0x000F000Fu) | 0x8DE0E000u;
+  dst[640] &= 0xFFF0FFF0u;
+  dst[641] &= 0xFFF0FFF0u;
+  dst[642] = (dst[642] & 0x00070007u) | 0xC00004C0u;
+  dst[643] = (dst[643] & 0x00070007u) | 0x1DE0C000u;
+  dst[680] = (dst[680] & 0xFFF0FFF0u) | 0x00010004u;
+  dst[681] = (dst[681] & 0xFFF0FFF0u) | 0x00040001u;
+  dst[682] = (dst[682] & 0x00030003u) | 0xC0000190u;
+  dst[683] = (dst[683] & 0x00030003u) | 0x0190C000u;
+  dst[720] = (dst[720] & 0xF8F0F8F0u) | 0x00000004u;
+  dst[721] = (dst[721] & 0xF8F0F8F0u) | 0x00040000u;
+  dst[722] = (dst[722] & 0x00010001u) | 0x0030204Cu;
+  dst[723] = (dst[723] & 0x00010001u) | 0x2D7C2000u;
+  dst[760] = (dst[760] & 0xF000F000u) | 0x07000005u;
+  dst[761] = (dst[761] & 0xF000F000u) | 0x07050701u;
+  dst[762] = (dst[762] & 0x00010001u) | 0x0078E084u;
+  dst[763] = (dst[763] & 0x00010001u) | 0xECFCE000u;
+  dst[800] = (dst[800] & 0xE000E000u) | 0x0FA0000Du;
+  dst[801] = (dst[801] & 0xE000E000u) | 0x0FAD0FA1u;
+  dst[802] = (dst[802] & 0x00010001u) | 0x00F0E008u;
+  dst[803] = (dst[803] & 0x00010001u) | 0xEEF8E000u;
+  dst[840] = (dst[840] & 0xE000E000u) | 0x0FA0000Du;
+  dst[841] = (dst[841] & 0xE000E000u) | 0x0FAD0FA1u;
+  dst[842] = 0x0046F0A0u;
+  dst[843] = 0xF6E6F006u;
+  dst[880] = (dst[880] & 0xE000E000u) | 0x0F60000Du;
+  dst[881] = (dst[881] & 0xE000E000u) | 0x0F6D0F61u;
+  dst[882] = 0x001EF0C0u;
+  dst[883] = 0xF6DEF01Eu;
+  dst[920] = (dst[920] & 0xE000E000u) | 0x0F00000Du;
+  dst[921] = (dst[921] & 0xE000E000u) | 0x0F0D0F01u;
+  dst[922] = (dst[922] & 0x00200020u) | 0x000FF000u;
+  dst[923] = (dst[923] & 0x00200020u) | 0xF70FF00Fu;
+  dst[924] &= 0x7FFF7FFFu;
+  dst[925] &= 0x7FFF7FFFu;
+  dst[960] = (dst[960] & 0xF0C0F0C0u) | 0x0000000Bu;
+  dst[961] = (dst[961] & 0xF0C0F0C0u) | 0x001B0003u;
+  dst[962] = (dst[962] & 0x00700070u) | 0x0007F000u;
+  dst[963] = (dst[963] & 0x00700070u) | 0xF707F007u;
+  dst[964] &= 0x7FFF7FFFu;
+  dst[965] &= 0x7FFF7FFFu;
+  dst[1000] = (dst[1000] & 0xFFC0FFC0u) | 0x0000000Bu;
+  dst[1001] = (dst[1001] & 0xFFC0FFC0u) | 0x001B0003u;
+  dst[1002] = (dst[1002] & 0x00200020u) | 0x000FF800u;
+  dst[1003] = (dst[1003] & 0x00200020u) | 0xFB8FF80Fu;
+  dst[1004] = (dst[1004] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1005] = (dst[1005] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[1040] = (dst[1040] & 0xFFC0FFC0u) | 0x0000000Bu;
+  dst[1041] = (dst[1041] & 0xFFC0FFC0u) | 0x001B0003u;
+  dst[1042] = 0x000FF800u;
+  dst[1043] = 0xFBCFF80Fu;
+  dst[1044] = (dst[1044] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1045] = (dst[1045] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[1080] = (dst[1080] & 0xFF80FF80u) | 0x00000003u;
+  dst[1081] = (dst[1081] & 0xFF80FF80u) | 0x003B0003u;
+  dst[1082] = 0x001FFC00u;
+  dst[1083] = 0xFDDFFC1Fu;
+  dst[1084] = (dst[1084] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1085] = (dst[1085] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[1120] = (dst[1120] & 0xFF80FF80u) | 0x00000007u;
+  dst[1121] = (dst[1121] & 0xFF80FF80u) | 0x00070007u;
+  dst[1122] = 0x000FFE00u;
+  dst[1123] = 0xFE0FFE0Fu;
+  dst[1124] &= 0x7FFF7FFFu;
+  dst[1125] &= 0x7FFF7FFFu;
+  dst[1160] = (dst[1160] & 0xFF80FF80u) | 0x00380001u;
+  dst[1161] = (dst[1161] & 0xFF80FF80u) | 0x00390001u;
+  dst[1162] = 0x00F0FC00u;
+  dst[1163] = 0xFCF0FC00u;
+  dst[1200] = (dst[1200] & 0xFF00FF00u) | 0x006E0010u;
+  dst[1201] = (dst[1201] & 0xFF00FF00u) | 0x007E0010u;
+  dst[1202] = (dst[1202] & 0x00030003u) | 0x033800C0u;
+  dst[1203] = (dst[1203] & 0x00030003u) | 0x03F800C0u;
+  dst[1240] = (dst[1240] & 0xFF00FF00u) | 0x00470038u;
+  dst[1241] = (dst[1241] & 0xFF00FF00u) | 0x007F0038u;
+  dst[1242] = (dst[1242] & 0x78017801u) | 0x021C01E0u;
+  dst[1243] = (dst[1243] & 0x78017801u) | 0x03FC01E0u;
+  dst[1280] = (dst[1280] & 0xFE00FE00u) | 0x00C70038u;
+  dst[1281] = (dst[1281] & 0xFE00FE00u) | 0x00FF0038u;
+  dst[1282] = (dst[1282] & 0x78007800u) | 0x021E01E0u;
+  dst[1283] = (dst[1283] & 0x78007800u) | 0x03FE01E0u;
+  dst[1320] = (dst[1320] & 0xFC00FC00u) | 0x00E70018u;
+  dst[1321] = (dst[1321] & 0xFC00FC00u) | 0x00FF0018u;
+  dst[1322] = (dst[1322] & 0x38003800u) | 0x821F01E0u;
+  dst[1323] = (dst[1323] & 0x38003800u) | 0x83FF01E0u;
+  dst[1324] &= 0x7FFF7FFFu;
+  dst[1325] &= 0x7FFF7FFFu;
+  dst[1360] = (dst[1360] & 0xF000F000u) | 0x03FF0000u;
+  dst[1361] = (dst[1361] & 0xF000F000u) | 0x03FF0000u;
+  dst[1362] = (dst[1362] & 0x3C003C00u) | 0x813F00C0u;
+  dst[1363] = (dst[1363] & 0x3C003C00u) | 0x81FF00C0u;
+  dst[1364] = (dst[1364] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1365] = (dst[1365] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1400] = (dst[1400] & 0xC000C000u) | 0x0E1F01E0u;
+  dst[1401] = (dst[1401] & 0xC000C000u) | 0x0FFF01E0u;
+  dst[1402] = (dst[1402] & 0x3C003C00u) | 0x81FF0000u;
+  dst[1403] = (dst[1403] & 0x3C003C00u) | 0x81FF0000u;
+  dst[1404] = (dst[1404] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1405] = (dst[1405] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1440] = (dst[1440] & 0x80008000u) | 0x383F07C0u;
+  dst[1441] = (dst[1441] & 0x80008000u) | 0x3FFF07C0u;
+  dst[1442] = (dst[1442] & 0x3C003C00u) | 0x81F80007u;
+  dst[1443] = (dst[1443] & 0x3C003C00u) | 0x81FF0007u;
+  dst[1444] = (dst[1444] & 0x01FF01FFu) | 0x78008000u;
+  dst[1445] = (dst[1445] & 0x01FF01FFu) | 0xF8008000u;
+  dst[1480] = 0x7FFF0000u;
+  dst[1481] = 0x7FFF0000u;
+  dst[1482] = (dst[1482] & 0x3E003E00u) | 0x80F0000Fu;
+  dst[1483] = (dst[1483] & 0x3E003E00u) | 0x80FF000Fu;
+  dst[1484] = (dst[1484] & 0x00FF00FFu) | 0x3E00C000u;
+  dst[1485] = (dst[1485] & 0x00FF00FFu) | 0xFE00C000u;
+  dst[1520] = 0x7FFF0000u;
+  dst[1521] = 0x7FFF0000u;
+  dst[1522] = (dst[1522] & 0x7E007E00u) | 0x00FF0000u;
+  dst[1523] = (dst[1523] & 0x7E007E00u) | 0x00FF0000u;
+  dst[1524] = (dst[1524] & 0x007F007Fu) | 0xFF000000u;
+  dst[1525] = (dst[1525] & 0x007F007Fu) | 0xFF000000u;
+  dst[1560] &= 0x80008000u;
+  dst[1561] &= 0x80008000u;
+  dst[1562] &= 0xFE00FE00u;
+  dst[1563] &= 0xFE00FE00u;
+  dst[1564] &= 0x007F007Fu;
+  dst[1565] &= 0x007F007Fu;
+}
+
+static void img_loserboy_f21_s1(uint32_t *dst) {
+  dst[40] &= 0xFFF8FFF8u;
+  dst[41] &= 0xFFF8FFF8u;
+  dst[42] &= 0x0FFF0FFFu;
+  dst[43] &= 0x0FFF0FFFu;
+  dst[80] = (dst[80] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[81] = (dst[81] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[82] = (dst[82] & 0x01FF01FFu) | 0xF0000000u;
+  dst[83] = (dst[83] & 0x01FF01FFu) | 0xF0000000u;
+  dst[120] = (dst[120] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[121] = (dst[121] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[122] = (dst[122] & 0x007F007Fu) | 0xFC000000u;
+  dst[123] = (dst[123] & 0x007F007Fu) | 0xFC000000u;
+  dst[160] = (dst[160] & 0xFF80FF80u) | 0x003F0000u;
+  dst[161] = (dst[161] & 0xFF80FF80u) | 0x003F0000u;
+  dst[162] = (dst[162] & 0x003F003Fu) | 0xFF800000u;
+  dst[163] = (dst[163] & 0x003F003Fu) | 0xFF800000u;
+  dst[200] = (dst[200] & 0xFF00FF00u) | 0x007F0000u;
+  dst[201] = (dst[201] & 0xFF00FF00u) | 0x007F0000u;
+  dst[202] = (dst[202] & 0x001F001Fu) | 0xFFC00000u;
+  dst[203] = (dst[203] & 0x001F001Fu) | 0xFFC00000u;
+  dst[240] = (dst[240] & 0xFF00FF00u) | 0x007F0000u;
+  dst[241] = (dst[241] & 0xFF00FF00u) | 0x007F0000u;
+  dst[242] = (dst[242] & 0x001F001Fu) | 0xFFC00000u;
+  dst[243] = (dst[243] & 0x001F001Fu) | 0xFFC00000u;
+  dst[280] = (dst[280] & 0xFF00FF00u) | 0x007E0000u;
+  dst[281] = (dst[281] & 0xFF00FF00u) | 0x007E0000u;
+  dst[282] = (dst[282] & 0x001F001Fu) | 0x38C00000u;
+  dst[283] = (dst[283] & 0x001F001Fu) | 0x38C00000u;
+  dst[320] = (dst[320] & 0xFF00FF00u) | 0x005C0000u;
+  dst[321] = (dst[321] & 0xFF00FF00u) | 0x005C0000u;
+  dst[322] = (dst[322] & 0x001F001Fu) | 0xCB408000u;
+  dst[323] = (dst[323] & 0x001F001Fu) | 0xCB40C300u;
+  dst[360] = (dst[360] & 0xFF80FF80u) | 0x00280002u;
+  dst[361] = (dst[361] & 0xFF80FF80u) | 0x002A0002u;
+  dst[362] = (dst[362] & 0x001F001Fu) | 0xF380C000u;
+  dst[363] = (dst[363] & 0x001F001Fu) | 0xE380F380u;
+  dst[400] = (dst[400] & 0xFF80FF80u) | 0x00240002u;
+  dst[401] = (dst[401] & 0xFF80FF80u) | 0x00260006u;
+  dst[402] = (dst[402] & 0x003F003Fu) | 0xFF80C000u;
+  dst[403] = (dst[403] & 0x003F003Fu) | 0xFF80FF80u;
+  dst[440] = (dst[440] & 0xFF80FF80u) | 0x006D001Au;
+  dst[441] = (dst[441] & 0xFF80FF80u) | 0x003F005Eu;
+  dst[442] = (dst[442] & 0x003F003Fu) | 0xFF80C000u;
+  dst[443] = (dst[443] & 0x003F003Fu) | 0xFF80FF80u;
+  dst[480] = (dst[480] & 0xFF80FF80u) | 0x007F0033u;
+  dst[481] = (dst[481] & 0xFF80FF80u) | 0x003F007Fu;
+  dst[482] = (dst[482] & 0x003F003Fu) | 0xFF008000u;
+  dst[483] = (dst[483] & 0x003F003Fu) | 0xFF00FF00u;
+  dst[520] = (dst[520] & 0xFF80FF80u) | 0x007F0000u;
+  dst[521] = (dst[521] & 0xFF80FF80u) | 0x003E007Fu;
+  dst[522] = (dst[522] & 0x001F001Fu) | 0xFC000000u;
+  dst[523] = (dst[523] & 0x001F001Fu) | 0x7C00FC00u;
+  dst[560] = (dst[560] & 0xFFC0FFC0u) | 0x003F0000u;
+  dst[561] = (dst[561] & 0xFFC0FFC0u) | 0x001D003Fu;
+  dst[562] = (dst[562] & 0x000F000Fu) | 0xF8000100u;
+  dst[563] = (dst[563] & 0x000F000Fu) | 0xF360F800u;
+  dst[600] = (dst[600] & 0xFFE0FFE0u) | 0x001F0000u;
+  dst[601] = (dst[601] & 0xFFE0FFE0u) | 0x0007001Fu;
+  dst[602] = (dst[602] & 0x00070007u) | 0xF0000640u;
+  dst[603] = (dst[603] & 0x00070007u) | 0xC6F0F000u;
+  dst[640] &= 0xFFF8FFF8u;
+  dst[641] &= 0xFFF8FFF8u;
+  dst[642] = (dst[642] & 0x00030003u) | 0x60000260u;
+  dst[643] = (dst[643] & 0x00030003u) | 0x0EF06000u;
+  dst[680] = (dst[680] & 0xFFF8FFF8u) | 0x00000002u;
+  dst[681] = (dst[681] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[682] = (dst[682] & 0x00010001u) | 0xE00000C8u;
+  dst[683] = (dst[683] & 0x00010001u) | 0x00C8E000u;
+  dst[720] = (dst[720] & 0xFC78FC78u) | 0x00000002u;
+  dst[721] = (dst[721] & 0xFC78FC78u) | 0x00020000u;
+  dst[722] = 0x00181026u;
+  dst[723] = 0x16BE1000u;
+  dst[760] = (dst[760] & 0xF800F800u) | 0x03800002u;
+  dst[761] = (dst[761] & 0xF800F800u) | 0x03820380u;
+  dst[762] = 0x003CF042u;
+  dst[763] = 0xF67EF000u;
+  dst[800] = (dst[800] & 0xF000F000u) | 0x07D00006u;
+  dst[801] = (dst[801] & 0xF000F000u) | 0x07D607D0u;
+  dst[802] = 0x0078F004u;
+  dst[803] = 0xF77CF000u;
+  dst[840] = (dst[840] & 0xF000F000u) | 0x07D00006u;
+  dst[841] = (dst[841] & 0xF000F000u) | 0x07D607D0u;
+  dst[842] = 0x0023F850u;
+  dst[843] = 0xFB73F803u;
+  dst[844] &= 0x7FFF7FFFu;
+  dst[845] &= 0x7FFF7FFFu;
+  dst[880] = (dst[880] & 0xF000F000u) | 0x07B00006u;
+  dst[881] = (dst[881] & 0xF000F000u) | 0x07B607B0u;
+  dst[882] = 0x000FF860u;
+  dst[883] = 0xFB6FF80Fu;
+  dst[884] &= 0x7FFF7FFFu;
+  dst[885] &= 0x7FFF7FFFu;
+  dst[920] = (dst[920] & 0xF000F000u) | 0x07800006u;
+  dst[921] = (dst[921] & 0xF000F000u) | 0x07860780u;
+  dst[922] = (dst[922] & 0x00100010u) | 0x0007F800u;
+  dst[923] = (dst[923] & 0x00100010u) | 0xFB87F807u;
+  dst[924] = (dst[924] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[925] = (dst[925] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[960] = (dst[960] & 0xF860F860u) | 0x00000005u;
+  dst[961] = (dst[961] & 0xF860F860u) | 0x000D0001u;
+  dst[962] = (dst[962] & 0x00380038u) | 0x0003F800u;
+  dst[963] = (dst[963] & 0x00380038u) | 0xFB83F803u;
+  dst[964] = (dst[964] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[965] = (dst[965] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[1000] = (dst[1000] & 0xFFE0FFE0u) | 0x00000005u;
+  dst[1001] = (dst[1001] & 0xFFE0FFE0u) | 0x000D0001u;
+  dst[1002] = (dst[1002] & 0x00100010u) | 0x0007FC00u;
+  dst[1003] = (dst[1003] & 0x00100010u) | 0xFDC7FC07u;
+  dst[1004] = (dst[1004] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1005] = (dst[1005] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[1040] = (dst[1040] & 0xFFE0FFE0u) | 0x00000005u;
+  dst[1041] = (dst[1041] & 0xFFE0FFE0u) | 0x000D0001u;
+  dst[1042] = 0x0007FC00u;
+  dst[1043] = 0xFDE7FC07u;
+  dst[1044] = (dst[1044] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1045] = (dst[1045] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[1080] = (dst[1080] & 0xFFC0FFC0u) | 0x00000001u;
+  dst[1081] = (dst[1081] & 0xFFC0FFC0u) | 0x001D0001u;
+  dst[1082] = 0x000FFE00u;
+  dst[1083] = 0xFEEFFE0Fu;
+  dst[1084] = (dst[1084] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1085] = (dst[1085] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[1120] = (dst[1120] & 0xFFC0FFC0u) | 0x00000003u;
+  dst[1121] = (dst[1121] & 0xFFC0FFC0u) | 0x00030003u;
+  dst[1122] = 0x0007FF00u;
+  dst[1123] = 0xFF07FF07u;
+  dst[1124] = (dst[1124] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1125] = (dst[1125] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[1160] = (dst[1160] & 0xFFC0FFC0u) | 0x001C0000u;
+  dst[1161] = (dst[1161] & 0xFFC0FFC0u) | 0x001C0000u;
+  dst[1162] = 0x0078FE00u;
+  dst[1163] = 0xFE78FE00u;
+  dst[1164] &= 0x7FFF7FFFu;
+  dst[1165] &= 0x7FFF7FFFu;
+  dst[1200] = (dst[1200] & 0xFF80FF80u) | 0x00370008u;
+  dst[1201] = (dst[1201] & 0xFF80FF80u) | 0x003F0008u;
+  dst[1202] = (dst[1202] & 0x00010001u) | 0x019C0060u;
+  dst[1203] = (dst[1203] & 0x00010001u) | 0x01FC0060u;
+  dst[1240] = (dst[1240] & 0xFF80FF80u) | 0x0023001Cu;
+  dst[1241] = (dst[1241] & 0xFF80FF80u) | 0x003F001Cu;
+  dst[1242] = (dst[1242] & 0x3C003C00u) | 0x810E00F0u;
+  dst[1243] = (dst[1243] & 0x3C003C00u) | 0x81FE00F0u;
+  dst[1280] = (dst[1280] & 0xFF00FF00u) | 0x0063001Cu;
+  dst[1281] = (dst[1281] & 0xFF00FF00u) | 0x007F001Cu;
+  dst[1282] = (dst[1282] & 0x3C003C00u) | 0x810F00F0u;
+  dst[1283] = (dst[1283] & 0x3C003C00u) | 0x81FF00F0u;
+  dst[1284] &= 0x7FFF7FFFu;
+  dst[1285] &= 0x7FFF7FFFu;
+  dst[1320] = (dst[1320] & 0xFE00FE00u) | 0x0073000Cu;
+  dst[1321] = (dst[1321] & 0xFE00FE00u) | 0x007F000Cu;
+  dst[1322] = (dst[1322] & 0x1C001C00u) | 0xC10F00F0u;
+  dst[1323] = (dst[1323] & 0x1C001C00u) | 0xC1FF00F0u;
+  dst[1324] = (dst[1324] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1325] = (dst[1325] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1360] = (dst[1360] & 0xF800F800u) | 0x01FF0000u;
+  dst[1361] = (dst[1361] & 0xF800F800u) | 0x01FF0000u;
+  dst[1362] = (dst[1362] & 0x1E001E00u) | 0xC09F0060u;
+  dst[1363] = (dst[1363] & 0x1E001E00u) | 0xC0FF0060u;
+  dst[1364] = (dst[1364] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1365] = (dst[1365] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1400] = (dst[1400] & 0xE000E000u) | 0x070F00F0u;
+  dst[1401] = (dst[1401] & 0xE000E000u) | 0x07FF00F0u;
+  dst[1402] = (dst[1402] & 0x1E001E00u) | 0xC0FF0000u;
+  dst[1403] = (dst[1403] & 0x1E001E00u) | 0xC0FF0000u;
+  dst[1404] = (dst[1404] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1405] = (dst[1405] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1440] = (dst[1440] & 0xC000C000u) | 0x1C1F03E0u;
+  dst[1441] = (dst[1441] & 0xC000C000u) | 0x1FFF03E0u;
+  dst[1442] = (dst[1442] & 0x1E001E00u) | 0xC0FC0003u;
+  dst[1443] = (dst[1443] & 0x1E001E00u) | 0xC0FF0003u;
+  dst[1444] = (dst[1444] & 0x00FF00FFu) | 0x3C00C000u;
+  dst[1445] = (dst[1445] & 0x00FF00FFu) | 0xFC00C000u;
+  dst[1480] = (dst[1480] & 0x80008000u) | 0x3FFF0000u;
+  dst[1481] = (dst[1481] & 0x80008000u) | 0x3FFF0000u;
+  dst[1482] = (dst[1482] & 0x1F001F00u) | 0xC0780007u;
+  dst[1483] = (dst[1483] & 0x1F001F00u) | 0xC07F0007u;
+  dst[1484] = (dst[1484] & 0x007F007Fu) | 0x1F00E000u;
+  dst[1485] = (dst[1485] & 0x007F007Fu) | 0xFF00E000u;
+  dst[1520] = (dst[1520] & 0x80008000u) | 0x3FFF0000u;
+  dst[1521] = (dst[1521] & 0x80008000u) | 0x3FFF0000u;
+  dst[1522] = (dst[1522] & 0x3F003F00u) | 0x807F0000u;
+  dst[1523] = (dst[1523] & 0x3F003F00u) | 0x807F0000u;
+  dst[1524] = (dst[1524] & 0x003F003Fu) | 0xFF800000u;
+  dst[1525] = (dst[1525] & 0x003F003Fu) | 0xFF800000u;
+  dst[1560] &= 0xC000C000u;
+  dst[1561] &= 0xC000C000u;
+  dst[1562] &= 0x7F007F00u;
+  dst[1563] &= 0x7F007F00u;
+  dst[1564] &= 0x003F003Fu;
+  dst[1565] &= 0x003F003Fu;
+}
+
+static void img_loserboy_f21_s2(uint32_t *dst) {
+  dst[40] &= 0xFFFCFFFCu;
+  dst[41] &= 0xFFFCFFFCu;
+  dst[42] &= 0x07FF07FFu;
+  dst[43] &= 0x07FF07FFu;
+  dst[80] = (dst[80] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[81] = (dst[81] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[82] = (dst[82] & 0x00FF00FFu) | 0xF8000000u;
+  dst[83] = (dst[83] & 0x00FF00FFu) | 0xF8000000u;
+  dst[120] = (dst[120] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[121] = (dst[121] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[122] = (dst[122] & 0x003F003Fu) | 0xFE000000u;
+  dst[123] = (dst[123] & 0x003F003Fu) | 0xFE000000u;
+  dst[160] = (dst[160] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[161] = (dst[161] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[162] = (dst[162] & 0x001F001Fu) | 0xFFC00000u;
+  dst[163] = (dst[163] & 0x001F001Fu) | 0xFFC00000u;
+  dst[200] = (dst[200] & 0xFF80FF80u) | 0x003F0000u;
+  dst[201] = (dst[201] & 0xFF80FF80u) | 0x003F0000u;
+  dst[202] = (dst[202] & 0x000F000Fu) | 0xFFE00000u;
+  dst[203] = (dst[203] & 0x000F000Fu) | 0xFFE00000u;
+  dst[240] = (dst[240] & 0xFF80FF80u) | 0x003F0000u;
+  dst[241] = (dst[241] & 0xFF80FF80u) | 0x003F0000u;
+  dst[242] = (dst[242] & 0x000F000Fu) | 0xFFE00000u;
+  dst[243] = (dst[243] & 0x000F000Fu) | 0xFFE00000u;
+  dst[280] = (dst[280] & 0xFF80FF80u) | 0x003F0000u;
+  dst[281] = (dst[281] & 0xFF80FF80u) | 0x003F0000u;
+  dst[282] = (dst[282] & 0x000F000Fu) | 0x1C600000u;
+  dst[283] = (dst[283] & 0x000F000Fu) | 0x1C600000u;
+  dst[320] = (dst[320] & 0xFF80FF80u) | 0x002E0000u;
+  dst[321] = (dst[321] & 0xFF80FF80u) | 0x002E0000u;
+  dst[322] = (dst[322] & 0x000F000Fu) | 0x65A04000u;
+  dst[323] = (dst[323] & 0x000F000Fu) | 0x65A06180u;
+  dst[360] = (dst[360] & 0xFFC0FFC0u) | 0x00140001u;
+  dst[361] = (dst[361] & 0xFFC0FFC0u) | 0x00150001u;
+  dst[362] = (dst[362] & 0x000F000Fu) | 0x79C06000u;
+  dst[363] = (dst[363] & 0x000F000Fu) | 0x71C079C0u;
+  dst[400] = (dst[400] & 0xFFC0FFC0u) | 0x00120001u;
+  dst[401] = (dst[401] & 0xFFC0FFC0u) | 0x00130003u;
+  dst[402] = (dst[402] & 0x001F001Fu) | 0x7FC06000u;
+  dst[403] = (dst[403] & 0x001F001Fu) | 0x7FC07FC0u;
+  dst[440] = (dst[440] & 0xFFC0FFC0u) | 0x0036000Du;
+  dst[441] = (dst[441] & 0xFFC0FFC0u) | 0x001F002Fu;
+  dst[442] = (dst[442] & 0x001F001Fu) | 0xFFC06000u;
+  dst[443] = (dst[443] & 0x001F001Fu) | 0xFFC07FC0u;
+  dst[480] = (dst[480] & 0xFFC0FFC0u) | 0x003F0019u;
+  dst[481] = (dst[481] & 0xFFC0FFC0u) | 0x001F003Fu;
+  dst[482] = (dst[482] & 0x001F001Fu) | 0xFF80C000u;
+  dst[483] = (dst[483] & 0x001F001Fu) | 0xFF80FF80u;
+  dst[520] = (dst[520] & 0xFFC0FFC0u) | 0x003F0000u;
+  dst[521] = (dst[521] & 0xFFC0FFC0u) | 0x001F003Fu;
+  dst[522] = (dst[522] & 0x000F000Fu) | 0xFE000000u;
+  dst[523] = (dst[523] & 0x000F000Fu) | 0x3E00FE00u;
+  dst[560] = (dst[560] & 0xFFE0FFE0u) | 0x001F0000u;
+  dst[561] = (dst[561] & 0xFFE0FFE0u) | 0x000E001Fu;
+  dst[562] = (dst[562] & 0x00070007u) | 0xFC000080u;
+  dst[563] = (dst[563] & 0x00070007u) | 0xF9B0FC00u;
+  dst[600] = (dst[600] & 0xFFF0FFF0u) | 0x000F0000u;
+  dst[601] = (dst[601] & 0xFFF0FFF0u) | 0x0003000Fu;
+  dst[602] = (dst[602] & 0x00030003u) | 0xF8000320u;
+  dst[603] = (dst[603] & 0x00030003u) | 0xE378F800u;
+  dst[640] &= 0xFFFCFFFCu;
+  dst[641] &= 0xFFFCFFFCu;
+  dst[642] = (dst[642] & 0x00010001u) | 0x30000130u;
+  dst[643] = (dst[643] & 0x00010001u) | 0x07783000u;
+  dst[680] = (dst[680] & 0xFFFCFFFCu) | 0x00000001u;
+  dst[681] = (dst[681] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[682] = 0x70000064u;
+  dst[683] = 0x00647000u;
+  dst[720] = (dst[720] & 0xFE3CFE3Cu) | 0x00000001u;
+  dst[721] = (dst[721] & 0xFE3CFE3Cu) | 0x00010000u;
+  dst[722] = 0x000C0813u;
+  dst[723] = 0x0B5F0800u;
+  dst[724] &= 0x7FFF7FFFu;
+  dst[725] &= 0x7FFF7FFFu;
+  dst[760] = (dst[760] & 0xFC00FC00u) | 0x01C00001u;
+  dst[761] = (dst[761] & 0xFC00FC00u) | 0x01C101C0u;
+  dst[762] = 0x001E7821u;
+  dst[763] = 0x7B3F7800u;
+  dst[764] &= 0x7FFF7FFFu;
+  dst[765] &= 0x7FFF7FFFu;
+  dst[800] = (dst[800] & 0xF800F800u) | 0x03E80003u;
+  dst[801] = (dst[801] & 0xF800F800u) | 0x03EB03E8u;
+  dst[802] = 0x003C7802u;
+  dst[803] = 0x7BBE7800u;
+  dst[804] &= 0x7FFF7FFFu;
+  dst[805] &= 0x7FFF7FFFu;
+  dst[840] = (dst[840] & 0xF800F800u) | 0x03E80003u;
+  dst[841] = (dst[841] & 0xF800F800u) | 0x03EB03E8u;
+  dst[842] = 0x00117C28u;
+  dst[843] = 0x7DB97C01u;
+  dst[844] = (dst[844] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[845] = (dst[845] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[880] = (dst[880] & 0xF800F800u) | 0x03D80003u;
+  dst[881] = (dst[881] & 0xF800F800u) | 0x03DB03D8u;
+  dst[882] = 0x00077C30u;
+  dst[883] = 0x7DB77C07u;
+  dst[884] = (dst[884] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[885] = (dst[885] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[920] = (dst[920] & 0xF800F800u) | 0x03C00003u;
+  dst[921] = (dst[921] & 0xF800F800u) | 0x03C303C0u;
+  dst[922] = (dst[922] & 0x00080008u) | 0x00037C00u;
+  dst[923] = (dst[923] & 0x00080008u) | 0x7DC37C03u;
+  dst[924] = (dst[924] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[925] = (dst[925] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[960] = (dst[960] & 0xFC30FC30u) | 0x00000002u;
+  dst[961] = (dst[961] & 0xFC30FC30u) | 0x00060000u;
+  dst[962] = (dst[962] & 0x001C001Cu) | 0x0001FC00u;
+  dst[963] = (dst[963] & 0x001C001Cu) | 0xFDC1FC01u;
+  dst[964] = (dst[964] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[965] = (dst[965] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[1000] = (dst[1000] & 0xFFF0FFF0u) | 0x00000002u;
+  dst[1001] = (dst[1001] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[1002] = (dst[1002] & 0x00080008u) | 0x0003FE00u;
+  dst[1003] = (dst[1003] & 0x00080008u) | 0xFEE3FE03u;
+  dst[1004] = (dst[1004] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1005] = (dst[1005] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[1040] = (dst[1040] & 0xFFF0FFF0u) | 0x00000002u;
+  dst[1041] = (dst[1041] & 0xFFF0FFF0u) | 0x00060000u;
+  dst[1042] = 0x0003FE00u;
+  dst[1043] = 0xFEF3FE03u;
+  dst[1044] = (dst[1044] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1045] = (dst[1045] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[1080] &= 0xFFE0FFE0u;
+  dst[1081] = (dst[1081] & 0xFFE0FFE0u) | 0x000E0000u;
+  dst[1082] = 0x0007FF00u;
+  dst[1083] = 0xFF77FF07u;
+  dst[1084] = (dst[1084] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1085] = (dst[1085] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[1120] = (dst[1120] & 0xFFE0FFE0u) | 0x00000001u;
+  dst[1121] = (dst[1121] & 0xFFE0FFE0u) | 0x00010001u;
+  dst[1122] = 0x0003FF80u;
+  dst[1123] = 0xFF83FF83u;
+  dst[1124] = (dst[1124] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1125] = (dst[1125] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[1160] = (dst[1160] & 0xFFE0FFE0u) | 0x000E0000u;
+  dst[1161] = (dst[1161] & 0xFFE0FFE0u) | 0x000E0000u;
+  dst[1162] = 0x003C7F00u;
+  dst[1163] = 0x7F3C7F00u;
+  dst[1164] &= 0x3FFF3FFFu;
+  dst[1165] &= 0x3FFF3FFFu;
+  dst[1200] = (dst[1200] & 0xFFC0FFC0u) | 0x001B0004u;
+  dst[1201] = (dst[1201] & 0xFFC0FFC0u) | 0x001F0004u;
+  dst[1202] = 0x80CE0030u;
+  dst[1203] = 0x80FE0030u;
+  dst[1240] = (dst[1240] & 0xFFC0FFC0u) | 0x0011000Eu;
+  dst[1241] = (dst[1241] & 0xFFC0FFC0u) | 0x001F000Eu;
+  dst[1242] = (dst[1242] & 0x1E001E00u) | 0xC0870078u;
+  dst[1243] = (dst[1243] & 0x1E001E00u) | 0xC0FF0078u;
+  dst[1244] &= 0x7FFF7FFFu;
+  dst[1245] &= 0x7FFF7FFFu;
+  dst[1280] = (dst[1280] & 0xFF80FF80u) | 0x0031000Eu;
+  dst[1281] = (dst[1281] & 0xFF80FF80u) | 0x003F000Eu;
+  dst[1282] = (dst[1282] & 0x1E001E00u) | 0xC0870078u;
+  dst[1283] = (dst[1283] & 0x1E001E00u) | 0xC0FF0078u;
+  dst[1284] = (dst[1284] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1285] = (dst[1285] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1320] = (dst[1320] & 0xFF00FF00u) | 0x00390006u;
+  dst[1321] = (dst[1321] & 0xFF00FF00u) | 0x003F0006u;
+  dst[1322] = (dst[1322] & 0x0E000E00u) | 0xE0870078u;
+  dst[1323] = (dst[1323] & 0x0E000E00u) | 0xE0FF0078u;
+  dst[1324] = (dst[1324] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1325] = (dst[1325] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1360] = (dst[1360] & 0xFC00FC00u) | 0x00FF0000u;
+  dst[1361] = (dst[1361] & 0xFC00FC00u) | 0x00FF0000u;
+  dst[1362] = (dst[1362] & 0x0F000F00u) | 0xE04F0030u;
+  dst[1363] = (dst[1363] & 0x0F000F00u) | 0xE07F0030u;
+  dst[1364] = (dst[1364] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1365] = (dst[1365] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1400] = (dst[1400] & 0xF000F000u) | 0x03870078u;
+  dst[1401] = (dst[1401] & 0xF000F000u) | 0x03FF0078u;
+  dst[1402] = (dst[1402] & 0x0F000F00u) | 0xE07F0000u;
+  dst[1403] = (dst[1403] & 0x0F000F00u) | 0xE07F0000u;
+  dst[1404] = (dst[1404] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1405] = (dst[1405] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1440] = (dst[1440] & 0xE000E000u) | 0x0E0F01F0u;
+  dst[1441] = (dst[1441] & 0xE000E000u) | 0x0FFF01F0u;
+  dst[1442] = (dst[1442] & 0x0F000F00u) | 0xE07E0001u;
+  dst[1443] = (dst[1443] & 0x0F000F00u) | 0xE07F0001u;
+  dst[1444] = (dst[1444] & 0x007F007Fu) | 0x1E00E000u;
+  dst[1445] = (dst[1445] & 0x007F007Fu) | 0xFE00E000u;
+  dst[1480] = (dst[1480] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1481] = (dst[1481] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1482] = (dst[1482] & 0x0F800F80u) | 0xE03C0003u;
+  dst[1483] = (dst[1483] & 0x0F800F80u) | 0xE03F0003u;
+  dst[1484] = (dst[1484] & 0x003F003Fu) | 0x0F80F000u;
+  dst[1485] = (dst[1485] & 0x003F003Fu) | 0xFF80F000u;
+  dst[1520] = (dst[1520] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1521] = (dst[1521] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1522] = (dst[1522] & 0x1F801F80u) | 0xC03F0000u;
+  dst[1523] = (dst[1523] & 0x1F801F80u) | 0xC03F0000u;
+  dst[1524] = (dst[1524] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1525] = (dst[1525] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1560] &= 0xE000E000u;
+  dst[1561] &= 0xE000E000u;
+  dst[1562] &= 0x3F803F80u;
+  dst[1563] &= 0x3F803F80u;
+  dst[1564] &= 0x001F001Fu;
+  dst[1565] &= 0x001F001Fu;
+}
+
+static void img_loserboy_f21_s3(uint32_t *dst) {
+  dst[40] &= 0xFFFEFFFEu;
+  dst[41] &= 0xFFFEFFFEu;
+  dst[42] &= 0x03FF03FFu;
+  dst[43] &= 0x03FF03FFu;
+  dst[80] = (dst[80] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[81] = (dst[81] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[82] = (dst[82] & 0x007F007Fu) | 0xFC000000u;
+  dst[83] = (dst[83] & 0x007F007Fu) | 0xFC000000u;
+  dst[120] = (dst[120] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[121] = (dst[121] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[122] = (dst[122] & 0x001F001Fu) | 0xFF000000u;
+  dst[123] = (dst[123] & 0x001F001Fu) | 0xFF000000u;
+  dst[160] = (dst[160] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[161] = (dst[161] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[162] = (dst[162] & 0x000F000Fu) | 0xFFE00000u;
+  dst[163] = (dst[163] & 0x000F000Fu) | 0xFFE00000u;
+  dst[200] = (dst[200] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[201] = (dst[201] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[202] = (dst[202] & 0x00070007u) | 0xFFF00000u;
+  dst[203] = (dst[203] & 0x00070007u) | 0xFFF00000u;
+  dst[240] = (dst[240] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[241] = (dst[241] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[242] = (dst[242] & 0x00070007u) | 0xFFF00000u;
+  dst[243] = (dst[243] & 0x00070007u) | 0xFFF00000u;
+  dst[280] = (dst[280] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[281] = (dst[281] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[282] = (dst[282] & 0x00070007u) | 0x8E300000u;
+  dst[283] = (dst[283] & 0x00070007u) | 0x8E300000u;
+  dst[320] = (dst[320] & 0xFFC0FFC0u) | 0x00170000u;
+  dst[321] = (dst[321] & 0xFFC0FFC0u) | 0x00170000u;
+  dst[322] = (dst[322] & 0x00070007u) | 0x32D02000u;
+  dst[323] = (dst[323] & 0x00070007u) | 0x32D030C0u;
+  dst[360] = (dst[360] & 0xFFE0FFE0u) | 0x000A0000u;
+  dst[361] = (dst[361] & 0xFFE0FFE0u) | 0x000A0000u;
+  dst[362] = (dst[362] & 0x00070007u) | 0x3CE0B000u;
+  dst[363] = (dst[363] & 0x00070007u) | 0xB8E0BCE0u;
+  dst[400] = (dst[400] & 0xFFE0FFE0u) | 0x00090000u;
+  dst[401] = (dst[401] & 0xFFE0FFE0u) | 0x00090001u;
+  dst[402] = (dst[402] & 0x000F000Fu) | 0x3FE0B000u;
+  dst[403] = (dst[403] & 0x000F000Fu) | 0xBFE0BFE0u;
+  dst[440] = (dst[440] & 0xFFE0FFE0u) | 0x001B0006u;
+  dst[441] = (dst[441] & 0xFFE0FFE0u) | 0x000F0017u;
+  dst[442] = (dst[442] & 0x000F000Fu) | 0x7FE0B000u;
+  dst[443] = (dst[443] & 0x000F000Fu) | 0xFFE0BFE0u;
+  dst[480] = (dst[480] & 0xFFE0FFE0u) | 0x001F000Cu;
+  dst[481] = (dst[481] & 0xFFE0FFE0u) | 0x000F001Fu;
+  dst[482] = (dst[482] & 0x000F000Fu) | 0xFFC0E000u;
+  dst[483] = (dst[483] & 0x000F000Fu) | 0xFFC0FFC0u;
+  dst[520] = (dst[520] & 0xFFE0FFE0u) | 0x001F0000u;
+  dst[521] = (dst[521] & 0xFFE0FFE0u) | 0x000F001Fu;
+  dst[522] = (dst[522] & 0x00070007u) | 0xFF000000u;
+  dst[523] = (dst[523] & 0x00070007u) | 0x9F00FF00u;
+  dst[560] = (dst[560] & 0xFFF0FFF0u) | 0x000F0000u;
+  dst[561] = (dst[561] & 0xFFF0FFF0u) | 0x0007000Fu;
+  dst[562] = (dst[562] & 0x00030003u) | 0xFE000040u;
+  dst[563] = (dst[563] & 0x00030003u) | 0x7CD8FE00u;
+  dst[600] = (dst[600] & 0xFFF8FFF8u) | 0x00070000u;
+  dst[601] = (dst[601] & 0xFFF8FFF8u) | 0x00010007u;
+  dst[602] = (dst[602] & 0x00010001u) | 0xFC000190u;
+  dst[603] = (dst[603] & 0x00010001u) | 0xF1BCFC00u;
+  dst[640] &= 0xFFFEFFFEu;
+  dst[641] &= 0xFFFEFFFEu;
+  dst[642] = 0x18000098u;
+  dst[643] = 0x03BC1800u;
+  dst[680] &= 0xFFFEFFFEu;
+  dst[681] &= 0xFFFEFFFEu;
+  dst[682] = 0x38008032u;
+  dst[683] = 0x80323800u;
+  dst[684] &= 0x7FFF7FFFu;
+  dst[685] &= 0x7FFF7FFFu;
+  dst[720] &= 0xFF1EFF1Eu;
+  dst[721] &= 0xFF1EFF1Eu;
+  dst[722] = 0x00068409u;
+  dst[723] = 0x85AF0400u;
+  dst[724] = (dst[724] & 0x3FFF3FFFu) | 0x00008000u;
+  dst[725] = (dst[725] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[760] = (dst[760] & 0xFE00FE00u) | 0x00E00000u;
+  dst[761] = (dst[761] & 0xFE00FE00u) | 0x00E000E0u;
+  dst[762] = 0x000FBC10u;
+  dst[763] = 0xBD9F3C00u;
+  dst[764] = (dst[764] & 0x3FFF3FFFu) | 0x00008000u;
+  dst[765] = (dst[765] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[800] = (dst[800] & 0xFC00FC00u) | 0x01F40001u;
+  dst[801] = (dst[801] & 0xFC00FC00u) | 0x01F501F4u;
+  dst[802] = 0x001EBC01u;
+  dst[803] = 0xBDDF3C00u;
+  dst[804] &= 0x3FFF3FFFu;
+  dst[805] &= 0x3FFF3FFFu;
+  dst[840] = (dst[840] & 0xFC00FC00u) | 0x01F40001u;
+  dst[841] = (dst[841] & 0xFC00FC00u) | 0x01F501F4u;
+  dst[842] = 0x0008BE14u;
+  dst[843] = 0xBEDC3E00u;
+  dst[844] = (dst[844] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[845] = (dst[845] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[880] = (dst[880] & 0xFC00FC00u) | 0x01EC0001u;
+  dst[881] = (dst[881] & 0xFC00FC00u) | 0x01ED01ECu;
+  dst[882] = 0x0003BE18u;
+  dst[883] = 0xBEDB3E03u;
+  dst[884] = (dst[884] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[885] = (dst[885] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[920] = (dst[920] & 0xFC00FC00u) | 0x01E00001u;
+  dst[921] = (dst[921] & 0xFC00FC00u) | 0x01E101E0u;
+  dst[922] = (dst[922] & 0x00040004u) | 0x0001BE00u;
+  dst[923] = (dst[923] & 0x00040004u) | 0xBEE13E01u;
+  dst[924] = (dst[924] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[925] = (dst[925] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[960] = (dst[960] & 0xFE18FE18u) | 0x00000001u;
+  dst[961] = (dst[961] & 0xFE18FE18u) | 0x00030000u;
+  dst[962] = (dst[962] & 0x000E000Eu) | 0x00007E00u;
+  dst[963] = (dst[963] & 0x000E000Eu) | 0x7EE07E00u;
+  dst[964] = (dst[964] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[965] = (dst[965] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[1000] = (dst[1000] & 0xFFF8FFF8u) | 0x00000001u;
+  dst[1001] = (dst[1001] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1002] = (dst[1002] & 0x00040004u) | 0x00017F00u;
+  dst[1003] = (dst[1003] & 0x00040004u) | 0x7F717F01u;
+  dst[1004] = (dst[1004] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1005] = (dst[1005] & 0x07FF07FFu) | 0xF000F000u;
+  dst[1040] = (dst[1040] & 0xFFF8FFF8u) | 0x00000001u;
+  dst[1041] = (dst[1041] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1042] = 0x00017F00u;
+  dst[1043] = 0x7F797F01u;
+  dst[1044] = (dst[1044] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1045] = (dst[1045] & 0x07FF07FFu) | 0xF000F000u;
+  dst[1080] &= 0xFFF0FFF0u;
+  dst[1081] = (dst[1081] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1082] = 0x00037F80u;
+  dst[1083] = 0x7FBB7F83u;
+  dst[1084] = (dst[1084] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1085] = (dst[1085] & 0x07FF07FFu) | 0xF000F000u;
+  dst[1120] &= 0xFFF0FFF0u;
+  dst[1121] &= 0xFFF0FFF0u;
+  dst[1122] = 0x0001FFC0u;
+  dst[1123] = 0xFFC1FFC1u;
+  dst[1124] = (dst[1124] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1125] = (dst[1125] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[1160] = (dst[1160] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1161] = (dst[1161] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1162] = 0x001E3F80u;
+  dst[1163] = 0x3F9E3F80u;
+  dst[1164] &= 0x1FFF1FFFu;
+  dst[1165] &= 0x1FFF1FFFu;
+  dst[1200] = (dst[1200] & 0xFFE0FFE0u) | 0x000D0002u;
+  dst[1201] = (dst[1201] & 0xFFE0FFE0u) | 0x000F0002u;
+  dst[1202] = 0xC0670018u;
+  dst[1203] = 0xC07F0018u;
+  dst[1204] &= 0x7FFF7FFFu;
+  dst[1205] &= 0x7FFF7FFFu;
+  dst[1240] = (dst[1240] & 0xFFE0FFE0u) | 0x00080007u;
+  dst[1241] = (dst[1241] & 0xFFE0FFE0u) | 0x000F0007u;
+  dst[1242] = (dst[1242] & 0x0F000F00u) | 0xE043003Cu;
+  dst[1243] = (dst[1243] & 0x0F000F00u) | 0xE07F003Cu;
+  dst[1244] = (dst[1244] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1245] = (dst[1245] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1280] = (dst[1280] & 0xFFC0FFC0u) | 0x00180007u;
+  dst[1281] = (dst[1281] & 0xFFC0FFC0u) | 0x001F0007u;
+  dst[1282] = (dst[1282] & 0x0F000F00u) | 0xE043003Cu;
+  dst[1283] = (dst[1283] & 0x0F000F00u) | 0xE07F003Cu;
+  dst[1284] = (dst[1284] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1285] = (dst[1285] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1320] = (dst[1320] & 0xFF80FF80u) | 0x001C0003u;
+  dst[1321] = (dst[1321] & 0xFF80FF80u) | 0x001F0003u;
+  dst[1322] = (dst[1322] & 0x07000700u) | 0xF043003Cu;
+  dst[1323] = (dst[1323] & 0x07000700u) | 0xF07F003Cu;
+  dst[1324] = (dst[1324] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1325] = (dst[1325] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1360] = (dst[1360] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1361] = (dst[1361] & 0xFE00FE00u) | 0x007F0000u;
+  dst[1362] = (dst[1362] & 0x07800780u) | 0xF0270018u;
+  dst[1363] = (dst[1363] & 0x07800780u) | 0xF03F0018u;
+  dst[1364] = (dst[1364] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1365] = (dst[1365] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1400] = (dst[1400] & 0xF800F800u) | 0x01C3003Cu;
+  dst[1401] = (dst[1401] & 0xF800F800u) | 0x01FF003Cu;
+  dst[1402] = (dst[1402] & 0x07800780u) | 0xF03F0000u;
+  dst[1403] = (dst[1403] & 0x07800780u) | 0xF03F0000u;
+  dst[1404] = (dst[1404] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1405] = (dst[1405] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1440] = (dst[1440] & 0xF000F000u) | 0x070700F8u;
+  dst[1441] = (dst[1441] & 0xF000F000u) | 0x07FF00F8u;
+  dst[1442] = (dst[1442] & 0x07800780u) | 0xF03F0000u;
+  dst[1443] = (dst[1443] & 0x07800780u) | 0xF03F0000u;
+  dst[1444] = (dst[1444] & 0x003F003Fu) | 0x0F00F000u;
+  dst[1445] = (dst[1445] & 0x003F003Fu) | 0xFF00F000u;
+  dst[1480] = (dst[1480] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1481] = (dst[1481] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1482] = (dst[1482] & 0x07C007C0u) | 0xF01E0001u;
+  dst[1483] = (dst[1483] & 0x07C007C0u) | 0xF01F0001u;
+  dst[1484] = (dst[1484] & 0x001F001Fu) | 0x07C0F800u;
+  dst[1485] = (dst[1485] & 0x001F001Fu) | 0xFFC0F800u;
+  dst[1520] = (dst[1520] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1521] = (dst[1521] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1522] = (dst[1522] & 0x0FC00FC0u) | 0xE01F0000u;
+  dst[1523] = (dst[1523] & 0x0FC00FC0u) | 0xE01F0000u;
+  dst[1524] = (dst[1524] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1525] = (dst[1525] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1560] &= 0xF000F000u;
+  dst[1561] &= 0xF000F000u;
+  dst[1562] &= 0x1FC01FC0u;
+  dst[1563] &= 0x1FC01FC0u;
+  dst[1564] &= 0x000F000Fu;
+  dst[1565] &= 0x000F000Fu;
+}
+
+static void img_loserboy_f21_s4(uint32_t *dst) {
+  dst[42] &= 0x01FF01FFu;
+  dst[43] &= 0x01FF01FFu;
+  dst[80] &= 0xFFFCFFFCu;
+  dst[81] &= 0xFFFCFFFCu;
+  dst[82] = (dst[82] & 0x003F003Fu) | 0xFE000000u;
+  dst[83] = (dst[83] & 0x003F003Fu) | 0xFE000000u;
+  dst[120] = (dst[120] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[121] = (dst[121] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[122] = (dst[122] & 0x000F000Fu) | 0xFF800000u;
+  dst[123] = (dst[123] & 0x000F000Fu) | 0xFF800000u;
+  dst[160] = (dst[160] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[161] = (dst[161] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[162] = (dst[162] & 0x00070007u) | 0xFFF00000u;
+  dst[163] = (dst[163] & 0x00070007u) | 0xFFF00000u;
+  dst[200] = (dst[200] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[201] = (dst[201] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[202] = (dst[202] & 0x00030003u) | 0xFFF80000u;
+  dst[203] = (dst[203] & 0x00030003u) | 0xFFF80000u;
+  dst[240] = (dst[240] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[241] = (dst[241] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[242] = (dst[242] & 0x00030003u) | 0xFFF80000u;
+  dst[243] = (dst[243] & 0x00030003u) | 0xFFF80000u;
+  dst[280] = (dst[280] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[281] = (dst[281] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[282] = (dst[282] & 0x00030003u) | 0xC7180000u;
+  dst[283] = (dst[283] & 0x00030003u) | 0xC7180000u;
+  dst[320] = (dst[320] & 0xFFE0FFE0u) | 0x000B0000u;
+  dst[321] = (dst[321] & 0xFFE0FFE0u) | 0x000B0000u;
+  dst[322] = (dst[322] & 0x00030003u) | 0x99681000u;
+  dst[323] = (dst[323] & 0x00030003u) | 0x99681860u;
+  dst[360] = (dst[360] & 0xFFF0FFF0u) | 0x00050000u;
+  dst[361] = (dst[361] & 0xFFF0FFF0u) | 0x00050000u;
+  dst[362] = (dst[362] & 0x00030003u) | 0x1E705800u;
+  dst[363] = (dst[363] & 0x00030003u) | 0x5C705E70u;
+  dst[400] = (dst[400] & 0xFFF0FFF0u) | 0x00040000u;
+  dst[401] = (dst[401] & 0xFFF0FFF0u) | 0x00040000u;
+  dst[402] = (dst[402] & 0x00070007u) | 0x9FF05800u;
+  dst[403] = (dst[403] & 0x00070007u) | 0xDFF0DFF0u;
+  dst[440] = (dst[440] & 0xFFF0FFF0u) | 0x000D0003u;
+  dst[441] = (dst[441] & 0xFFF0FFF0u) | 0x0007000Bu;
+  dst[442] = (dst[442] & 0x00070007u) | 0xBFF05800u;
+  dst[443] = (dst[443] & 0x00070007u) | 0xFFF0DFF0u;
+  dst[480] = (dst[480] & 0xFFF0FFF0u) | 0x000F0006u;
+  dst[481] = (dst[481] & 0xFFF0FFF0u) | 0x0007000Fu;
+  dst[482] = (dst[482] & 0x00070007u) | 0xFFE07000u;
+  dst[483] = (dst[483] & 0x00070007u) | 0xFFE0FFE0u;
+  dst[520] = (dst[520] & 0xFFF0FFF0u) | 0x000F0000u;
+  dst[521] = (dst[521] & 0xFFF0FFF0u) | 0x0007000Fu;
+  dst[522] = (dst[522] & 0x00030003u) | 0xFF800000u;
+  dst[523] = (dst[523] & 0x00030003u) | 0xCF80FF80u;
+  dst[560] = (dst[560] & 0xFFF8FFF8u) | 0x00070000u;
+  dst[561] = (dst[561] & 0xFFF8FFF8u) | 0x00030007u;
+  dst[562] = (dst[562] & 0x00010001u) | 0xFF000020u;
+  dst[563] = (dst[563] & 0x00010001u) | 0xBE6CFF00u;
+  dst[600] = (dst[600] & 0xFFFCFFFCu) | 0x00030000u;
+  dst[601] = (dst[601] & 0xFFFCFFFCu) | 0x00000003u;
+  dst[602] = 0xFE0000C8u;
+  dst[603] = 0xF8DEFE00u;
+  dst[642] = 0x0C00004Cu;
+  dst[643] = 0x01DE0C00u;
+  dst[644] &= 0x7FFF7FFFu;
+  dst[645] &= 0x7FFF7FFFu;
+  dst[682] = 0x1C004019u;
+  dst[683] = 0x40191C00u;
+  dst[684] &= 0x3FFF3FFFu;
+  dst[685] &= 0x3FFF3FFFu;
+  dst[720] &= 0xFF8FFF8Fu;
+  dst[721] &= 0xFF8FFF8Fu;
+  dst[722] = 0x00034204u;
+  dst[723] = 0x42D70200u;
+  dst[724] = (dst[724] & 0x1FFF1FFFu) | 0x0000C000u;
+  dst[725] = (dst[725] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[760] = (dst[760] & 0xFF00FF00u) | 0x00700000u;
+  dst[761] = (dst[761] & 0xFF00FF00u) | 0x00700070u;
+  dst[762] = 0x00075E08u;
+  dst[763] = 0x5ECF1E00u;
+  dst[764] = (dst[764] & 0x1FFF1FFFu) | 0x80004000u;
+  dst[765] = (dst[765] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[800] = (dst[800] & 0xFE00FE00u) | 0x00FA0000u;
+  dst[801] = (dst[801] & 0xFE00FE00u) | 0x00FA00FAu;
+  dst[802] = 0x000FDE00u;
+  dst[803] = 0xDEEF1E00u;
+  dst[804] = (dst[804] & 0x1FFF1FFFu) | 0x00008000u;
+  dst[805] = (dst[805] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[840] = (dst[840] & 0xFE00FE00u) | 0x00FA0000u;
+  dst[841] = (dst[841] & 0xFE00FE00u) | 0x00FA00FAu;
+  dst[842] = 0x0004DF0Au;
+  dst[843] = 0xDF6E1F00u;
+  dst[844] = (dst[844] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[845] = (dst[845] & 0x0FFF0FFFu) | 0x60006000u;
+  dst[880] = (dst[880] & 0xFE00FE00u) | 0x00F60000u;
+  dst[881] = (dst[881] & 0xFE00FE00u) | 0x00F600F6u;
+  dst[882] = 0x0001DF0Cu;
+  dst[883] = 0xDF6D1F01u;
+  dst[884] = (dst[884] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[885] = (dst[885] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[920] = (dst[920] & 0xFE00FE00u) | 0x00F00000u;
+  dst[921] = (dst[921] & 0xFE00FE00u) | 0x00F000F0u;
+  dst[922] = (dst[922] & 0x00020002u) | 0x0000DF00u;
+  dst[923] = (dst[923] & 0x00020002u) | 0xDF701F00u;
+  dst[924] = (dst[924] & 0x07FF07FFu) | 0xF0000000u;
+  dst[925] = (dst[925] & 0x07FF07FFu) | 0xF000F000u;
+  dst[960] &= 0xFF0CFF0Cu;
+  dst[961] = (dst[961] & 0xFF0CFF0Cu) | 0x00010000u;
+  dst[962] = (dst[962] & 0x00070007u) | 0x0000BF00u;
+  dst[963] = (dst[963] & 0x00070007u) | 0xBF703F00u;
+  dst[964] = (dst[964] & 0x07FF07FFu) | 0x70000000u;
+  dst[965] = (dst[965] & 0x07FF07FFu) | 0x70007000u;
+  dst[1000] &= 0xFFFCFFFCu;
+  dst[1001] = (dst[1001] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1002] = (dst[1002] & 0x00020002u) | 0x0000BF80u;
+  dst[1003] = (dst[1003] & 0x00020002u) | 0xBFB83F80u;
+  dst[1004] = (dst[1004] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1005] = (dst[1005] & 0x03FF03FFu) | 0xF800F800u;
+  dst[1040] &= 0xFFFCFFFCu;
+  dst[1041] = (dst[1041] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1042] = 0x0000BF80u;
+  dst[1043] = 0xBFBC3F80u;
+  dst[1044] = (dst[1044] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1045] = (dst[1045] & 0x03FF03FFu) | 0xF800F800u;
+  dst[1080] &= 0xFFF8FFF8u;
+  dst[1081] = (dst[1081] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1082] = 0x00013FC0u;
+  dst[1083] = 0xBFDD3FC1u;
+  dst[1084] = (dst[1084] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1085] = (dst[1085] & 0x03FF03FFu) | 0xF800F800u;
+  dst[1120] &= 0xFFF8FFF8u;
+  dst[1121] &= 0xFFF8FFF8u;
+  dst[1122] = 0x00007FE0u;
+  dst[1123] = 0x7FE07FE0u;
+  dst[1124] = (dst[1124] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1125] = (dst[1125] & 0x07FF07FFu) | 0xF000F000u;
+  dst[1160] = (dst[1160] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1161] = (dst[1161] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1162] = 0x800F1FC0u;
+  dst[1163] = 0x9FCF1FC0u;
+  dst[1164] &= 0x0FFF0FFFu;
+  dst[1165] &= 0x0FFF0FFFu;
+  dst[1200] = (dst[1200] & 0xFFF0FFF0u) | 0x00060001u;
+  dst[1201] = (dst[1201] & 0xFFF0FFF0u) | 0x00070001u;
+  dst[1202] = 0xE033000Cu;
+  dst[1203] = 0xE03F000Cu;
+  dst[1204] = (dst[1204] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1205] = (dst[1205] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1240] = (dst[1240] & 0xFFF0FFF0u) | 0x00040003u;
+  dst[1241] = (dst[1241] & 0xFFF0FFF0u) | 0x00070003u;
+  dst[1242] = (dst[1242] & 0x07800780u) | 0x7021801Eu;
+  dst[1243] = (dst[1243] & 0x07800780u) | 0xF03F801Eu;
+  dst[1244] = (dst[1244] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1245] = (dst[1245] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1280] = (dst[1280] & 0xFFE0FFE0u) | 0x000C0003u;
+  dst[1281] = (dst[1281] & 0xFFE0FFE0u) | 0x000F0003u;
+  dst[1282] = (dst[1282] & 0x07800780u) | 0x7021801Eu;
+  dst[1283] = (dst[1283] & 0x07800780u) | 0xF03F801Eu;
+  dst[1284] = (dst[1284] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1285] = (dst[1285] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1320] = (dst[1320] & 0xFFC0FFC0u) | 0x000E0001u;
+  dst[1321] = (dst[1321] & 0xFFC0FFC0u) | 0x000F0001u;
+  dst[1322] = (dst[1322] & 0x03800380u) | 0x7821801Eu;
+  dst[1323] = (dst[1323] & 0x03800380u) | 0xF83F801Eu;
+  dst[1324] = (dst[1324] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1325] = (dst[1325] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1360] = (dst[1360] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1361] = (dst[1361] & 0xFF00FF00u) | 0x003F0000u;
+  dst[1362] = (dst[1362] & 0x03C003C0u) | 0xF813000Cu;
+  dst[1363] = (dst[1363] & 0x03C003C0u) | 0xF81F000Cu;
+  dst[1364] = (dst[1364] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1365] = (dst[1365] & 0x01FF01FFu) | 0xF8000000u;
+  dst[1400] = (dst[1400] & 0xFC00FC00u) | 0x00E1001Eu;
+  dst[1401] = (dst[1401] & 0xFC00FC00u) | 0x00FF001Eu;
+  dst[1402] = (dst[1402] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1403] = (dst[1403] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1404] = (dst[1404] & 0x007F007Fu) | 0xFE000000u;
+  dst[1405] = (dst[1405] & 0x007F007Fu) | 0xFE000000u;
+  dst[1440] = (dst[1440] & 0xF800F800u) | 0x0383007Cu;
+  dst[1441] = (dst[1441] & 0xF800F800u) | 0x03FF007Cu;
+  dst[1442] = (dst[1442] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1443] = (dst[1443] & 0x03C003C0u) | 0xF81F0000u;
+  dst[1444] = (dst[1444] & 0x001F001Fu) | 0x87807800u;
+  dst[1445] = (dst[1445] & 0x001F001Fu) | 0xFF807800u;
+  dst[1480] = (dst[1480] & 0xF000F000u) | 0x07FF0000u;
+  dst[1481] = (dst[1481] & 0xF000F000u) | 0x07FF0000u;
+  dst[1482] = (dst[1482] & 0x03E003E0u) | 0xF80F0000u;
+  dst[1483] = (dst[1483] & 0x03E003E0u) | 0xF80F0000u;
+  dst[1484] = (dst[1484] & 0x000F000Fu) | 0x03E0FC00u;
+  dst[1485] = (dst[1485] & 0x000F000Fu) | 0xFFE0FC00u;
+  dst[1520] = (dst[1520] & 0xF000F000u) | 0x07FF0000u;
+  dst[1521] = (dst[1521] & 0xF000F000u) | 0x07FF0000u;
+  dst[1522] = (dst[1522] & 0x07E007E0u) | 0xF00F0000u;
+  dst[1523] = (dst[1523] & 0x07E007E0u) | 0xF00F0000u;
+  dst[1524] = (dst[1524] & 0x00070007u) | 0xFFF00000u;
+  dst[1525] = (dst[1525] & 0x00070007u) | 0xFFF00000u;
+  dst[1560] &= 0xF800F800u;
+  dst[1561] &= 0xF800F800u;
+  dst[1562] &= 0x0FE00FE0u;
+  dst[1563] &= 0x0FE00FE0u;
+  dst[1564] &= 0x00070007u;
+  dst[1565] &= 0x00070007u;
+}
+
+static void img_loserboy_f21_s5(uint32_t *dst) {
+  dst[42] &= 0x80FF80FFu;
+  dst[43] &= 0x80FF80FFu;
+  dst[80] &= 0xFFFEFFFEu;
+  dst[81] &= 0xFFFEFFFEu;
+  dst[82] = (dst[82] & 0x001F001Fu) | 0x7F000000u;
+  dst[83] = (dst[83] & 0x001F001Fu) | 0x7F000000u;
+  dst[120] = (dst[120] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[121] = (dst[121] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[122] = (dst[122] & 0x00070007u) | 0xFFC00000u;
+  dst[123] = (dst[123] & 0x00070007u) | 0xFFC00000u;
+  dst[160] = (dst[160] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[161] = (dst[161] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[162] = (dst[162] & 0x00030003u) | 0xFFF80000u;
+  dst[163] = (dst[163] & 0x00030003u) | 0xFFF80000u;
+  dst[200] = (dst[200] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[201] = (dst[201] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[202] = (dst[202] & 0x00010001u) | 0xFFFC0000u;
+  dst[203] = (dst[203] & 0x00010001u) | 0xFFFC0000u;
+  dst[240] = (dst[240] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[241] = (dst[241] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[242] = (dst[242] & 0x00010001u) | 0xFFFC0000u;
+  dst[243] = (dst[243] & 0x00010001u) | 0xFFFC0000u;
+  dst[280] = (dst[280] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[281] = (dst[281] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[282] = (dst[282] & 0x00010001u) | 0xE38C0000u;
+  dst[283] = (dst[283] & 0x00010001u) | 0xE38C0000u;
+  dst[320] = (dst[320] & 0xFFF0FFF0u) | 0x00050000u;
+  dst[321] = (dst[321] & 0xFFF0FFF0u) | 0x00050000u;
+  dst[322] = (dst[322] & 0x00010001u) | 0xCCB40800u;
+  dst[323] = (dst[323] & 0x00010001u) | 0xCCB40C30u;
+  dst[360] = (dst[360] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[361] = (dst[361] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[362] = (dst[362] & 0x00010001u) | 0x8F382C00u;
+  dst[363] = (dst[363] & 0x00010001u) | 0xAE382F38u;
+  dst[400] = (dst[400] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[401] = (dst[401] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[402] = (dst[402] & 0x00030003u) | 0x4FF82C00u;
+  dst[403] = (dst[403] & 0x00030003u) | 0x6FF86FF8u;
+  dst[440] = (dst[440] & 0xFFF8FFF8u) | 0x00060001u;
+  dst[441] = (dst[441] & 0xFFF8FFF8u) | 0x00030005u;
+  dst[442] = (dst[442] & 0x00030003u) | 0xDFF8AC00u;
+  dst[443] = (dst[443] & 0x00030003u) | 0xFFF8EFF8u;
+  dst[480] = (dst[480] & 0xFFF8FFF8u) | 0x00070003u;
+  dst[481] = (dst[481] & 0xFFF8FFF8u) | 0x00030007u;
+  dst[482] = (dst[482] & 0x00030003u) | 0xFFF03800u;
+  dst[483] = (dst[483] & 0x00030003u) | 0xFFF0FFF0u;
+  dst[520] = (dst[520] & 0xFFF8FFF8u) | 0x00070000u;
+  dst[521] = (dst[521] & 0xFFF8FFF8u) | 0x00030007u;
+  dst[522] = (dst[522] & 0x00010001u) | 0xFFC00000u;
+  dst[523] = (dst[523] & 0x00010001u) | 0xE7C0FFC0u;
+  dst[560] = (dst[560] & 0xFFFCFFFCu) | 0x00030000u;
+  dst[561] = (dst[561] & 0xFFFCFFFCu) | 0x00010003u;
+  dst[562] = 0xFF800010u;
+  dst[563] = 0xDF36FF80u;
+  dst[600] = (dst[600] & 0xFFFEFFFEu) | 0x00010000u;
+  dst[601] = (dst[601] & 0xFFFEFFFEu) | 0x00000001u;
+  dst[602] = 0xFF000064u;
+  dst[603] = 0x7C6FFF00u;
+  dst[604] &= 0x7FFF7FFFu;
+  dst[605] &= 0x7FFF7FFFu;
+  dst[642] = (dst[642] & 0x80008000u) | 0x06000026u;
+  dst[643] = (dst[643] & 0x80008000u) | 0x00EF0600u;
+  dst[644] &= 0x3FFF3FFFu;
+  dst[645] &= 0x3FFF3FFFu;
+  dst[682] = (dst[682] & 0x80008000u) | 0x0E00200Cu;
+  dst[683] = (dst[683] & 0x80008000u) | 0x200C0E00u;
+  dst[684] = (dst[684] & 0x1FFF1FFFu) | 0x00008000u;
+  dst[685] = (dst[685] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[720] &= 0xFFC7FFC7u;
+  dst[721] &= 0xFFC7FFC7u;
+  dst[722] = (dst[722] & 0x80008000u) | 0x00012102u;
+  dst[723] = (dst[723] & 0x80008000u) | 0x216B0100u;
+  dst[724] = (dst[724] & 0x0FFF0FFFu) | 0x80006000u;
+  dst[725] = (dst[725] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[760] = (dst[760] & 0xFF80FF80u) | 0x00380000u;
+  dst[761] = (dst[761] & 0xFF80FF80u) | 0x00380038u;
+  dst[762] = 0x00032F04u;
+  dst[763] = 0x2F670F00u;
+  dst[764] = (dst[764] & 0x0FFF0FFFu) | 0xC0002000u;
+  dst[765] = (dst[765] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[800] = (dst[800] & 0xFF00FF00u) | 0x007D0000u;
+  dst[801] = (dst[801] & 0xFF00FF00u) | 0x007D007Du;
+  dst[802] = 0x00076F00u;
+  dst[803] = 0x6F770F00u;
+  dst[804] = (dst[804] & 0x0FFF0FFFu) | 0x80004000u;
+  dst[805] = (dst[805] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[840] = (dst[840] & 0xFF00FF00u) | 0x007D0000u;
+  dst[841] = (dst[841] & 0xFF00FF00u) | 0x007D007Du;
+  dst[842] = 0x00026F85u;
+  dst[843] = 0x6FB70F80u;
+  dst[844] = (dst[844] & 0x07FF07FFu) | 0x30000000u;
+  dst[845] = (dst[845] & 0x07FF07FFu) | 0x30003000u;
+  dst[880] = (dst[880] & 0xFF00FF00u) | 0x007B0000u;
+  dst[881] = (dst[881] & 0xFF00FF00u) | 0x007B007Bu;
+  dst[882] = 0x00006F86u;
+  dst[883] = 0x6FB60F80u;
+  dst[884] = (dst[884] & 0x07FF07FFu) | 0xF0000000u;
+  dst[885] = (dst[885] & 0x07FF07FFu) | 0xF000F000u;
+  dst[920] = (dst[920] & 0xFF00FF00u) | 0x00780000u;
+  dst[921] = (dst[921] & 0xFF00FF00u) | 0x00780078u;
+  dst[922] = (dst[922] & 0x00010001u) | 0x00006F80u;
+  dst[923] = (dst[923] & 0x00010001u) | 0x6FB80F80u;
+  dst[924] = (dst[924] & 0x03FF03FFu) | 0x78000000u;
+  dst[925] = (dst[925] & 0x03FF03FFu) | 0x78007800u;
+  dst[960] &= 0xFF86FF86u;
+  dst[961] &= 0xFF86FF86u;
+  dst[962] = (dst[962] & 0x00030003u) | 0x00005F80u;
+  dst[963] = (dst[963] & 0x00030003u) | 0xDFB81F80u;
+  dst[964] = (dst[964] & 0x83FF83FFu) | 0x38000000u;
+  dst[965] = (dst[965] & 0x83FF83FFu) | 0x38003800u;
+  dst[1000] &= 0xFFFEFFFEu;
+  dst[1001] &= 0xFFFEFFFEu;
+  dst[1002] = (dst[1002] & 0x00010001u) | 0x00005FC0u;
+  dst[1003] = (dst[1003] & 0x00010001u) | 0xDFDC1FC0u;
+  dst[1004] = (dst[1004] & 0x01FF01FFu) | 0x7C000000u;
+  dst[1005] = (dst[1005] & 0x01FF01FFu) | 0x7C007C00u;
+  dst[1040] &= 0xFFFEFFFEu;
+  dst[1041] &= 0xFFFEFFFEu;
+  dst[1042] = 0x00005FC0u;
+  dst[1043] = 0xDFDE1FC0u;
+  dst[1044] = (dst[1044] & 0x01FF01FFu) | 0x7C000000u;
+  dst[1045] = (dst[1045] & 0x01FF01FFu) | 0x7C007C00u;
+  dst[1080] &= 0xFFFCFFFCu;
+  dst[1081] = (dst[1081] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1082] = 0x00001FE0u;
+  dst[1083] = 0xDFEE1FE0u;
+  dst[1084] = (dst[1084] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1085] = (dst[1085] & 0x01FF01FFu) | 0xFC00FC00u;
+  dst[1120] &= 0xFFFCFFFCu;
+  dst[1121] &= 0xFFFCFFFCu;
+  dst[1122] = 0x00003FF0u;
+  dst[1123] = 0x3FF03FF0u;
+  dst[1124] = (dst[1124] & 0x03FF03FFu) | 0x78000000u;
+  dst[1125] = (dst[1125] & 0x03FF03FFu) | 0x78007800u;
+  dst[1160] = (dst[1160] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1161] = (dst[1161] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1162] = 0xC0070FE0u;
+  dst[1163] = 0xCFE70FE0u;
+  dst[1164] = (dst[1164] & 0x07FF07FFu) | 0x80000000u;
+  dst[1165] = (dst[1165] & 0x07FF07FFu) | 0x80000000u;
+  dst[1200] = (dst[1200] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1201] = (dst[1201] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1202] = 0x70198006u;
+  dst[1203] = 0xF01F8006u;
+  dst[1204] = (dst[1204] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1205] = (dst[1205] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1240] = (dst[1240] & 0xFFF8FFF8u) | 0x00020001u;
+  dst[1241] = (dst[1241] & 0xFFF8FFF8u) | 0x00030001u;
+  dst[1242] = (dst[1242] & 0x03C003C0u) | 0x3810C00Fu;
+  dst[1243] = (dst[1243] & 0x03C003C0u) | 0xF81FC00Fu;
+  dst[1244] = (dst[1244] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1245] = (dst[1245] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1280] = (dst[1280] & 0xFFF0FFF0u) | 0x00060001u;
+  dst[1281] = (dst[1281] & 0xFFF0FFF0u) | 0x00070001u;
+  dst[1282] = (dst[1282] & 0x03C003C0u) | 0x3810C00Fu;
+  dst[1283] = (dst[1283] & 0x03C003C0u) | 0xF81FC00Fu;
+  dst[1284] = (dst[1284] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1285] = (dst[1285] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1320] = (dst[1320] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1321] = (dst[1321] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1322] = (dst[1322] & 0x01C001C0u) | 0x3C10C00Fu;
+  dst[1323] = (dst[1323] & 0x01C001C0u) | 0xFC1FC00Fu;
+  dst[1324] = (dst[1324] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1325] = (dst[1325] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1360] = (dst[1360] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1361] = (dst[1361] & 0xFF80FF80u) | 0x001F0000u;
+  dst[1362] = (dst[1362] & 0x01E001E0u) | 0xFC090006u;
+  dst[1363] = (dst[1363] & 0x01E001E0u) | 0xFC0F0006u;
+  dst[1364] = (dst[1364] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1365] = (dst[1365] & 0x00FF00FFu) | 0xFC000000u;
+  dst[1400] = (dst[1400] & 0xFE00FE00u) | 0x0070000Fu;
+  dst[1401] = (dst[1401] & 0xFE00FE00u) | 0x007F000Fu;
+  dst[1402] = (dst[1402] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1403] = (dst[1403] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1404] = (dst[1404] & 0x003F003Fu) | 0xFF000000u;
+  dst[1405] = (dst[1405] & 0x003F003Fu) | 0xFF000000u;
+  dst[1440] = (dst[1440] & 0xFC00FC00u) | 0x01C1003Eu;
+  dst[1441] = (dst[1441] & 0xFC00FC00u) | 0x01FF003Eu;
+  dst[1442] = (dst[1442] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1443] = (dst[1443] & 0x01E001E0u) | 0xFC0F0000u;
+  dst[1444] = (dst[1444] & 0x000F000Fu) | 0xC3C03C00u;
+  dst[1445] = (dst[1445] & 0x000F000Fu) | 0xFFC03C00u;
+  dst[1480] = (dst[1480] & 0xF800F800u) | 0x03FF0000u;
+  dst[1481] = (dst[1481] & 0xF800F800u) | 0x03FF0000u;
+  dst[1482] = (dst[1482] & 0x01F001F0u) | 0xFC070000u;
+  dst[1483] = (dst[1483] & 0x01F001F0u) | 0xFC070000u;
+  dst[1484] = (dst[1484] & 0x00070007u) | 0x81F07E00u;
+  dst[1485] = (dst[1485] & 0x00070007u) | 0xFFF07E00u;
+  dst[1520] = (dst[1520] & 0xF800F800u) | 0x03FF0000u;
+  dst[1521] = (dst[1521] & 0xF800F800u) | 0x03FF0000u;
+  dst[1522] = (dst[1522] & 0x03F003F0u) | 0xF8070000u;
+  dst[1523] = (dst[1523] & 0x03F003F0u) | 0xF8070000u;
+  dst[1524] = (dst[1524] & 0x00030003u) | 0xFFF80000u;
+  dst[1525] = (dst[1525] & 0x00030003u) | 0xFFF80000u;
+  dst[1560] &= 0xFC00FC00u;
+  dst[1561] &= 0xFC00FC00u;
+  dst[1562] &= 0x07F007F0u;
+  dst[1563] &= 0x07F007F0u;
+  dst[1564] &= 0x00030003u;
+  dst[1565] &= 0x00030003u;
+}
+
+static void img_loserboy_f21_s6(uint32_t *dst) {
+  dst[42] &= 0xC07FC07Fu;
+  dst[43] &= 0xC07FC07Fu;
+  dst[82] = (dst[82] & 0x000F000Fu) | 0x3F800000u;
+  dst[83] = (dst[83] & 0x000F000Fu) | 0x3F800000u;
+  dst[120] &= 0xFFFEFFFEu;
+  dst[121] &= 0xFFFEFFFEu;
+  dst[122] = (dst[122] & 0x00030003u) | 0xFFE00000u;
+  dst[123] = (dst[123] & 0x00030003u) | 0xFFE00000u;
+  dst[160] = (dst[160] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[161] = (dst[161] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[162] = (dst[162] & 0x00010001u) | 0xFFFC0000u;
+  dst[163] = (dst[163] & 0x00010001u) | 0xFFFC0000u;
+  dst[200] = (dst[200] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[201] = (dst[201] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[202] = 0xFFFE0000u;
+  dst[203] = 0xFFFE0000u;
+  dst[240] = (dst[240] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[241] = (dst[241] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[242] = 0xFFFE0000u;
+  dst[243] = 0xFFFE0000u;
+  dst[280] = (dst[280] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[281] = (dst[281] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[282] = 0xF1C60000u;
+  dst[283] = 0xF1C60000u;
+  dst[320] = (dst[320] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[321] = (dst[321] & 0xFFF8FFF8u) | 0x00020000u;
+  dst[322] = 0xE65A0400u;
+  dst[323] = 0xE65A0618u;
+  dst[360] = (dst[360] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[361] = (dst[361] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[362] = 0x479C1600u;
+  dst[363] = 0x571C179Cu;
+  dst[400] = (dst[400] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[401] = (dst[401] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[402] = (dst[402] & 0x00010001u) | 0x27FC1600u;
+  dst[403] = (dst[403] & 0x00010001u) | 0x37FC37FCu;
+  dst[440] = (dst[440] & 0xFFFCFFFCu) | 0x00030000u;
+  dst[441] = (dst[441] & 0xFFFCFFFCu) | 0x00010002u;
+  dst[442] = (dst[442] & 0x00010001u) | 0x6FFCD600u;
+  dst[443] = (dst[443] & 0x00010001u) | 0xFFFCF7FCu;
+  dst[480] = (dst[480] & 0xFFFCFFFCu) | 0x00030001u;
+  dst[481] = (dst[481] & 0xFFFCFFFCu) | 0x00010003u;
+  dst[482] = (dst[482] & 0x00010001u) | 0xFFF89C00u;
+  dst[483] = (dst[483] & 0x00010001u) | 0xFFF8FFF8u;
+  dst[520] = (dst[520] & 0xFFFCFFFCu) | 0x00030000u;
+  dst[521] = (dst[521] & 0xFFFCFFFCu) | 0x00010003u;
+  dst[522] = 0xFFE00000u;
+  dst[523] = 0xF3E0FFE0u;
+  dst[560] = (dst[560] & 0xFFFEFFFEu) | 0x00010000u;
+  dst[561] = (dst[561] & 0xFFFEFFFEu) | 0x00000001u;
+  dst[562] = 0xFFC00008u;
+  dst[563] = 0xEF9BFFC0u;
+  dst[564] &= 0x7FFF7FFFu;
+  dst[565] &= 0x7FFF7FFFu;
+  dst[602] = 0xFF800032u;
+  dst[603] = 0x3E37FF80u;
+  dst[604] &= 0x3FFF3FFFu;
+  dst[605] = (dst[605] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[642] = (dst[642] & 0xC000C000u) | 0x03000013u;
+  dst[643] = (dst[643] & 0xC000C000u) | 0x00770300u;
+  dst[644] &= 0x1FFF1FFFu;
+  dst[645] = (dst[645] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[682] = (dst[682] & 0xC000C000u) | 0x07001006u;
+  dst[683] = (dst[683] & 0xC000C000u) | 0x10060700u;
+  dst[684] = (dst[684] & 0x0FFF0FFFu) | 0x00004000u;
+  dst[685] = (dst[685] & 0x0FFF0FFFu) | 0x40000000u;
+  dst[720] &= 0xFFE3FFE3u;
+  dst[721] &= 0xFFE3FFE3u;
+  dst[722] = (dst[722] & 0xC000C000u) | 0x00001081u;
+  dst[723] = (dst[723] & 0xC000C000u) | 0x10B50080u;
+  dst[724] = (dst[724] & 0x07FF07FFu) | 0xC0003000u;
+  dst[725] = (dst[725] & 0x07FF07FFu) | 0xF0000000u;
+  dst[760] = (dst[760] & 0xFFC0FFC0u) | 0x001C0000u;
+  dst[761] = (dst[761] & 0xFFC0FFC0u) | 0x001C001Cu;
+  dst[762] = 0x00011782u;
+  dst[763] = 0x17B30780u;
+  dst[764] = (dst[764] & 0x07FF07FFu) | 0xE0001000u;
+  dst[765] = (dst[765] & 0x07FF07FFu) | 0xF0000000u;
+  dst[800] = (dst[800] & 0xFF80FF80u) | 0x003E0000u;
+  dst[801] = (dst[801] & 0xFF80FF80u) | 0x003E003Eu;
+  dst[802] = 0x80033780u;
+  dst[803] = 0xB7BB8780u;
+  dst[804] = (dst[804] & 0x07FF07FFu) | 0xC0002000u;
+  dst[805] = (dst[805] & 0x07FF07FFu) | 0xE0000000u;
+  dst[840] = (dst[840] & 0xFF80FF80u) | 0x003E0000u;
+  dst[841] = (dst[841] & 0xFF80FF80u) | 0x003E003Eu;
+  dst[842] = 0x800137C2u;
+  dst[843] = 0xB7DB87C0u;
+  dst[844] = (dst[844] & 0x03FF03FFu) | 0x18008000u;
+  dst[845] = (dst[845] & 0x03FF03FFu) | 0x98001800u;
+  dst[880] = (dst[880] & 0xFF80FF80u) | 0x003D0000u;
+  dst[881] = (dst[881] & 0xFF80FF80u) | 0x003D003Du;
+  dst[882] = 0x800037C3u;
+  dst[883] = 0xB7DB87C0u;
+  dst[884] = (dst[884] & 0x03FF03FFu) | 0x78000000u;
+  dst[885] = (dst[885] & 0x03FF03FFu) | 0x78007800u;
+  dst[920] = (dst[920] & 0xFF80FF80u) | 0x003C0000u;
+  dst[921] = (dst[921] & 0xFF80FF80u) | 0x003C003Cu;
+  dst[922] = 0x000037C0u;
+  dst[923] = 0x37DC07C0u;
+  dst[924] = (dst[924] & 0x81FF81FFu) | 0x3C000000u;
+  dst[925] = (dst[925] & 0x81FF81FFu) | 0x3C003C00u;
+  dst[960] &= 0xFFC3FFC3u;
+  dst[961] &= 0xFFC3FFC3u;
+  dst[962] = (dst[962] & 0x00010001u) | 0x00002FC0u;
+  dst[963] = (dst[963] & 0x00010001u) | 0x6FDC0FC0u;
+  dst[964] = (dst[964] & 0xC1FFC1FFu) | 0x1C000000u;
+  dst[965] = (dst[965] & 0xC1FFC1FFu) | 0x1C001C00u;
+  dst[1002] = 0x00002FE0u;
+  dst[1003] = 0x6FEE0FE0u;
+  dst[1004] = (dst[1004] & 0x80FF80FFu) | 0x3E000000u;
+  dst[1005] = (dst[1005] & 0x80FF80FFu) | 0x3E003E00u;
+  dst[1042] = 0x00002FE0u;
+  dst[1043] = 0x6FEF0FE0u;
+  dst[1044] = (dst[1044] & 0x00FF00FFu) | 0x3E000000u;
+  dst[1045] = (dst[1045] & 0x00FF00FFu) | 0x3E003E00u;
+  dst[1080] &= 0xFFFEFFFEu;
+  dst[1081] &= 0xFFFEFFFEu;
+  dst[1082] = 0x00000FF0u;
+  dst[1083] = 0xEFF70FF0u;
+  dst[1084] = (dst[1084] & 0x00FF00FFu) | 0x7E000000u;
+  dst[1085] = (dst[1085] & 0x00FF00FFu) | 0x7E007E00u;
+  dst[1120] &= 0xFFFEFFFEu;
+  dst[1121] &= 0xFFFEFFFEu;
+  dst[1122] = 0x00001FF8u;
+  dst[1123] = 0x1FF81FF8u;
+  dst[1124] = (dst[1124] & 0x01FF01FFu) | 0x3C000000u;
+  dst[1125] = (dst[1125] & 0x01FF01FFu) | 0x3C003C00u;
+  dst[1160] &= 0xFFFEFFFEu;
+  dst[1161] &= 0xFFFEFFFEu;
+  dst[1162] = 0xE00307F0u;
+  dst[1163] = 0xE7F307F0u;
+  dst[1164] = (dst[1164] & 0x03FF03FFu) | 0xC0000000u;
+  dst[1165] = (dst[1165] & 0x03FF03FFu) | 0xC0000000u;
+  dst[1200] = (dst[1200] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1201] = (dst[1201] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1202] = 0xB80C4003u;
+  dst[1203] = 0xF80F4003u;
+  dst[1204] = (dst[1204] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1205] = (dst[1205] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1240] = (dst[1240] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1241] = (dst[1241] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1242] = (dst[1242] & 0x01E001E0u) | 0x1C08E007u;
+  dst[1243] = (dst[1243] & 0x01E001E0u) | 0xFC0FE007u;
+  dst[1244] = (dst[1244] & 0x07FF07FFu) | 0x70008000u;
+  dst[1245] = (dst[1245] & 0x07FF07FFu) | 0xF0008000u;
+  dst[1280] = (dst[1280] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1281] = (dst[1281] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1282] = (dst[1282] & 0x01E001E0u) | 0x1C08E007u;
+  dst[1283] = (dst[1283] & 0x01E001E0u) | 0xFC0FE007u;
+  dst[1284] = (dst[1284] & 0x03FF03FFu) | 0x78008000u;
+  dst[1285] = (dst[1285] & 0x03FF03FFu) | 0xF8008000u;
+  dst[1320] = (dst[1320] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1321] = (dst[1321] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1322] = (dst[1322] & 0x00E000E0u) | 0x9E086007u;
+  dst[1323] = (dst[1323] & 0x00E000E0u) | 0xFE0F6007u;
+  dst[1324] = (dst[1324] & 0x01FF01FFu) | 0x7C008000u;
+  dst[1325] = (dst[1325] & 0x01FF01FFu) | 0xFC008000u;
+  dst[1360] = (dst[1360] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1361] = (dst[1361] & 0xFFC0FFC0u) | 0x000F0000u;
+  dst[1362] = (dst[1362] & 0x00F000F0u) | 0xFE040003u;
+  dst[1363] = (dst[1363] & 0x00F000F0u) | 0xFE070003u;
+  dst[1364] = (dst[1364] & 0x007F007Fu) | 0xFE000000u;
+  dst[1365] = (dst[1365] & 0x007F007Fu) | 0xFE000000u;
+  dst[1400] = (dst[1400] & 0xFF00FF00u) | 0x00380007u;
+  dst[1401] = (dst[1401] & 0xFF00FF00u) | 0x003F0007u;
+  dst[1402] = (dst[1402] & 0x00F000F0u) | 0x7E078000u;
+  dst[1403] = (dst[1403] & 0x00F000F0u) | 0xFE078000u;
+  dst[1404] = (dst[1404] & 0x001F001Fu) | 0xFF800000u;
+  dst[1405] = (dst[1405] & 0x001F001Fu) | 0xFF800000u;
+  dst[1440] = (dst[1440] & 0xFE00FE00u) | 0x00E0001Fu;
+  dst[1441] = (dst[1441] & 0xFE00FE00u) | 0x00FF001Fu;
+  dst[1442] = (dst[1442] & 0x00F000F0u) | 0xFE070000u;
+  dst[1443] = (dst[1443] & 0x00F000F0u) | 0xFE070000u;
+  dst[1444] = (dst[1444] & 0x00070007u) | 0xE1E01E00u;
+  dst[1445] = (dst[1445] & 0x00070007u) | 0xFFE01E00u;
+  dst[1480] = (dst[1480] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1481] = (dst[1481] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1482] = (dst[1482] & 0x00F800F8u) | 0xFE030000u;
+  dst[1483] = (dst[1483] & 0x00F800F8u) | 0xFE030000u;
+  dst[1484] = (dst[1484] & 0x00030003u) | 0xC0F83F00u;
+  dst[1485] = (dst[1485] & 0x00030003u) | 0xFFF83F00u;
+  dst[1520] = (dst[1520] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1521] = (dst[1521] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1522] = (dst[1522] & 0x01F801F8u) | 0xFC030000u;
+  dst[1523] = (dst[1523] & 0x01F801F8u) | 0xFC030000u;
+  dst[1524] = (dst[1524] & 0x00010001u) | 0xFFFC0000u;
+  dst[1525] = (dst[1525] & 0x00010001u) | 0xFFFC0000u;
+  dst[1560] &= 0xFE00FE00u;
+  dst[1561] &= 0xFE00FE00u;
+  dst[1562] &= 0x03F803F8u;
+  dst[1563] &= 0x03F803F8u;
+  dst[1564] &= 0x00010001u;
+  dst[1565] &= 0x00010001u;
+}
+
+static void img_loserboy_f21_s7(uint32_t *dst) {
+  dst[42] &= 0xE03FE03Fu;
+  dst[43] &= 0xE03FE03Fu;
+  dst[82] = (dst[82] & 0x80078007u) | 0x1FC00000u;
+  dst[83] = (dst[83] & 0x80078007u) | 0x1FC00000u;
+  dst[122] = (dst[122] & 0x00010001u) | 0x7FF00000u;
+  dst[123] = (dst[123] & 0x00010001u) | 0x7FF00000u;
+  dst[160] &= 0xFFFEFFFEu;
+  dst[161] &= 0xFFFEFFFEu;
+  dst[162] = 0xFFFE0000u;
+  dst[163] = 0xFFFE0000u;
+  dst[200] = (dst[200] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[201] = (dst[201] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[202] = 0xFFFF0000u;
+  dst[203] = 0xFFFF0000u;
+  dst[204] &= 0x7FFF7FFFu;
+  dst[205] &= 0x7FFF7FFFu;
+  dst[240] = (dst[240] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[241] = (dst[241] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[242] = 0xFFFF0000u;
+  dst[243] = 0xFFFF0000u;
+  dst[244] &= 0x7FFF7FFFu;
+  dst[245] &= 0x7FFF7FFFu;
+  dst[280] = (dst[280] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[281] = (dst[281] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[282] = 0xF8E30000u;
+  dst[283] = 0xF8E30000u;
+  dst[284] &= 0x7FFF7FFFu;
+  dst[285] &= 0x7FFF7FFFu;
+  dst[320] = (dst[320] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[321] = (dst[321] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[322] = 0x732D0200u;
+  dst[323] = 0x732D030Cu;
+  dst[324] &= 0x7FFF7FFFu;
+  dst[325] &= 0x7FFF7FFFu;
+  dst[360] &= 0xFFFEFFFEu;
+  dst[361] &= 0xFFFEFFFEu;
+  dst[362] = 0xA3CE0B00u;
+  dst[363] = 0xAB8E0BCEu;
+  dst[364] &= 0x7FFF7FFFu;
+  dst[365] &= 0x7FFF7FFFu;
+  dst[400] &= 0xFFFEFFFEu;
+  dst[401] &= 0xFFFEFFFEu;
+  dst[402] = 0x93FE0B00u;
+  dst[403] = 0x9BFE1BFEu;
+  dst[440] = (dst[440] & 0xFFFEFFFEu) | 0x00010000u;
+  dst[441] = (dst[441] & 0xFFFEFFFEu) | 0x00000001u;
+  dst[442] = 0xB7FE6B00u;
+  dst[443] = 0xFFFE7BFEu;
+  dst[480] = (dst[480] & 0xFFFEFFFEu) | 0x00010000u;
+  dst[481] = (dst[481] & 0xFFFEFFFEu) | 0x00000001u;
+  dst[482] = 0xFFFCCE00u;
+  dst[483] = 0xFFFCFFFCu;
+  dst[520] = (dst[520] & 0xFFFEFFFEu) | 0x00010000u;
+  dst[521] = (dst[521] & 0xFFFEFFFEu) | 0x00000001u;
+  dst[522] = 0xFFF00000u;
+  dst[523] = 0xF9F0FFF0u;
+  dst[524] &= 0x7FFF7FFFu;
+  dst[525] &= 0x7FFF7FFFu;
+  dst[562] = 0xFFE00004u;
+  dst[563] = 0x77CDFFE0u;
+  dst[564] &= 0x3FFF3FFFu;
+  dst[565] = (dst[565] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[602] = (dst[602] & 0x80008000u) | 0x7FC00019u;
+  dst[603] = (dst[603] & 0x80008000u) | 0x1F1B7FC0u;
+  dst[604] &= 0x1FFF1FFFu;
+  dst[605] = (dst[605] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[642] = (dst[642] & 0xE000E000u) | 0x01800009u;
+  dst[643] = (dst[643] & 0xE000E000u) | 0x003B0180u;
+  dst[644] = (dst[644] & 0x0FFF0FFFu) | 0x00008000u;
+  dst[645] = (dst[645] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[682] = (dst[682] & 0xE000E000u) | 0x03800803u;
+  dst[683] = (dst[683] & 0xE000E000u) | 0x08030380u;
+  dst[684] = (dst[684] & 0x07FF07FFu) | 0x00002000u;
+  dst[685] = (dst[685] & 0x07FF07FFu) | 0x20000000u;
+  dst[720] &= 0xFFF1FFF1u;
+  dst[721] &= 0xFFF1FFF1u;
+  dst[722] = (dst[722] & 0xE000E000u) | 0x00000840u;
+  dst[723] = (dst[723] & 0xE000E000u) | 0x085A0040u;
+  dst[724] = (dst[724] & 0x03FF03FFu) | 0x60009800u;
+  dst[725] = (dst[725] & 0x03FF03FFu) | 0xF8000000u;
+  dst[760] = (dst[760] & 0xFFE0FFE0u) | 0x000E0000u;
+  dst[761] = (dst[761] & 0xFFE0FFE0u) | 0x000E000Eu;
+  dst[762] = 0x00000BC1u;
+  dst[763] = 0x0BD903C0u;
+  dst[764] = (dst[764] & 0x03FF03FFu) | 0xF0000800u;
+  dst[765] = (dst[765] & 0x03FF03FFu) | 0xF8000000u;
+  dst[800] = (dst[800] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[801] = (dst[801] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[802] = 0x40011BC0u;
+  dst[803] = 0x5BDD43C0u;
+  dst[804] = (dst[804] & 0x03FF03FFu) | 0xE0001000u;
+  dst[805] = (dst[805] & 0x03FF03FFu) | 0xF0000000u;
+  dst[840] = (dst[840] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[841] = (dst[841] & 0xFFC0FFC0u) | 0x001F001Fu;
+  dst[842] = 0x40001BE1u;
+  dst[843] = 0x5BED43E0u;
+  dst[844] = (dst[844] & 0x01FF01FFu) | 0x8C004000u;
+  dst[845] = (dst[845] & 0x01FF01FFu) | 0xCC000C00u;
+  dst[880] = (dst[880] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[881] = (dst[881] & 0xFFC0FFC0u) | 0x001E001Eu;
+  dst[882] = 0xC0001BE1u;
+  dst[883] = 0xDBEDC3E0u;
+  dst[884] = (dst[884] & 0x01FF01FFu) | 0x3C008000u;
+  dst[885] = (dst[885] & 0x01FF01FFu) | 0xBC003C00u;
+  dst[920] = (dst[920] & 0xFFC0FFC0u) | 0x001E0000u;
+  dst[921] = (dst[921] & 0xFFC0FFC0u) | 0x001E001Eu;
+  dst[922] = 0x00001BE0u;
+  dst[923] = 0x1BEE03E0u;
+  dst[924] = (dst[924] & 0x40FF40FFu) | 0x1E000000u;
+  dst[925] = (dst[925] & 0x40FF40FFu) | 0x1E001E00u;
+  dst[960] &= 0xFFE1FFE1u;
+  dst[961] &= 0xFFE1FFE1u;
+  dst[962] = (dst[962] & 0x80008000u) | 0x000017E0u;
+  dst[963] = (dst[963] & 0x80008000u) | 0x37EE07E0u;
+  dst[964] = (dst[964] & 0xE0FFE0FFu) | 0x0E000000u;
+  dst[965] = (dst[965] & 0xE0FFE0FFu) | 0x0E000E00u;
+  dst[1002] = (dst[1002] & 0x80008000u) | 0x000017F0u;
+  dst[1003] = (dst[1003] & 0x80008000u) | 0x37F707F0u;
+  dst[1004] = (dst[1004] & 0x407F407Fu) | 0x1F000000u;
+  dst[1005] = (dst[1005] & 0x407F407Fu) | 0x1F001F00u;
+  dst[1042] = (dst[1042] & 0x80008000u) | 0x000017F0u;
+  dst[1043] = (dst[1043] & 0x80008000u) | 0x37F707F0u;
+  dst[1044] = (dst[1044] & 0x007F007Fu) | 0x1F000000u;
+  dst[1045] = (dst[1045] & 0x007F007Fu) | 0x9F001F00u;
+  dst[1082] = 0x000007F8u;
+  dst[1083] = 0x77FB07F8u;
+  dst[1084] = (dst[1084] & 0x007F007Fu) | 0x3F000000u;
+  dst[1085] = (dst[1085] & 0x007F007Fu) | 0xBF003F00u;
+  dst[1122] = 0x00000FFCu;
+  dst[1123] = 0x0FFC0FFCu;
+  dst[1124] = (dst[1124] & 0x00FF00FFu) | 0x1E000000u;
+  dst[1125] = (dst[1125] & 0x00FF00FFu) | 0x1E001E00u;
+  dst[1162] = 0x700103F8u;
+  dst[1163] = 0x73F903F8u;
+  dst[1164] = (dst[1164] & 0x01FF01FFu) | 0xE0000000u;
+  dst[1165] = (dst[1165] & 0x01FF01FFu) | 0xE0000000u;
+  dst[1200] &= 0xFFFEFFFEu;
+  dst[1201] &= 0xFFFEFFFEu;
+  dst[1202] = 0xDC062001u;
+  dst[1203] = 0xFC072001u;
+  dst[1204] = (dst[1204] & 0x07FF07FFu) | 0x70008000u;
+  dst[1205] = (dst[1205] & 0x07FF07FFu) | 0xF0008000u;
+  dst[1240] &= 0xFFFEFFFEu;
+  dst[1241] &= 0xFFFEFFFEu;
+  dst[1242] = (dst[1242] & 0x00F000F0u) | 0x8E047003u;
+  dst[1243] = (dst[1243] & 0x00F000F0u) | 0xFE077003u;
+  dst[1244] = (dst[1244] & 0x03FF03FFu) | 0x3800C000u;
+  dst[1245] = (dst[1245] & 0x03FF03FFu) | 0xF800C000u;
+  dst[1280] = (dst[1280] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1281] = (dst[1281] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1282] = (dst[1282] & 0x00F000F0u) | 0x8E047003u;
+  dst[1283] = (dst[1283] & 0x00F000F0u) | 0xFE077003u;
+  dst[1284] = (dst[1284] & 0x01FF01FFu) | 0x3C00C000u;
+  dst[1285] = (dst[1285] & 0x01FF01FFu) | 0xFC00C000u;
+  dst[1320] = (dst[1320] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1321] = (dst[1321] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1322] = (dst[1322] & 0x00700070u) | 0xCF043003u;
+  dst[1323] = (dst[1323] & 0x00700070u) | 0xFF073003u;
+  dst[1324] = (dst[1324] & 0x00FF00FFu) | 0x3E00C000u;
+  dst[1325] = (dst[1325] & 0x00FF00FFu) | 0xFE00C000u;
+  dst[1360] = (dst[1360] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1361] = (dst[1361] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1362] = (dst[1362] & 0x00780078u) | 0xFF020001u;
+  dst[1363] = (dst[1363] & 0x00780078u) | 0xFF030001u;
+  dst[1364] = (dst[1364] & 0x003F003Fu) | 0x7F008000u;
+  dst[1365] = (dst[1365] & 0x003F003Fu) | 0xFF008000u;
+  dst[1400] = (dst[1400] & 0xFF80FF80u) | 0x001C0003u;
+  dst[1401] = (dst[1401] & 0xFF80FF80u) | 0x001F0003u;
+  dst[1402] = (dst[1402] & 0x00780078u) | 0x3F03C000u;
+  dst[1403] = (dst[1403] & 0x00780078u) | 0xFF03C000u;
+  dst[1404] = (dst[1404] & 0x000F000Fu) | 0xFFC00000u;
+  dst[1405] = (dst[1405] & 0x000F000Fu) | 0xFFC00000u;
+  dst[1440] = (dst[1440] & 0xFF00FF00u) | 0x0070000Fu;
+  dst[1441] = (dst[1441] & 0xFF00FF00u) | 0x007F000Fu;
+  dst[1442] = (dst[1442] & 0x00780078u) | 0x7F038000u;
+  dst[1443] = (dst[1443] & 0x00780078u) | 0xFF038000u;
+  dst[1444] = (dst[1444] & 0x00030003u) | 0xF0F00F00u;
+  dst[1445] = (dst[1445] & 0x00030003u) | 0xFFF00F00u;
+  dst[1480] = (dst[1480] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1481] = (dst[1481] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1482] = (dst[1482] & 0x007C007Cu) | 0xFF010000u;
+  dst[1483] = (dst[1483] & 0x007C007Cu) | 0xFF010000u;
+  dst[1484] = (dst[1484] & 0x00010001u) | 0xE07C1F80u;
+  dst[1485] = (dst[1485] & 0x00010001u) | 0xFFFC1F80u;
+  dst[1520] = (dst[1520] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1521] = (dst[1521] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[1522] = (dst[1522] & 0x00FC00FCu) | 0xFE010000u;
+  dst[1523] = (dst[1523] & 0x00FC00FCu) | 0xFE010000u;
+  dst[1524] = 0xFFFE0000u;
+  dst[1525] = 0xFFFE0000u;
+  dst[1560] &= 0xFF00FF00u;
+  dst[1561] &= 0xFF00FF00u;
+  dst[1562] &= 0x01FC01FCu;
+  dst[1563] &= 0x01FC01FCu;
+  dst[1564] = 0x00000000u;
+  dst[1565] = 0x00000000u;
+}
+
+static void img_loserboy_f21_s8(uint32_t *dst) {
+  dst[42] &= 0xF01FF01Fu;
+  dst[43] &= 0xF01FF01Fu;
+  dst[82] = (dst[82] & 0xC003C003u) | 0x0FE00000u;
+  dst[83] = (dst[83] & 0xC003C003u) | 0x0FE00000u;
+  dst[122] = (dst[122] & 0x80008000u) | 0x3FF80000u;
+  dst[123] = (dst[123] & 0x80008000u) | 0x3FF80000u;
+  dst[162] = 0x7FFF0000u;
+  dst[163] = 0x7FFF0000u;
+  dst[164] &= 0x7FFF7FFFu;
+  dst[165] &= 0x7FFF7FFFu;
+  dst[200] &= 0xFFFEFFFEu;
+  dst[201] &= 0xFFFEFFFEu;
+  dst[202] = 0xFFFF0000u;
+  dst[203] = 0xFFFF0000u;
+  dst[204] = (dst[204] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[205] = (dst[205] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[240] &= 0xFFFEFFFEu;
+  dst[241] &= 0xFFFEFFFEu;
+  dst[242] = 0xFFFF0000u;
+  dst[243] = 0xFFFF0000u;
+  dst[244] = (dst[244] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[245] = (dst[245] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[280] &= 0xFFFEFFFEu;
+  dst[281] &= 0xFFFEFFFEu;
+  dst[282] = 0xFC710000u;
+  dst[283] = 0xFC710000u;
+  dst[284] = (dst[284] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[285] = (dst[285] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[320] &= 0xFFFEFFFEu;
+  dst[321] &= 0xFFFEFFFEu;
+  dst[322] = 0xB9960100u;
+  dst[323] = 0xB9960186u;
+  dst[324] = (dst[324] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[325] = (dst[325] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[362] = 0x51E70580u;
+  dst[363] = 0x55C705E7u;
+  dst[364] &= 0x3FFF3FFFu;
+  dst[365] &= 0x3FFF3FFFu;
+  dst[402] = 0x49FF0580u;
+  dst[403] = 0x4DFF0DFFu;
+  dst[404] &= 0x7FFF7FFFu;
+  dst[405] &= 0x7FFF7FFFu;
+  dst[442] = 0xDBFF3580u;
+  dst[443] = 0x7FFFBDFFu;
+  dst[444] &= 0x7FFF7FFFu;
+  dst[445] &= 0x7FFF7FFFu;
+  dst[482] = 0xFFFE6700u;
+  dst[483] = 0x7FFEFFFEu;
+  dst[484] &= 0x7FFF7FFFu;
+  dst[485] &= 0x7FFF7FFFu;
+  dst[522] = 0xFFF80000u;
+  dst[523] = 0x7CF8FFF8u;
+  dst[524] &= 0x3FFF3FFFu;
+  dst[525] &= 0x3FFF3FFFu;
+  dst[562] = (dst[562] & 0x80008000u) | 0x7FF00002u;
+  dst[563] = (dst[563] & 0x80008000u) | 0x3BE67FF0u;
+  dst[564] &= 0x1FFF1FFFu;
+  dst[565] = (dst[565] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[602] = (dst[602] & 0xC000C000u) | 0x3FE0000Cu;
+  dst[603] = (dst[603] & 0xC000C000u) | 0x0F8D3FE0u;
+  dst[604] = (dst[604] & 0x0FFF0FFFu) | 0x00008000u;
+  dst[605] = (dst[605] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[642] = (dst[642] & 0xF000F000u) | 0x00C00004u;
+  dst[643] = (dst[643] & 0xF000F000u) | 0x001D00C0u;
+  dst[644] = (dst[644] & 0x07FF07FFu) | 0x0000C000u;
+  dst[645] = (dst[645] & 0x07FF07FFu) | 0xE0000000u;
+  dst[682] = (dst[682] & 0xF000F000u) | 0x01C00401u;
+  dst[683] = (dst[683] & 0xF000F000u) | 0x040101C0u;
+  dst[684] = (dst[684] & 0x03FF03FFu) | 0x00009000u;
+  dst[685] = (dst[685] & 0x03FF03FFu) | 0x90000000u;
+  dst[720] &= 0xFFF8FFF8u;
+  dst[721] &= 0xFFF8FFF8u;
+  dst[722] = (dst[722] & 0xF000F000u) | 0x00000420u;
+  dst[723] = (dst[723] & 0xF000F000u) | 0x042D0020u;
+  dst[724] = (dst[724] & 0x01FF01FFu) | 0x30004C00u;
+  dst[725] = (dst[725] & 0x01FF01FFu) | 0x7C000000u;
+  dst[760] = (dst[760] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[761] = (dst[761] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[762] = 0x000005E0u;
+  dst[763] = 0x05EC01E0u;
+  dst[764] = (dst[764] & 0x01FF01FFu) | 0x78008400u;
+  dst[765] = (dst[765] & 0x01FF01FFu) | 0xFC000000u;
+  dst[800] = (dst[800] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[801] = (dst[801] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[802] = 0xA0000DE0u;
+  dst[803] = 0xADEEA1E0u;
+  dst[804] = (dst[804] & 0x01FF01FFu) | 0xF0000800u;
+  dst[805] = (dst[805] & 0x01FF01FFu) | 0xF8000000u;
+  dst[840] = (dst[840] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[841] = (dst[841] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[842] = 0xA0000DF0u;
+  dst[843] = 0xADF6A1F0u;
+  dst[844] = (dst[844] & 0x00FF00FFu) | 0x4600A000u;
+  dst[845] = (dst[845] & 0x00FF00FFu) | 0xE6000600u;
+  dst[880] = (dst[880] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[881] = (dst[881] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[882] = 0x60000DF0u;
+  dst[883] = 0x6DF661F0u;
+  dst[884] = (dst[884] & 0x00FF00FFu) | 0x1E00C000u;
+  dst[885] = (dst[885] & 0x00FF00FFu) | 0xDE001E00u;
+  dst[920] = (dst[920] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[921] = (dst[921] & 0xFFE0FFE0u) | 0x000F000Fu;
+  dst[922] = 0x00000DF0u;
+  dst[923] = 0x0DF701F0u;
+  dst[924] = (dst[924] & 0x207F207Fu) | 0x0F000000u;
+  dst[925] = (dst[925] & 0x207F207Fu) | 0x0F000F00u;
+  dst[960] &= 0xFFF0FFF0u;
+  dst[961] &= 0xFFF0FFF0u;
+  dst[962] = (dst[962] & 0xC000C000u) | 0x00000BF0u;
+  dst[963] = (dst[963] & 0xC000C000u) | 0x1BF703F0u;
+  dst[964] = (dst[964] & 0x707F707Fu) | 0x07000000u;
+  dst[965] = (dst[965] & 0x707F707Fu) | 0x07000700u;
+  dst[1002] = (dst[1002] & 0xC000C000u) | 0x00000BF8u;
+  dst[1003] = (dst[1003] & 0xC000C000u) | 0x1BFB03F8u;
+  dst[1004] = (dst[1004] & 0x203F203Fu) | 0x0F800000u;
+  dst[1005] = (dst[1005] & 0x203F203Fu) | 0x8F800F80u;
+  dst[1042] = (dst[1042] & 0xC000C000u) | 0x00000BF8u;
+  dst[1043] = (dst[1043] & 0xC000C000u) | 0x1BFB03F8u;
+  dst[1044] = (dst[1044] & 0x003F003Fu) | 0x0F800000u;
+  dst[1045] = (dst[1045] & 0x003F003Fu) | 0xCF800F80u;
+  dst[1082] = (dst[1082] & 0x80008000u) | 0x000003FCu;
+  dst[1083] = (dst[1083] & 0x80008000u) | 0x3BFD03FCu;
+  dst[1084] = (dst[1084] & 0x003F003Fu) | 0x1F800000u;
+  dst[1085] = (dst[1085] & 0x003F003Fu) | 0xDF801F80u;
+  dst[1122] = (dst[1122] & 0x80008000u) | 0x000007FEu;
+  dst[1123] = (dst[1123] & 0x80008000u) | 0x07FE07FEu;
+  dst[1124] = (dst[1124] & 0x007F007Fu) | 0x0F000000u;
+  dst[1125] = (dst[1125] & 0x007F007Fu) | 0x0F000F00u;
+  dst[1162] = (dst[1162] & 0x80008000u) | 0x380001FCu;
+  dst[1163] = (dst[1163] & 0x80008000u) | 0x39FC01FCu;
+  dst[1164] = (dst[1164] & 0x00FF00FFu) | 0xF0000000u;
+  dst[1165] = (dst[1165] & 0x00FF00FFu) | 0xF0000000u;
+  dst[1202] = 0x6E031000u;
+  dst[1203] = 0x7E031000u;
+  dst[1204] = (dst[1204] & 0x03FF03FFu) | 0x3800C000u;
+  dst[1205] = (dst[1205] & 0x03FF03FFu) | 0xF800C000u;
+  dst[1242] = (dst[1242] & 0x00780078u) | 0x47023801u;
+  dst[1243] = (dst[1243] & 0x00780078u) | 0x7F033801u;
+  dst[1244] = (dst[1244] & 0x01FF01FFu) | 0x1C00E000u;
+  dst[1245] = (dst[1245] & 0x01FF01FFu) | 0xFC00E000u;
+  dst[1280] &= 0xFFFEFFFEu;
+  dst[1281] &= 0xFFFEFFFEu;
+  dst[1282] = (dst[1282] & 0x00780078u) | 0xC7023801u;
+  dst[1283] = (dst[1283] & 0x00780078u) | 0xFF033801u;
+  dst[1284] = (dst[1284] & 0x00FF00FFu) | 0x1E00E000u;
+  dst[1285] = (dst[1285] & 0x00FF00FFu) | 0xFE00E000u;
+  dst[1320] &= 0xFFFCFFFCu;
+  dst[1321] &= 0xFFFCFFFCu;
+  dst[1322] = (dst[1322] & 0x00380038u) | 0xE7821801u;
+  dst[1323] = (dst[1323] & 0x00380038u) | 0xFF831801u;
+  dst[1324] = (dst[1324] & 0x007F007Fu) | 0x1F00E000u;
+  dst[1325] = (dst[1325] & 0x007F007Fu) | 0xFF00E000u;
+  dst[1360] = (dst[1360] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1361] = (dst[1361] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1362] = (dst[1362] & 0x003C003Cu) | 0xFF810000u;
+  dst[1363] = (dst[1363] & 0x003C003Cu) | 0xFF810000u;
+  dst[1364] = (dst[1364] & 0x001F001Fu) | 0x3F80C000u;
+  dst[1365] = (dst[1365] & 0x001F001Fu) | 0xFF80C000u;
+  dst[1400] = (dst[1400] & 0xFFC0FFC0u) | 0x000E0001u;
+  dst[1401] = (dst[1401] & 0xFFC0FFC0u) | 0x000F0001u;
+  dst[1402] = (dst[1402] & 0x003C003Cu) | 0x1F81E000u;
+  dst[1403] = (dst[1403] & 0x003C003Cu) | 0xFF81E000u;
+  dst[1404] = (dst[1404] & 0x00070007u) | 0xFFE00000u;
+  dst[1405] = (dst[1405] & 0x00070007u) | 0xFFE00000u;
+  dst[1440] = (dst[1440] & 0xFF80FF80u) | 0x00380007u;
+  dst[1441] = (dst[1441] & 0xFF80FF80u) | 0x003F0007u;
+  dst[1442] = (dst[1442] & 0x003C003Cu) | 0x3F81C000u;
+  dst[1443] = (dst[1443] & 0x003C003Cu) | 0xFF81C000u;
+  dst[1444] = (dst[1444] & 0x00010001u) | 0xF8780780u;
+  dst[1445] = (dst[1445] & 0x00010001u) | 0xFFF80780u;
+  dst[1480] = (dst[1480] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1481] = (dst[1481] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1482] = (dst[1482] & 0x003E003Eu) | 0xFF800000u;
+  dst[1483] = (dst[1483] & 0x003E003Eu) | 0xFF800000u;
+  dst[1484] = 0xF03E0FC0u;
+  dst[1485] = 0xFFFE0FC0u;
+  dst[1520] = (dst[1520] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1521] = (dst[1521] & 0xFF00FF00u) | 0x007F0000u;
+  dst[1522] = (dst[1522] & 0x007E007Eu) | 0xFF000000u;
+  dst[1523] = (dst[1523] & 0x007E007Eu) | 0xFF000000u;
+  dst[1524] = 0xFFFF0000u;
+  dst[1525] = 0xFFFF0000u;
+  dst[1526] &= 0x7FFF7FFFu;
+  dst[1527] &= 0x7FFF7FFFu;
+  dst[1560] &= 0xFF80FF80u;
+  dst[1561] &= 0xFF80FF80u;
+  dst[1562] &= 0x00FE00FEu;
+  dst[1563] &= 0x00FE00FEu;
+  dst[1564] = 0x00000000u;
+  dst[1565] = 0x00000000u;
+  dst[1566] &= 0x7FFF7FFFu;
+  dst[1567] &= 0x7FFF7FFFu;
+}
+
+static void img_loserboy_f21_s9(uint32_t *dst) {
+  dst[42] &= 0xF80FF80Fu;
+  dst[43] &= 0xF80FF80Fu;
+  dst[82] = (dst[82] & 0xE001E001u) | 0x07F00000u;
+  dst[83] = (dst[83] & 0xE001E001u) | 0x07F00000u;
+  dst[122] = (dst[122] & 0xC000C000u) | 0x1FFC0000u;
+  dst[123] = (dst[123] & 0xC000C000u) | 0x1FFC0000u;
+  dst[124] &= 0x7FFF7FFFu;
+  dst[125] &= 0x7FFF7FFFu;
+  dst[162] = (dst[162] & 0x80008000u) | 0x3FFF0000u;
+  dst[163] = (dst[163] & 0x80008000u) | 0x3FFF0000u;
+  dst[164] = (dst[164] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[165] = (dst[165] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[202] = 0x7FFF0000u;
+  dst[203] = 0x7FFF0000u;
+  dst[204] = (dst[204] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[205] = (dst[205] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[242] = 0x7FFF0000u;
+  dst[243] = 0x7FFF0000u;
+  dst[244] = (dst[244] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[245] = (dst[245] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[282] = 0x7E380000u;
+  dst[283] = 0x7E380000u;
+  dst[284] = (dst[284] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[285] = (dst[285] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[322] = 0x5CCB0080u;
+  dst[323] = 0x5CCB00C3u;
+  dst[324] = (dst[324] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[325] = (dst[325] & 0x1FFF1FFFu) | 0x40000000u;
+  dst[362] = (dst[362] & 0x80008000u) | 0x28F302C0u;
+  dst[363] = (dst[363] & 0x80008000u) | 0x2AE302F3u;
+  dst[364] = (dst[364] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[365] = (dst[365] & 0x1FFF1FFFu) | 0x80008000u;
+  dst[402] = (dst[402] & 0x80008000u) | 0x24FF02C0u;
+  dst[403] = (dst[403] & 0x80008000u) | 0x26FF06FFu;
+  dst[404] = (dst[404] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[405] = (dst[405] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[442] = (dst[442] & 0x80008000u) | 0x6DFF1AC0u;
+  dst[443] = (dst[443] & 0x80008000u) | 0x3FFF5EFFu;
+  dst[444] = (dst[444] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[445] = (dst[445] & 0x3FFF3FFFu) | 0x80008000u;
+  dst[482] = (dst[482] & 0x80008000u) | 0x7FFF3380u;
+  dst[483] = (dst[483] & 0x80008000u) | 0x3FFF7FFFu;
+  dst[484] &= 0x3FFF3FFFu;
+  dst[485] &= 0x3FFF3FFFu;
+  dst[522] = (dst[522] & 0x80008000u) | 0x7FFC0000u;
+  dst[523] = (dst[523] & 0x80008000u) | 0x3E7C7FFCu;
+  dst[524] &= 0x1FFF1FFFu;
+  dst[525] &= 0x1FFF1FFFu;
+  dst[562] = (dst[562] & 0xC000C000u) | 0x3FF80001u;
+  dst[563] = (dst[563] & 0xC000C000u) | 0x1DF33FF8u;
+  dst[564] &= 0x0FFF0FFFu;
+  dst[565] = (dst[565] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[602] = (dst[602] & 0xE000E000u) | 0x1FF00006u;
+  dst[603] = (dst[603] & 0xE000E000u) | 0x07C61FF0u;
+  dst[604] = (dst[604] & 0x07FF07FFu) | 0x00004000u;
+  dst[605] = (dst[605] & 0x07FF07FFu) | 0xF0000000u;
+  dst[642] = (dst[642] & 0xF800F800u) | 0x00600002u;
+  dst[643] = (dst[643] & 0xF800F800u) | 0x000E0060u;
+  dst[644] = (dst[644] & 0x03FF03FFu) | 0x00006000u;
+  dst[645] = (dst[645] & 0x03FF03FFu) | 0xF0000000u;
+  dst[682] = (dst[682] & 0xF800F800u) | 0x00E00200u;
+  dst[683] = (dst[683] & 0xF800F800u) | 0x020000E0u;
+  dst[684] = (dst[684] & 0x01FF01FFu) | 0x0000C800u;
+  dst[685] = (dst[685] & 0x01FF01FFu) | 0xC8000000u;
+  dst[720] &= 0xFFFCFFFCu;
+  dst[721] &= 0xFFFCFFFCu;
+  dst[722] = (dst[722] & 0x78007800u) | 0x00000210u;
+  dst[723] = (dst[723] & 0x78007800u) | 0x02160010u;
+  dst[724] = (dst[724] & 0x00FF00FFu) | 0x18002600u;
+  dst[725] = (dst[725] & 0x00FF00FFu) | 0xBE000000u;
+  dst[760] = (dst[760] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[761] = (dst[761] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[762] = 0x800002F0u;
+  dst[763] = 0x82F680F0u;
+  dst[764] = (dst[764] & 0x00FF00FFu) | 0x3C004200u;
+  dst[765] = (dst[765] & 0x00FF00FFu) | 0x7E000000u;
+  dst[800] = (dst[800] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[801] = (dst[801] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[802] = 0xD00006F0u;
+  dst[803] = 0xD6F7D0F0u;
+  dst[804] = (dst[804] & 0x00FF00FFu) | 0x78000400u;
+  dst[805] = (dst[805] & 0x00FF00FFu) | 0x7C000000u;
+  dst[840] = (dst[840] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[841] = (dst[841] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[842] = 0xD00006F8u;
+  dst[843] = 0xD6FBD0F8u;
+  dst[844] = (dst[844] & 0x007F007Fu) | 0x23005000u;
+  dst[845] = (dst[845] & 0x007F007Fu) | 0x73000300u;
+  dst[880] = (dst[880] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[881] = (dst[881] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[882] = 0xB00006F8u;
+  dst[883] = 0xB6FBB0F8u;
+  dst[884] = (dst[884] & 0x007F007Fu) | 0x0F006000u;
+  dst[885] = (dst[885] & 0x007F007Fu) | 0x6F000F00u;
+  dst[920] = (dst[920] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[921] = (dst[921] & 0xFFF0FFF0u) | 0x00070007u;
+  dst[922] = 0x800006F8u;
+  dst[923] = 0x86FB80F8u;
+  dst[924] = (dst[924] & 0x103F103Fu) | 0x07800000u;
+  dst[925] = (dst[925] & 0x103F103Fu) | 0x87800780u;
+  dst[960] &= 0xFFF8FFF8u;
+  dst[961] &= 0xFFF8FFF8u;
+  dst[962] = (dst[962] & 0x60006000u) | 0x000005F8u;
+  dst[963] = (dst[963] & 0x60006000u) | 0x0DFB01F8u;
+  dst[964] = (dst[964] & 0x383F383Fu) | 0x03800000u;
+  dst[965] = (dst[965] & 0x383F383Fu) | 0x83800380u;
+  dst[1002] = (dst[1002] & 0xE000E000u) | 0x000005FCu;
+  dst[1003] = (dst[1003] & 0xE000E000u) | 0x0DFD01FCu;
+  dst[1004] = (dst[1004] & 0x101F101Fu) | 0x07C00000u;
+  dst[1005] = (dst[1005] & 0x101F101Fu) | 0xC7C007C0u;
+  dst[1042] = (dst[1042] & 0xE000E000u) | 0x000005FCu;
+  dst[1043] = (dst[1043] & 0xE000E000u) | 0x0DFD01FCu;
+  dst[1044] = (dst[1044] & 0x001F001Fu) | 0x07C00000u;
+  dst[1045] = (dst[1045] & 0x001F001Fu) | 0xE7C007C0u;
+  dst[1082] = (dst[1082] & 0xC000C000u) | 0x000001FEu;
+  dst[1083] = (dst[1083] & 0xC000C000u) | 0x1DFE01FEu;
+  dst[1084] = (dst[1084] & 0x001F001Fu) | 0x0FC00000u;
+  dst[1085] = (dst[1085] & 0x001F001Fu) | 0xEFC00FC0u;
+  dst[1122] = (dst[1122] & 0xC000C000u) | 0x000003FFu;
+  dst[1123] = (dst[1123] & 0xC000C000u) | 0x03FF03FFu;
+  dst[1124] = (dst[1124] & 0x003F003Fu) | 0x07800000u;
+  dst[1125] = (dst[1125] & 0x003F003Fu) | 0x07800780u;
+  dst[1162] = (dst[1162] & 0xC000C000u) | 0x1C0000FEu;
+  dst[1163] = (dst[1163] & 0xC000C000u) | 0x1CFE00FEu;
+  dst[1164] = (dst[1164] & 0x007F007Fu) | 0x78000000u;
+  dst[1165] = (dst[1165] & 0x007F007Fu) | 0x78000000u;
+  dst[1202] = (dst[1202] & 0x80008000u) | 0x37010800u;
+  dst[1203] = (dst[1203] & 0x80008000u) | 0x3F010800u;
+  dst[1204] = (dst[1204] & 0x01FF01FFu) | 0x9C006000u;
+  dst[1205] = (dst[1205] & 0x01FF01FFu) | 0xFC006000u;
+  dst[1242] = (dst[1242] & 0x803C803Cu) | 0x23811C00u;
+  dst[1243] = (dst[1243] & 0x803C803Cu) | 0x3F811C00u;
+  dst[1244] = (dst[1244] & 0x00FF00FFu) | 0x0E00F000u;
+  dst[1245] = (dst[1245] & 0x00FF00FFu) | 0xFE00F000u;
+  dst[1282] = (dst[1282] & 0x003C003Cu) | 0x63811C00u;
+  dst[1283] = (dst[1283] & 0x003C003Cu) | 0x7F811C00u;
+  dst[1284] = (dst[1284] & 0x007F007Fu) | 0x0F00F000u;
+  dst[1285] = (dst[1285] & 0x007F007Fu) | 0xFF00F000u;
+  dst[1320] &= 0xFFFEFFFEu;
+  dst[1321] &= 0xFFFEFFFEu;
+  dst[1322] = (dst[1322] & 0x001C001Cu) | 0x73C10C00u;
+  dst[1323] = (dst[1323] & 0x001C001Cu) | 0x7FC10C00u;
+  dst[1324] = (dst[1324] & 0x003F003Fu) | 0x0F80F000u;
+  dst[1325] = (dst[1325] & 0x003F003Fu) | 0xFF80F000u;
+  dst[1360] = (dst[1360] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1361] = (dst[1361] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1362] = (dst[1362] & 0x001E001Eu) | 0xFFC00000u;
+  dst[1363] = (dst[1363] & 0x001E001Eu) | 0xFFC00000u;
+  dst[1364] = (dst[1364] & 0x000F000Fu) | 0x9FC06000u;
+  dst[1365] = (dst[1365] & 0x000F000Fu) | 0xFFC06000u;
+  dst[1400] = (dst[1400] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1401] = (dst[1401] & 0xFFE0FFE0u) | 0x00070000u;
+  dst[1402] = (dst[1402] & 0x001E001Eu) | 0x0FC0F000u;
+  dst[1403] = (dst[1403] & 0x001E001Eu) | 0xFFC0F000u;
+  dst[1404] = (dst[1404] & 0x00030003u) | 0xFFF00000u;
+  dst[1405] = (dst[1405] & 0x00030003u) | 0xFFF00000u;
+  dst[1440] = (dst[1440] & 0xFFC0FFC0u) | 0x001C0003u;
+  dst[1441] = (dst[1441] & 0xFFC0FFC0u) | 0x001F0003u;
+  dst[1442] = (dst[1442] & 0x001E001Eu) | 0x1FC0E000u;
+  dst[1443] = (dst[1443] & 0x001E001Eu) | 0xFFC0E000u;
+  dst[1444] = 0xFC3C03C0u;
+  dst[1445] = 0xFFFC03C0u;
+  dst[1480] = (dst[1480] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1481] = (dst[1481] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1482] = (dst[1482] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1483] = (dst[1483] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1484] = 0x781F07E0u;
+  dst[1485] = 0x7FFF07E0u;
+  dst[1486] &= 0x7FFF7FFFu;
+  dst[1487] &= 0x7FFF7FFFu;
+  dst[1520] = (dst[1520] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1521] = (dst[1521] & 0xFF80FF80u) | 0x003F0000u;
+  dst[1522] = (dst[1522] & 0x003F003Fu) | 0xFF800000u;
+  dst[1523] = (dst[1523] & 0x003F003Fu) | 0xFF800000u;
+  dst[1524] = 0x7FFF0000u;
+  dst[1525] = 0x7FFF0000u;
+  dst[1526] = (dst[1526] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1527] = (dst[1527] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1560] &= 0xFFC0FFC0u;
+  dst[1561] &= 0xFFC0FFC0u;
+  dst[1562] &= 0x007F007Fu;
+  dst[1563] &= 0x007F007Fu;
+  dst[1564] = 0x00000000u;
+  dst[1565] = 0x00000000u;
+  dst[1566] &= 0x3FFF3FFFu;
+  dst[1567] &= 0x3FFF3FFFu;
+}
+
+static void img_loserboy_f21_s10(uint32_t *dst) {
+  dst[42] &= 0xFC07FC07u;
+  dst[43] &= 0xFC07FC07u;
+  dst[82] = (dst[82] & 0xF000F000u) | 0x03F80000u;
+  dst[83] = (dst[83] & 0xF000F000u) | 0x03F80000u;
+  dst[122] = (dst[122] & 0xE000E000u) | 0x0FFE0000u;
+  dst[123] = (dst[123] & 0xE000E000u) | 0x0FFE0000u;
+  dst[124] &= 0x3FFF3FFFu;
+  dst[125] &= 0x3FFF3FFFu;
+  dst[162] = (dst[162] & 0xC000C000u) | 0x1FFF0000u;
+  dst[163] = (dst[163] & 0xC000C000u) | 0x1FFF0000u;
+  dst[164] = (dst[164] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[165] = (dst[165] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[202] = (dst[202] & 0x80008000u) | 0x3FFF0000u;
+  dst[203] = (dst[203] & 0x80008000u) | 0x3FFF0000u;
+  dst[204] = (dst[204] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[205] = (dst[205] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[242] = (dst[242] & 0x80008000u) | 0x3FFF0000u;
+  dst[243] = (dst[243] & 0x80008000u) | 0x3FFF0000u;
+  dst[244] = (dst[244] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[245] = (dst[245] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[282] = (dst[282] & 0x80008000u) | 0x3F1C0000u;
+  dst[283] = (dst[283] & 0x80008000u) | 0x3F1C0000u;
+  dst[284] = (dst[284] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[285] = (dst[285] & 0x0FFF0FFFu) | 0x60000000u;
+  dst[322] = (dst[322] & 0x80008000u) | 0x2E650040u;
+  dst[323] = (dst[323] & 0x80008000u) | 0x2E650061u;
+  dst[324] = (dst[324] & 0x0FFF0FFFu) | 0xA0000000u;
+  dst[325] = (dst[325] & 0x0FFF0FFFu) | 0xA0008000u;
+  dst[362] = (dst[362] & 0xC000C000u) | 0x14790160u;
+  dst[363] = (dst[363] & 0xC000C000u) | 0x15710179u;
+  dst[364] = (dst[364] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[365] = (dst[365] & 0x0FFF0FFFu) | 0xC000C000u;
+  dst[402] = (dst[402] & 0xC000C000u) | 0x127F0160u;
+  dst[403] = (dst[403] & 0xC000C000u) | 0x137F037Fu;
+  dst[404] = (dst[404] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[405] = (dst[405] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[442] = (dst[442] & 0xC000C000u) | 0x36FF0D60u;
+  dst[443] = (dst[443] & 0xC000C000u) | 0x1FFF2F7Fu;
+  dst[444] = (dst[444] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[445] = (dst[445] & 0x1FFF1FFFu) | 0xC000C000u;
+  dst[482] = (dst[482] & 0xC000C000u) | 0x3FFF19C0u;
+  dst[483] = (dst[483] & 0xC000C000u) | 0x1FFF3FFFu;
+  dst[484] = (dst[484] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[485] = (dst[485] & 0x1FFF1FFFu) | 0x80008000u;
+  dst[522] = (dst[522] & 0xC000C000u) | 0x3FFE0000u;
+  dst[523] = (dst[523] & 0xC000C000u) | 0x1F3E3FFEu;
+  dst[524] &= 0x0FFF0FFFu;
+  dst[525] &= 0x0FFF0FFFu;
+  dst[562] = (dst[562] & 0xE000E000u) | 0x1FFC0000u;
+  dst[563] = (dst[563] & 0xE000E000u) | 0x0EF91FFCu;
+  dst[564] = (dst[564] & 0x07FF07FFu) | 0x00008000u;
+  dst[565] = (dst[565] & 0x07FF07FFu) | 0xB0000000u;
+  dst[602] = (dst[602] & 0xF000F000u) | 0x0FF80003u;
+  dst[603] = (dst[603] & 0xF000F000u) | 0x03E30FF8u;
+  dst[604] = (dst[604] & 0x03FF03FFu) | 0x00002000u;
+  dst[605] = (dst[605] & 0x03FF03FFu) | 0x78000000u;
+  dst[642] = (dst[642] & 0xFC00FC00u) | 0x00300001u;
+  dst[643] = (dst[643] & 0xFC00FC00u) | 0x00070030u;
+  dst[644] = (dst[644] & 0x01FF01FFu) | 0x00003000u;
+  dst[645] = (dst[645] & 0x01FF01FFu) | 0x78000000u;
+  dst[682] = (dst[682] & 0xFC00FC00u) | 0x00700100u;
+  dst[683] = (dst[683] & 0xFC00FC00u) | 0x01000070u;
+  dst[684] = (dst[684] & 0x00FF00FFu) | 0x00006400u;
+  dst[685] = (dst[685] & 0x00FF00FFu) | 0x64000000u;
+  dst[720] &= 0xFFFEFFFEu;
+  dst[721] &= 0xFFFEFFFEu;
+  dst[722] = (dst[722] & 0x3C003C00u) | 0x00000108u;
+  dst[723] = (dst[723] & 0x3C003C00u) | 0x010B0008u;
+  dst[724] = (dst[724] & 0x007F007Fu) | 0x0C001300u;
+  dst[725] = (dst[725] & 0x007F007Fu) | 0x5F000000u;
+  dst[760] = (dst[760] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[761] = (dst[761] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[762] = 0xC0000178u;
+  dst[763] = 0xC17BC078u;
+  dst[764] = (dst[764] & 0x007F007Fu) | 0x1E002100u;
+  dst[765] = (dst[765] & 0x007F007Fu) | 0x3F000000u;
+  dst[800] = (dst[800] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[801] = (dst[801] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[802] = 0xE8000378u;
+  dst[803] = 0xEB7BE878u;
+  dst[804] = (dst[804] & 0x007F007Fu) | 0x3C000200u;
+  dst[805] = (dst[805] & 0x007F007Fu) | 0xBE000000u;
+  dst[840] = (dst[840] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[841] = (dst[841] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[842] = 0xE800037Cu;
+  dst[843] = 0xEB7DE87Cu;
+  dst[844] = (dst[844] & 0x003F003Fu) | 0x11802800u;
+  dst[845] = (dst[845] & 0x003F003Fu) | 0xB9800180u;
+  dst[880] = (dst[880] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[881] = (dst[881] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[882] = 0xD800037Cu;
+  dst[883] = 0xDB7DD87Cu;
+  dst[884] = (dst[884] & 0x003F003Fu) | 0x07803000u;
+  dst[885] = (dst[885] & 0x003F003Fu) | 0xB7800780u;
+  dst[920] = (dst[920] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[921] = (dst[921] & 0xFFF8FFF8u) | 0x00030003u;
+  dst[922] = 0xC000037Cu;
+  dst[923] = 0xC37DC07Cu;
+  dst[924] = (dst[924] & 0x081F081Fu) | 0x03C00000u;
+  dst[925] = (dst[925] & 0x081F081Fu) | 0xC3C003C0u;
+  dst[960] &= 0xFFFCFFFCu;
+  dst[961] &= 0xFFFCFFFCu;
+  dst[962] = (dst[962] & 0x30003000u) | 0x000002FCu;
+  dst[963] = (dst[963] & 0x30003000u) | 0x06FD00FCu;
+  dst[964] = (dst[964] & 0x1C1F1C1Fu) | 0x01C00000u;
+  dst[965] = (dst[965] & 0x1C1F1C1Fu) | 0xC1C001C0u;
+  dst[1002] = (dst[1002] & 0xF000F000u) | 0x000002FEu;
+  dst[1003] = (dst[1003] & 0xF000F000u) | 0x06FE00FEu;
+  dst[1004] = (dst[1004] & 0x080F080Fu) | 0x03E00000u;
+  dst[1005] = (dst[1005] & 0x080F080Fu) | 0xE3E003E0u;
+  dst[1042] = (dst[1042] & 0xF000F000u) | 0x000002FEu;
+  dst[1043] = (dst[1043] & 0xF000F000u) | 0x06FE00FEu;
+  dst[1044] = (dst[1044] & 0x000F000Fu) | 0x03E00000u;
+  dst[1045] = (dst[1045] & 0x000F000Fu) | 0xF3E003E0u;
+  dst[1082] = (dst[1082] & 0xE000E000u) | 0x000000FFu;
+  dst[1083] = (dst[1083] & 0xE000E000u) | 0x0EFF00FFu;
+  dst[1084] = (dst[1084] & 0x000F000Fu) | 0x07E00000u;
+  dst[1085] = (dst[1085] & 0x000F000Fu) | 0x77E007E0u;
+  dst[1122] = (dst[1122] & 0xE000E000u) | 0x000001FFu;
+  dst[1123] = (dst[1123] & 0xE000E000u) | 0x01FF01FFu;
+  dst[1124] = (dst[1124] & 0x001F001Fu) | 0x03C08000u;
+  dst[1125] = (dst[1125] & 0x001F001Fu) | 0x83C083C0u;
+  dst[1162] = (dst[1162] & 0xE000E000u) | 0x0E00007Fu;
+  dst[1163] = (dst[1163] & 0xE000E000u) | 0x0E7F007Fu;
+  dst[1164] = (dst[1164] & 0x003F003Fu) | 0x3C000000u;
+  dst[1165] = (dst[1165] & 0x003F003Fu) | 0x3C000000u;
+  dst[1202] = (dst[1202] & 0xC000C000u) | 0x1B800400u;
+  dst[1203] = (dst[1203] & 0xC000C000u) | 0x1F800400u;
+  dst[1204] = (dst[1204] & 0x00FF00FFu) | 0xCE003000u;
+  dst[1205] = (dst[1205] & 0x00FF00FFu) | 0xFE003000u;
+  dst[1242] = (dst[1242] & 0xC01EC01Eu) | 0x11C00E00u;
+  dst[1243] = (dst[1243] & 0xC01EC01Eu) | 0x1FC00E00u;
+  dst[1244] = (dst[1244] & 0x007F007Fu) | 0x87007800u;
+  dst[1245] = (dst[1245] & 0x007F007Fu) | 0xFF007800u;
+  dst[1282] = (dst[1282] & 0x801E801Eu) | 0x31C00E00u;
+  dst[1283] = (dst[1283] & 0x801E801Eu) | 0x3FC00E00u;
+  dst[1284] = (dst[1284] & 0x003F003Fu) | 0x87807800u;
+  dst[1285] = (dst[1285] & 0x003F003Fu) | 0xFF807800u;
+  dst[1322] = (dst[1322] & 0x000E000Eu) | 0x39E00600u;
+  dst[1323] = (dst[1323] & 0x000E000Eu) | 0x3FE00600u;
+  dst[1324] = (dst[1324] & 0x001F001Fu) | 0x87C07800u;
+  dst[1325] = (dst[1325] & 0x001F001Fu) | 0xFFC07800u;
+  dst[1360] &= 0xFFFCFFFCu;
+  dst[1361] &= 0xFFFCFFFCu;
+  dst[1362] = (dst[1362] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1363] = (dst[1363] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1364] = (dst[1364] & 0x00070007u) | 0x4FE03000u;
+  dst[1365] = (dst[1365] & 0x00070007u) | 0x7FE03000u;
+  dst[1400] = (dst[1400] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1401] = (dst[1401] & 0xFFF0FFF0u) | 0x00030000u;
+  dst[1402] = (dst[1402] & 0x000F000Fu) | 0x87E07800u;
+  dst[1403] = (dst[1403] & 0x000F000Fu) | 0xFFE07800u;
+  dst[1404] = (dst[1404] & 0x00010001u) | 0x7FF80000u;
+  dst[1405] = (dst[1405] & 0x00010001u) | 0x7FF80000u;
+  dst[1440] = (dst[1440] & 0xFFE0FFE0u) | 0x000E0001u;
+  dst[1441] = (dst[1441] & 0xFFE0FFE0u) | 0x000F0001u;
+  dst[1442] = (dst[1442] & 0x000F000Fu) | 0x0FE0F000u;
+  dst[1443] = (dst[1443] & 0x000F000Fu) | 0xFFE0F000u;
+  dst[1444] = 0x7E1E01E0u;
+  dst[1445] = 0x7FFE01E0u;
+  dst[1446] &= 0x7FFF7FFFu;
+  dst[1447] &= 0x7FFF7FFFu;
+  dst[1480] = (dst[1480] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1481] = (dst[1481] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1482] = (dst[1482] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1483] = (dst[1483] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1484] = (dst[1484] & 0x80008000u) | 0x3C0F03F0u;
+  dst[1485] = (dst[1485] & 0x80008000u) | 0x3FFF03F0u;
+  dst[1486] = (dst[1486] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1487] = (dst[1487] & 0x3FFF3FFFu) | 0x80000000u;
+  dst[1520] = (dst[1520] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1521] = (dst[1521] & 0xFFC0FFC0u) | 0x001F0000u;
+  dst[1522] = (dst[1522] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1523] = (dst[1523] & 0x001F001Fu) | 0xFFC00000u;
+  dst[1524] = (dst[1524] & 0x80008000u) | 0x3FFF0000u;
+  dst[1525] = (dst[1525] & 0x80008000u) | 0x3FFF0000u;
+  dst[1526] = (dst[1526] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1527] = (dst[1527] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1560] &= 0xFFE0FFE0u;
+  dst[1561] &= 0xFFE0FFE0u;
+  dst[1562] &= 0x003F003Fu;
+  dst[1563] &= 0x003F003Fu;
+  dst[1564] &= 0x80008000u;
+  dst[1565] &= 0x80008000u;
+  dst[1566] &= 0x1FFF1FFFu;
+  dst[1567] &= 0x1FFF1FFFu;
+}
+
+static void img_loserboy_f21_s11(uint32_t *dst) {
+  dst[42] &= 0xFE03FE03u;
+  dst[43] &= 0xFE03FE03u;
+  dst[82] = (dst[82] & 0xF800F800u) | 0x01FC0000u;
+  dst[83] = (dst[83] & 0xF800F800u) | 0x01FC0000u;
+  dst[84] &= 0x7FFF7FFFu;
+  dst[85] &= 0x7FFF7FFFu;
+  dst[122] = (dst[122] & 0xF000F000u) | 0x07FF0000u;
+  dst[123] = (dst[123] & 0xF000F000u) | 0x07FF0000u;
+  dst[124] &= 0x1FFF1FFFu;
+  dst[125] &= 0x1FFF1FFFu;
+  dst[162] = (dst[162] & 0xE000E000u) | 0x0FFF0000u;
+  dst[163] = (dst[163] & 0xE000E000u) | 0x0FFF0000u;
+  dst[164] = (dst[164] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[165] = (dst[165] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[202] = (dst[202] & 0xC000C000u) | 0x1FFF0000u;
+  dst[203] = (dst[203] & 0xC000C000u) | 0x1FFF0000u;
+  dst[204] = (dst[204] & 0x07FF07FFu) | 0xF0000000u;
+  dst[205] = (dst[205] & 0x07FF07FFu) | 0xF0000000u;
+  dst[242] = (dst[242] & 0xC000C000u) | 0x1FFF0000u;
+  dst[243] = (dst[243] & 0xC000C000u) | 0x1FFF0000u;
+  dst[244] = (dst[244] & 0x07FF07FFu) | 0xF0000000u;
+  dst[245] = (dst[245] & 0x07FF07FFu) | 0xF0000000u;
+  dst[282] = (dst[282] & 0xC000C000u) | 0x1F8E0000u;
+  dst[283] = (dst[283] & 0xC000C000u) | 0x1F8E0000u;
+  dst[284] = (dst[284] & 0x07FF07FFu) | 0x30000000u;
+  dst[285] = (dst[285] & 0x07FF07FFu) | 0x30000000u;
+  dst[322] = (dst[322] & 0xC000C000u) | 0x17320020u;
+  dst[323] = (dst[323] & 0xC000C000u) | 0x17320030u;
+  dst[324] = (dst[324] & 0x07FF07FFu) | 0xD0000000u;
+  dst[325] = (dst[325] & 0x07FF07FFu) | 0xD000C000u;
+  dst[362] = (dst[362] & 0xE000E000u) | 0x0A3C00B0u;
+  dst[363] = (dst[363] & 0xE000E000u) | 0x0AB800BCu;
+  dst[364] = (dst[364] & 0x07FF07FFu) | 0xE0000000u;
+  dst[365] = (dst[365] & 0x07FF07FFu) | 0xE000E000u;
+  dst[402] = (dst[402] & 0xE000E000u) | 0x093F00B0u;
+  dst[403] = (dst[403] & 0xE000E000u) | 0x09BF01BFu;
+  dst[404] = (dst[404] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[405] = (dst[405] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[442] = (dst[442] & 0xE000E000u) | 0x1B7F06B0u;
+  dst[443] = (dst[443] & 0xE000E000u) | 0x0FFF17BFu;
+  dst[444] = (dst[444] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[445] = (dst[445] & 0x0FFF0FFFu) | 0xE000E000u;
+  dst[482] = (dst[482] & 0xE000E000u) | 0x1FFF0CE0u;
+  dst[483] = (dst[483] & 0xE000E000u) | 0x0FFF1FFFu;
+  dst[484] = (dst[484] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[485] = (dst[485] & 0x0FFF0FFFu) | 0xC000C000u;
+  dst[522] = (dst[522] & 0xE000E000u) | 0x1FFF0000u;
+  dst[523] = (dst[523] & 0xE000E000u) | 0x0F9F1FFFu;
+  dst[524] &= 0x07FF07FFu;
+  dst[525] &= 0x07FF07FFu;
+  dst[562] = (dst[562] & 0xF000F000u) | 0x0FFE0000u;
+  dst[563] = (dst[563] & 0xF000F000u) | 0x077C0FFEu;
+  dst[564] = (dst[564] & 0x03FF03FFu) | 0x00004000u;
+  dst[565] = (dst[565] & 0x03FF03FFu) | 0xD8000000u;
+  dst[602] = (dst[602] & 0xF800F800u) | 0x07FC0001u;
+  dst[603] = (dst[603] & 0xF800F800u) | 0x01F107FCu;
+  dst[604] = (dst[604] & 0x01FF01FFu) | 0x00009000u;
+  dst[605] = (dst[605] & 0x01FF01FFu) | 0xBC000000u;
+  dst[642] = (dst[642] & 0xFE00FE00u) | 0x00180000u;
+  dst[643] = (dst[643] & 0xFE00FE00u) | 0x00030018u;
+  dst[644] = (dst[644] & 0x00FF00FFu) | 0x00009800u;
+  dst[645] = (dst[645] & 0x00FF00FFu) | 0xBC000000u;
+  dst[682] = (dst[682] & 0xFE00FE00u) | 0x00380080u;
+  dst[683] = (dst[683] & 0xFE00FE00u) | 0x00800038u;
+  dst[684] = (dst[684] & 0x007F007Fu) | 0x00003200u;
+  dst[685] = (dst[685] & 0x007F007Fu) | 0x32000000u;
+  dst[722] = (dst[722] & 0x1E001E00u) | 0x00000084u;
+  dst[723] = (dst[723] & 0x1E001E00u) | 0x00850004u;
+  dst[724] = (dst[724] & 0x003F003Fu) | 0x06000980u;
+  dst[725] = (dst[725] & 0x003F003Fu) | 0xAF800000u;
+  dst[760] &= 0xFFFEFFFEu;
+  dst[761] &= 0xFFFEFFFEu;
+  dst[762] = 0xE00000BCu;
+  dst[763] = 0xE0BDE03Cu;
+  dst[764] = (dst[764] & 0x003F003Fu) | 0x0F001080u;
+  dst[765] = (dst[765] & 0x003F003Fu) | 0x9F800000u;
+  dst[800] = (dst[800] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[801] = (dst[801] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[802] = 0xF40001BCu;
+  dst[803] = 0xF5BDF43Cu;
+  dst[804] = (dst[804] & 0x003F003Fu) | 0x1E000100u;
+  dst[805] = (dst[805] & 0x003F003Fu) | 0xDF000000u;
+  dst[840] = (dst[840] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[841] = (dst[841] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[842] = 0xF40001BEu;
+  dst[843] = 0xF5BEF43Eu;
+  dst[844] = (dst[844] & 0x001F001Fu) | 0x08C01400u;
+  dst[845] = (dst[845] & 0x001F001Fu) | 0xDCC000C0u;
+  dst[880] = (dst[880] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[881] = (dst[881] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[882] = 0xEC0001BEu;
+  dst[883] = 0xEDBEEC3Eu;
+  dst[884] = (dst[884] & 0x001F001Fu) | 0x03C01800u;
+  dst[885] = (dst[885] & 0x001F001Fu) | 0xDBC003C0u;
+  dst[920] = (dst[920] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[921] = (dst[921] & 0xFFFCFFFCu) | 0x00010001u;
+  dst[922] = 0xE00001BEu;
+  dst[923] = 0xE1BEE03Eu;
+  dst[924] = (dst[924] & 0x040F040Fu) | 0x01E00000u;
+  dst[925] = (dst[925] & 0x040F040Fu) | 0xE1E001E0u;
+  dst[960] &= 0xFFFEFFFEu;
+  dst[961] &= 0xFFFEFFFEu;
+  dst[962] = (dst[962] & 0x18001800u) | 0x0000017Eu;
+  dst[963] = (dst[963] & 0x18001800u) | 0x037E007Eu;
+  dst[964] = (dst[964] & 0x0E0F0E0Fu) | 0x00E00000u;
+  dst[965] = (dst[965] & 0x0E0F0E0Fu) | 0xE0E000E0u;
+  dst[1002] = (dst[1002] & 0xF800F800u) | 0x0000017Fu;
+  dst[1003] = (dst[1003] & 0xF800F800u) | 0x037F007Fu;
+  dst[1004] = (dst[1004] & 0x04070407u) | 0x01F00000u;
+  dst[1005] = (dst[1005] & 0x04070407u) | 0x71F001F0u;
+  dst[1042] = (dst[1042] & 0xF800F800u) | 0x0000017Fu;
+  dst[1043] = (dst[1043] & 0xF800F800u) | 0x037F007Fu;
+  dst[1044] = (dst[1044] & 0x00070007u) | 0x01F00000u;
+  dst[1045] = (dst[1045] & 0x00070007u) | 0x79F001F0u;
+  dst[1082] = (dst[1082] & 0xF000F000u) | 0x0000007Fu;
+  dst[1083] = (dst[1083] & 0xF000F000u) | 0x077F007Fu;
+  dst[1084] = (dst[1084] & 0x00070007u) | 0x03F08000u;
+  dst[1085] = (dst[1085] & 0x00070007u) | 0xBBF083F0u;
+  dst[1122] = (dst[1122] & 0xF000F000u) | 0x000000FFu;
+  dst[1123] = (dst[1123] & 0xF000F000u) | 0x00FF00FFu;
+  dst[1124] = (dst[1124] & 0x000F000Fu) | 0x01E0C000u;
+  dst[1125] = (dst[1125] & 0x000F000Fu) | 0xC1E0C1E0u;
+  dst[1162] = (dst[1162] & 0xF000F000u) | 0x0700003Fu;
+  dst[1163] = (dst[1163] & 0xF000F000u) | 0x073F003Fu;
+  dst[1164] = (dst[1164] & 0x001F001Fu) | 0x1E008000u;
+  dst[1165] = (dst[1165] & 0x001F001Fu) | 0x9E008000u;
+  dst[1202] = (dst[1202] & 0xE000E000u) | 0x0DC00200u;
+  dst[1203] = (dst[1203] & 0xE000E000u) | 0x0FC00200u;
+  dst[1204] = (dst[1204] & 0x007F007Fu) | 0x67001800u;
+  dst[1205] = (dst[1205] & 0x007F007Fu) | 0x7F001800u;
+  dst[1242] = (dst[1242] & 0xE00FE00Fu) | 0x08E00700u;
+  dst[1243] = (dst[1243] & 0xE00FE00Fu) | 0x0FE00700u;
+  dst[1244] = (dst[1244] & 0x003F003Fu) | 0x43803C00u;
+  dst[1245] = (dst[1245] & 0x003F003Fu) | 0x7F803C00u;
+  dst[1282] = (dst[1282] & 0xC00FC00Fu) | 0x18E00700u;
+  dst[1283] = (dst[1283] & 0xC00FC00Fu) | 0x1FE00700u;
+  dst[1284] = (dst[1284] & 0x001F001Fu) | 0x43C03C00u;
+  dst[1285] = (dst[1285] & 0x001F001Fu) | 0x7FC03C00u;
+  dst[1322] = (dst[1322] & 0x80078007u) | 0x1CF00300u;
+  dst[1323] = (dst[1323] & 0x80078007u) | 0x1FF00300u;
+  dst[1324] = (dst[1324] & 0x000F000Fu) | 0x43E03C00u;
+  dst[1325] = (dst[1325] & 0x000F000Fu) | 0x7FE03C00u;
+  dst[1360] &= 0xFFFEFFFEu;
+  dst[1361] &= 0xFFFEFFFEu;
+  dst[1362] = (dst[1362] & 0x00070007u) | 0x7FF00000u;
+  dst[1363] = (dst[1363] & 0x00070007u) | 0x7FF00000u;
+  dst[1364] = (dst[1364] & 0x80038003u) | 0x27F01800u;
+  dst[1365] = (dst[1365] & 0x80038003u) | 0x3FF01800u;
+  dst[1400] = (dst[1400] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1401] = (dst[1401] & 0xFFF8FFF8u) | 0x00010000u;
+  dst[1402] = (dst[1402] & 0x00070007u) | 0xC3F03C00u;
+  dst[1403] = (dst[1403] & 0x00070007u) | 0xFFF03C00u;
+  dst[1404] = (dst[1404] & 0x80008000u) | 0x3FFC0000u;
+  dst[1405] = (dst[1405] & 0x80008000u) | 0x3FFC0000u;
+  dst[1440] = (dst[1440] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1441] = (dst[1441] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1442] = (dst[1442] & 0x00070007u) | 0x07F0F800u;
+  dst[1443] = (dst[1443] & 0x00070007u) | 0xFFF0F800u;
+  dst[1444] = (dst[1444] & 0x80008000u) | 0x3F0F00F0u;
+  dst[1445] = (dst[1445] & 0x80008000u) | 0x3FFF00F0u;
+  dst[1446] &= 0x3FFF3FFFu;
+  dst[1447] &= 0x3FFF3FFFu;
+  dst[1480] = (dst[1480] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1481] = (dst[1481] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1482] = (dst[1482] & 0x00070007u) | 0xFFF00000u;
+  dst[1483] = (dst[1483] & 0x00070007u) | 0xFFF00000u;
+  dst[1484] = (dst[1484] & 0xC000C000u) | 0x1E0701F8u;
+  dst[1485] = (dst[1485] & 0xC000C000u) | 0x1FFF01F8u;
+  dst[1486] = (dst[1486] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1487] = (dst[1487] & 0x1FFF1FFFu) | 0xC0000000u;
+  dst[1520] = (dst[1520] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1521] = (dst[1521] & 0xFFE0FFE0u) | 0x000F0000u;
+  dst[1522] = (dst[1522] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1523] = (dst[1523] & 0x000F000Fu) | 0xFFE00000u;
+  dst[1524] = (dst[1524] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1525] = (dst[1525] & 0xC000C000u) | 0x1FFF0000u;
+  dst[1526] = (dst[1526] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1527] = (dst[1527] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1560] &= 0xFFF0FFF0u;
+  dst[1561] &= 0xFFF0FFF0u;
+  dst[1562] &= 0x001F001Fu;
+  dst[1563] &= 0x001F001Fu;
+  dst[1564] &= 0xC000C000u;
+  dst[1565] &= 0xC000C000u;
+  dst[1566] &= 0x0FFF0FFFu;
+  dst[1567] &= 0x0FFF0FFFu;
+}
+
+static void img_loserboy_f21_s12(uint32_t *dst) {
+  dst[42] &= 0xFF01FF01u;
+  dst[43] &= 0xFF01FF01u;
+  dst[82] = (dst[82] & 0xFC00FC00u) | 0x00FE0000u;
+  dst[83] = (dst[83] & 0xFC00FC00u) | 0x00FE0000u;
+  dst[84] &= 0x3FFF3FFFu;
+  dst[85] &= 0x3FFF3FFFu;
+  dst[122] = (dst[122] & 0xF800F800u) | 0x03FF0000u;
+  dst[123] = (dst[123] & 0xF800F800u) | 0x03FF0000u;
+  dst[124] = (dst[124] & 0x0FFF0FFFu) | 0x80000000u;
+  dst[125] = (dst[125] & 0x0FFF0FFFu) | 0x80000000u;
+  dst[162] = (dst[162] & 0xF000F000u) | 0x07FF0000u;
+  dst[163] = (dst[163] & 0xF000F000u) | 0x07FF0000u;
+  dst[164] = (dst[164] & 0x07FF07FFu) | 0xF0000000u;
+  dst[165] = (dst[165] & 0x07FF07FFu) | 0xF0000000u;
+  dst[202] = (dst[202] & 0xE000E000u) | 0x0FFF0000u;
+  dst[203] = (dst[203] & 0xE000E000u) | 0x0FFF0000u;
+  dst[204] = (dst[204] & 0x03FF03FFu) | 0xF8000000u;
+  dst[205] = (dst[205] & 0x03FF03FFu) | 0xF8000000u;
+  dst[242] = (dst[242] & 0xE000E000u) | 0x0FFF0000u;
+  dst[243] = (dst[243] & 0xE000E000u) | 0x0FFF0000u;
+  dst[244] = (dst[244] & 0x03FF03FFu) | 0xF8000000u;
+  dst[245] = (dst[245] & 0x03FF03FFu) | 0xF8000000u;
+  dst[282] = (dst[282] & 0xE000E000u) | 0x0FC70000u;
+  dst[283] = (dst[283] & 0xE000E000u) | 0x0FC70000u;
+  dst[284] = (dst[284] & 0x03FF03FFu) | 0x18000000u;
+  dst[285] = (dst[285] & 0x03FF03FFu) | 0x18000000u;
+  dst[322] = (dst[322] & 0xE000E000u) | 0x0B990010u;
+  dst[323] = (dst[323] & 0xE000E000u) | 0x0B990018u;
+  dst[324] = (dst[324] & 0x03FF03FFu) | 0x68000000u;
+  dst[325] = (dst[325] & 0x03FF03FFu) | 0x68006000u;
+  dst[362] = (dst[362] & 0xF000F000u) | 0x051E0058u;
+  dst[363] = (dst[363] & 0xF000F000u) | 0x055C005Eu;
+  dst[364] = (dst[364] & 0x03FF03FFu) | 0x70000000u;
+  dst[365] = (dst[365] & 0x03FF03FFu) | 0x70007000u;
+  dst[402] = (dst[402] & 0xF000F000u) | 0x049F0058u;
+  dst[403] = (dst[403] & 0xF000F000u) | 0x04DF00DFu;
+  dst[404] = (dst[404] & 0x07FF07FFu) | 0xF0000000u;
+  dst[405] = (dst[405] & 0x07FF07FFu) | 0xF000F000u;
+  dst[442] = (dst[442] & 0xF000F000u) | 0x0DBF0358u;
+  dst[443] = (dst[443] & 0xF000F000u) | 0x07FF0BDFu;
+  dst[444] = (dst[444] & 0x07FF07FFu) | 0xF0000000u;
+  dst[445] = (dst[445] & 0x07FF07FFu) | 0xF000F000u;
+  dst[482] = (dst[482] & 0xF000F000u) | 0x0FFF0670u;
+  dst[483] = (dst[483] & 0xF000F000u) | 0x07FF0FFFu;
+  dst[484] = (dst[484] & 0x07FF07FFu) | 0xE0000000u;
+  dst[485] = (dst[485] & 0x07FF07FFu) | 0xE000E000u;
+  dst[522] = (dst[522] & 0xF000F000u) | 0x0FFF0000u;
+  dst[523] = (dst[523] & 0xF000F000u) | 0x07CF0FFFu;
+  dst[524] = (dst[524] & 0x03FF03FFu) | 0x80000000u;
+  dst[525] = (dst[525] & 0x03FF03FFu) | 0x80008000u;
+  dst[562] = (dst[562] & 0xF800F800u) | 0x07FF0000u;
+  dst[563] = (dst[563] & 0xF800F800u) | 0x03BE07FFu;
+  dst[564] = (dst[564] & 0x01FF01FFu) | 0x00002000u;
+  dst[565] = (dst[565] & 0x01FF01FFu) | 0x6C000000u;
+  dst[602] = (dst[602] & 0xFC00FC00u) | 0x03FE0000u;
+  dst[603] = (dst[603] & 0xFC00FC00u) | 0x00F803FEu;
+  dst[604] = (dst[604] & 0x00FF00FFu) | 0x0000C800u;
+  dst[605] = (dst[605] & 0x00FF00FFu) | 0xDE000000u;
+  dst[642] = (dst[642] & 0xFF00FF00u) | 0x000C0000u;
+  dst[643] = (dst[643] & 0xFF00FF00u) | 0x0001000Cu;
+  dst[644] = (dst[644] & 0x007F007Fu) | 0x00004C00u;
+  dst[645] = (dst[645] & 0x007F007Fu) | 0xDE000000u;
+  dst[682] = (dst[682] & 0xFF00FF00u) | 0x001C0040u;
+  dst[683] = (dst[683] & 0xFF00FF00u) | 0x0040001Cu;
+  dst[684] = (dst[684] & 0x003F003Fu) | 0x00001900u;
+  dst[685] = (dst[685] & 0x003F003Fu) | 0x19000000u;
+  dst[722] = (dst[722] & 0x8F008F00u) | 0x00000042u;
+  dst[723] = (dst[723] & 0x8F008F00u) | 0x00420002u;
+  dst[724] = (dst[724] & 0x001F001Fu) | 0x030004C0u;
+  dst[725] = (dst[725] & 0x001F001Fu) | 0xD7C00000u;
+  dst[762] = 0x7000005Eu;
+  dst[763] = 0x705E701Eu;
+  dst[764] = (dst[764] & 0x001F001Fu) | 0x07800840u;
+  dst[765] = (dst[765] & 0x001F001Fu) | 0xCFC00000u;
+  dst[800] &= 0xFFFEFFFEu;
+  dst[801] &= 0xFFFEFFFEu;
+  dst[802] = 0xFA0000DEu;
+  dst[803] = 0xFADEFA1Eu;
+  dst[804] = (dst[804] & 0x001F001Fu) | 0x0F000080u;
+  dst[805] = (dst[805] & 0x001F001Fu) | 0xEF800000u;
+  dst[840] &= 0xFFFEFFFEu;
+  dst[841] &= 0xFFFEFFFEu;
+  dst[842] = 0xFA0000DFu;
+  dst[843] = 0xFADFFA1Fu;
+  dst[844] = (dst[844] & 0x000F000Fu) | 0x04600A00u;
+  dst[845] = (dst[845] & 0x000F000Fu) | 0x6E600060u;
+  dst[880] &= 0xFFFEFFFEu;
+  dst[881] &= 0xFFFEFFFEu;
+  dst[882] = 0xF60000DFu;
+  dst[883] = 0xF6DFF61Fu;
+  dst[884] = (dst[884] & 0x000F000Fu) | 0x01E00C00u;
+  dst[885] = (dst[885] & 0x000F000Fu) | 0x6DE001E0u;
+  dst[920] &= 0xFFFEFFFEu;
+  dst[921] &= 0xFFFEFFFEu;
+  dst[922] = 0xF00000DFu;
+  dst[923] = 0xF0DFF01Fu;
+  dst[924] = (dst[924] & 0x02070207u) | 0x00F00000u;
+  dst[925] = (dst[925] & 0x02070207u) | 0x70F000F0u;
+  dst[962] = (dst[962] & 0x0C000C00u) | 0x000000BFu;
+  dst[963] = (dst[963] & 0x0C000C00u) | 0x01BF003Fu;
+  dst[964] = (dst[964] & 0x07070707u) | 0x00700000u;
+  dst[965] = (dst[965] & 0x07070707u) | 0x70700070u;
+  dst[1002] = (dst[1002] & 0xFC00FC00u) | 0x000000BFu;
+  dst[1003] = (dst[1003] & 0xFC00FC00u) | 0x01BF003Fu;
+  dst[1004] = (dst[1004] & 0x02030203u) | 0x00F88000u;
+  dst[1005] = (dst[1005] & 0x02030203u) | 0xB8F880F8u;
+  dst[1042] = (dst[1042] & 0xFC00FC00u) | 0x000000BFu;
+  dst[1043] = (dst[1043] & 0xFC00FC00u) | 0x01BF003Fu;
+  dst[1044] = (dst[1044] & 0x00030003u) | 0x00F88000u;
+  dst[1045] = (dst[1045] & 0x00030003u) | 0xBCF880F8u;
+  dst[1082] = (dst[1082] & 0xF800F800u) | 0x0000003Fu;
+  dst[1083] = (dst[1083] & 0xF800F800u) | 0x03BF003Fu;
+  dst[1084] = (dst[1084] & 0x00030003u) | 0x01F8C000u;
+  dst[1085] = (dst[1085] & 0x00030003u) | 0xDDF8C1F8u;
+  dst[1122] = (dst[1122] & 0xF800F800u) | 0x0000007Fu;
+  dst[1123] = (dst[1123] & 0xF800F800u) | 0x007F007Fu;
+  dst[1124] = (dst[1124] & 0x00070007u) | 0x00F0E000u;
+  dst[1125] = (dst[1125] & 0x00070007u) | 0xE0F0E0F0u;
+  dst[1162] = (dst[1162] & 0xF800F800u) | 0x0380001Fu;
+  dst[1163] = (dst[1163] & 0xF800F800u) | 0x039F001Fu;
+  dst[1164] = (dst[1164] & 0x000F000Fu) | 0x0F00C000u;
+  dst[1165] = (dst[1165] & 0x000F000Fu) | 0xCF00C000u;
+  dst[1202] = (dst[1202] & 0xF000F000u) | 0x06E00100u;
+  dst[1203] = (dst[1203] & 0xF000F000u) | 0x07E00100u;
+  dst[1204] = (dst[1204] & 0x003F003Fu) | 0x33800C00u;
+  dst[1205] = (dst[1205] & 0x003F003Fu) | 0x3F800C00u;
+  dst[1242] = (dst[1242] & 0xF007F007u) | 0x04700380u;
+  dst[1243] = (dst[1243] & 0xF007F007u) | 0x07F00380u;
+  dst[1244] = (dst[1244] & 0x801F801Fu) | 0x21C01E00u;
+  dst[1245] = (dst[1245] & 0x801F801Fu) | 0x3FC01E00u;
+  dst[1282] = (dst[1282] & 0xE007E007u) | 0x0C700380u;
+  dst[1283] = (dst[1283] & 0xE007E007u) | 0x0FF00380u;
+  dst[1284] = (dst[1284] & 0x800F800Fu) | 0x21E01E00u;
+  dst[1285] = (dst[1285] & 0x800F800Fu) | 0x3FE01E00u;
+  dst[1322] = (dst[1322] & 0xC003C003u) | 0x0E780180u;
+  dst[1323] = (dst[1323] & 0xC003C003u) | 0x0FF80180u;
+  dst[1324] = (dst[1324] & 0x80078007u) | 0x21F01E00u;
+  dst[1325] = (dst[1325] & 0x80078007u) | 0x3FF01E00u;
+  dst[1362] = (dst[1362] & 0x00030003u) | 0x3FF80000u;
+  dst[1363] = (dst[1363] & 0x00030003u) | 0x3FF80000u;
+  dst[1364] = (dst[1364] & 0xC001C001u) | 0x13F80C00u;
+  dst[1365] = (dst[1365] & 0xC001C001u) | 0x1FF80C00u;
+  dst[1400] &= 0xFFFCFFFCu;
+  dst[1401] &= 0xFFFCFFFCu;
+  dst[1402] = (dst[1402] & 0x00030003u) | 0xE1F81E00u;
+  dst[1403] = (dst[1403] & 0x00030003u) | 0xFFF81E00u;
+  dst[1404] = (dst[1404] & 0xC000C000u) | 0x1FFE0000u;
+  dst[1405] = (dst[1405] & 0xC000C000u) | 0x1FFE0000u;
+  dst[1406] &= 0x7FFF7FFFu;
+  dst[1407] &= 0x7FFF7FFFu;
+  dst[1440] = (dst[1440] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1441] = (dst[1441] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1442] = (dst[1442] & 0x00030003u) | 0x83F87C00u;
+  dst[1443] = (dst[1443] & 0x00030003u) | 0xFFF87C00u;
+  dst[1444] = (dst[1444] & 0xC000C000u) | 0x1F870078u;
+  dst[1445] = (dst[1445] & 0xC000C000u) | 0x1FFF0078u;
+  dst[1446] = (dst[1446] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1447] = (dst[1447] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1480] = (dst[1480] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1481] = (dst[1481] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1482] = (dst[1482] & 0x00030003u) | 0xFFF80000u;
+  dst[1483] = (dst[1483] & 0x00030003u) | 0xFFF80000u;
+  dst[1484] = (dst[1484] & 0xE000E000u) | 0x0F0300FCu;
+  dst[1485] = (dst[1485] & 0xE000E000u) | 0x0FFF00FCu;
+  dst[1486] = (dst[1486] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1487] = (dst[1487] & 0x0FFF0FFFu) | 0xE0000000u;
+  dst[1520] = (dst[1520] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1521] = (dst[1521] & 0xFFF0FFF0u) | 0x00070000u;
+  dst[1522] = (dst[1522] & 0x00070007u) | 0xFFF00000u;
+  dst[1523] = (dst[1523] & 0x00070007u) | 0xFFF00000u;
+  dst[1524] = (dst[1524] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1525] = (dst[1525] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1526] = (dst[1526] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1527] = (dst[1527] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1560] &= 0xFFF8FFF8u;
+  dst[1561] &= 0xFFF8FFF8u;
+  dst[1562] &= 0x000F000Fu;
+  dst[1563] &= 0x000F000Fu;
+  dst[1564] &= 0xE000E000u;
+  dst[1565] &= 0xE000E000u;
+  dst[1566] &= 0x07FF07FFu;
+  dst[1567] &= 0x07FF07FFu;
+}
+
+static void img_loserboy_f21_s13(uint32_t *dst) {
+  dst[42] &= 0xFF80FF80u;
+  dst[43] &= 0xFF80FF80u;
+  dst[82] = (dst[82] & 0xFE00FE00u) | 0x007F0000u;
+  dst[83] = (dst[83] & 0xFE00FE00u) | 0x007F0000u;
+  dst[84] &= 0x1FFF1FFFu;
+  dst[85] &= 0x1FFF1FFFu;
+  dst[122] = (dst[122] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[123] = (dst[123] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[124] = (dst[124] & 0x07FF07FFu) | 0xC0000000u;
+  dst[125] = (dst[125] & 0x07FF07FFu) | 0xC0000000u;
+  dst[162] = (dst[162] & 0xF800F800u) | 0x03FF0000u;
+  dst[163] = (dst[163] & 0xF800F800u) | 0x03FF0000u;
+  dst[164] = (dst[164] & 0x03FF03FFu) | 0xF8000000u;
+  dst[165] = (dst[165] & 0x03FF03FFu) | 0xF8000000u;
+  dst[202] = (dst[202] & 0xF000F000u) | 0x07FF0000u;
+  dst[203] = (dst[203] & 0xF000F000u) | 0x07FF0000u;
+  dst[204] = (dst[204] & 0x01FF01FFu) | 0xFC000000u;
+  dst[205] = (dst[205] & 0x01FF01FFu) | 0xFC000000u;
+  dst[242] = (dst[242] & 0xF000F000u) | 0x07FF0000u;
+  dst[243] = (dst[243] & 0xF000F000u) | 0x07FF0000u;
+  dst[244] = (dst[244] & 0x01FF01FFu) | 0xFC000000u;
+  dst[245] = (dst[245] & 0x01FF01FFu) | 0xFC000000u;
+  dst[282] = (dst[282] & 0xF000F000u) | 0x07E30000u;
+  dst[283] = (dst[283] & 0xF000F000u) | 0x07E30000u;
+  dst[284] = (dst[284] & 0x01FF01FFu) | 0x8C000000u;
+  dst[285] = (dst[285] & 0x01FF01FFu) | 0x8C000000u;
+  dst[322] = (dst[322] & 0xF000F000u) | 0x05CC0008u;
+  dst[323] = (dst[323] & 0xF000F000u) | 0x05CC000Cu;
+  dst[324] = (dst[324] & 0x01FF01FFu) | 0xB4000000u;
+  dst[325] = (dst[325] & 0x01FF01FFu) | 0xB4003000u;
+  dst[362] = (dst[362] & 0xF800F800u) | 0x028F002Cu;
+  dst[363] = (dst[363] & 0xF800F800u) | 0x02AE002Fu;
+  dst[364] = (dst[364] & 0x01FF01FFu) | 0x38000000u;
+  dst[365] = (dst[365] & 0x01FF01FFu) | 0x38003800u;
+  dst[402] = (dst[402] & 0xF800F800u) | 0x024F002Cu;
+  dst[403] = (dst[403] & 0xF800F800u) | 0x026F006Fu;
+  dst[404] = (dst[404] & 0x03FF03FFu) | 0xF8000000u;
+  dst[405] = (dst[405] & 0x03FF03FFu) | 0xF800F800u;
+  dst[442] = (dst[442] & 0xF800F800u) | 0x06DF01ACu;
+  dst[443] = (dst[443] & 0xF800F800u) | 0x03FF05EFu;
+  dst[444] = (dst[444] & 0x03FF03FFu) | 0xF8000000u;
+  dst[445] = (dst[445] & 0x03FF03FFu) | 0xF800F800u;
+  dst[482] = (dst[482] & 0xF800F800u) | 0x07FF0338u;
+  dst[483] = (dst[483] & 0xF800F800u) | 0x03FF07FFu;
+  dst[484] = (dst[484] & 0x03FF03FFu) | 0xF0000000u;
+  dst[485] = (dst[485] & 0x03FF03FFu) | 0xF000F000u;
+  dst[522] = (dst[522] & 0xF800F800u) | 0x07FF0000u;
+  dst[523] = (dst[523] & 0xF800F800u) | 0x03E707FFu;
+  dst[524] = (dst[524] & 0x01FF01FFu) | 0xC0000000u;
+  dst[525] = (dst[525] & 0x01FF01FFu) | 0xC000C000u;
+  dst[562] = (dst[562] & 0xFC00FC00u) | 0x03FF0000u;
+  dst[563] = (dst[563] & 0xFC00FC00u) | 0x01DF03FFu;
+  dst[564] = (dst[564] & 0x00FF00FFu) | 0x80001000u;
+  dst[565] = (dst[565] & 0x00FF00FFu) | 0x36008000u;
+  dst[602] = (dst[602] & 0xFE00FE00u) | 0x01FF0000u;
+  dst[603] = (dst[603] & 0xFE00FE00u) | 0x007C01FFu;
+  dst[604] = (dst[604] & 0x007F007Fu) | 0x00006400u;
+  dst[605] = (dst[605] & 0x007F007Fu) | 0x6F000000u;
+  dst[642] = (dst[642] & 0xFF80FF80u) | 0x00060000u;
+  dst[643] = (dst[643] & 0xFF80FF80u) | 0x00000006u;
+  dst[644] = (dst[644] & 0x003F003Fu) | 0x00002600u;
+  dst[645] = (dst[645] & 0x003F003Fu) | 0xEF000000u;
+  dst[682] = (dst[682] & 0xFF80FF80u) | 0x000E0020u;
+  dst[683] = (dst[683] & 0xFF80FF80u) | 0x0020000Eu;
+  dst[684] = (dst[684] & 0x001F001Fu) | 0x00000C80u;
+  dst[685] = (dst[685] & 0x001F001Fu) | 0x0C800000u;
+  dst[722] = (dst[722] & 0xC780C780u) | 0x00000021u;
+  dst[723] = (dst[723] & 0xC780C780u) | 0x00210001u;
+  dst[724] = (dst[724] & 0x000F000Fu) | 0x01800260u;
+  dst[725] = (dst[725] & 0x000F000Fu) | 0x6BE00000u;
+  dst[762] = (dst[762] & 0x80008000u) | 0x3800002Fu;
+  dst[763] = (dst[763] & 0x80008000u) | 0x382F380Fu;
+  dst[764] = (dst[764] & 0x000F000Fu) | 0x03C00420u;
+  dst[765] = (dst[765] & 0x000F000Fu) | 0x67E00000u;
+  dst[802] = 0x7D00006Fu;
+  dst[803] = 0x7D6F7D0Fu;
+  dst[804] = (dst[804] & 0x000F000Fu) | 0x07800040u;
+  dst[805] = (dst[805] & 0x000F000Fu) | 0x77C00000u;
+  dst[842] = 0x7D00006Fu;
+  dst[843] = 0x7D6F7D0Fu;
+  dst[844] = (dst[844] & 0x00070007u) | 0x02308500u;
+  dst[845] = (dst[845] & 0x00070007u) | 0xB7308030u;
+  dst[882] = 0x7B00006Fu;
+  dst[883] = 0x7B6F7B0Fu;
+  dst[884] = (dst[884] & 0x00070007u) | 0x00F08600u;
+  dst[885] = (dst[885] & 0x00070007u) | 0xB6F080F0u;
+  dst[922] = 0x7800006Fu;
+  dst[923] = 0x786F780Fu;
+  dst[924] = (dst[924] & 0x01030103u) | 0x00788000u;
+  dst[925] = (dst[925] & 0x01030103u) | 0xB8788078u;
+  dst[962] = (dst[962] & 0x86008600u) | 0x0000005Fu;
+  dst[963] = (dst[963] & 0x86008600u) | 0x00DF001Fu;
+  dst[964] = (dst[964] & 0x03830383u) | 0x00388000u;
+  dst[965] = (dst[965] & 0x03830383u) | 0xB8388038u;
+  dst[1002] = (dst[1002] & 0xFE00FE00u) | 0x0000005Fu;
+  dst[1003] = (dst[1003] & 0xFE00FE00u) | 0x00DF001Fu;
+  dst[1004] = (dst[1004] & 0x01010101u) | 0x007CC000u;
+  dst[1005] = (dst[1005] & 0x01010101u) | 0xDC7CC07Cu;
+  dst[1042] = (dst[1042] & 0xFE00FE00u) | 0x0000005Fu;
+  dst[1043] = (dst[1043] & 0xFE00FE00u) | 0x00DF001Fu;
+  dst[1044] = (dst[1044] & 0x00010001u) | 0x007CC000u;
+  dst[1045] = (dst[1045] & 0x00010001u) | 0xDE7CC07Cu;
+  dst[1082] = (dst[1082] & 0xFC00FC00u) | 0x0000001Fu;
+  dst[1083] = (dst[1083] & 0xFC00FC00u) | 0x01DF001Fu;
+  dst[1084] = (dst[1084] & 0x00010001u) | 0x00FCE000u;
+  dst[1085] = (dst[1085] & 0x00010001u) | 0xEEFCE0FCu;
+  dst[1122] = (dst[1122] & 0xFC00FC00u) | 0x0000003Fu;
+  dst[1123] = (dst[1123] & 0xFC00FC00u) | 0x003F003Fu;
+  dst[1124] = (dst[1124] & 0x00030003u) | 0x0078F000u;
+  dst[1125] = (dst[1125] & 0x00030003u) | 0xF078F078u;
+  dst[1162] = (dst[1162] & 0xFC00FC00u) | 0x01C0000Fu;
+  dst[1163] = (dst[1163] & 0xFC00FC00u) | 0x01CF000Fu;
+  dst[1164] = (dst[1164] & 0x00070007u) | 0x0780E000u;
+  dst[1165] = (dst[1165] & 0x00070007u) | 0xE780E000u;
+  dst[1202] = (dst[1202] & 0xF800F800u) | 0x03700080u;
+  dst[1203] = (dst[1203] & 0xF800F800u) | 0x03F00080u;
+  dst[1204] = (dst[1204] & 0x001F001Fu) | 0x19C00600u;
+  dst[1205] = (dst[1205] & 0x001F001Fu) | 0x1FC00600u;
+  dst[1242] = (dst[1242] & 0xF803F803u) | 0x023801C0u;
+  dst[1243] = (dst[1243] & 0xF803F803u) | 0x03F801C0u;
+  dst[1244] = (dst[1244] & 0xC00FC00Fu) | 0x10E00F00u;
+  dst[1245] = (dst[1245] & 0xC00FC00Fu) | 0x1FE00F00u;
+  dst[1282] = (dst[1282] & 0xF003F003u) | 0x063801C0u;
+  dst[1283] = (dst[1283] & 0xF003F003u) | 0x07F801C0u;
+  dst[1284] = (dst[1284] & 0xC007C007u) | 0x10F00F00u;
+  dst[1285] = (dst[1285] & 0xC007C007u) | 0x1FF00F00u;
+  dst[1322] = (dst[1322] & 0xE001E001u) | 0x073C00C0u;
+  dst[1323] = (dst[1323] & 0xE001E001u) | 0x07FC00C0u;
+  dst[1324] = (dst[1324] & 0xC003C003u) | 0x10F80F00u;
+  dst[1325] = (dst[1325] & 0xC003C003u) | 0x1FF80F00u;
+  dst[1362] = (dst[1362] & 0x80018001u) | 0x1FFC0000u;
+  dst[1363] = (dst[1363] & 0x80018001u) | 0x1FFC0000u;
+  dst[1364] = (dst[1364] & 0xE000E000u) | 0x09FC0600u;
+  dst[1365] = (dst[1365] & 0xE000E000u) | 0x0FFC0600u;
+  dst[1400] &= 0xFFFEFFFEu;
+  dst[1401] &= 0xFFFEFFFEu;
+  dst[1402] = (dst[1402] & 0x00010001u) | 0x70FC0F00u;
+  dst[1403] = (dst[1403] & 0x00010001u) | 0x7FFC0F00u;
+  dst[1404] = (dst[1404] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1405] = (dst[1405] & 0xE000E000u) | 0x0FFF0000u;
+  dst[1406] &= 0x3FFF3FFFu;
+  dst[1407] &= 0x3FFF3FFFu;
+  dst[1440] = (dst[1440] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1441] = (dst[1441] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1442] = (dst[1442] & 0x00010001u) | 0xC1FC3E00u;
+  dst[1443] = (dst[1443] & 0x00010001u) | 0xFFFC3E00u;
+  dst[1444] = (dst[1444] & 0xE000E000u) | 0x0FC3003Cu;
+  dst[1445] = (dst[1445] & 0xE000E000u) | 0x0FFF003Cu;
+  dst[1446] = (dst[1446] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1447] = (dst[1447] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1480] = (dst[1480] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1481] = (dst[1481] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1482] = (dst[1482] & 0x00010001u) | 0xFFFC0000u;
+  dst[1483] = (dst[1483] & 0x00010001u) | 0xFFFC0000u;
+  dst[1484] = (dst[1484] & 0xF000F000u) | 0x0781007Eu;
+  dst[1485] = (dst[1485] & 0xF000F000u) | 0x07FF007Eu;
+  dst[1486] = (dst[1486] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1487] = (dst[1487] & 0x07FF07FFu) | 0xF0000000u;
+  dst[1520] = (dst[1520] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1521] = (dst[1521] & 0xFFF8FFF8u) | 0x00030000u;
+  dst[1522] = (dst[1522] & 0x00030003u) | 0xFFF80000u;
+  dst[1523] = (dst[1523] & 0x00030003u) | 0xFFF80000u;
+  dst[1524] = (dst[1524] & 0xF000F000u) | 0x07FF0000u;
+  dst[1525] = (dst[1525] & 0xF000F000u) | 0x07FF0000u;
+  dst[1526] = (dst[1526] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1527] = (dst[1527] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1560] &= 0xFFFCFFFCu;
+  dst[1561] &= 0xFFFCFFFCu;
+  dst[1562] &= 0x00070007u;
+  dst[1563] &= 0x00070007u;
+  dst[1564] &= 0xF000F000u;
+  dst[1565] &= 0xF000F000u;
+  dst[1566] &= 0x03FF03FFu;
+  dst[1567] &= 0x03FF03FFu;
+}
+
+static void img_loserboy_f21_s14(uint32_t *dst) {
+  dst[42] &= 0xFFC0FFC0u;
+  dst[43] &= 0xFFC0FFC0u;
+  dst[44] &= 0x7FFF7FFFu;
+  dst[45] &= 0x7FFF7FFFu;
+  dst[82] = (dst[82] & 0xFF00FF00u) | 0x003F0000u;
+  dst[83] = (dst[83] & 0xFF00FF00u) | 0x003F0000u;
+  dst[84] = (dst[84] & 0x0FFF0FFFu) | 0x80000000u;
+  dst[85] = (dst[85] & 0x0FFF0FFFu) | 0x80000000u;
+  dst[122] = (dst[122] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[123] = (dst[123] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[124] = (dst[124] & 0x03FF03FFu) | 0xE0000000u;
+  dst[125] = (dst[125] & 0x03FF03FFu) | 0xE0000000u;
+  dst[162] = (dst[162] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[163] = (dst[163] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[164] = (dst[164] & 0x01FF01FFu) | 0xFC000000u;
+  dst[165] = (dst[165] & 0x01FF01FFu) | 0xFC000000u;
+  dst[202] = (dst[202] & 0xF800F800u) | 0x03FF0000u;
+  dst[203] = (dst[203] & 0xF800F800u) | 0x03FF0000u;
+  dst[204] = (dst[204] & 0x00FF00FFu) | 0xFE000000u;
+  dst[205] = (dst[205] & 0x00FF00FFu) | 0xFE000000u;
+  dst[242] = (dst[242] & 0xF800F800u) | 0x03FF0000u;
+  dst[243] = (dst[243] & 0xF800F800u) | 0x03FF0000u;
+  dst[244] = (dst[244] & 0x00FF00FFu) | 0xFE000000u;
+  dst[245] = (dst[245] & 0x00FF00FFu) | 0xFE000000u;
+  dst[282] = (dst[282] & 0xF800F800u) | 0x03F10000u;
+  dst[283] = (dst[283] & 0xF800F800u) | 0x03F10000u;
+  dst[284] = (dst[284] & 0x00FF00FFu) | 0xC6000000u;
+  dst[285] = (dst[285] & 0x00FF00FFu) | 0xC6000000u;
+  dst[322] = (dst[322] & 0xF800F800u) | 0x02E60004u;
+  dst[323] = (dst[323] & 0xF800F800u) | 0x02E60006u;
+  dst[324] = (dst[324] & 0x00FF00FFu) | 0x5A000000u;
+  dst[325] = (dst[325] & 0x00FF00FFu) | 0x5A001800u;
+  dst[362] = (dst[362] & 0xFC00FC00u) | 0x01470016u;
+  dst[363] = (dst[363] & 0xFC00FC00u) | 0x01570017u;
+  dst[364] = (dst[364] & 0x00FF00FFu) | 0x9C000000u;
+  dst[365] = (dst[365] & 0x00FF00FFu) | 0x1C009C00u;
+  dst[402] = (dst[402] & 0xFC00FC00u) | 0x01270016u;
+  dst[403] = (dst[403] & 0xFC00FC00u) | 0x01370037u;
+  dst[404] = (dst[404] & 0x01FF01FFu) | 0xFC000000u;
+  dst[405] = (dst[405] & 0x01FF01FFu) | 0xFC00FC00u;
+  dst[442] = (dst[442] & 0xFC00FC00u) | 0x036F00D6u;
+  dst[443] = (dst[443] & 0xFC00FC00u) | 0x01FF02F7u;
+  dst[444] = (dst[444] & 0x01FF01FFu) | 0xFC000000u;
+  dst[445] = (dst[445] & 0x01FF01FFu) | 0xFC00FC00u;
+  dst[482] = (dst[482] & 0xFC00FC00u) | 0x03FF019Cu;
+  dst[483] = (dst[483] & 0xFC00FC00u) | 0x01FF03FFu;
+  dst[484] = (dst[484] & 0x01FF01FFu) | 0xF8000000u;
+  dst[485] = (dst[485] & 0x01FF01FFu) | 0xF800F800u;
+  dst[522] = (dst[522] & 0xFC00FC00u) | 0x03FF0000u;
+  dst[523] = (dst[523] & 0xFC00FC00u) | 0x01F303FFu;
+  dst[524] = (dst[524] & 0x00FF00FFu) | 0xE0000000u;
+  dst[525] = (dst[525] & 0x00FF00FFu) | 0xE000E000u;
+  dst[562] = (dst[562] & 0xFE00FE00u) | 0x01FF0000u;
+  dst[563] = (dst[563] & 0xFE00FE00u) | 0x00EF01FFu;
+  dst[564] = (dst[564] & 0x007F007Fu) | 0xC0000800u;
+  dst[565] = (dst[565] & 0x007F007Fu) | 0x9B00C000u;
+  dst[602] = (dst[602] & 0xFF00FF00u) | 0x00FF0000u;
+  dst[603] = (dst[603] & 0xFF00FF00u) | 0x003E00FFu;
+  dst[604] = (dst[604] & 0x003F003Fu) | 0x80003200u;
+  dst[605] = (dst[605] & 0x003F003Fu) | 0x37808000u;
+  dst[642] = (dst[642] & 0xFFC0FFC0u) | 0x00030000u;
+  dst[643] = (dst[643] & 0xFFC0FFC0u) | 0x00000003u;
+  dst[644] = (dst[644] & 0x001F001Fu) | 0x00001300u;
+  dst[645] = (dst[645] & 0x001F001Fu) | 0x77800000u;
+  dst[682] = (dst[682] & 0xFFC0FFC0u) | 0x00070010u;
+  dst[683] = (dst[683] & 0xFFC0FFC0u) | 0x00100007u;
+  dst[684] = (dst[684] & 0x000F000Fu) | 0x00000640u;
+  dst[685] = (dst[685] & 0x000F000Fu) | 0x06400000u;
+  dst[722] = (dst[722] & 0xE3C0E3C0u) | 0x00000010u;
+  dst[723] = (dst[723] & 0xE3C0E3C0u) | 0x00100000u;
+  dst[724] = (dst[724] & 0x00070007u) | 0x00C08130u;
+  dst[725] = (dst[725] & 0x00070007u) | 0xB5F08000u;
+  dst[762] = (dst[762] & 0xC000C000u) | 0x1C000017u;
+  dst[763] = (dst[763] & 0xC000C000u) | 0x1C171C07u;
+  dst[764] = (dst[764] & 0x00070007u) | 0x01E08210u;
+  dst[765] = (dst[765] & 0x00070007u) | 0xB3F08000u;
+  dst[802] = (dst[802] & 0x80008000u) | 0x3E800037u;
+  dst[803] = (dst[803] & 0x80008000u) | 0x3EB73E87u;
+  dst[804] = (dst[804] & 0x00070007u) | 0x03C08020u;
+  dst[805] = (dst[805] & 0x00070007u) | 0xBBE08000u;
+  dst[842] = (dst[842] & 0x80008000u) | 0x3E800037u;
+  dst[843] = (dst[843] & 0x80008000u) | 0x3EB73E87u;
+  dst[844] = (dst[844] & 0x00030003u) | 0x0118C280u;
+  dst[845] = (dst[845] & 0x00030003u) | 0xDB98C018u;
+  dst[882] = (dst[882] & 0x80008000u) | 0x3D800037u;
+  dst[883] = (dst[883] & 0x80008000u) | 0x3DB73D87u;
+  dst[884] = (dst[884] & 0x00030003u) | 0x0078C300u;
+  dst[885] = (dst[885] & 0x00030003u) | 0xDB78C078u;
+  dst[922] = (dst[922] & 0x80008000u) | 0x3C000037u;
+  dst[923] = (dst[923] & 0x80008000u) | 0x3C373C07u;
+  dst[924] = (dst[924] & 0x00810081u) | 0x003CC000u;
+  dst[925] = (dst[925] & 0x00810081u) | 0xDC3CC03Cu;
+  dst[962] = (dst[962] & 0xC300C300u) | 0x0000002Fu;
+  dst[963] = (dst[963] & 0xC300C300u) | 0x006F000Fu;
+  dst[964] = (dst[964] & 0x01C101C1u) | 0x001CC000u;
+  dst[965] = (dst[965] & 0x01C101C1u) | 0xDC1CC01Cu;
+  dst[1002] = (dst[1002] & 0xFF00FF00u) | 0x0000002Fu;
+  dst[1003] = (dst[1003] & 0xFF00FF00u) | 0x006F000Fu;
+  dst[1004] = (dst[1004] & 0x00800080u) | 0x003EE000u;
+  dst[1005] = (dst[1005] & 0x00800080u) | 0xEE3EE03Eu;
+  dst[1042] = (dst[1042] & 0xFF00FF00u) | 0x0000002Fu;
+  dst[1043] = (dst[1043] & 0xFF00FF00u) | 0x006F000Fu;
+  dst[1044] = 0x003EE000u;
+  dst[1045] = 0xEF3EE03Eu;
+  dst[1082] = (dst[1082] & 0xFE00FE00u) | 0x0000000Fu;
+  dst[1083] = (dst[1083] & 0xFE00FE00u) | 0x00EF000Fu;
+  dst[1084] = 0x007EF000u;
+  dst[1085] = 0xF77EF07Eu;
+  dst[1122] = (dst[1122] & 0xFE00FE00u) | 0x0000001Fu;
+  dst[1123] = (dst[1123] & 0xFE00FE00u) | 0x001F001Fu;
+  dst[1124] = (dst[1124] & 0x00010001u) | 0x003CF800u;
+  dst[1125] = (dst[1125] & 0x00010001u) | 0xF83CF83Cu;
+  dst[1162] = (dst[1162] & 0xFE00FE00u) | 0x00E00007u;
+  dst[1163] = (dst[1163] & 0xFE00FE00u) | 0x00E70007u;
+  dst[1164] = (dst[1164] & 0x00030003u) | 0x03C0F000u;
+  dst[1165] = (dst[1165] & 0x00030003u) | 0xF3C0F000u;
+  dst[1202] = (dst[1202] & 0xFC00FC00u) | 0x01B80040u;
+  dst[1203] = (dst[1203] & 0xFC00FC00u) | 0x01F80040u;
+  dst[1204] = (dst[1204] & 0x000F000Fu) | 0x0CE00300u;
+  dst[1205] = (dst[1205] & 0x000F000Fu) | 0x0FE00300u;
+  dst[1242] = (dst[1242] & 0xFC01FC01u) | 0x011C00E0u;
+  dst[1243] = (dst[1243] & 0xFC01FC01u) | 0x01FC00E0u;
+  dst[1244] = (dst[1244] & 0xE007E007u) | 0x08700780u;
+  dst[1245] = (dst[1245] & 0xE007E007u) | 0x0FF00780u;
+  dst[1282] = (dst[1282] & 0xF801F801u) | 0x031C00E0u;
+  dst[1283] = (dst[1283] & 0xF801F801u) | 0x03FC00E0u;
+  dst[1284] = (dst[1284] & 0xE003E003u) | 0x08780780u;
+  dst[1285] = (dst[1285] & 0xE003E003u) | 0x0FF80780u;
+  dst[1322] = (dst[1322] & 0xF000F000u) | 0x039E0060u;
+  dst[1323] = (dst[1323] & 0xF000F000u) | 0x03FE0060u;
+  dst[1324] = (dst[1324] & 0xE001E001u) | 0x087C0780u;
+  dst[1325] = (dst[1325] & 0xE001E001u) | 0x0FFC0780u;
+  dst[1362] = (dst[1362] & 0xC000C000u) | 0x0FFE0000u;
+  dst[1363] = (dst[1363] & 0xC000C000u) | 0x0FFE0000u;
+  dst[1364] = (dst[1364] & 0xF000F000u) | 0x04FE0300u;
+  dst[1365] = (dst[1365] & 0xF000F000u) | 0x07FE0300u;
+  dst[1366] &= 0x7FFF7FFFu;
+  dst[1367] &= 0x7FFF7FFFu;
+  dst[1402] = 0x387E0780u;
+  dst[1403] = 0x3FFE0780u;
+  dst[1404] = (dst[1404] & 0xF000F000u) | 0x07FF0000u;
+  dst[1405] = (dst[1405] & 0xF000F000u) | 0x07FF0000u;
+  dst[1406] = (dst[1406] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1407] = (dst[1407] & 0x1FFF1FFFu) | 0x80000000u;
+  dst[1440] &= 0xFFFEFFFEu;
+  dst[1441] &= 0xFFFEFFFEu;
+  dst[1442] = 0xE0FE1F00u;
+  dst[1443] = 0xFFFE1F00u;
+  dst[1444] = (dst[1444] & 0xF000F000u) | 0x07E1001Eu;
+  dst[1445] = (dst[1445] & 0xF000F000u) | 0x07FF001Eu;
+  dst[1446] = (dst[1446] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1447] = (dst[1447] & 0x07FF07FFu) | 0xE0000000u;
+  dst[1480] = (dst[1480] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1481] = (dst[1481] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1482] = 0xFFFE0000u;
+  dst[1483] = 0xFFFE0000u;
+  dst[1484] = (dst[1484] & 0xF800F800u) | 0x03C0003Fu;
+  dst[1485] = (dst[1485] & 0xF800F800u) | 0x03FF003Fu;
+  dst[1486] = (dst[1486] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1487] = (dst[1487] & 0x03FF03FFu) | 0xF8000000u;
+  dst[1520] = (dst[1520] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1521] = (dst[1521] & 0xFFFCFFFCu) | 0x00010000u;
+  dst[1522] = (dst[1522] & 0x00010001u) | 0xFFFC0000u;
+  dst[1523] = (dst[1523] & 0x00010001u) | 0xFFFC0000u;
+  dst[1524] = (dst[1524] & 0xF800F800u) | 0x03FF0000u;
+  dst[1525] = (dst[1525] & 0xF800F800u) | 0x03FF0000u;
+  dst[1526] = (dst[1526] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1527] = (dst[1527] & 0x01FF01FFu) | 0xFC000000u;
+  dst[1560] &= 0xFFFEFFFEu;
+  dst[1561] &= 0xFFFEFFFEu;
+  dst[1562] &= 0x00030003u;
+  dst[1563] &= 0x00030003u;
+  dst[1564] &= 0xF800F800u;
+  dst[1565] &= 0xF800F800u;
+  dst[1566] &= 0x01FF01FFu;
+  dst[1567] &= 0x01FF01FFu;
+}
+
+static void img_loserboy_f21_s15(uint32_t *dst) {
+  dst[42] &= 0xFFE0FFE0u;
+  dst[43] &= 0xFFE0FFE0u;
+  dst[44] &= 0x3FFF3FFFu;
+  dst[45] &= 0x3FFF3FFFu;
+  dst[82] = (dst[82] & 0xFF80FF80u) | 0x001F0000u;
+  dst[83] = (dst[83] & 0xFF80FF80u) | 0x001F0000u;
+  dst[84] = (dst[84] & 0x07FF07FFu) | 0xC0000000u;
+  dst[85] = (dst[85] & 0x07FF07FFu) | 0xC0000000u;
+  dst[122] = (dst[122] & 0xFF00FF00u) | 0x007F0000u;
+  dst[123] = (dst[123] & 0xFF00FF00u) | 0x007F0000u;
+  dst[124] = (dst[124] & 0x01FF01FFu) | 0xF0000000u;
+  dst[125] = (dst[125] & 0x01FF01FFu) | 0xF0000000u;
+  dst[162] = (dst[162] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[163] = (dst[163] & 0xFE00FE00u) | 0x00FF0000u;
+  dst[164] = (dst[164] & 0x00FF00FFu) | 0xFE000000u;
+  dst[165] = (dst[165] & 0x00FF00FFu) | 0xFE000000u;
+  dst[202] = (dst[202] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[203] = (dst[203] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[204] = (dst[204] & 0x007F007Fu) | 0xFF000000u;
+  dst[205] = (dst[205] & 0x007F007Fu) | 0xFF000000u;
+  dst[242] = (dst[242] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[243] = (dst[243] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[244] = (dst[244] & 0x007F007Fu) | 0xFF000000u;
+  dst[245] = (dst[245] & 0x007F007Fu) | 0xFF000000u;
+  dst[282] = (dst[282] & 0xFC00FC00u) | 0x01F80000u;
+  dst[283] = (dst[283] & 0xFC00FC00u) | 0x01F80000u;
+  dst[284] = (dst[284] & 0x007F007Fu) | 0xE3000000u;
+  dst[285] = (dst[285] & 0x007F007Fu) | 0xE3000000u;
+  dst[322] = (dst[322] & 0xFC00FC00u) | 0x01730002u;
+  dst[323] = (dst[323] & 0xFC00FC00u) | 0x01730003u;
+  dst[324] = (dst[324] & 0x007F007Fu) | 0x2D000000u;
+  dst[325] = (dst[325] & 0x007F007Fu) | 0x2D000C00u;
+  dst[362] = (dst[362] & 0xFE00FE00u) | 0x00A3000Bu;
+  dst[363] = (dst[363] & 0xFE00FE00u) | 0x00AB000Bu;
+  dst[364] = (dst[364] & 0x007F007Fu) | 0xCE000000u;
+  dst[365] = (dst[365] & 0x007F007Fu) | 0x8E00CE00u;
+  dst[402] = (dst[402] & 0xFE00FE00u) | 0x0093000Bu;
+  dst[403] = (dst[403] & 0xFE00FE00u) | 0x009B001Bu;
+  dst[404] = (dst[404] & 0x00FF00FFu) | 0xFE000000u;
+  dst[405] = (dst[405] & 0x00FF00FFu) | 0xFE00FE00u;
+  dst[442] = (dst[442] & 0xFE00FE00u) | 0x01B7006Bu;
+  dst[443] = (dst[443] & 0xFE00FE00u) | 0x00FF017Bu;
+  dst[444] = (dst[444] & 0x00FF00FFu) | 0xFE000000u;
+  dst[445] = (dst[445] & 0x00FF00FFu) | 0xFE00FE00u;
+  dst[482] = (dst[482] & 0xFE00FE00u) | 0x01FF00CEu;
+  dst[483] = (dst[483] & 0xFE00FE00u) | 0x00FF01FFu;
+  dst[484] = (dst[484] & 0x00FF00FFu) | 0xFC000000u;
+  dst[485] = (dst[485] & 0x00FF00FFu) | 0xFC00FC00u;
+  dst[522] = (dst[522] & 0xFE00FE00u) | 0x01FF0000u;
+  dst[523] = (dst[523] & 0xFE00FE00u) | 0x00F901FFu;
+  dst[524] = (dst[524] & 0x007F007Fu) | 0xF0000000u;
+  dst[525] = (dst[525] & 0x007F007Fu) | 0xF000F000u;
+  dst[562] = (dst[562] & 0xFF00FF00u) | 0x00FF0000u;
+  dst[563] = (dst[563] & 0xFF00FF00u) | 0x007700FFu;
+  dst[564] = (dst[564] & 0x003F003Fu) | 0xE0000400u;
+  dst[565] = (dst[565] & 0x003F003Fu) | 0xCD80E000u;
+  dst[602] = (dst[602] & 0xFF80FF80u) | 0x007F0000u;
+  dst[603] = (dst[603] & 0xFF80FF80u) | 0x001F007Fu;
+  dst[604] = (dst[604] & 0x001F001Fu) | 0xC0001900u;
+  dst[605] = (dst[605] & 0x001F001Fu) | 0x1BC0C000u;
+  dst[642] = (dst[642] & 0xFFE0FFE0u) | 0x00010000u;
+  dst[643] = (dst[643] & 0xFFE0FFE0u) | 0x00000001u;
+  dst[644] = (dst[644] & 0x000F000Fu) | 0x80000980u;
+  dst[645] = (dst[645] & 0x000F000Fu) | 0x3BC08000u;
+  dst[682] = (dst[682] & 0xFFE0FFE0u) | 0x00030008u;
+  dst[683] = (dst[683] & 0xFFE0FFE0u) | 0x00080003u;
+  dst[684] = (dst[684] & 0x00070007u) | 0x80000320u;
+  dst[685] = (dst[685] & 0x00070007u) | 0x03208000u;
+  dst[722] = (dst[722] & 0xF1E0F1E0u) | 0x00000008u;
+  dst[723] = (dst[723] & 0xF1E0F1E0u) | 0x00080000u;
+  dst[724] = (dst[724] & 0x00030003u) | 0x00604098u;
+  dst[725] = (dst[725] & 0x00030003u) | 0x5AF84000u;
+  dst[762] = (dst[762] & 0xE000E000u) | 0x0E00000Bu;
+  dst[763] = (dst[763] & 0xE000E000u) | 0x0E0B0E03u;
+  dst[764] = (dst[764] & 0x00030003u) | 0x00F0C108u;
+  dst[765] = (dst[765] & 0x00030003u) | 0xD9F8C000u;
+  dst[802] = (dst[802] & 0xC000C000u) | 0x1F40001Bu;
+  dst[803] = (dst[803] & 0xC000C000u) | 0x1F5B1F43u;
+  dst[804] = (dst[804] & 0x00030003u) | 0x01E0C010u;
+  dst[805] = (dst[805] & 0x00030003u) | 0xDDF0C000u;
+  dst[842] = (dst[842] & 0xC000C000u) | 0x1F40001Bu;
+  dst[843] = (dst[843] & 0xC000C000u) | 0x1F5B1F43u;
+  dst[844] = (dst[844] & 0x00010001u) | 0x008CE140u;
+  dst[845] = (dst[845] & 0x00010001u) | 0xEDCCE00Cu;
+  dst[882] = (dst[882] & 0xC000C000u) | 0x1EC0001Bu;
+  dst[883] = (dst[883] & 0xC000C000u) | 0x1EDB1EC3u;
+  dst[884] = (dst[884] & 0x00010001u) | 0x003CE180u;
+  dst[885] = (dst[885] & 0x00010001u) | 0xEDBCE03Cu;
+  dst[922] = (dst[922] & 0xC000C000u) | 0x1E00001Bu;
+  dst[923] = (dst[923] & 0xC000C000u) | 0x1E1B1E03u;
+  dst[924] = (dst[924] & 0x00400040u) | 0x001EE000u;
+  dst[925] = (dst[925] & 0x00400040u) | 0xEE1EE01Eu;
+  dst[962] = (dst[962] & 0xE180E180u) | 0x00000017u;
+  dst[963] = (dst[963] & 0xE180E180u) | 0x00370007u;
+  dst[964] = (dst[964] & 0x00E000E0u) | 0x000EE000u;
+  dst[965] = (dst[965] & 0x00E000E0u) | 0xEE0EE00Eu;
+  dst[1002] = (dst[1002] & 0xFF80FF80u) | 0x00000017u;
+  dst[1003] = (dst[1003] & 0xFF80FF80u) | 0x00370007u;
+  dst[1004] = (dst[1004] & 0x00400040u) | 0x001FF000u;
+  dst[1005] = (dst[1005] & 0x00400040u) | 0xF71FF01Fu;
+  dst[1006] &= 0x7FFF7FFFu;
+  dst[1007] &= 0x7FFF7FFFu;
+  dst[1042] = (dst[1042] & 0xFF80FF80u) | 0x00000017u;
+  dst[1043] = (dst[1043] & 0xFF80FF80u) | 0x00370007u;
+  dst[1044] = 0x001FF000u;
+  dst[1045] = 0xF79FF01Fu;
+  dst[1046] &= 0x7FFF7FFFu;
+  dst[1047] &= 0x7FFF7FFFu;
+  dst[1082] = (dst[1082] & 0xFF00FF00u) | 0x00000007u;
+  dst[1083] = (dst[1083] & 0xFF00FF00u) | 0x00770007u;
+  dst[1084] = 0x003FF800u;
+  dst[1085] = 0xFBBFF83Fu;
+  dst[1086] &= 0x7FFF7FFFu;
+  dst[1087] &= 0x7FFF7FFFu;
+  dst[1122] = (dst[1122] & 0xFF00FF00u) | 0x0000000Fu;
+  dst[1123] = (dst[1123] & 0xFF00FF00u) | 0x000F000Fu;
+  dst[1124] = 0x001EFC00u;
+  dst[1125] = 0xFC1EFC1Eu;
+  dst[1162] = (dst[1162] & 0xFF00FF00u) | 0x00700003u;
+  dst[1163] = (dst[1163] & 0xFF00FF00u) | 0x00730003u;
+  dst[1164] = (dst[1164] & 0x00010001u) | 0x01E0F800u;
+  dst[1165] = (dst[1165] & 0x00010001u) | 0xF9E0F800u;
+  dst[1202] = (dst[1202] & 0xFE00FE00u) | 0x00DC0020u;
+  dst[1203] = (dst[1203] & 0xFE00FE00u) | 0x00FC0020u;
+  dst[1204] = (dst[1204] & 0x00070007u) | 0x06700180u;
+  dst[1205] = (dst[1205] & 0x00070007u) | 0x07F00180u;
+  dst[1242] = (dst[1242] & 0xFE00FE00u) | 0x008E0070u;
+  dst[1243] = (dst[1243] & 0xFE00FE00u) | 0x00FE0070u;
+  dst[1244] = (dst[1244] & 0xF003F003u) | 0x043803C0u;
+  dst[1245] = (dst[1245] & 0xF003F003u) | 0x07F803C0u;
+  dst[1282] = (dst[1282] & 0xFC00FC00u) | 0x018E0070u;
+  dst[1283] = (dst[1283] & 0xFC00FC00u) | 0x01FE0070u;
+  dst[1284] = (dst[1284] & 0xF001F001u) | 0x043C03C0u;
+  dst[1285] = (dst[1285] & 0xF001F001u) | 0x07FC03C0u;
+  dst[1322] = (dst[1322] & 0xF800F800u) | 0x01CF0030u;
+  dst[1323] = (dst[1323] & 0xF800F800u) | 0x01FF0030u;
+  dst[1324] = (dst[1324] & 0x70007000u) | 0x043E03C0u;
+  dst[1325] = (dst[1325] & 0x70007000u) | 0x07FE03C0u;
+  dst[1362] = (dst[1362] & 0xE000E000u) | 0x07FF0000u;
+  dst[1363] = (dst[1363] & 0xE000E000u) | 0x07FF0000u;
+  dst[1364] = (dst[1364] & 0x78007800u) | 0x027F0180u;
+  dst[1365] = (dst[1365] & 0x78007800u) | 0x03FF0180u;
+  dst[1366] &= 0x3FFF3FFFu;
+  dst[1367] &= 0x3FFF3FFFu;
+  dst[1402] = (dst[1402] & 0x80008000u) | 0x1C3F03C0u;
+  dst[1403] = (dst[1403] & 0x80008000u) | 0x1FFF03C0u;
+  dst[1404] = (dst[1404] & 0x78007800u) | 0x03FF0000u;
+  dst[1405] = (dst[1405] & 0x78007800u) | 0x03FF0000u;
+  dst[1406] = (dst[1406] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1407] = (dst[1407] & 0x0FFF0FFFu) | 0xC0000000u;
+  dst[1442] = 0x707F0F80u;
+  dst[1443] = 0x7FFF0F80u;
+  dst[1444] = (dst[1444] & 0x78007800u) | 0x03F0000Fu;
+  dst[1445] = (dst[1445] & 0x78007800u) | 0x03FF000Fu;
+  dst[1446] = (dst[1446] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1447] = (dst[1447] & 0x03FF03FFu) | 0xF0000000u;
+  dst[1480] &= 0xFFFEFFFEu;
+  dst[1481] &= 0xFFFEFFFEu;
+  dst[1482] = 0xFFFF0000u;
+  dst[1483] = 0xFFFF0000u;
+  dst[1484] = (dst[1484] & 0x7C007C00u) | 0x01E0001Fu;
+  dst[1485] = (dst[1485] & 0x7C007C00u) | 0x01FF001Fu;
+  dst[1486] = (dst[1486] & 0x01FF01FFu) | 0x7C008000u;
+  dst[1487] = (dst[1487] & 0x01FF01FFu) | 0xFC008000u;
+  dst[1520] &= 0xFFFEFFFEu;
+  dst[1521] &= 0xFFFEFFFEu;
+  dst[1522] = 0xFFFE0000u;
+  dst[1523] = 0xFFFE0000u;
+  dst[1524] = (dst[1524] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1525] = (dst[1525] & 0xFC00FC00u) | 0x01FF0000u;
+  dst[1526] = (dst[1526] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1527] = (dst[1527] & 0x00FF00FFu) | 0xFE000000u;
+  dst[1562] &= 0x00010001u;
+  dst[1563] &= 0x00010001u;
+  dst[1564] &= 0xFC00FC00u;
+  dst[1565] &= 0xFC00FC00u;
+  dst[1566] &= 0x00FF00FFu;
+  dst[1567] &= 0x00FF00FFu;
+}
+
+static const compiled_sprite_func img_loserboy_f21[VGA_BLOCK_PIXELS] = {
+    img_loserboy_f21_s0,
+    img_loserboy_f21_s1,
+    img_loserboy_f21_s2,
+    img_loserboy_f21_s3,
+    img_loserboy_f21_s4,
+    img_loserboy_f21_s5,
+    img_loserboy_f21_s6,
+    img_loserboy_f21_s7,
+    img_loserboy_f21_s8,
+    img_loserboy_f21_s9,
+    img_loserboy_f21_s10,
+    img_loserboy_f21_s11,
+    img_loserboy_f21_s12,
+    img_loserboy_f21_s13,
+    img_loserboy_f21_s14,
+    img_loserboy_f21_s15,
+};
+
+static const struct COMPILED_SPRITE img_loserboy_compiled[] = {
+    {10, img_loserboy_f10},
+    {21, img_loserboy_f21},
+};
+
+#endif  // LOSERBOY_COMPILED_H
@@ -0,0 +1,2068 @@
+/* File generated automatically by sprite_packer.py from loserboy.h */
+#ifndef LOSERBOY_PACKED_H
+#define LOSERBOY_PACKED_H
+
+#define img_loserboy_packed_width 51
+#define img_loserboy_packed_height 40
+#define img_loserboy_packed_stride 7
+#define img_loserboy_packed_num_spr 44
+
+const unsigned int img_loserboy_packed_data[]
+    __attribute__((aligned(4))) = {
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe00000cc,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x60880800, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x08808998, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x9990cccc, 0x89099880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa90ccc, 0x80999809, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa900ccc, 0x0889909a, 0x66666000,
+        0xccccc666, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ee0cc, 0x0889909a,
+        0xc000000d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeeee0c,
+        0xd0889099, 0xcc00dddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00eeeee0, 0xdd089800, 0xcc00dddd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeeee0, 0xddd09890, 0xccc0dddd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeeeee0, 0xddd0890e, 0x00000ddd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeeee0, 0xdddd00ee, 0xeeeee0dd,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xdddd00ee,
+        0xeeeee0dd, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0xdddd090e, 0xeeee0ddd, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeee00ccc, 0xdddd0080, 0xeeee0ddd, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0xdddd0080, 0xeee00ddd, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00000000, 0x0e0ad000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0000cc, 0xaa000000, 0xc000adda,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa00000, 0xaaa0000a,
+        0xcccc0ddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaa00a000,
+        0xdaa00000, 0xcccc0add, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x0a0aaa00, 0xa0000000, 0xccccc00a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00aaaa00, 0x0aaaa000, 0xcccc00aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00aaa00c, 0xddddaa00, 0xccc0aaad, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00a000cc, 0xddddda00, 0xcc00addd,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xaaaaa000,
+        0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x00000000, 0xcc000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0880800c,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x88089880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x900ccccc, 0x80999980, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa90cccc, 0x09999809, 0x66666000, 0xccccc666, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa900cccc, 0x0899809a, 0xcc0000dd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x90ee0ccc, 0xd09909aa, 0xccc0dddd,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeee0cc, 0xd08909a9,
+        0xccc0dddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeee0c,
+        0xdd098090, 0xcc000ddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeeee0c, 0xdd099800, 0xc0eee0dd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeee0c, 0xdd08990e, 0x0eeeee0d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xddd0990e, 0x0eeeee0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xddd0990e, 0x0eeeee0d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x0dd09900,
+        0xc0eee000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0xa0000900, 0xcc000aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xddaa0000, 0xcccc00dd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0a000ccc, 0xdddaa000, 0xccccc0ad, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0aa000cc, 0xddddaa00, 0xccccc00d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00aa000c, 0x000adaa0, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00aaa000, 0xaaa0aaa0,
+        0xccccc00a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000000,
+        0xddddda00, 0xcccc00ad, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaa00000, 0xddddaa00, 0xccc00add, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa000c, 0xdddaa00a, 0xccc00aad, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa000cc, 0xaaaa00aa, 0xccc000aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00000000, 0xcccc0000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa00cc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xe000ccc0, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x990ccccc, 0xe0000000, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa90ccccc, 0x60808809, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa000cccc, 0x0898009a, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eee00cc, 0x8990909a, 0xeeeee660,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeeee0c, 0x9909909a,
+        0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeeeee0,
+        0x90999809, 0x66666000, 0xccccc666, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x00eeeeee, 0x00899880, 0x000000dd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xcc0eeeee, 0xdd089980, 0xc000dddd, 0xcccc000c, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x0c0eeeee, 0xdd089998, 0x0000dddd, 0xccc0eee0,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x800eeeee, 0xddd08999, 0xee00dddd,
+        0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9800eee0, 0xddd08999,
+        0xee00dddd, 0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980000c,
+        0xddd08899, 0xee00000d, 0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x9980cccc, 0xdddd0899, 0x000aaa00, 0xccc0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x880ccccc, 0x0ddd0899, 0xc0adda00, 0xcccc000c, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x80cccccc, 0x00dd0898, 0x00dddaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00000880, 0xaaddddaa,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000000cc, 0x00c09009,
+        0xaaddddaa, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa00c,
+        0x00cc0990, 0xddaaddaa, 0xcc000add, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaaa00, 0x00cc0000, 0xddddaaaa, 0xcc0000ad, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaaaaaa0, 0x00cc00aa, 0xadddda00, 0xcc000000, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xa000aa00, 0x00ccc00a, 0x00addda0, 0xccc00000,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0x0aaaaaa0, 0x0cccc000, 0x0000adaa,
+        0xcccc0000, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaa0, 0x0ccc000a,
+        0x00000aaa, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa00,
+        0xcccc00aa, 0x00000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaa00000, 0xcccc000a, 0xcc00000c, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000000c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa00cc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xe000ccc0, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x990ccccc, 0xe0000000,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9990cccc,
+        0x60880809, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa000ccc, 0x08980099, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0eee00c, 0x8990909a, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x0eeeeee0, 0x9909909a, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xe0cccccc, 0x0eeeeeee, 0x90999809, 0x66666000,
+        0xccccc666, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0x000eeeee, 0x08998800,
+        0xc00000dd, 0xccc000cc, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xccc0eeee,
+        0xd0899880, 0x00900ddd, 0xcc0eee00, 0xcccccccc, 0xcccccccc, 0xee0ccccc,
+        0x0ccc0eee, 0xdd089998, 0xe090dddd, 0xc0eeeeee, 0xcccccccc, 0xcccccccc,
+        0xee0ccccc, 0x0ccc0eee, 0xddd09998, 0xe090dddd, 0xc0eeeeee, 0xcccccccc,
+        0xcccccccc, 0xe0cccccc, 0x80ccc0ee, 0xddd08999, 0xe090dddd, 0xc0eeeeee,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x9800c000, 0xdddd0999, 0x000ddddd,
+        0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xa00ccccc, 0x98090aaa, 0xdddd0999,
+        0x000000dd, 0xccc00000, 0xcccccccc, 0xcccccccc, 0xaaa00ccc, 0x80990aaa,
+        0xdddd0999, 0x0aaaaa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0x0990aaaa, 0xddddd088, 0x0addaa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaaa0c, 0x090aaaaa, 0xdd000c00, 0xaddddaa0, 0xcc000000, 0xcccccccc,
+        0xcccccccc, 0xaaaaaa0c, 0xc0aaaaaa, 0x00cccccc, 0xaadddaa0, 0xc0aaaaaa,
+        0xcccccccc, 0xcccccccc, 0xaaaaaaa0, 0xcc0aaaaa, 0xcccccccc, 0xaaaddaa0,
+        0xc00aadda, 0xcccccccc, 0xcccccccc, 0xaaaaaaa0, 0xccc0aaaa, 0xcccccccc,
+        0xdaaadaa0, 0xcc00aadd, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xcccc0aaa,
+        0xcccccccc, 0xddaadaa0, 0xcc0000ad, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa,
+        0xccccc0aa, 0xcccccccc, 0xddaadaa0, 0xccc0000a, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaaa, 0xcccccc0a, 0xcccccccc, 0xadaaaa0c, 0xcccc0000, 0xcccccccc,
+        0x0ccccccc, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0x0aaaaa0c, 0xccccc000,
+        0xcccccccc, 0x0ccccccc, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0x00aaa0cc,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xc0aaaaa0, 0xcccccccc, 0xcccccccc,
+        0x000aa0cc, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcc00000c, 0xcccccccc,
+        0xcccccccc, 0xc0000ccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xe000ccc0, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x990000cc, 0xe0080009, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xa90eee00, 0x6089909a, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xe00ccccc, 0xa0eeeeee, 0x0899009a,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xeee0cccc, 0xa0eeeeee,
+        0x8990809a, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xeeee0ccc,
+        0x9000eeee, 0x99088009, 0xeee66600, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x00cc00ee, 0x00999800, 0x66666000, 0xc0000666, 0xcccccccc,
+        0xcccccccc, 0xeeee0ccc, 0x0ccccc0e, 0xdd009990, 0x0000000d, 0x0eeee000,
+        0xcccccccc, 0xcccccccc, 0xeee0cccc, 0x800ccc0e, 0xdddd0999, 0x0a9080dd,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0x000ccccc, 0x98800cc0, 0xddddd099,
+        0x0a9080dd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x999880cc,
+        0xdddddd09, 0x0a9080dd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0x0000cccc,
+        0x999980cc, 0xdddddd09, 0x099080dd, 0x0eeeeeee, 0xcccccccc, 0xcccccccc,
+        0xaaaa00cc, 0x899980c0, 0xddddddd0, 0xc09080dd, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xaaaaaa0c, 0x89980c0a, 0xddddddd0, 0xcc00000d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaaaa0, 0x898800aa, 0xddddddd0, 0xcc0aaaa0,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0x888090aa, 0x0dddddd0,
+        0x00aaadaa, 0xc0000000, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0x000990aa,
+        0x0ddddddd, 0xa0aaddda, 0x000aaaaa, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa,
+        0xc0990aaa, 0xa0dddd00, 0xaaadddda, 0x000addda, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0xc090aaaa, 0xa00000cc, 0xaaddddda, 0xc000addd, 0xcccccccc,
+        0xa0cccccc, 0xaaaaaaaa, 0xcc00aaaa, 0x00cccccc, 0xdaadddaa, 0xc0000add,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0xccc00000, 0x0ccccccc, 0xddaadaa0,
+        0xcc0000ad, 0xcccccccc, 0xa0cccccc, 0x00aaaaaa, 0xcccccccc, 0xcccccccc,
+        0xdddaaaa0, 0xcc00000a, 0xcccccccc, 0xa0cccccc, 0xcc00aaaa, 0xcccccccc,
+        0xcccccccc, 0xadaaaa00, 0xccc00000, 0xcccccccc, 0xa0cccccc, 0xcccc0aaa,
+        0xcccccccc, 0xcccccccc, 0x0aaaa00c, 0xcccc0000, 0xcccccccc, 0x0ccccccc,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0x00aa00cc, 0xccccc000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0000ccc, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0880880c, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x89098880, 0xeeeee660,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x80999898,
+        0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc,
+        0x00890000, 0x66666000, 0xccccc666, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0x89909999, 0xc0000008, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x900ccccc, 0x00009aaa, 0xcc000ee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa90ccccc, 0xeeee099a, 0xcc0eeeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ccccc, 0xeeeee009, 0xcc0eeeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeeee00,
+        0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc,
+        0xeeee0000, 0xcc00eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x980ccccc, 0x00009999, 0xccc00000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x80cccccc, 0xa0099999, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaa099988, 0xc0aaaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa00ccccc, 0xa0888800, 0xc0aaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa00ccc, 0xa00000aa,
+        0xc0aaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdaaaa0cc,
+        0x0aaaaaad, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xdaaaaa0c, 0x0aaadddd, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xddaaaaa0, 0xa0aaaddd, 0xccc0aaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaadaa0, 0xaa0aaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaddaa0, 0xaaa000aa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddddaaa0, 0xaa000aaa,
+        0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddddaa0c,
+        0xaa0c0aad, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xdddaa0cc, 0xa0cc0aad, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x0cccc000, 0xccc00000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0000ccc,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x608800cc, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0880880c, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x89099880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x80999998, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc, 0x00990009, 0x66666000,
+        0xccccc666, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc, 0x99909990,
+        0xcc000088, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0x88009aa9, 0xc0ee0d08, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x900ccccc, 0x00ee09aa, 0xc0ee0d08, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x080ccccc, 0xeeeee099, 0xc0ee0000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x8980cccc, 0xeeeeee00, 0xcc000eee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980cccc, 0xeeee0099, 0xcccc0eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980cccc, 0xee008999,
+        0xcccc0eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980cccc,
+        0x00088999, 0xcccc00ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x880000cc, 0xdd088888, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000aa00c, 0xdd000000, 0xcccc00dd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00aaaa00, 0x00000aaa, 0xccc0a000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ddda0, 0x0000aaaa, 0xccc0aaa0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xddddddda, 0x0000addd,
+        0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xdddddaad,
+        0xa0000add, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xddda00ad, 0xaa0000aa, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0x0a00aadd, 0xaaa00000, 0xccc0000a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x000aaddd, 0xaaa0000c, 0xcc0aaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xcc00aadd, 0xaaa0000c, 0xc00aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xccc00aaa, 0x0000000c,
+        0xc0aaaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xccccc000,
+        0x000000cc, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0000ccc, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x08808800,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x89098800, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0x80999880, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0x00899880, 0x66666000, 0xccccc666, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0x99099988, 0x00000009, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xa9099909, 0xee000009,
+        0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x90cccccc, 0x9a909088,
+        0xeeeeeee0, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc,
+        0x9a900899, 0xeeeeeee0, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0x990ccccc, 0x99908899, 0xeeeeeee0, 0xccccc0ee, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0x9980cc00, 0x00088999, 0xeeeeee00, 0xcccccc0e, 0xcccccccc,
+        0xcccccccc, 0x00000ccc, 0x9990c000, 0xdd089999, 0x000000dd, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xa00a00cc, 0x9980000a, 0xdd089999, 0xc000000d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0aa00c, 0x8809000a, 0xdd089999,
+        0xc000a000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xda0daa00, 0x00aa000a,
+        0x00009988, 0xc00aaa00, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xdaaddaa0,
+        0x9aaa00ad, 0x00cc0000, 0xc00aaaa0, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xda0dddaa, 0x09aa00ad, 0x00cccccc, 0x0000aaaa, 0xccccccc0, 0xcccccccc,
+        0x0ccccccc, 0xda0dddda, 0xc09a00ad, 0xa0cccccc, 0xaaaa0aaa, 0xccccc00a,
+        0xcccccccc, 0x0ccccccc, 0xd00addda, 0xcc0000dd, 0xa00ccccc, 0xaaaaa0aa,
+        0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0x00000000, 0xcc000ddd, 0x000ccccc,
+        0xaaaaaaa0, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xccc00000,
+        0x000ccccc, 0x00aaaaaa, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0x0000aaaa, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x000ccccc, 0x000000a0, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x00000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xcc000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a0000c,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xe0000880, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x8800cccc, 0xe0000088, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x88080ccc, 0x60880808, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x880a0ccc, 0x08808980, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00aa00cc, 0x00089998, 0xeeeee600,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aa0ee0c, 0x90899998,
+        0xeee66099, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x800eee0c,
+        0x90899909, 0x6660009a, 0xccccc600, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x980eee0c, 0xa9090089, 0x000ee09a, 0xccccc0ee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x980ee0cc, 0xa9008899, 0xeeeeee0a, 0xcccc0eee, 0xcccccccc,
+        0xcccccccc, 0xcc0000cc, 0x99800ccc, 0x99088899, 0xeeeeee09, 0xcccc0eee,
+        0xcccccccc, 0xcccccccc, 0x0000000c, 0x9980ccc0, 0x00088999, 0xeeeee000,
+        0xcccc0eee, 0xcccccccc, 0xcccccccc, 0x000aa000, 0x99900000, 0xdd089999,
+        0xeee000dd, 0xccccc0ee, 0xcccccccc, 0x0ccccccc, 0xaaaadaa0, 0x99800000,
+        0xdd089999, 0x0000090d, 0xcccccc00, 0xcccccccc, 0x0ccccccc, 0xddaddda0,
+        0x880000ad, 0xdd089999, 0x0aaa0990, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xddaaddda, 0x00a90add, 0x00009988, 0xaaa00099, 0xccccccc0, 0xcccccccc,
+        0xa0cccccc, 0xdda0adda, 0xaaa90aad, 0x00cc0000, 0xaaaa0009, 0xccccccc0,
+        0xcccccccc, 0xa00ccccc, 0xdaa0addd, 0x999900ad, 0xccccccc0, 0xaaaa0000,
+        0xc000000a, 0xcccccccc, 0xa00ccccc, 0x0000addd, 0x00000000, 0xcccccccc,
+        0xaaaa000c, 0x00aaaaaa, 0xcccccccc, 0xa00ccccc, 0x00000ada, 0xcccc0000,
+        0xcccccccc, 0x00aa000c, 0x0000aaaa, 0xcccccccc, 0x000ccccc, 0xcccc0000,
+        0xcccccccc, 0xcccccccc, 0xa000000c, 0x00000aaa, 0xcccccccc, 0x00cccccc,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xa000000c, 0xc00000aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa00000c, 0xcc00000a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa00000c,
+        0xccc00000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa00000cc, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000000cc, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe00000cc,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x60880800, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa000000c, 0x08808809, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0eeeee0, 0x89098809, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0eeeee0, 0x00999809, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0eeeee0, 0x99990880, 0x66666000,
+        0xccc00066, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ee0, 0x99990888,
+        0xccc00009, 0xcc0eee0c, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cc000c,
+        0x99808898, 0x00099909, 0xc0eeeee0, 0xcccccccc, 0xcccccccc, 0xcc000000,
+        0x880ccccc, 0x98088999, 0xee09a908, 0xc0eeeeee, 0xcccccccc, 0x00cccccc,
+        0xc0000000, 0x9880cccc, 0x80888999, 0xee09a900, 0xc0eeeeee, 0xcccccccc,
+        0x0000cccc, 0x000aaada, 0x99800ccc, 0x08889999, 0xee09a900, 0xcc0eeeee,
+        0xcccccccc, 0xaa000ccc, 0x00addadd, 0x980990c0, 0x00899999, 0x00009009,
+        0xccc00000, 0xcccccccc, 0xddaa00cc, 0x0aaddaad, 0x880a9900, 0x90889999,
+        0xcc000099, 0xcccccccc, 0xcccccccc, 0xdddaa00c, 0xaadddaaa, 0x809aa00a,
+        0x99089998, 0xc00aa099, 0x000ccccc, 0xcccccc00, 0xadddaa00, 0xaddda00a,
+        0x809a90aa, 0x90088988, 0x0aaaaa09, 0xaaa00000, 0xccccc00a, 0xaaaaaa00,
+        0xdddaa000, 0x0c0900aa, 0x0c088880, 0xaaaaa000, 0xaaaaa00a, 0xccccc000,
+        0x00000000, 0xdda00000, 0xccc0000a, 0xcc00000c, 0xaaaaa00c, 0x0aaaaaaa,
+        0xccccc000, 0x000000cc, 0x000000cc, 0xcccc0000, 0xcccccccc, 0xaaaa000c,
+        0x00aaaaaa, 0xccccc000, 0xcccccccc, 0x000ccccc, 0xccccc000, 0xcccccccc,
+        0xaaa000cc, 0x000aaaaa, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0a000ccc, 0x000aaaaa, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0x0000aaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x00000aa0, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x00000a00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcc000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xccc0000c, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0000000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x0aaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa000ccc, 0xaaaaaaaa,
+        0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaaa0c, 0xaaaaaaaa, 0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaaa0c, 0xaaaaaaaa, 0xcccc0aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa000aa0c, 0xaaa000aa, 0xcccc0aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0ee0a0c, 0xaa00fe00, 0xcccc0a0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00eee00c, 0xa0d0ffe6,
+        0xccccc0a0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0x0ed0ffee, 0xccccc0a0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeee0cc, 0xfedaffee, 0xccccc6ad, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeee00cc, 0xeefffeee, 0xccccc6ff, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xee00000c, 0xeee66eee, 0xccccc6ee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x60890880, 0xee6eeeee, 0xcccccc6e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x09908988, 0x6eeeee66,
+        0xccccccc6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x88908998,
+        0xc0000660, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ccccc,
+        0x00009900, 0xc0906660, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa990cccc, 0x0880809a, 0xc090000d, 0xcc000ccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa90cccc, 0x088009aa, 0x0090dddd, 0xc0eee000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa900cccc, 0x08880aaa, 0x0990dddd, 0x0eeeee0e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00ee0ccc, 0xd08809a9, 0x0990dddd,
+        0x0eeeee0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0880990,
+        0x0990dddd, 0x0eeee0ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeee0cc,
+        0xd088800c, 0x0990dddd, 0x0eeee000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0eee0cc, 0xd08880cc, 0x890ddddd, 0xc0000cc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0eeeee0c, 0xdd08880c, 0x890ddddd, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0eeeee0c, 0xdd088880, 0x890ddddd, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xddd08880, 0x880ddddd,
+        0xcccccc08, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeee0cc, 0xdddd0000,
+        0x00dddddd, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0000ccc,
+        0xddd00aaa, 0xaa00dddd, 0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0x000aadda, 0xdaaa0000, 0xccccc0aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaa0cccc, 0xcc0adddd, 0xddaaa0cc, 0xccccc0ad, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xcc0adddd, 0xddaaa0cc, 0xcccc0aad,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xcc0adddd, 0xddaaaa0c,
+        0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaaa00, 0xccc0adda,
+        0xaaaaaa0c, 0xc00aaaaa, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xaaaaaa0c, 0x0aaadddd, 0xccccccc0, 0xcccccccc, 0xaa00cccc,
+        0xaaddddaa, 0xccc0aaaa, 0xaaaaaa0c, 0xaaddddda, 0xcccccc0a, 0xcccccccc,
+        0xaaaa0ccc, 0xadddddda, 0xcccc0aaa, 0xaaaaaa0c, 0xaaaaaaaa, 0xccccc0aa,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcccc0aaa, 0xaaaaa0cc, 0xaaaaaaaa,
+        0xccccc0aa, 0xcccccccc, 0x000000cc, 0x00000000, 0xcccc0000, 0x00000ccc,
+        0x00000000, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xccccc008, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcc000899, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x99098066, 0xc0999088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99908806, 0x09aaa908,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x66666666, 0x99880000,
+        0x009aaa90, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x99880d00, 0xee009a90, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xd00ccccc, 0x9880dddd, 0xeeee0990, 0xcccccc0e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xd00ccccc, 0x980ddddd, 0xeee00008, 0xccccc0ee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xd0cccccc, 0x90dddddd, 0xeeeee098, 0xccccc0ee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0x80dddddd, 0xeeeeee09,
+        0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x0dddddd0,
+        0xeeeeeee0, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0x0dddddd0, 0xeeeeeee0, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0eeee0cc, 0x0ddddddd, 0xeeeeee09, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0eeee0cc, 0x0ddddddd, 0x00eee080, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00eee0cc, 0x0ddddddd, 0xcc000080, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xda0e0ccc, 0x00000000, 0xc0000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa000cccc, 0x000aaadd,
+        0x000aa000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x00aaaddd, 0x00aaaa00, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x00aaddda, 0xa00aa000, 0xcccc0000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000aa00, 0xaa0a0000, 0xcccc000a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaa0aa0, 0xaaa00000, 0xccccc00a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xadddddaa, 0xaaa0000a,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa00ccccc, 0xdddddddd,
+        0x00a0000a, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaaaaaaaa, 0x00000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x00000000, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0xc000eeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x8088066e, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x98088066, 0xcccc0088, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99908806, 0xcc009089, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x66666666, 0x99990000, 0xc09aa908, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x89980dd0, 0xc009aa90,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xd0cccccc, 0x0990dddd,
+        0x0ee09aa9, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xd0cccccc,
+        0x0980dddd, 0xeeee09a9, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x890ddddd, 0xeeeee090, 0xcccccc0e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeee0cccc, 0x990dddd0, 0xeeeee008, 0xcccccc0e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x980ddd0e, 0xeeeeee09, 0xcccccc0e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x90dddd0e, 0xeeeeee09,
+        0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x90dddd0e,
+        0xeeeeee09, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeee0cccc,
+        0x90dd0000, 0x0eeee009, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x0000aaaa, 0xc0000009, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x0aadddd0, 0xc0000000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaadddda0, 0x000a0000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaddddd00, 0x00aa000a,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xda00000c,
+        0x0aa000aa, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0aaaa00, 0xaaa000aa, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xdddddda0, 0x0000000a, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xadddddda, 0x00aaa00a, 0xccccc000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaddddaa, 0x0aaaaa00, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x0aaaaaa0, 0x00aaaaa0,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x00000000,
+        0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0xc000eeee, 0xccc000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcc099000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x808066ee, 0xcc09a908, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x0898066e, 0xc000aa90,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x90998066,
+        0x0eee0a90, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x99099806, 0xeeee0a90, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x66666666, 0x99909000, 0xeeee0908, 0xccccc0ee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00000ccc, 0x99800dd0, 0xeee00088, 0xcccc0eee, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xd000cc00, 0x980ddddd, 0xee0cc089, 0xcccc0eee,
+        0xcccccccc, 0xcccccccc, 0xe0cccccc, 0xd00000ee, 0x980ddddd, 0xee0c0899,
+        0xcccc0eee, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xd00eeeee, 0x80dddddd,
+        0xee008999, 0xcccc0eee, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xd00eeeee,
+        0x80dddddd, 0xe0089999, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xee0ccccc,
+        0x000eeeee, 0x80dddd00, 0x00899998, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xe0cccccc, 0xaa0000ee, 0x0dddd00a, 0xc0899998, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xdda0cc00, 0x0ddd000a, 0xcc088998, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddd00ccc, 0x0dd000aa, 0xccc08898,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdddaa000, 0x00000aad,
+        0xc0000088, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xdddaaaaa,
+        0x90c00aad, 0x00000900, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0xdaadddda, 0x0cc00aad, 0xaaaa0099, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0xaddddda0, 0x0cc00aaa, 0xaaaaa000, 0xccccc00a, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0xdddda000, 0x0cc0000a, 0xaaaaaaa0, 0xcccc00aa,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xdda00000, 0xccc000ad, 0xa000aa00,
+        0xccc0000a, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xa0000000, 0xcccc0aad,
+        0xaaaa0000, 0xccc000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c,
+        0x0ccc0aaa, 0xaaaaaa00, 0xccc000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0x0cccc000, 0xaaaaaaa0, 0xccc0000a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0x0ccccc00, 0x00aaaa00, 0xcccc0000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000000, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xccc000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xcc099000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xc0999908, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x0898066e, 0x000aa990, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x90998066, 0xeee0aa90, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99099806, 0xeeee0a90,
+        0xcccc00ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x66666666, 0x99909000,
+        0xeeee0908, 0xccc0eeee, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x0000ccc0,
+        0x89980dd0, 0xee000008, 0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xee0ccccc,
+        0x0090000e, 0x9980dddd, 0xe0ccc088, 0xcc0eeeee, 0xcccccccc, 0xcccccccc,
+        0xeee0cccc, 0xd090eeee, 0x980ddddd, 0x0ccc0899, 0xcc0eeeee, 0xcccccccc,
+        0xcccccccc, 0xeee0cccc, 0xd090eeee, 0x90dddddd, 0x0ccc0899, 0xcc0eeeee,
+        0xcccccccc, 0xcccccccc, 0xeee0cccc, 0xd090eeee, 0x80dddddd, 0xccc08999,
+        0xccc0eee0, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xdd000eee, 0x0ddddddd,
+        0xc0089999, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x00000000,
+        0x0dddddd0, 0x09089999, 0xcc00aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0x0ddddd0a, 0x09908999, 0x00aaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xadda0ccc, 0xdddddd0a, 0xa0990880, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0x000ccccc, 0xdddda000, 0x000dd0aa, 0xaa09000c, 0xaaaaaaaa,
+        0xcccccc0a, 0xcccccccc, 0xaaa0cccc, 0xdddaaaaa, 0xccc000aa, 0xaaa0cccc,
+        0xaaaaaaaa, 0xcccccc0a, 0xcccccccc, 0xaa00cccc, 0xddaaaadd, 0xccccc0aa,
+        0xaa0ccccc, 0xaaaaaaaa, 0xccccc0aa, 0xcccccccc, 0xa00ccccc, 0xdaaaddda,
+        0xccccc0aa, 0xa0cccccc, 0xaaaaaaaa, 0xccccc0aa, 0xcccccccc, 0x000ccccc,
+        0xdaaddda0, 0xccccc0aa, 0x0ccccccc, 0xaaaaaaaa, 0xcccc0aaa, 0xcccccccc,
+        0x00cccccc, 0xdaadda00, 0xccccc0aa, 0xcccccccc, 0xaaaaaaa0, 0xcccc0aaa,
+        0xcccccccc, 0x0ccccccc, 0xaaada000, 0xcccccc0a, 0xcccccccc, 0xaaaaaa0c,
+        0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0xaaaa0000, 0xcccccc0a, 0xcccccccc,
+        0xaaaaa0cc, 0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0xaaa0000c, 0xccccccc0,
+        0xcccccccc, 0xaaaa0ccc, 0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0xaa0000cc,
+        0xccccccc0, 0xcccccccc, 0xaaa0cccc, 0xccccc0aa, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xccc000cc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0x0800eeee, 0x00099900,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x998066ee,
+        0xee09aa90, 0xcccc000e, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x0998066e, 0xeee0aa90, 0xcc00eeee, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x80998066, 0xeee0aa90, 0xc0eeeeee, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x88099006, 0xe0009900, 0x0eeeeeee, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x66666666, 0x99900000, 0x0cc00008, 0x0eeeeee0,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000, 0x900ddd00, 0xcccc0099,
+        0x0eeeee0c, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x809a0eee, 0x0dddddd0,
+        0xcc008999, 0xc0eeee0c, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x809a0eee,
+        0xddddddd0, 0x00889990, 0xcc0000cc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0x809a0eee, 0xddddddd0, 0x8899990d, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x80990eee, 0xddddddd0, 0x8999990d, 0xc0000cc0, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x8090c000, 0xddddddd0, 0x899980dd, 0x0aaaa0c0,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xdddddd00, 0x089980dd,
+        0xaaaaaa0c, 0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xddddd0aa,
+        0x088980dd, 0xaaaaaaa0, 0xccccc0aa, 0xcccccccc, 0x0000cccc, 0xaaa00000,
+        0xdddd0aad, 0x908880dd, 0xaaaaaaa0, 0xcccc0aaa, 0xcccccccc, 0xaa000ccc,
+        0xdaa0aaaa, 0xdddd0add, 0x99000ddd, 0xaaaaaaa0, 0xcccc0aaa, 0xcccccccc,
+        0xda000ccc, 0xddaaaadd, 0xddd0aadd, 0x0990c00d, 0xaaaaaaaa, 0xccc0aaaa,
+        0xcccccccc, 0xa000cccc, 0xdddaaddd, 0x0000aadd, 0xa090ccc0, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0x0000cccc, 0xddaaddda, 0xccc00aad, 0xa00ccccc,
+        0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0x000ccccc, 0xdaaddda0, 0xcccc00aa,
+        0x00cccccc, 0xaaaaa000, 0xccc0aaaa, 0xcccccccc, 0x000ccccc, 0xaaddda00,
+        0xccccc0aa, 0xcccccccc, 0xaaa00ccc, 0xccc0aaaa, 0xcccccccc, 0x00cccccc,
+        0xaaada000, 0xccccc00a, 0xcccccccc, 0xa00ccccc, 0xccc0aaaa, 0xcccccccc,
+        0x0ccccccc, 0xaaaa0000, 0xcccccc00, 0xcccccccc, 0x0ccccccc, 0xccc0aaaa,
+        0xcccccccc, 0xcccccccc, 0x0aa00000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccc0000, 0xcccccccc, 0xcccccccc, 0x0000000c, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0000ccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcccccc08,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x89098066,
+        0xccccc088, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x99908806, 0xcccc0898, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x66666666, 0x09800000, 0xccc08000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x90998800, 0xccc00999, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x000ccccc, 0x900000ee, 0xcc009aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0x0eeeeeee, 0xcc09aa99,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xeeeeeeee,
+        0xcc009900, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xee0ccccc,
+        0xeeeeeeee, 0xccc0000e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe00ccccc, 0x0eeeeeee, 0xcc089000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0x90000000, 0xcc089999, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x9900aaaa, 0xccc08999, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc, 0x990aaaaa, 0xccc00889,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc, 0x8880aaaa,
+        0xcc00a008, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc,
+        0x0000aaaa, 0x00aaaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaa0aaa, 0xaaaaddaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xdaaa0aaa, 0xaaaadddd, 0xcccccc0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaa0aaaa, 0xaaaddddd, 0xccccc0aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaa0aaaaa, 0xdaaaaaaa,
+        0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x00aaaaaa,
+        0xddaaaaa0, 0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0x000aaaaa, 0xaddddaaa, 0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0x0c0aaaaa, 0xadddddaa, 0xcccccc0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0x0cc0aaaa, 0xaaddddaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xcccc0000, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcccccc08, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x99098066, 0xccccc088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99908806, 0xcccc0899,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x66666666, 0x09900000,
+        0xccc08900, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0x90999880, 0xccc08099, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ee0cccc, 0x9008880d, 0xccc009aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ee0cccc, 0x0ee0080d, 0xcc009aa9, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ee0cccc, 0xeeeee000, 0xcc080990, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xeeeeeeee, 0xc089800e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0eeeeeee,
+        0xc0899990, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x800eeeee, 0xc0899999, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x88000ee0, 0xc0899999, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x880dd000, 0x00088888, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x000dddd0, 0xaa000000, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00000000, 0xaaa00aaa,
+        0xccccc00a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xa00000aa,
+        0xdd0aaaaa, 0xccccc0ad, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xa0000aaa, 0xdddddddd, 0xcccc0add, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x0000aaa0, 0xddddddda, 0xcccc0daa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x000aaaa0, 0x0adddaa0, 0xccc0ada0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0x00aaaa00, 0xa00a0000, 0xccc0adda,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x00aaaaaa, 0xaa000c00,
+        0xccc0addd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa00cccc, 0x00aaaaaa,
+        0xa00ccc00, 0xccc0adda, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc,
+        0x000000aa, 0x00cccc00, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0x00000000, 0xccccccc0, 0xcccc0000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x8088066e, 0xccccc008, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x89098066, 0xcccc0008, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99908806, 0xccc00088, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x66666666, 0x99800000, 0xccc00088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000000cc, 0x99099900, 0xccc00889,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000eee0c, 0x9909a900,
+        0xccc00909, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeeee0,
+        0x909a90ee, 0xccc09880, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeeeee0, 0x009a90ee, 0xcc089998, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeeee0, 0x809990ee, 0xcc099998, 0xcc000ccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0x8800000e, 0xc0899999, 0xc000000c,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000000cc, 0x980dddd0, 0xc0999999,
+        0x00000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x980ddd00,
+        0x00899999, 0x0a00aa00, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xa000cccc,
+        0x980dd000, 0x09088999, 0xaa0aaa00, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xaa00cccc, 0x9000000a, 0x0aa00889, 0xad0ada00, 0xccccc00a, 0xcccccccc,
+        0xcccccccc, 0xaa00cccc, 0x0cc000aa, 0x0aaa9000, 0xddaadda0, 0xcccc00aa,
+        0xcccccccc, 0xcccccccc, 0xa00000cc, 0xccc00aaa, 0x0aa90ccc, 0xdd0adda0,
+        0xcccc0aad, 0xcccccccc, 0xcccccccc, 0x0aaaaa00, 0xccc0aaaa, 0x0a90cccc,
+        0xdd0adda0, 0xcccc0add, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xcc00aaa0,
+        0x000ccccc, 0xda00ddd0, 0xcccc0add, 0xcccccccc, 0x0ccccccc, 0xaaaaa000,
+        0xcc0000aa, 0x000ccccc, 0x00000ddd, 0xccccc000, 0xcccccccc, 0x0ccccccc,
+        0xaaa00000, 0xcc000aaa, 0x00cccccc, 0xcccc0000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0000000, 0xcc000aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000000c, 0xcc0000a0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xcc000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xccc00000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0x0000eeee, 0xccc00088, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xc0088880, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee, 0x08088808, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x8088066e, 0x0a088089,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x98000006,
+        0x0aa00899, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x99809990, 0xe0aa0899, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00666006, 0x99809a90, 0xee008909, 0xcccccc0e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xee000ee0, 0x0909aa90, 0xee089980, 0xcccccc0e, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xeeeeeeee, 0x8009aa0e, 0xee089998, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xeeeeeeee, 0x8809990e, 0x00899998,
+        0x000ccccc, 0xccccccc0, 0xcccccccc, 0x0ccccccc, 0xeeeeeeee, 0x88000000,
+        0xc0899999, 0x000000cc, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0x00eeeee0,
+        0x980dddd0, 0x00999999, 0xaa000000, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0x0000000c, 0x980ddd09, 0x00899999, 0xdaaaa000, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0x0aaa0ccc, 0x980dd099, 0x00088999, 0xddaddda0, 0xcccc00ad,
+        0xcccccccc, 0xcccccccc, 0x00aaa0cc, 0x90000990, 0x09a00889, 0xdaadddda,
+        0xccc00add, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0x0cc00900, 0x09aaa000,
+        0xa0adddaa, 0xccc0aadd, 0xcccccccc, 0x0000cccc, 0x0aaaaa00, 0xccccc000,
+        0x099990cc, 0xa0aadda0, 0xcc00addd, 0xcccccccc, 0xaaa00ccc, 0x0aaaaaaa,
+        0xcccccc00, 0x00000ccc, 0xa0000000, 0xcc00addd, 0xcccccccc, 0xa0000ccc,
+        0x0aa00aaa, 0xcccccc00, 0x0ccccccc, 0x00000000, 0xcc00aada, 0xcccccccc,
+        0x00000ccc, 0x0000aaaa, 0xcccccc00, 0xcccccccc, 0x0ccccccc, 0xcc000000,
+        0xcccccccc, 0x0000cccc, 0x0000aaa0, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xccc0000c, 0xcccccccc, 0x000ccccc, 0x000aaa00, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x000aa000, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0000a000,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000000c, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcc000ccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xcccc0008, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x8088066e, 0x0000a908, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x89098066, 0xeee0a908, 0xccccc0ee,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99900806, 0xeee0a908,
+        0xccccc0ee, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x66666660, 0x09999000,
+        0xeee0a088, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xee0ccccc, 0x00cccc0e,
+        0x09999900, 0x00000888, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xeee0cccc,
+        0x990000ee, 0x80899909, 0x0cc08898, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xeee0cccc, 0xa90eeeee, 0x88089809, 0xcc088999, 0x000ccccc, 0xccccc000,
+        0xcccccccc, 0xeee0cccc, 0xa90eeeee, 0x88808009, 0xc0889999, 0x0000cccc,
+        0xccc00000, 0xcccccccc, 0xee0ccccc, 0xa90eeeee, 0x98880009, 0x00899999,
+        0xaa000ccc, 0xc0000ada, 0xcccccccc, 0x00cccccc, 0x90000000, 0x99800900,
+        0x99089999, 0xdda000c0, 0x000aadda, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0x98809990, 0x9a088999, 0xddaa0009, 0x0aadddaa, 0xccccccc0, 0xcc00000c,
+        0xaa00cccc, 0x98099990, 0xaa908899, 0xdddaaa00, 0xaadddaaa, 0xcccccc00,
+        0x00aaaa00, 0xaaaa0000, 0x8800990a, 0x9a908889, 0xadddaaa0, 0xadddaa00,
+        0xccccc00a, 0xaaaaa000, 0xaaaaaa00, 0x880c0000, 0x090c0088, 0xaadddaa0,
+        0xaaaaa000, 0xccccc00a, 0xaaaa0000, 0xaaaaaaaa, 0x000ccc00, 0x00cccc00,
+        0x00adda00, 0x00000000, 0xccccc000, 0xaaa00000, 0x0aaaaaaa, 0xcccccc00,
+        0x0ccccccc, 0x00000000, 0x00000cc0, 0xccccccc0, 0xaa00000c, 0x00aaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcc000000, 0xcccccccc, 0xcccccccc, 0xaa00000c,
+        0x000a0aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa00000cc, 0xc0000aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000000cc, 0xcc0000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0000a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xcccc0000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa00cc, 0xcc000aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaaa0c, 0x000aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaaaa0,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaaa, 0xaaaaaaaa, 0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xcccccc0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x00aaaaaa, 0xa000aaa0, 0xcccccc0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xf00aaa0a, 0x0ee0a00e, 0xcccccc0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xf0d0a0a0, 0xeee006ef,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xf0de00a0,
+        0xeeeeeeef, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xfadefda6, 0xeeeeeeef, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xfffeeff6, 0x0eeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x66eeeee6, 0x000eeeee, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xee6eee6c, 0x09806eee, 0xccccc088,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee66cc, 0x8099066e,
+        0xcccc0889, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x80988066, 0xccc00899, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6090cccc, 0x90000066, 0xcc009009, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x0090cccc, 0x80880d00, 0xc099aa90, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeee0cccc, 0xd0900000, 0x00880ddd, 0xc09aaaa9, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0990e0e, 0x08880ddd, 0xc009aaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0990e0e, 0x0880dddd,
+        0x0ee009a9, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0990ee0,
+        0x0880dddd, 0x0eeee099, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc,
+        0xd0990000, 0x8880dddd, 0xeeee0c00, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xdd0980cc, 0x8880dddd, 0xeee0ccc0, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xdd0980cc, 0x880ddddd, 0xeeee0c08, 0xcccccc0e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdd0980cc, 0x880ddddd, 0xeeee0088,
+        0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdd08880c, 0x80dddddd,
+        0xeeeee088, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddd0000c,
+        0x0ddddddd, 0xeeee0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xd00aaa0c, 0x00dddddd, 0x0000aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaadaa0, 0xaa000000, 0xcc0aaadd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaddda0, 0xda0cccc0, 0xc0aaaddd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaadddaa, 0xda0cccc0, 0x0aaaaddd,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaddaaa, 0xda0ccc0a,
+        0xaaaaaddd, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xaa00cccc, 0xaaaaaaaa,
+        0xa0cccc0a, 0xaaaaaadd, 0xccccc00a, 0xcccccccc, 0xcccccccc, 0xdaaa00cc,
+        0xaaaaaddd, 0xa0cccc0a, 0xaaaaaaaa, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xdddaaa0c, 0xaaaaaadd, 0xa0cccc0a, 0xdddaaaaa, 0xc00aaaad, 0xcccccccc,
+        0xcccccccc, 0xaaaaaaa0, 0xaaaaaaaa, 0x0ccccc0a, 0xddddaaaa, 0x0aaaaadd,
+        0xcccccccc, 0xcccccccc, 0xaaaaaaa0, 0xaaaaaaaa, 0x0cccccc0, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0x0000000c, 0x00000000, 0x0ccccccc,
+        0x00000000, 0x00000000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe00000cc, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x60880800, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x08808998,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9990cccc,
+        0x89099880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaa90ccc, 0x80999809, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa900ccc, 0x0889909a, 0x66666000, 0xc0000666, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x900ee0cc, 0x0889909a, 0x0000000d, 0x0eeee000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeeee0c, 0xd0889099, 0x0a90dddd,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x00eeeee0, 0xdd089800,
+        0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeeeeee0,
+        0xddd09890, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xeeeeeee0, 0xddd0890e, 0x09990ddd, 0x0eeeeeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeeee0, 0xdddd00ee, 0xc0990ddd, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xdddd00ee, 0xcc000ddd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xdddd090e, 0xcccc0ddd,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeee00ccc, 0xdddd0080,
+        0xcccc0ddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0xdddd0080, 0xcccc0ddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0x00000000, 0xccc0d000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0000cc, 0xaa000000, 0xccc0adda, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa00000, 0xaaa0000a, 0xcccc0ddd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaa00a000, 0xdaa00000, 0xcccc0add,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0a0aaa00, 0xa0000000,
+        0xccccc00a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00aaaa00,
+        0x0aaaa000, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00aaa00c, 0xddddaa00, 0xccc0aaad, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00a000cc, 0xddddda00, 0xcc00addd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xaaaaa000, 0xcc0aaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00000000, 0xcc000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0880800c, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x88089880, 0xeeeee660,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ccccc, 0x80999980,
+        0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa90cccc,
+        0x09999809, 0x66666000, 0xc0000666, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa900cccc, 0x0899809a, 0x000000dd, 0x0eeee000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x90ee0ccc, 0xd09909aa, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x0eeee0cc, 0xd08909a9, 0x0a90dddd, 0xeeeeeeee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xdd098090, 0x0a90dddd,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeeeee0c, 0xdd099800,
+        0x09990ddd, 0x0eeeeeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeee0c,
+        0xdd08990e, 0xc0990ddd, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeeee0c, 0xddd0990e, 0xcc000ddd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0xddd0990e, 0xcccc0ddd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x0dd09900, 0xcccc0000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xa0000900, 0xcccc0aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xddaa0000,
+        0xcccc00dd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0a000ccc,
+        0xdddaa000, 0xccccc0ad, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0aa000cc, 0xddddaa00, 0xccccc00d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00aa000c, 0x000adaa0, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00aaa000, 0xaaa0aaa0, 0xccccc00a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000000, 0xddddda00, 0xcccc00ad,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa00000, 0xddddaa00,
+        0xccc00add, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa000c,
+        0xdddaa00a, 0xccc00aad, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaa000cc, 0xaaaa00aa, 0xccc000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x00000000, 0xcccc0000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa00cc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xe000ccc0, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x990ccccc, 0xe0000000,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa90ccccc,
+        0x60808809, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa000cccc, 0x0898009a, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0eee00cc, 0x8990909a, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0eeeee0c, 0x9909909a, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeeeee0, 0x90999809, 0x66666000,
+        0xc0000666, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x00eeeeee, 0x00899880,
+        0x000000dd, 0x0eeee000, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xcc0eeeee,
+        0xdd089980, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0x0ccccccc,
+        0x0c0eeeee, 0xdd089998, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc,
+        0x0ccccccc, 0x800eeeee, 0xddd08999, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x9800eee0, 0xddd08999, 0x0990dddd, 0x0eeeeeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980000c, 0xddd08899, 0xc000000d,
+        0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980cccc, 0xdddd0899,
+        0xc00aaa00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x880ccccc,
+        0x0ddd0899, 0xc0adda00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x80cccccc, 0x00dd0898, 0x00dddaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x00000880, 0xaaddddaa, 0xccccc000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x000000cc, 0x00c09009, 0xaaddddaa, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa00c, 0x00cc0990, 0xddaaddaa,
+        0xcc000add, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaaa00, 0x00cc0000,
+        0xddddaaaa, 0xcc0000ad, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0,
+        0x00cc00aa, 0xadddda00, 0xcc000000, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xa000aa00, 0x00ccc00a, 0x00addda0, 0xccc00000, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0x0aaaaaa0, 0x0cccc000, 0x0000adaa, 0xcccc0000, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaaa0, 0x0ccc000a, 0x00000aaa, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa00, 0xcccc00aa, 0x00000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaa00000, 0xcccc000a,
+        0xcc00000c, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa00cc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xe000ccc0, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x990ccccc, 0xe0000000, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9990cccc, 0x60880809, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa000ccc, 0x08980099,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0eee00c,
+        0x8990909a, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x0eeeeee0, 0x9909909a, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xe0cccccc, 0x0eeeeeee, 0x90999809, 0x66666000, 0xc0000666, 0xcccccccc,
+        0xcccccccc, 0xee0ccccc, 0x000eeeee, 0x08998800, 0x000000dd, 0x0eeee000,
+        0xcccccccc, 0xcccccccc, 0xee0ccccc, 0xccc0eeee, 0xd0899880, 0x0a900ddd,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xee0ccccc, 0x0ccc0eee, 0xdd089998,
+        0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xee0ccccc, 0x0ccc0eee,
+        0xddd09998, 0x0a90dddd, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xe0cccccc,
+        0x80ccc0ee, 0xddd08999, 0x0990dddd, 0x0eeeeeee, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x9800c000, 0xdddd0999, 0xc090dddd, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xa00ccccc, 0x98090aaa, 0xdddd0999, 0xc00000dd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa00ccc, 0x80990aaa, 0xdddd0999, 0x0aaaaa0d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x0990aaaa, 0xddddd088,
+        0x0addaa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaaa0c, 0x090aaaaa,
+        0xdd000c00, 0xaddddaa0, 0xcc000000, 0xcccccccc, 0xcccccccc, 0xaaaaaa0c,
+        0xc0aaaaaa, 0x00cccccc, 0xaadddaa0, 0xc0aaaaaa, 0xcccccccc, 0xcccccccc,
+        0xaaaaaaa0, 0xcc0aaaaa, 0xcccccccc, 0xaaaddaa0, 0xc00aadda, 0xcccccccc,
+        0xcccccccc, 0xaaaaaaa0, 0xccc0aaaa, 0xcccccccc, 0xdaaadaa0, 0xcc00aadd,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xcccc0aaa, 0xcccccccc, 0xddaadaa0,
+        0xcc0000ad, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xccccc0aa, 0xcccccccc,
+        0xddaadaa0, 0xccc0000a, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xcccccc0a,
+        0xcccccccc, 0xadaaaa0c, 0xcccc0000, 0xcccccccc, 0x0ccccccc, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0x0aaaaa0c, 0xccccc000, 0xcccccccc, 0x0ccccccc,
+        0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0x00aaa0cc, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xc0aaaaa0, 0xcccccccc, 0xcccccccc, 0x000aa0cc, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcc00000c, 0xcccccccc, 0xcccccccc, 0xc0000ccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xe000ccc0, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x990000cc, 0xe0080009, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xa90eee00, 0x6089909a, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xe00ccccc, 0xa0eeeeee, 0x0899009a, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xeee0cccc, 0xa0eeeeee, 0x8990809a, 0xeeeee660,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x9000eeee, 0x99088009,
+        0xeee66600, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00cc00ee,
+        0x00999800, 0x66666000, 0xc0000666, 0xcccccccc, 0xcccccccc, 0xeeee0ccc,
+        0x0ccccc0e, 0xdd009990, 0x0000000d, 0x0eeee000, 0xcccccccc, 0xcccccccc,
+        0xeee0cccc, 0x800ccc0e, 0xdddd0999, 0x0a9080dd, 0xeeeeeeee, 0xccccccc0,
+        0xcccccccc, 0x000ccccc, 0x98800cc0, 0xddddd099, 0x0a9080dd, 0xeeeeeeee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0x999880cc, 0xdddddd09, 0x0a9080dd,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0x0000cccc, 0x999980cc, 0xdddddd09,
+        0x099080dd, 0x0eeeeeee, 0xcccccccc, 0xcccccccc, 0xaaaa00cc, 0x899980c0,
+        0xddddddd0, 0xc09080dd, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xaaaaaa0c,
+        0x89980c0a, 0xddddddd0, 0xcc00000d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaaaa0, 0x898800aa, 0xddddddd0, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaaaaaaa, 0x888090aa, 0x0dddddd0, 0x00aaadaa, 0xc0000000,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0x000990aa, 0x0ddddddd, 0xa0aaddda,
+        0x000aaaaa, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0xc0990aaa, 0xa0dddd00,
+        0xaaadddda, 0x000addda, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0xc090aaaa,
+        0xa00000cc, 0xaaddddda, 0xc000addd, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa,
+        0xcc00aaaa, 0x00cccccc, 0xdaadddaa, 0xc0000add, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0xccc00000, 0x0ccccccc, 0xddaadaa0, 0xcc0000ad, 0xcccccccc,
+        0xa0cccccc, 0x00aaaaaa, 0xcccccccc, 0xcccccccc, 0xdddaaaa0, 0xcc00000a,
+        0xcccccccc, 0xa0cccccc, 0xcc00aaaa, 0xcccccccc, 0xcccccccc, 0xadaaaa00,
+        0xccc00000, 0xcccccccc, 0xa0cccccc, 0xcccc0aaa, 0xcccccccc, 0xcccccccc,
+        0x0aaaa00c, 0xcccc0000, 0xcccccccc, 0x0ccccccc, 0xccccc000, 0xcccccccc,
+        0xcccccccc, 0x00aa00cc, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0000ccc,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x608800cc, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0880880c, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x89098880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x80999898, 0xeee66608, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc, 0x00890000, 0x66666000,
+        0xc0000666, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x89909999,
+        0x00000008, 0x0eeee000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ccccc,
+        0x00009aaa, 0x0a900ee0, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xa90ccccc, 0xeeee099a, 0x0a0eeeee, 0xeeeeeeee, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0x900ccccc, 0xeeeee009, 0x0a0eeeee, 0xeeeeeeee, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeeee00, 0x090eeeee, 0x0eeeeeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc, 0xeeee0000, 0xc090eeee,
+        0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc, 0x00009999,
+        0xccc00000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc,
+        0xa0099999, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaa099988, 0xc0aaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa00ccccc, 0xa0888800, 0xc0aaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa00ccc, 0xa00000aa, 0xc0aaaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdaaaa0cc, 0x0aaaaaad, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdaaaaa0c, 0x0aaadddd,
+        0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddaaaaa0,
+        0xa0aaaddd, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaadaa0, 0xaa0aaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaddaa0, 0xaaa000aa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xddddaaa0, 0xaa000aaa, 0xcc0aaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddddaa0c, 0xaa0c0aad, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xdddaa0cc, 0xa0cc0aad,
+        0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x0cccc000, 0xccc00000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0000ccc, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0880880c,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x89099880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x80999998, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x80cccccc, 0x00990009, 0x66666000, 0xc0000666, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x80cccccc, 0x99909990, 0x00000088, 0x0eeee000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0x88009aa9, 0x0a980d08,
+        0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x900ccccc, 0x00ee09aa,
+        0x0a980d08, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x080ccccc,
+        0xeeeee099, 0x0a980000, 0xeeeeeeee, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0x8980cccc, 0xeeeeee00, 0x09900eee, 0x0eeeeeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x9980cccc, 0xeeee0099, 0xc00c0eee, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x9980cccc, 0xee008999, 0xcccc0eee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x9980cccc, 0x00088999, 0xcccc00ee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x880000cc, 0xdd088888,
+        0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000aa00c,
+        0xdd000000, 0xcccc00dd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00aaaa00, 0x00000aaa, 0xccc0a000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ddda0, 0x0000aaaa, 0xccc0aaa0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xddddddda, 0x0000addd, 0xccc00aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xdddddaad, 0xa0000add, 0xcccc00aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xddda00ad, 0xaa0000aa,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x0a00aadd,
+        0xaaa00000, 0xccc0000a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x000aaddd, 0xaaa0000c, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xcc00aadd, 0xaaa0000c, 0xc00aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xccc00aaa, 0x0000000c, 0xc0aaaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xccccc000, 0x000000cc, 0xc0000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0,
+        0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc,
+        0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee,
+        0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc,
+        0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0000ccc, 0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x608800cc, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0880880c, 0x6eeeee66, 0xccc6eee6,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x8909880c, 0xeeeee660,
+        0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80999880,
+        0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00899880, 0x66666000, 0xc0000666, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x99099988, 0x00000009, 0x0eeee000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xa9099909, 0xee000009, 0xeeeeee0e, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x90cccccc, 0x9a909088, 0xeeeeeee0, 0xeeeee0ee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0x980ccccc, 0x9a900899, 0xeeeeeee0,
+        0xeeeee0ee, 0xccccccc0, 0xcccccccc, 0x000ccccc, 0x990ccccc, 0x99908899,
+        0xeeeeeee0, 0x0eeee0ee, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x9980cc00,
+        0x00088999, 0xeeeeee00, 0xc000000e, 0xcccccccc, 0xcccccccc, 0x00000ccc,
+        0x9990c000, 0xdd089999, 0x000000dd, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xa00a00cc, 0x9980000a, 0xdd089999, 0xc000000d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0aa00c, 0x8809000a, 0xdd089999, 0xc000a000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xda0daa00, 0x00aa000a, 0x00009988, 0xc00aaa00,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xdaaddaa0, 0x9aaa00ad, 0x00cc0000,
+        0xc00aaaa0, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xda0dddaa, 0x09aa00ad,
+        0x00cccccc, 0x0000aaaa, 0xccccccc0, 0xcccccccc, 0x0ccccccc, 0xda0dddda,
+        0xc09a00ad, 0xa0cccccc, 0xaaaa0aaa, 0xccccc00a, 0xcccccccc, 0x0ccccccc,
+        0xd00addda, 0xcc0000dd, 0xa00ccccc, 0xaaaaa0aa, 0xcccc0aaa, 0xcccccccc,
+        0xcccccccc, 0x00000000, 0xcc000ddd, 0x000ccccc, 0xaaaaaaa0, 0xcccc0000,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xccc00000, 0x000ccccc, 0x00aaaaaa,
+        0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0x0000aaaa, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x000ccccc, 0x000000a0, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0x00000000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xcc000000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xc0cccccc, 0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa0cc, 0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee,
+        0xccc00e0d, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe00000cc,
+        0xffeeeeee, 0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6088080c, 0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x08808980, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x00089998, 0xeeeee600, 0xccc6ee6e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x90899998, 0xeee66099, 0xcccc6eee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc, 0x90899909, 0x6660009a,
+        0xc0000600, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc, 0xa9090089,
+        0x000ee09a, 0x0eeee0ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x980ccccc,
+        0xa9008899, 0xeeeeee0a, 0xeeee0eee, 0xccccccc0, 0xcccccccc, 0xcc0000cc,
+        0x9980cccc, 0x99088899, 0xeeeeee09, 0xeeee0eee, 0xccccccc0, 0xcccccccc,
+        0x0000000c, 0x9980ccc0, 0x00088999, 0xeeeee000, 0xeeee0eee, 0xccccccc0,
+        0xcccccccc, 0x000aa000, 0x99900000, 0xdd089999, 0xeee000dd, 0x0eeee0ee,
+        0xcccccccc, 0x0ccccccc, 0xaaaadaa0, 0x99800000, 0xdd089999, 0x0000090d,
+        0xc0000000, 0xcccccccc, 0x0ccccccc, 0xddaddda0, 0x880000ad, 0xdd089999,
+        0x0aaa0990, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xddaaddda, 0x00a90add,
+        0x00009988, 0xaaa00099, 0xccccccc0, 0xcccccccc, 0xa0cccccc, 0xdda0adda,
+        0xaaa90aad, 0x00cc0000, 0xaaaa0009, 0xccccccc0, 0xcccccccc, 0xa00ccccc,
+        0xdaa0addd, 0x999900ad, 0xccccccc0, 0xaaaa0000, 0xc000000a, 0xcccccccc,
+        0xa00ccccc, 0x0000addd, 0x00000000, 0xcccccccc, 0xaaaa000c, 0x00aaaaaa,
+        0xcccccccc, 0xa00ccccc, 0x00000ada, 0xcccc0000, 0xcccccccc, 0x00aa000c,
+        0x0000aaaa, 0xcccccccc, 0x000ccccc, 0xcccc0000, 0xcccccccc, 0xcccccccc,
+        0xa000000c, 0x00000aaa, 0xcccccccc, 0x00cccccc, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xa000000c, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa00000c, 0xcc00000a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa00000c, 0xccc00000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa00000cc, 0xcccc0000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000000cc,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc, 0x000000cc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa, 0xcc0aaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0x000aaaaa,
+        0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaaa0cc,
+        0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc6eead,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x60880ccc, 0xfeeeeee6,
+        0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x088080cc,
+        0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x8909880c, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0099980c, 0xeee66608, 0xcccc6eee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x99990880, 0x66666000, 0xc0000066, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x99990888, 0x00000009, 0x0e0eee00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x80cccccc, 0x99808898, 0x00099909,
+        0xe0eeeee0, 0xccccccc0, 0xcccccccc, 0xcc000000, 0x880ccccc, 0x98088999,
+        0xee09a908, 0xe0eeeeee, 0xccccccc0, 0x00cccccc, 0xc0000000, 0x9880cccc,
+        0x80888999, 0xee09a900, 0xe0eeeeee, 0xccccccc0, 0x0000cccc, 0x000aaada,
+        0x99800ccc, 0x08889999, 0xee09a900, 0x0e0eeeee, 0xcccccccc, 0xaa000ccc,
+        0x00addadd, 0x980990c0, 0x00899999, 0x00009009, 0xc0000000, 0xcccccccc,
+        0xddaa00cc, 0x0aaddaad, 0x880a9900, 0x90889999, 0xcc000099, 0xcccccccc,
+        0xcccccccc, 0xdddaa00c, 0xaadddaaa, 0x809aa00a, 0x99089998, 0xc00aa099,
+        0x000ccccc, 0xcccccc00, 0xadddaa00, 0xaddda00a, 0x809a90aa, 0x90088988,
+        0x0aaaaa09, 0xaaa00000, 0xccccc00a, 0xaaaaaa00, 0xdddaa000, 0x0c0900aa,
+        0x0c088880, 0xaaaaa000, 0xaaaaa00a, 0xccccc000, 0x00000000, 0xdda00000,
+        0xccc0000a, 0xcc00000c, 0xaaaaa00c, 0x0aaaaaaa, 0xccccc000, 0x000000cc,
+        0x000000cc, 0xcccc0000, 0xcccccccc, 0xaaaa000c, 0x00aaaaaa, 0xccccc000,
+        0xcccccccc, 0x000ccccc, 0xccccc000, 0xcccccccc, 0xaaa000cc, 0x000aaaaa,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0a000ccc,
+        0x000aaaaa, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000cccc, 0x0000aaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0x00000aa0, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0x00000a00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcc000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xccc0000c, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xc0cccccc,
+        0x000000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaa0c, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaa0, 0xccc00aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0xaaaaaaaa, 0xccc0aaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc, 0xaaaaaaaa,
+        0xcc0aaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa0cc,
+        0x000aaaaa, 0xcc0aaaa0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0aaaa0cc, 0xaa00a000, 0xcc0aaa0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe0aa0ccc, 0xfee000ee, 0xccc0aa0d, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe0a00ccc, 0xffeee0ee, 0xccc0a00d, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe000cccc, 0xffeeeeee, 0xccc00e0d,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe0cccccc, 0xffeeeeee,
+        0xccc6eead, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x600ccccc,
+        0xfeeeeee6, 0xccc6eeff, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0880000c, 0x6eeeee66, 0xccc6eee6, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x99880880, 0xeeeee660, 0xccc6ee6e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0x99809988, 0xeee66660, 0xcccc6eee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0x99909988, 0x66666660, 0xccccc666,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x900ccccc, 0x00009900, 0x00000660,
+        0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa990cccc, 0x0880909a,
+        0x090dd00d, 0x000000a0, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xaa90cccc,
+        0x088009aa, 0x090ddddd, 0xeeeee0a9, 0xccccc0ee, 0xcccccccc, 0xcccccccc,
+        0xa900cccc, 0x08880aaa, 0x090ddddd, 0xeeeee0a9, 0xccccc0ee, 0xcccccccc,
+        0xcccccccc, 0x00ee0ccc, 0xd08809a9, 0x090ddddd, 0xeeeee0a9, 0xccccc0ee,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0880990, 0x090ddddd, 0xeeeee0a9,
+        0xccccc0ee, 0xcccccccc, 0xcccccccc, 0x0eeee0cc, 0xd088800c, 0x0980dddd,
+        0xee000099, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xc0eee0cc, 0xd08880cc,
+        0x0980dddd, 0x00cccc00, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0x0eeeee0c,
+        0xdd08880c, 0x0980dddd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0eeeee0c, 0xdd088880, 0x0980dddd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeee0c, 0xddd08880, 0x8800dddd, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0eeee0cc, 0xdddd0000, 0x00dddddd, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0000ccc, 0xddd00aaa, 0xaa00dddd,
+        0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x000aadda,
+        0xdaaa0000, 0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc,
+        0xcc0adddd, 0xddaaa0cc, 0xccccc0ad, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaa0ccc, 0xcc0adddd, 0xddaaa0cc, 0xcccc0aad, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa0cc, 0xcc0adddd, 0xddaaaa0c, 0xccc00aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaaaaa00, 0xccc0adda, 0xaaaaaa0c, 0xc00aaaaa,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0xccc0aaaa, 0xaaaaaa0c,
+        0x0aaadddd, 0xccccccc0, 0xcccccccc, 0xaa00cccc, 0xaaddddaa, 0xccc0aaaa,
+        0xaaaaaa0c, 0xaaddddda, 0xcccccc0a, 0xcccccccc, 0xaaaa0ccc, 0xadddddda,
+        0xcccc0aaa, 0xaaaaaa0c, 0xaaaaaaaa, 0xccccc0aa, 0xcccccccc, 0xaaaaa0cc,
+        0xaaaaaaaa, 0xcccc0aaa, 0xaaaaa0cc, 0xaaaaaaaa, 0xccccc0aa, 0xcccccccc,
+        0x000000cc, 0x00000000, 0xcccc0000, 0x00000ccc, 0x00000000, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xccccc008, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x8088066e, 0xcc000899, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x99098066, 0xc0999088, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99908806, 0x09aaa908, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x66666666, 0x99880000, 0x009aaa90, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000, 0x99880d00, 0xee009a90,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xd09a0eee, 0x9880dddd,
+        0xeeee0990, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xd09a0eee,
+        0x980ddddd, 0xeee00008, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0xd09a0eee, 0x90dddddd, 0xeeeee098, 0xccccc0ee, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x09990eee, 0x80dddddd, 0xeeeeee09, 0xccccc0ee, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x0990c000, 0x0ddddddd, 0xeeeeeee0, 0xccccc0ee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x0ddddddd, 0xeeeeeee0,
+        0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0ddddddd,
+        0xeeeeee09, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x0ddddddd, 0x00eee080, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x0ddddddd, 0xcc000080, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xd0cccccc, 0x00000000, 0xc0000000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x000aaadd, 0x000aa000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x00aaaddd, 0x00aaaa00,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x00aaddda,
+        0xa00aa000, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000aa00, 0xaa0a0000, 0xcccc000a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaaa0aa0, 0xaaa00000, 0xccccc00a, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xadddddaa, 0xaaa0000a, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa00ccccc, 0xdddddddd, 0x00a0000a, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0x00000000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x00000000,
+        0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0xc000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x98088066,
+        0xcccc0088, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x99908806, 0xcc009089, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x66666666, 0x99990000, 0xc09aa908, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x00000000, 0x89980dd0, 0xc009aa90, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0xd09a0eee, 0x0990dddd, 0x0ee09aa9, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xd09a0eee, 0x0980dddd, 0xeeee09a9,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xd09a0eee, 0x890ddddd,
+        0xeeeee090, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x09990eee,
+        0x990ddddd, 0xeeeee008, 0xcccccc0e, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x0990c000, 0x980ddddd, 0xeeeeee09, 0xcccccc0e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0x90dddddd, 0xeeeeee09, 0xcccccc0e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x90dddddd, 0xeeeeee09, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x90dd0000, 0x0eeee009,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0000aaaa,
+        0xc0000009, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x0aadddd0, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaadddda0, 0x000a0000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaddddd00, 0x00aa000a, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xda00000c, 0x0aa000aa, 0xcccccc00,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0aaaa00, 0xaaa000aa,
+        0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xdddddda0,
+        0x0000000a, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xadddddda, 0x00aaa00a, 0xccccc000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaddddaa, 0x0aaaaa00, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0x0aaaaaa0, 0x00aaaaa0, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x00000000, 0xc0000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xccc000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xcc099000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x808066ee, 0xcc09a908, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x0898066e, 0xc000aa90, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x90998066, 0x0eee0a90, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99099806, 0xeeee0a90,
+        0xcccccc0e, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x66666666, 0x99909000,
+        0xeeee0908, 0xccccc0ee, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000,
+        0x99800dd0, 0xeee00088, 0xcccc0eee, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0xd09a0eee, 0x980ddddd, 0xee0cc089, 0xcccc0eee, 0xcccccccc, 0xcccccccc,
+        0xeeeee0cc, 0xd09a0eee, 0x980ddddd, 0xee0c0899, 0xcccc0eee, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0xd09a0eee, 0x80dddddd, 0xee008999, 0xcccc0eee,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xd0990eee, 0x80dddddd, 0xe0089999,
+        0xccccc0ee, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x0000c000, 0x80dddd00,
+        0x00899998, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa00cccc,
+        0x0dddd00a, 0xc0899998, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xdda0cccc, 0x0ddd000a, 0xcc088998, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xddd00ccc, 0x0dd000aa, 0xccc08898, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xdddaa000, 0x00000aad, 0xc0000088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xdddaaaaa, 0x90c00aad, 0x00000900,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xdaadddda, 0x0cc00aad,
+        0xaaaa0099, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0xaddddda0,
+        0x0cc00aaa, 0xaaaaa000, 0xccccc00a, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0xdddda000, 0x0cc0000a, 0xaaaaaaa0, 0xcccc00aa, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xdda00000, 0xccc000ad, 0xa000aa00, 0xccc0000a, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xa0000000, 0xcccc0aad, 0xaaaa0000, 0xccc000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c, 0x0ccc0aaa, 0xaaaaaa00,
+        0xccc000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0x0cccc000,
+        0xaaaaaaa0, 0xccc0000a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000ccccc,
+        0x0ccccc00, 0x00aaaa00, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000000, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xccc000cc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcc099000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xc0999908, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x0898066e, 0x000aa990, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x90998066, 0xeee0aa90, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99099806, 0xeeee0a90, 0xcccc00ee, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x66666666, 0x99909000, 0xeeee0908, 0xccc0eeee,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000, 0x89980dd0, 0xee000008,
+        0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x009a0eee, 0x9980dddd,
+        0xe0ccc088, 0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xd09a0eee,
+        0x980ddddd, 0x0ccc0899, 0xcc0eeeee, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0xd09a0eee, 0x90dddddd, 0x0ccc0899, 0xcc0eeeee, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0xd0990eee, 0x80dddddd, 0xccc08999, 0xccc0eee0, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0xd090c000, 0x0ddddddd, 0xc0089999, 0xcccc0000,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x0dddddd0, 0x09089999,
+        0xcc00aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaa0ccc, 0x0ddddd0a,
+        0x09908999, 0x00aaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xadda0ccc,
+        0xdddddd0a, 0xa0990880, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0x000ccccc,
+        0xdddda000, 0x000dd0aa, 0xaa09000c, 0xaaaaaaaa, 0xcccccc0a, 0xcccccccc,
+        0xaaa0cccc, 0xdddaaaaa, 0xccc000aa, 0xaaa0cccc, 0xaaaaaaaa, 0xcccccc0a,
+        0xcccccccc, 0xaa00cccc, 0xddaaaadd, 0xccccc0aa, 0xaa0ccccc, 0xaaaaaaaa,
+        0xccccc0aa, 0xcccccccc, 0xa00ccccc, 0xdaaaddda, 0xccccc0aa, 0xa0cccccc,
+        0xaaaaaaaa, 0xccccc0aa, 0xcccccccc, 0x000ccccc, 0xdaaddda0, 0xccccc0aa,
+        0x0ccccccc, 0xaaaaaaaa, 0xcccc0aaa, 0xcccccccc, 0x00cccccc, 0xdaadda00,
+        0xccccc0aa, 0xcccccccc, 0xaaaaaaa0, 0xcccc0aaa, 0xcccccccc, 0x0ccccccc,
+        0xaaada000, 0xcccccc0a, 0xcccccccc, 0xaaaaaa0c, 0xcccc0aaa, 0xcccccccc,
+        0xcccccccc, 0xaaaa0000, 0xcccccc0a, 0xcccccccc, 0xaaaaa0cc, 0xcccc0aaa,
+        0xcccccccc, 0xcccccccc, 0xaaa0000c, 0xccccccc0, 0xcccccccc, 0xaaaa0ccc,
+        0xcccc0aaa, 0xcccccccc, 0xcccccccc, 0xaa0000cc, 0xccccccc0, 0xcccccccc,
+        0xaaa0cccc, 0xccccc0aa, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0xc000eeee, 0xccc000cc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0x0800eeee, 0x00099900, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x998066ee, 0xee09aa90, 0xcccc000e,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x0998066e, 0xeee0aa90,
+        0xcc00eeee, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x80998066,
+        0xeee0aa90, 0xc0eeeeee, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x88099006, 0xe0009900, 0x0eeeeeee, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x66666666, 0x99900000, 0x0cc00008, 0x0eeeeee0, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x00000000, 0x900ddd00, 0xcccc0099, 0x0eeeee0c, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0x809a0eee, 0x0dddddd0, 0xcc008999, 0xc0eeee0c,
+        0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x809a0eee, 0xddddddd0, 0x00889990,
+        0xcc0000cc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x809a0eee, 0xddddddd0,
+        0x8899990d, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x80990eee,
+        0xddddddd0, 0x8999990d, 0xc0000cc0, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x8090c000, 0xddddddd0, 0x899980dd, 0x0aaaa0c0, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0x000ccccc, 0xdddddd00, 0x089980dd, 0xaaaaaa0c, 0xcccccc0a,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xddddd0aa, 0x088980dd, 0xaaaaaaa0,
+        0xccccc0aa, 0xcccccccc, 0x0000cccc, 0xaaa00000, 0xdddd0aad, 0x908880dd,
+        0xaaaaaaa0, 0xcccc0aaa, 0xcccccccc, 0xaa000ccc, 0xdaa0aaaa, 0xdddd0add,
+        0x99000ddd, 0xaaaaaaa0, 0xcccc0aaa, 0xcccccccc, 0xda000ccc, 0xddaaaadd,
+        0xddd0aadd, 0x0990c00d, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc, 0xa000cccc,
+        0xdddaaddd, 0x0000aadd, 0xa090ccc0, 0xaaaaaaaa, 0xccc0aaaa, 0xcccccccc,
+        0x0000cccc, 0xddaaddda, 0xccc00aad, 0xa00ccccc, 0xaaaaaaaa, 0xccc0aaaa,
+        0xcccccccc, 0x000ccccc, 0xdaaddda0, 0xcccc00aa, 0x00cccccc, 0xaaaaa000,
+        0xccc0aaaa, 0xcccccccc, 0x000ccccc, 0xaaddda00, 0xccccc0aa, 0xcccccccc,
+        0xaaa00ccc, 0xccc0aaaa, 0xcccccccc, 0x00cccccc, 0xaaada000, 0xccccc00a,
+        0xcccccccc, 0xa00ccccc, 0xccc0aaaa, 0xcccccccc, 0x0ccccccc, 0xaaaa0000,
+        0xcccccc00, 0xcccccccc, 0x0ccccccc, 0xccc0aaaa, 0xcccccccc, 0xcccccccc,
+        0x0aa00000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccc0000, 0xcccccccc,
+        0xcccccccc, 0x0000000c, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xc0000ccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcccccc08, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x89098066, 0xccccc088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99908806, 0xcccc0898,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x66666666, 0x09800000,
+        0xccc08000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000,
+        0x90998800, 0xccc00999, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0x009a0eee, 0x900000ee, 0xcc009aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeee0cc, 0xee0a0eee, 0x0eeeeeee, 0xcc09aa99, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0xee0a0eee, 0xeeeeeeee, 0xcc009900, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xee090eee, 0xeeeeeeee, 0xccc0000e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0xe090c000, 0x0eeeeeee,
+        0xcc089000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0x90000000, 0xcc089999, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0x9900aaaa, 0xccc08999, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaa0cccc, 0x990aaaaa, 0xccc00889, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaaa0cccc, 0x8880aaaa, 0xcc00a008, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc, 0x0000aaaa, 0x00aaaaa0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaa0aaa,
+        0xaaaaddaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xdaaa0aaa, 0xaaaadddd, 0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xaaa0aaaa, 0xaaaddddd, 0xccccc0aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaa0aaaaa, 0xdaaaaaaa, 0xccccc0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x00aaaaaa, 0xddaaaaa0, 0xccccc0aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x000aaaaa, 0xaddddaaa,
+        0xccccc0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0x0c0aaaaa,
+        0xadddddaa, 0xcccccc0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0x0cc0aaaa, 0xaaddddaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xcccc0000, 0xc0000000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x8088066e, 0xcccccc08, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x99098066, 0xccccc088, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99908806, 0xcccc0899, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x66666666, 0x09900000, 0xccc08900, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0x00000000, 0x90999880, 0xccc08099,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x089a0eee, 0x9008880d,
+        0xccc009aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0x089a0eee,
+        0x0ee0080d, 0xcc009aa9, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc,
+        0x089a0eee, 0xeeeee000, 0xcc080990, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x00990eee, 0xeeeeeeee, 0xc089800e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x0c00c000, 0x0eeeeeee, 0xc0899990, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x800eeeee, 0xc0899999,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x88000ee0,
+        0xc0899999, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x880dd000, 0x00088888, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0x000dddd0, 0xaa000000, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00000000, 0xaaa00aaa, 0xccccc00a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xa00000aa, 0xdd0aaaaa, 0xccccc0ad,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xa0000aaa, 0xdddddddd,
+        0xcccc0add, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0000aaa0,
+        0xddddddda, 0xcccc0daa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0x000aaaa0, 0x0adddaa0, 0xccc0ada0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0x00aaaa00, 0xa00a0000, 0xccc0adda, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0x00aaaaaa, 0xaa000c00, 0xccc0addd, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa00cccc, 0x00aaaaaa, 0xa00ccc00, 0xccc0adda,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaa0cccc, 0x000000aa, 0x00cccc00,
+        0xccc0aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00000000,
+        0xccccccc0, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa,
+        0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00,
+        0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc,
+        0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeffdae, 0x0000eeee, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xcccccc08,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x89098066,
+        0xcccccc08, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee,
+        0x99908806, 0xccccc088, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0x66666666, 0x99800000, 0xccccc088, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeee0ccc, 0x00000000, 0x99099900, 0xcccc0889, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeee0cc, 0x000eee0e, 0x9909a900, 0xcccc0909, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xeeeeeee0, 0x909a90ee, 0xccc09880,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeee0cc, 0xeeeeeee0, 0x009a90ee,
+        0xcc089998, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xeeeeeee0,
+        0x809990ee, 0xcc099998, 0xcc000ccc, 0xcccccccc, 0xcccccccc, 0x0000cccc,
+        0xeeeeee00, 0x8800000e, 0xc0899999, 0xc000000c, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x000000cc, 0x980dddd0, 0xc0999999, 0x00000000, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0000cccc, 0x980ddd00, 0x00899999, 0x0a00aa00,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xa000cccc, 0x980dd000, 0x09088999,
+        0xaa0aaa00, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xaa00cccc, 0x9000000a,
+        0x0aa00889, 0xad0ada00, 0xccccc00a, 0xcccccccc, 0xcccccccc, 0xaa00cccc,
+        0x0cc000aa, 0x0aaa9000, 0xddaadda0, 0xcccc00aa, 0xcccccccc, 0xcccccccc,
+        0xa00000cc, 0xccc00aaa, 0x0aa90ccc, 0xdd0adda0, 0xcccc0aad, 0xcccccccc,
+        0xcccccccc, 0x0aaaaa00, 0xccc0aaaa, 0x0a90cccc, 0xdd0adda0, 0xcccc0add,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaaa, 0xcc00aaa0, 0x000ccccc, 0xda00ddd0,
+        0xcccc0add, 0xcccccccc, 0x0ccccccc, 0xaaaaa000, 0xcc0000aa, 0x000ccccc,
+        0x00000ddd, 0xccccc000, 0xcccccccc, 0x0ccccccc, 0xaaa00000, 0xcc000aaa,
+        0x00cccccc, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0000000,
+        0xcc000aaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0000000c, 0xcc0000a0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00000ccc, 0xcc000000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x000ccccc, 0xccc00000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xaa0000aa, 0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaa0ccccc, 0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae,
+        0x0000eeee, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeefffe, 0x088066ee, 0xcccccc08, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeee66ee, 0x8088066e, 0xccccc089, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xe6cccccc, 0xeeeeee6e, 0x98000006, 0xcccc0899, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x99809990, 0xcccc0899,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000cccc, 0x00666006, 0x99809a90,
+        0xccc08909, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeee0ccc, 0xee000ee0,
+        0x0909aa90, 0xcc089980, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0eeee0cc,
+        0xeeeeeeee, 0x8009aa0e, 0xcc089998, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0eeee0cc, 0xeeeeeeee, 0x8809990e, 0xc0899998, 0x000ccccc, 0xccccccc0,
+        0xcccccccc, 0x0eeee0cc, 0xeeeeeeee, 0x88000000, 0xc0899999, 0x000000cc,
+        0xcccccc00, 0xcccccccc, 0xeeee0ccc, 0x00eeeee0, 0x980dddd0, 0x00999999,
+        0xaa000000, 0xccccc000, 0xcccccccc, 0x0000cccc, 0x00000000, 0x980ddd09,
+        0x00899999, 0xdaaaa000, 0xcccc00aa, 0xcccccccc, 0xcccccccc, 0x0aaa0ccc,
+        0x980dd099, 0x00088999, 0xddaddda0, 0xcccc00ad, 0xcccccccc, 0xcccccccc,
+        0x00aaa0cc, 0x90000990, 0x09a00889, 0xdaadddda, 0xccc00add, 0xcccccccc,
+        0xcccccccc, 0x0aaaa0cc, 0x0cc00900, 0x09aaa000, 0xa0adddaa, 0xccc0aadd,
+        0xcccccccc, 0x0000cccc, 0x0aaaaa00, 0xccccc000, 0x099990cc, 0xa0aadda0,
+        0xcc00addd, 0xcccccccc, 0xaaa00ccc, 0x0aaaaaaa, 0xcccccc00, 0x00000ccc,
+        0xa0000000, 0xcc00addd, 0xcccccccc, 0xa0000ccc, 0x0aa00aaa, 0xcccccc00,
+        0x0ccccccc, 0x00000000, 0xcc00aada, 0xcccccccc, 0x00000ccc, 0x0000aaaa,
+        0xcccccc00, 0xcccccccc, 0x0ccccccc, 0xcc000000, 0xcccccccc, 0x0000cccc,
+        0x0000aaa0, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xccc0000c, 0xcccccccc,
+        0x000ccccc, 0x000aaa00, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0x000aa000, 0xcccccc00, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x0ccccccc, 0x0000a000, 0xccccccc0, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000000, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcc000ccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc, 0xccc0ccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaaaaa000,
+        0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0ccccccc,
+        0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xa00aaa0a,
+        0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa0cccccc,
+        0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0xc000eeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe, 0x088066ee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeee66ee,
+        0x8088066e, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeeeee6e, 0x89098066, 0xcccccc08, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x6ccccccc, 0x66eeeeee, 0x99900806, 0xcccccc08, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0x66666660, 0x09999000, 0xccccc088, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xee0e0ccc, 0x0000000e, 0x09999900, 0xcccc0888,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeee0e0cc, 0x990000ee, 0x80899909,
+        0xccc08898, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeee0e0cc, 0xa90eeeee,
+        0x88089809, 0xcc088999, 0x000ccccc, 0xccccc000, 0xcccccccc, 0xeee0e0cc,
+        0xa90eeeee, 0x88808009, 0xc0889999, 0x0000cccc, 0xccc00000, 0xcccccccc,
+        0xee0e0ccc, 0xa90eeeee, 0x98880009, 0x00899999, 0xaa000ccc, 0xc0000ada,
+        0xcccccccc, 0x0000cccc, 0x90000000, 0x99800900, 0x99089999, 0xdda000c0,
+        0x000aadda, 0xcccccccc, 0xcccccccc, 0x000ccccc, 0x98809990, 0x9a088999,
+        0xddaa0009, 0x0aadddaa, 0xccccccc0, 0xcc00000c, 0xaa00cccc, 0x98099990,
+        0xaa908899, 0xdddaaa00, 0xaadddaaa, 0xcccccc00, 0x00aaaa00, 0xaaaa0000,
+        0x8800990a, 0x9a908889, 0xadddaaa0, 0xadddaa00, 0xccccc00a, 0xaaaaa000,
+        0xaaaaaa00, 0x880c0000, 0x090c0088, 0xaadddaa0, 0xaaaaa000, 0xccccc00a,
+        0xaaaa0000, 0xaaaaaaaa, 0x000ccc00, 0x00cccc00, 0x00adda00, 0x00000000,
+        0xccccc000, 0xaaa00000, 0x0aaaaaaa, 0xcccccc00, 0x0ccccccc, 0x00000000,
+        0x00000cc0, 0xccccccc0, 0xaa00000c, 0x00aaaaaa, 0xccccccc0, 0xcccccccc,
+        0xcc000000, 0xcccccccc, 0xcccccccc, 0xaa00000c, 0x000a0aaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xa00000cc, 0xc0000aaa,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000000cc,
+        0xcc0000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x00000ccc, 0xccc0000a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x0000cccc, 0xcccc0000, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x000ccccc, 0xccccc000, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00cccccc, 0xcccccc00, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x00000ccc,
+        0xccc0ccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaaa000, 0xccc00c0a, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaaaaaa0, 0xc00000aa, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaaaaaa, 0x0aaaa0aa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xa0cccccc, 0xaaaaaaaa, 0x0aaaaaaa, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaaaaaaaa, 0xaaaaaaaa,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc, 0xaa0000aa,
+        0xaaaaaaaa, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xaa0ccccc,
+        0xa00aaa0a, 0xaaaa0000, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xa0cccccc, 0x00eefd0a, 0x0aa0eee0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xa0cccccc, 0xeeeffd00, 0x00a0eee0, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0x00cccccc, 0xeeeffd0e, 0xc000eeee, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeffdae, 0xccc0eeee,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc, 0xeeeefffe,
+        0xcc0066ee, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xe6cccccc,
+        0xeeee66ee, 0x0088066e, 0xcccccc00, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xe6cccccc, 0xeeeeee6e, 0x08899066, 0xccccc088, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x6ccccccc, 0x66eeeeee, 0x90899066, 0xcccc0889, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x66666666, 0x90999066, 0xccc00889,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c, 0x90000066,
+        0xcc009009, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0000000c, 0xdd0900a0,
+        0x90880d00, 0xc099aa90, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xeeeeeee0,
+        0xdd0909a0, 0x00880ddd, 0xc09aaaa9, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xeeeeeee0, 0xdd0909a0, 0x08880ddd, 0xc009aaaa, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xeeeeeee0, 0xdd0909a0, 0x0880dddd, 0x0ee009a9, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xeeeeeee0, 0xdd0909a0, 0x0880dddd, 0x0eeee099,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0x000eee0c, 0xd0890990, 0x8880dddd,
+        0xeeee0c00, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xccc000cc, 0xd089000c,
+        0x8880dddd, 0xeee0ccc0, 0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xd0890ccc, 0x880ddddd, 0xeeee0c08, 0xcccccc0e, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0xd0890ccc, 0x880ddddd, 0xeeee0088, 0xcccccc0e, 0xcccccccc,
+        0xcccccccc, 0xcccccccc, 0xd00880cc, 0x80dddddd, 0xeeeee088, 0xcccccc0e,
+        0xcccccccc, 0xcccccccc, 0xcccccccc, 0xddd0000c, 0x0ddddddd, 0xeeee0000,
+        0xccccccc0, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xd00aaa0c, 0x00dddddd,
+        0x0000aaaa, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0x0aaadaa0,
+        0xaa000000, 0xcc0aaadd, 0xcccccccc, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0xaaaddda0, 0xda0cccc0, 0xc0aaaddd, 0xcccccccc, 0xcccccccc, 0xcccccccc,
+        0x0ccccccc, 0xaaadddaa, 0xda0cccc0, 0x0aaaaddd, 0xcccccccc, 0xcccccccc,
+        0xcccccccc, 0x00cccccc, 0xaaaddaaa, 0xda0ccc0a, 0xaaaaaddd, 0xccccccc0,
+        0xcccccccc, 0xcccccccc, 0xaa00cccc, 0xaaaaaaaa, 0xa0cccc0a, 0xaaaaaadd,
+        0xccccc00a, 0xcccccccc, 0xcccccccc, 0xdaaa00cc, 0xaaaaaddd, 0xa0cccc0a,
+        0xaaaaaaaa, 0xccc00aaa, 0xcccccccc, 0xcccccccc, 0xdddaaa0c, 0xaaaaaadd,
+        0xa0cccc0a, 0xdddaaaaa, 0xc00aaaad, 0xcccccccc, 0xcccccccc, 0xaaaaaaa0,
+        0xaaaaaaaa, 0x0ccccc0a, 0xddddaaaa, 0x0aaaaadd, 0xcccccccc, 0xcccccccc,
+        0xaaaaaaa0, 0xaaaaaaaa, 0x0cccccc0, 0xaaaaaaaa, 0xaaaaaaaa, 0xccccccc0,
+        0xcccccccc, 0x0000000c, 0x00000000, 0x0ccccccc, 0x00000000, 0x00000000,
+        0xccccccc0, 0xcccccccc,
+};
+
+#endif  // LOSERBOY_PACKED_H
@@ -0,0 +1,185 @@
+/* File generated automatically by sprite_packer.py from tiles.h */
+#ifndef TILES_PACKED_H
+#define TILES_PACKED_H
+
+#define img_tiles_packed_width 64
+#define img_tiles_packed_height 64
+#define img_tiles_packed_stride 8
+#define img_tiles_packed_num_spr 2
+
+const unsigned int img_tiles_packed_data[]
+    __not_in_flash("img_tiles_packed_data") __attribute__((aligned(4))) = {
+        0x05500000, 0x00550550, 0x50100000, 0x00005551, 0x05000000, 0x00550100,
+        0x00000500, 0x00000000, 0xaaaa5000, 0x05aa5aaa, 0xaaa50000, 0x00055aaa,
+        0xaaa55500, 0x00aa15aa, 0xaaaaaaa5, 0x000aaaaa, 0x55665005, 0x55aaaaaa,
+        0x5aaa5000, 0x15aa5aa5, 0xa5aaaa00, 0x55a515aa, 0x55aa6aaa, 0x055a6655,
+        0x00aa5055, 0xa5a65500, 0x05aaa500, 0x0aaa5550, 0x00566a00, 0x55a555a5,
+        0x0055aa55, 0xa55a6a00, 0x00550155, 0x05a65500, 0x5aaaa500, 0x0aa05510,
+        0x005aa500, 0x55555a51, 0x0055aa55, 0x555aa500, 0x45000555, 0x055a5555,
+        0xaaa50000, 0x05405555, 0x55550000, 0x00555a55, 0x555a5a50, 0x00005555,
+        0x54000500, 0x04554555, 0x55510000, 0x00005055, 0x55000000, 0x00540545,
+        0x55551550, 0x00000005, 0x00000000, 0x00000000, 0x00000000, 0x00050000,
+        0x00000000, 0x00050000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x01115000, 0x00000000, 0x00000000, 0x55000500, 0x00000000,
+        0x00050000, 0x54000000, 0x00555150, 0x55555000, 0x05015000, 0x00005500,
+        0x55051aaa, 0x5a55a000, 0x05aaaaaa, 0xaa550000, 0x05aaaaaa, 0x05150000,
+        0x0a01a000, 0xaaaaa550, 0x5155aaa5, 0xaa5a6500, 0x0aaaaaaa, 0xaa6aa000,
+        0x1555aaaa, 0x00000000, 0x05505000, 0xaaa6a000, 0x51555a55, 0x555aa500,
+        0x55aaaa55, 0x55aa6500, 0x5000aaa5, 0x01110500, 0x05505510, 0xaaa65000,
+        0x55555555, 0x5a55a000, 0x5a555515, 0x55a55500, 0x0005a555, 0x55555500,
+        0x0555aa54, 0xaaaa5000, 0x55555555, 0xa5105000, 0x5a55a555, 0x55150000,
+        0x05555555, 0x55555500, 0x0555555a, 0x555a5000, 0x05555555, 0x55000000,
+        0x04555155, 0x00000000, 0x05510555, 0x55500000, 0x05555555, 0x55505500,
+        0x00000111, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00015000, 0x00000000, 0x00000000,
+        0x55a50000, 0x00055aa5, 0x55a50000, 0x40055a55, 0x5a504000, 0x005a5555,
+        0x55555a50, 0x00011155, 0xaaaa5000, 0x05aaaaaa, 0xaa6a0000, 0x555aaaaa,
+        0xa6a5a550, 0x00aa15aa, 0xaaaaa6a0, 0x005aaaaa, 0xaaa6a505, 0x556aaaaa,
+        0x5a6aa500, 0x55aaaaa5, 0xaaaa6a50, 0x00aa55aa, 0x5aaaa6a1, 0x005a6aa5,
+        0xaaaa5555, 0xa5aaaaaa, 0x5a66a500, 0x0a6a5555, 0x00566a00, 0x00555555,
+        0x0055aa51, 0x005aaa10, 0x55555555, 0x455aaaaa, 0xaa6a5000, 0x0aa00555,
+        0x005aa500, 0x00105a55, 0x0055a550, 0x000a5550, 0x15555554, 0x00555555,
+        0xaaa50000, 0x04005555, 0x55510000, 0x00500a55, 0x55555550, 0x00555555,
+        0x44000500, 0x00000051, 0x55000000, 0x00005155, 0x55000000, 0x00500015,
+        0x55000500, 0x00051155, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xaa000a55, 0x00150000,
+        0x00000000, 0xaa000000, 0x0555a5aa, 0x05555400, 0x00001000, 0x0555aa50,
+        0xa55556aa, 0x00055000, 0x00555551, 0xa6500000, 0x05aa6a6a, 0x55aa5a00,
+        0x000555a5, 0xaaaaaaa5, 0x555aa6a5, 0x00155000, 0x01555551, 0xaa100000,
+        0x055a666a, 0x55aa5a50, 0x005aaaa5, 0xaaaaaaa1, 0x5055aa40, 0x05555000,
+        0x05551100, 0x55001500, 0x0004aaa5, 0xaaaa5aa0, 0x0055aaaa, 0x55aaaaa1,
+        0x0055a550, 0x55100000, 0x11101100, 0x50001500, 0x0005aa55, 0xaaaa5550,
+        0x005aaaaa, 0x55aaaa50, 0x005a5aa5, 0x55000000, 0x00001101, 0x00000000,
+        0x055aaa55, 0x5aa51000, 0x000555aa, 0xaaaaaa50, 0x00555555, 0x00000000,
+        0x00000000, 0x00000000, 0x00010050, 0x05400000, 0x00000055, 0x00155550,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000500,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x10505500, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x55550000, 0x05a555a5, 0x55a50000, 0x50a5aa55,
+        0x5a555000, 0x0055555a, 0x5555a510, 0x00055555, 0xaaaa5000, 0x05aaaaaa,
+        0xaaaa1000, 0x55aaaaaa, 0xaaaaa550, 0x0000055a, 0xa5aaaa50, 0x005aaaaa,
+        0x54aa5005, 0x15aa5aa5, 0x556a5500, 0x5aaaaaa5, 0x55aa6a50, 0x00500001,
+        0x55a5aa50, 0x015aaa55, 0x00550005, 0x505a5500, 0xaa6aa500, 0x1aa55555,
+        0x015aa500, 0x00510000, 0x55555500, 0x555aa505, 0x00500055, 0x005a5100,
+        0xa5aa5000, 0x05500055, 0x00055000, 0x00005500, 0xa5545500, 0x0055555a,
+        0x55500050, 0x00450155, 0x55550000, 0x00000515, 0x00000000, 0x00000555,
+        0x55501000, 0x00115555, 0x50000000, 0x00000015, 0x00000000, 0x00000101,
+        0x50000000, 0x00000005, 0x51000000, 0x00000005, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x54000000,
+        0x00000000, 0x50000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000,
+        0x00001501, 0x55554000, 0x00555555, 0x55000000, 0x00151555, 0x55005000,
+        0x00000010, 0x00145500, 0x55501555, 0x055aa000, 0x00555555, 0x5a500000,
+        0x05555555, 0x51155000, 0x05155555, 0x0555a550, 0xa55556aa, 0x100aa000,
+        0x05aaaaa5, 0xaa504000, 0x0aaaaaaa, 0x50000500, 0x05555555, 0xaaaaaa50,
+        0x55555aa5, 0xa55aa500, 0x55aa55aa, 0x5aaaa000, 0x055aaaaa, 0x05000500,
+        0x01001550, 0x55aaaa50, 0x5555aaa5, 0xaaaaa000, 0x0555555a, 0x5055a500,
+        0x01aaaaaa, 0x55100500, 0x04005000, 0x00055550, 0x55555555, 0x5a550000,
+        0x55055555, 0x50005500, 0x005aaaaa, 0x55555500, 0x05555005, 0x00055550,
+        0x45555550, 0x55000000, 0x01051010, 0x50000000, 0x055aaaaa, 0x55551000,
+        0x00010001, 0x05551000, 0x00500055, 0x00000000, 0x00000000, 0x00000000,
+        0x01550555, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x05500000, 0x01550550, 0x51100000, 0x21115551,
+        0x16112222, 0x00551111, 0x00000510, 0x00000000, 0xaaaa5000, 0x056a5aaa,
+        0x66650000, 0x22266666, 0x66666622, 0x01aa1566, 0xaaaaa6a5, 0x000aaaaa,
+        0x55665005, 0x556aaaaa, 0x56665100, 0x26666665, 0x66666e33, 0x55651566,
+        0x55aa66aa, 0x055a6655, 0x00aa5055, 0xa5a65500, 0x15666500, 0x3e666661,
+        0x2266ee33, 0x55a55666, 0x00556a55, 0xa55a6a00, 0x00550155, 0x15a65500,
+        0x6666a500, 0x3e626622, 0x2266e733, 0x55556662, 0x0055aa55, 0x555aa500,
+        0x45000555, 0x055a5555, 0x66661110, 0x37726666, 0x66663337, 0x11566666,
+        0x555a5a51, 0x00005555, 0x54000500, 0x05554555, 0x66611110, 0x33336266,
+        0x66223337, 0x11562666, 0x55551551, 0x00000005, 0x00000000, 0x00100000,
+        0x22111111, 0x33372222, 0x22233337, 0x11162222, 0x00001111, 0x00000000,
+        0x00000000, 0x10000000, 0x22211111, 0x73333222, 0x22333337, 0x11122222,
+        0x00000011, 0x00000000, 0x00000000, 0x11000000, 0x22211111, 0xb3333322,
+        0x23333337, 0x11222222, 0x00000001, 0x00000000, 0x00000000, 0x11000000,
+        0x22221111, 0xb7333332, 0x33333337, 0x12226222, 0x00000111, 0x00000000,
+        0x55000500, 0x11011000, 0x22262211, 0xf7333333, 0x33777377, 0x66666223,
+        0x05115111, 0x00005500, 0x55051aaa, 0x6655a000, 0x37e66666, 0xfe773333,
+        0x37eeeeeb, 0x26262333, 0x0a116111, 0xaaaaa550, 0x5155aaa5, 0x66566500,
+        0x3eee6666, 0xfeeee333, 0x3777eeeb, 0x22222333, 0x05515111, 0xaaa6a000,
+        0x51555a55, 0x66666501, 0x77ee6666, 0xf7e7e733, 0x7333eeeb, 0x22223733,
+        0x05516622, 0xaaa65000, 0x55555555, 0x6665a000, 0x7e776626, 0xf7e77733,
+        0x3337e77b, 0x66677733, 0x05556666, 0xaaaa5000, 0x55555555, 0x66115000,
+        0x37776666, 0xfb773333, 0x3777777b, 0x66677733, 0x05555666, 0x555a5000,
+        0x05555555, 0x66111000, 0x37772266, 0xfb777333, 0x377777bf, 0x66633333,
+        0x05555666, 0x55505500, 0x00000111, 0x21111000, 0x33332222, 0xfbb77333,
+        0x333777bf, 0x22233333, 0x01011122, 0x00000500, 0x00000000, 0x11111000,
+        0x33332222, 0xffb77733, 0x33777bbf, 0x22233333, 0x00001112, 0x00000000,
+        0x00000000, 0x11111100, 0x33332222, 0xffb77733, 0x33777bbf, 0x22237333,
+        0x00011112, 0x00000000, 0x55a50000, 0x21155a55, 0x77772222, 0xffbbee77,
+        0x7e77bbbf, 0x227e7777, 0x55555622, 0x00011155, 0xaaaa5000, 0x22665aaa,
+        0xeee73222, 0xffbbbeee, 0xeeebbbbf, 0x22e777ee, 0xaa666662, 0x005aaaaa,
+        0xaaaa5505, 0x2666555a, 0x77ee7222, 0xffbbbee7, 0xeeebbbff, 0x227777ee,
+        0x5a566662, 0x005a6a55, 0xaaaa5555, 0x62665555, 0x77ee7622, 0xffbbb777,
+        0x77bbbfff, 0x22777777, 0x01156662, 0x005aaa10, 0x55555555, 0x22665555,
+        0x7ee77222, 0xffbbbb77, 0x77bbffff, 0x22677777, 0x11556622, 0x000a5510,
+        0x11555550, 0x21111155, 0xee772222, 0xfffbbb77, 0x7ebbffff, 0x22637777,
+        0x55551622, 0x00055555, 0x00000500, 0x11111111, 0x77772222, 0xfffbbbb7,
+        0x7bbbffff, 0x22677777, 0x11111122, 0x00051011, 0x00000000, 0x11111001,
+        0x77772222, 0xfffbbbb7, 0xbbbbbfff, 0x22677777, 0x01111112, 0x00000000,
+        0x00000000, 0x11110000, 0x77776222, 0xfffbbbbb, 0xbbbbbfff, 0x226777bb,
+        0x00011112, 0x00000000, 0x00000000, 0x21110000, 0xb7777222, 0xfffbbbbb,
+        0xbbbbbfff, 0x22777bbb, 0x00011112, 0x00000000, 0x00000000, 0x11110000,
+        0xb7777222, 0xffbbbbbb, 0xbbbbbbbb, 0x22677bbb, 0x00111111, 0x00000000,
+        0x11000a05, 0x11111000, 0xb7777222, 0xffffbbbb, 0xbbbfffff, 0x2267bbbb,
+        0x00111111, 0x05555510, 0x555156a5, 0x11011000, 0x77762221, 0xbbbb7777,
+        0x77bbbbbb, 0x12267777, 0x00111111, 0xaa555551, 0x10155a55, 0x11011000,
+        0x77222211, 0x77777777, 0x77777777, 0x112227be, 0x00111111, 0x555a5551,
+        0x00055500, 0x10000000, 0x32222211, 0x77eeee77, 0x77777777, 0x112222be,
+        0x00111111, 0x55555550, 0x00015540, 0x10000000, 0x22222111, 0xee77e777,
+        0x33333773, 0x1111227e, 0x00111011, 0x55555510, 0x00051555, 0x10000000,
+        0x22111111, 0x737ee362, 0x72ee7373, 0x0111126b, 0x00000000, 0x55555510,
+        0x00000555, 0x10000000, 0x11111111, 0x3e27bb62, 0x26622777, 0x00111126,
+        0x00000000, 0x00001100, 0x00000000, 0x00000000, 0x11111111, 0x226e2e62,
+        0x2226622e, 0x00011116, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x11111000, 0xee62e261, 0x66122eeb, 0x00000112, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x11010000, 0xbbe62121, 0x62226bbb, 0x00010011,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0xe2e6e121,
+        0x666266ee, 0x00000011, 0x00000000, 0x00000000, 0x00500000, 0x00000000,
+        0x01000000, 0x111ee210, 0x1b611111, 0x00000001, 0x00000000, 0x00000010,
+        0x01551000, 0x00000000, 0x00000000, 0x61161110, 0x11b61116, 0x00000000,
+        0x00000000, 0x00055511, 0x00550005, 0x00000000, 0x00000000, 0x66611000,
+        0x001bb666, 0x00000000, 0x00000000, 0x00555500, 0x00150005, 0x00000000,
+        0x00000000, 0x11111000, 0x00006510, 0x00000000, 0x00000000, 0x10555100,
+        0x00100045, 0x00000000, 0x00000000, 0x15600000, 0x00001101, 0x00000010,
+        0x00000000, 0x00555500, 0x00000050, 0x00000000, 0x00000000, 0x10000000,
+        0x00000156, 0x00000055, 0x00000000, 0x00100100, 0x00000000, 0x00000000,
+        0x00000000, 0x11111000, 0xa0001115, 0x00000056, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x1115a500, 0x6a151011, 0x0000000a,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000500, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00105000, 0x51001555, 0x00051000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01555500,
+        0x555056a5, 0x00055000, 0x00111100, 0x11100000, 0x00111110, 0x00000000,
+        0x00000000, 0x5a5aaa50, 0x55555aa5, 0x1005a000, 0x00000015, 0x01551000,
+        0x00001051, 0x00000000, 0x00000000, 0x555aa510, 0x05555aa5, 0x55555000,
+        0x00000011, 0x00005000, 0x00555555, 0x00000000, 0x00000000, 0x00055510,
+        0x05555555, 0x55500000, 0x00055555, 0x00000000, 0x00155555, 0x00000000,
+        0x05550000, 0x00055550, 0x05515150, 0x00000000, 0x00000000, 0x00000000,
+        0x00011101, 0x00000000, 0x00000000, 0x05551000, 0x00400055, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+#endif  // TILES_PACKED_H
@@ -23,8 +23,15 @@
 #include "reset.h"
 #include "romemul.h"
 #include "select.h"
+#include "vga/background.h"
+#include "vga/bench.h"
+#include "vga/compose.h"
+#include "vga/dirty.h"
+#include "vga/displaylist.h"
 #include "vga/draw.h"
 #include "vga/font.h"
+#include "vga/surface.h"
+#include "vga/tilemap.h"
 #include "vga/vga.h"
 
 #define NUM_SPRITES 127              // number of sprites to draw
@@ -128,13 +135,25 @@ struct CHARACTER {
 
 #define loserboy_stand_frame 10
 #define loserboy_mirror_frame_start 11
+#define loserboy_bank_frames (2 * loserboy_mirror_frame_start)
 #define loserboy_walk_frame_delay 4
 static const unsigned int loserboy_walk_cycle[] = {
     5, 6, 7, 8, 9, 8, 7, 6, 5, 0, 1, 2, 3, 4, 3, 2, 1, 0,
 };
-static const unsigned char bg_map[20] = {
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+// Background tilemap: the wall tile, and torches that flicker between the
+// torch tile and its mirror image. It wraps around as the camera drifts.
+#define BG_MAP_COLUMNS 5
+#define BG_MAP_ROWS 3
+#define BG_TORCH (TILEMAP_CELL_ANIM | 0)
+#define BG_TORCH_FRAME_TICKS 6
+#define BG_SCROLL_X_FRAMES 1  // frames per pixel of camera movement
+#define BG_SCROLL_Y_FRAMES 3
+static const uint16_t bg_map[BG_MAP_COLUMNS * BG_MAP_ROWS] = {
+    0, 0,        0,        0,        0,  //
+    0, 0,        BG_TORCH, 0,        0,  //
+    0, BG_TORCH, 0,        BG_TORCH, 0,
 };
+static const uint16_t bg_torch_frames[] = {1, 1 | TILEMAP_CELL_FLIP_X};
 
 static const char *loserboy_messages[] = {
     "I'll get you!",     "Come back here!", "Ayeeeee!",
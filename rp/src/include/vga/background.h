@@ -0,0 +1,32 @@
+#ifndef VGA_BACKGROUND_H_FILE
+#define VGA_BACKGROUND_H_FILE
+
+#include "draw.h"
+
+/* Pristine background snapshot: the drawable rows of a framebuffer, planar,
+ * kept in RAM and copied back into the hidden framebuffer by DMA. Starting
+ * the copy and waiting for it are separate calls so the CPU can do other
+ * work, such as moving the characters, while the copy runs.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Allocate the snapshot (about 30 KB in 320x200) and claim its DMA channel.
+ * Returns 0, or VGA_ERROR_ALLOC when either is not available. */
+int background_init(void);
+
+/* Copy the drawable rows of the hidden framebuffer into the snapshot */
+void background_capture(void);
+
+/* Start copying the snapshot into the hidden framebuffer. Nothing may draw
+ * in it until background_restore_wait returns. */
+void __not_in_flash_func(background_restore_start)(void);
+void __not_in_flash_func(background_restore_wait)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_BACKGROUND_H_FILE
@@ -0,0 +1,95 @@
+#ifndef VGA_BENCH_H_FILE
+#define VGA_BENCH_H_FILE
+
+#include "compose.h"
+#include "draw.h"
+
+/* Rendering benchmarks. They draw into the hidden framebuffer and print the
+ * timings with DPRINTF, so they only report something in debug builds.
+ * emul.c runs them at start when VGA_ENABLE_BENCHMARKS is set.
+ */
+
+/* Number of positions each format is drawn at */
+#define BENCH_DRAWS 512
+/* Number of full screens of tiles drawn per format */
+#define BENCH_TILE_SCREENS 16
+/* Number of frames drawn per sprite count and compositing mode */
+#define BENCH_COMPOSE_FRAMES 8
+/* Number of full screens per blitter operation */
+#define BENCH_BLITTER_SCREENS 16
+/* Quads along each edge of the benchmark cube, and frames drawn per
+ * distance */
+#define BENCH_MESH_DIVISIONS 4
+#define BENCH_MESH_FRAMES 32
+/* Frames drawn per sprite count, planar and chunky */
+#define BENCH_CHUNKY_FRAMES 8
+/* Frames drawn per effect */
+#define BENCH_EFFECT_FRAMES 16
+/* Rotations and scales the affine draws cycle through */
+#define BENCH_AFFINE_POSES 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Time every storage format available for `spr` drawing it transparent over
+ * the same spread of positions, clipped ones included: its own format
+ * (packed or chunky), then planar, spans and compiled. A packed sprite is
+ * also timed against an RGB6 copy, as in bench_tile_formats. The RGB6 copy
+ * and the span data are built for the run and freed after.
+ */
+void bench_sprite_formats(const struct SPRITE *spr);
+
+/* Time full screens of draw_tile with `tile`: its planar copy when it has
+ * one, then its own format. A packed tile is also timed against an RGB6
+ * copy built for the run, which takes the chunky blitter (four rgb2index
+ * and four mask lookups per 32-bit word).
+ */
+void bench_tile_formats(const struct SPRITE *tile);
+
+/* Time frames of growing piles of `spr` around the screen centre, drawn
+ * directly and then through each compositor mode. Needs compose_init; the
+ * compositor is left in the bins mode. The frames are left in the drawable
+ * rows of the hidden framebuffer for the next frame to redraw.
+ */
+void bench_compose_modes(const struct SPRITE *spr);
+
+/* Time full screens of software blitter operations, one plane at a time as
+ * ST code does, against memset of the same rows: a halftone fill, an XOR
+ * over the screen, and a shifted copy and OR from the visible framebuffer.
+ */
+void bench_blitter_ops(void);
+
+/* Draw BENCH_MESH_FRAMES frames of a spinning cube, each side split in
+ * BENCH_MESH_DIVISIONS x BENCH_MESH_DIVISIONS quads, at three distances, and
+ * report the faces drawn per frame and how many fit in a 50 fps frame. The
+ * mesh is built for the run and freed after.
+ */
+void bench_mesh(void);
+
+/* Time frames of a cleared screen with growing piles of `spr`, doubling from
+ * one sprite, drawn planar and then into a chunky frame converted to planar,
+ * and report the first count where the chunky frame is faster. The chunky
+ * frame is allocated for the run and freed after.
+ */
+void bench_chunky_frames(const struct SPRITE *spr);
+
+/* Time BENCH_EFFECT_FRAMES frames of each effect of vga/effects.h, drawn into
+ * a chunky frame over the drawable rows and converted to planar, and report
+ * the time per frame against the 20 ms of a 50 fps frame. `tile` textures
+ * the rotozoom and the tunnel. Everything is allocated for the run and freed
+ * after.
+ */
+void bench_effects(const struct SPRITE *tile);
+
+/* Time draw_sprite_affine with `spr` over BENCH_DRAWS rotations and scales
+ * from 0.5 to 2, clipped positions included: decoded from the sprite data,
+ * then stepped through a byte copy built for the run and freed after.
+ */
+void bench_sprite_affine(const struct SPRITE *spr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_BENCH_H_FILE
@@ -0,0 +1,108 @@
+#ifndef VGA_BLITTER_H_FILE
+#define VGA_BLITTER_H_FILE
+
+#include "draw.h"
+
+/* Software BLiTTER: the STE blitter ($FF8A00, see target/atarist/src/main.s)
+ * over 16-bit words in RP memory, framebuffers and surfaces included. The
+ * registers are a struct with the same fields and meaning, so ST code that
+ * programs the blitter ports over field by field:
+ *
+ * - the increments are in bytes and signed, as on the ST. In an interleaved
+ *   planar buffer one plane is x_inc 8, and the Y increments are added in
+ *   place of the X increments after the last word of each line;
+ * - the source is read through a 32-bit buffer and shifted right by the
+ *   skew. FXSR reads one extra word at the start of each line and NFSR
+ *   skips the read of the last one. A negative source X increment shifts
+ *   the buffer the other way, for right-to-left blits;
+ * - HOP combines the source with the halftone line, ctrl bits 0-3, which
+ *   moves by one every line in the direction of dst_y_inc. With smudge the
+ *   line is picked by the low 4 bits of each skewed source word instead;
+ * - OP is any of the 16 logic functions of source and destination, written
+ *   through endmask[0] on the first word of each line, endmask[2] on the
+ *   last and endmask[1] in between. A line of one word uses endmask[0].
+ *
+ * blitter_run works synchronously, like HOG mode, and leaves the registers
+ * where the hardware would: addresses past the last line, y_count 0 and the
+ * halftone line moved on. Each logic op has its own instance, with the
+ * halftone-only HOPs split from the ones reading the source, so the middle
+ * words of a line take one load and one store when their mask is full.
+ */
+
+/* HOP: what is combined with the destination */
+enum BLITTER_HOP {
+  BLITTER_HOP_ONES = 0,
+  BLITTER_HOP_HALFTONE = 1,
+  BLITTER_HOP_SOURCE = 2,
+  BLITTER_HOP_SOURCE_AND_HALFTONE = 3,
+};
+
+/* OP: result from source S and destination D */
+enum BLITTER_OP {
+  BLITTER_OP_ZERO = 0,
+  BLITTER_OP_AND = 1,          /* S AND D */
+  BLITTER_OP_AND_NOT_DEST = 2, /* S AND NOT D */
+  BLITTER_OP_SOURCE = 3,
+  BLITTER_OP_AND_NOT_SOURCE = 4, /* NOT S AND D */
+  BLITTER_OP_DEST = 5,
+  BLITTER_OP_XOR = 6,
+  BLITTER_OP_OR = 7,
+  BLITTER_OP_NOR = 8,
+  BLITTER_OP_XNOR = 9,
+  BLITTER_OP_NOT_DEST = 10,
+  BLITTER_OP_OR_NOT_DEST = 11, /* S OR NOT D */
+  BLITTER_OP_NOT_SOURCE = 12,
+  BLITTER_OP_OR_NOT_SOURCE = 13, /* NOT S OR D */
+  BLITTER_OP_NAND = 14,
+  BLITTER_OP_ONES = 15,
+};
+
+/* ctrl: BUSY and HOG are accepted and ignored */
+#define BLITTER_CTRL_BUSY 0x80
+#define BLITTER_CTRL_HOG 0x40
+#define BLITTER_CTRL_SMUDGE 0x20
+#define BLITTER_CTRL_LINE_MASK 0x0F
+
+/* skew */
+#define BLITTER_SKEW_FXSR 0x80
+#define BLITTER_SKEW_NFSR 0x40
+#define BLITTER_SKEW_MASK 0x0F
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The blitter registers, in the order of the ST ports */
+struct VGA_BLITTER {
+  uint16_t halftone[16];    /* $FF8A00 */
+  int16_t src_x_inc;        /* $FF8A20, bytes */
+  int16_t src_y_inc;        /* $FF8A22, bytes */
+  const uint16_t *src_addr; /* $FF8A24 */
+  uint16_t endmask[3];      /* $FF8A28: first, middle and last word */
+  int16_t dst_x_inc;        /* $FF8A2E, bytes */
+  int16_t dst_y_inc;        /* $FF8A30, bytes */
+  uint16_t *dst_addr;       /* $FF8A32 */
+  uint16_t x_count;         /* $FF8A36, words per line, 0 is 65536 */
+  uint16_t y_count;         /* $FF8A38, lines, 0 is 65536 */
+  uint8_t hop;              /* $FF8A3A, enum BLITTER_HOP */
+  uint8_t op;               /* $FF8A3B, enum BLITTER_OP */
+  uint8_t ctrl;             /* $FF8A3C, BLITTER_CTRL_* and halftone line */
+  uint8_t skew;             /* $FF8A3D, BLITTER_SKEW_* and skew */
+};
+
+/* Run the blit programmed in `blt` to the end */
+void __not_in_flash_func(blitter_run)(struct VGA_BLITTER *blt);
+
+/* Program x_count, the end masks, the skew with FXSR and NFSR, and the Y
+ * increments of a left-to-right blit of `width` pixels from bit column
+ * src_x to dst_x, with rows src_pitch and dst_pitch bytes apart. The X
+ * increments must be set first; src_addr and dst_addr are then the words
+ * holding pixels src_x and dst_x. */
+void blitter_set_span(struct VGA_BLITTER *blt, int src_x, int dst_x,
+                      int width, int src_pitch, int dst_pitch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_BLITTER_H_FILE
@@ -0,0 +1,67 @@
+#ifndef VGA_CHUNKY_H_FILE
+#define VGA_CHUNKY_H_FILE
+
+#include "draw.h"
+
+/* Chunky render target: the frame is drawn as one palette index per nibble,
+ * laid out like the packed sprites (8 pixels per word, pixel 0 in the low
+ * nibble), and converted to planar once with chunky_to_planar.
+ *
+ * A pixel costs a nibble write instead of a merge into four plane words, so
+ * scenes with a lot of overdraw, or per-pixel effects, are drawn here and
+ * pay the planar conversion once per frame. Packed sprites are drawn eight
+ * pixels per word, shifted by whole nibbles, with the transparent index
+ * turned into a mask without any table.
+ *
+ * The chunky draws use frame coordinates and clip to the frame; they do not
+ * go through the viewport.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct CHUNKY_FRAME {
+  int width; /* whole blocks */
+  int height;
+  uint32_t *data; /* height rows of width / 8 words */
+};
+
+/* Allocate a frame of `width` (rounded up to whole blocks) x `height`
+ * pixels, cleared to index 0. Returns 0, or VGA_ERROR_ALLOC. */
+int chunky_init(struct CHUNKY_FRAME *frame, int width, int height);
+void chunky_free(struct CHUNKY_FRAME *frame);
+
+/* Fill the whole frame with `color` */
+void chunky_clear(struct CHUNKY_FRAME *frame, int color);
+
+/* Set pixel (x, y), without clipping */
+static inline __attribute__((always_inline)) void chunky_plot(
+    struct CHUNKY_FRAME *frame, int x, int y, int color) {
+  uint8_t *p = (uint8_t *)frame->data + y * (frame->width / 2) + x / 2;
+  const int shift = (x & 1) * 4;
+  *p = (uint8_t)((*p & ~(0xF << shift)) | (color << shift));
+}
+
+/* Filled rectangle [x0, x1) x [y0, y1) */
+void __not_in_flash_func(chunky_fill_rect)(struct CHUNKY_FRAME *frame,
+                                           int x0, int y0, int x1, int y1,
+                                           int color);
+
+/* Sprite of any format, transparent, at (x, y). Packed sprites take the
+ * word path unless mirrored or remapped; the others go pixel by pixel. */
+void __not_in_flash_func(chunky_draw_sprite)(struct CHUNKY_FRAME *frame,
+                                             const struct SPRITE *spr, int x,
+                                             int y);
+
+/* Convert rows [y0, y1) of the frame into the same rows of the hidden
+ * framebuffer, over the columns both have. Each 16-pixel block is eight
+ * byte lookups in a 1 KB table and two word stores. */
+void __not_in_flash_func(chunky_to_planar)(const struct CHUNKY_FRAME *frame,
+                                           int y0, int y1);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_CHUNKY_H_FILE
@@ -0,0 +1,88 @@
+#ifndef VGA_COMPOSE_H_FILE
+#define VGA_COMPOSE_H_FILE
+
+#include "draw.h"
+#include "font.h"
+#include "tilemap.h"
+
+/* Tile-binned deferred compositor. Between compose_begin and compose_end,
+ * sprites and text are not drawn but recorded, and every bin of the screen
+ * (one 16-pixel block column by COMPOSE_BIN_ROWS rows) gets the list of the
+ * items that touch it, in drawing order. compose_end then builds each bin in
+ * a scratch buffer on the stack, starting from the tilemap view or from what
+ * the framebuffer holds, merges its items in order and writes the bin to
+ * the hidden framebuffer once. Overlapping sprites no longer read and write
+ * the same framebuffer words over and over.
+ *
+ * In the scanline mode the items are instead listed by their first row.
+ * compose_end walks the rows keeping the list of the items that cover the
+ * current one, in drawing order, builds the row in a line buffer from their
+ * spans and writes it once. The cost of a row is bounded by the spans on
+ * it, so the worst case of a frame follows from the busiest rows rather
+ * than from the sum over all the sprites.
+ *
+ * Sprites are merged from their planar copy. Items the compositor cannot
+ * merge (sprites without a planar copy, remapped ones, text longer than
+ * COMPOSE_TEXT_CHARS - 1) flush the bins recorded so far and are drawn
+ * directly, so the drawing order always holds; running out of items or bin
+ * entries flushes too. Items are clipped to the viewport when they are
+ * recorded, and to the drawable rows; the background view covers the whole
+ * drawable screen whatever the viewport.
+ *
+ * Before compose_init, or when it failed, every call draws directly.
+ */
+
+/* Rows per bin: a bin is VGA_BLOCK_PIXELS x COMPOSE_BIN_ROWS pixels */
+#define COMPOSE_BIN_ROWS 16
+/* Items recorded per frame before a flush */
+#define COMPOSE_MAX_ITEMS 160
+/* Bin entries (item in a bin) recorded per frame before a flush */
+#define COMPOSE_MAX_REFS 4096
+/* Characters per text item, terminator included */
+#define COMPOSE_TEXT_CHARS 32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum COMPOSE_MODE {
+  COMPOSE_BINS = 0,  /* VGA_BLOCK_PIXELS x COMPOSE_BIN_ROWS bins */
+  COMPOSE_SCANLINES, /* one framebuffer row at a time */
+};
+
+/* Allocate the items, bin lists and line buffer (about 28 KB), in the bins
+ * mode. Returns 0, or VGA_ERROR_ALLOC. */
+int compose_init(void);
+
+/* Choose how the next frames are composited; ignored inside a frame */
+void compose_set_mode(enum COMPOSE_MODE mode);
+
+/* Start recording a frame over `background`, or over the current contents
+ * of the hidden framebuffer when NULL. The view must be up to date and stay
+ * unchanged until compose_end. */
+void __not_in_flash_func(compose_begin)(const struct TILEMAP_VIEW *background);
+
+/* Transparent sprite, as draw_sprite(spr, x, y, true) */
+void __not_in_flash_func(compose_sprite)(const struct SPRITE *spr, int x,
+                                         int y);
+/* The same sprite at `count` positions, in order, set up once */
+void __not_in_flash_func(compose_sprites)(const struct SPRITE *spr,
+                                          const struct VGA_POINT *at,
+                                          int count);
+
+/* Text with the font state, as font_print: alignment, color, border,
+ * font_x advance and font_last_rect */
+void __not_in_flash_func(compose_print)(const char *text);
+#if VGA_FONT_USE_STDARG
+void __not_in_flash_func(compose_printf)(const char *fmt, ...)
+    __attribute__((format(printf, 1, 2)));
+#endif
+
+/* Composite every bin into the hidden framebuffer */
+void __not_in_flash_func(compose_end)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_COMPOSE_H_FILE
@@ -0,0 +1,47 @@
+#ifndef VGA_DIRTY_H_FILE
+#define VGA_DIRTY_H_FILE
+
+#include "draw.h"
+
+/* Dirty rectangles: the screen areas drawn over the background, recorded
+ * per framebuffer. The next time a framebuffer is the hidden one, only those
+ * areas have to be restored before drawing again.
+ */
+
+/* Rectangles recorded per framebuffer before it falls back to a full
+ * restore */
+#define DIRTY_MAX_RECTS 32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct DIRTY_LIST {
+  int count;
+  bool full; /* restore the whole screen (first frames, or overflowed) */
+  struct VGA_RECT rects[DIRTY_MAX_RECTS];
+};
+
+/* Forget all the recorded rectangles: both framebuffers restore in full */
+void dirty_reset(void);
+
+/* Start a frame in the hidden framebuffer. Returns the areas to restore,
+ * the ones drawn into it last time, and starts recording anew. Overlapping
+ * rectangles are already merged, so no area is restored twice.
+ */
+const struct DIRTY_LIST *__not_in_flash_func(dirty_begin_frame)(void);
+
+/* Record an area drawn in the hidden framebuffer. It is clipped to the
+ * drawable screen and widened to whole 16-pixel blocks. */
+void __not_in_flash_func(dirty_add)(int x0, int y0, int x1, int y1);
+
+static inline void __not_in_flash_func(dirty_add_rect)(
+    const struct VGA_RECT *rect) {
+  dirty_add(rect->x0, rect->y0, rect->x1, rect->y1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_DIRTY_H_FILE
@@ -0,0 +1,76 @@
+#ifndef VGA_DISPLAYLIST_H_FILE
+#define VGA_DISPLAYLIST_H_FILE
+
+#include "compose.h"
+#include "draw.h"
+
+/* Retained display list of transparent sprites. Each frame the sprites are
+ * added, then drawn at once by dlist_execute:
+ *
+ * - sprites entirely outside the viewport are dropped when added;
+ * - the rest are drawn back to front by the row below their bottom edge,
+ *   so lower sprites overlap higher ones. Sprites on the same row keep the
+ *   order they were added in;
+ * - each run of consecutive entries with the same frame goes to
+ *   compose_sprites as one batch.
+ *
+ * Every sprite comes with an id of the caller's, the same from frame to
+ * frame. The drawing order of the last frame is kept by id and the new one
+ * is sorted from it by insertion, which is close to linear while the
+ * sprites move a little between frames, whichever of them are dropped.
+ * Entries repeating an id of the frame start from the end of the order.
+ */
+
+/* Sprites a display list holds per frame; more are dropped */
+#define DLIST_MAX_ENTRIES 160
+/* Positions handed to compose_sprites at a time */
+#define DLIST_MAX_BATCH 16
+/* Sprite ids, [0, DLIST_MAX_IDS) */
+#define DLIST_MAX_IDS 256
+/* Free slot of DISPLAY_LIST.slot */
+#define DLIST_NO_ENTRY 0xFF
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct DLIST_ENTRY {
+  const struct SPRITE *sprite;
+  struct VGA_POINT at;
+  int16_t depth; /* row below the bottom edge */
+  uint8_t id;
+};
+
+struct DISPLAY_LIST {
+  int count;
+  int last_count; /* ids in `last_ids` */
+  struct DLIST_ENTRY entries[DLIST_MAX_ENTRIES];
+  uint8_t order[DLIST_MAX_ENTRIES];    /* entry indices, back to front */
+  uint8_t last_ids[DLIST_MAX_ENTRIES]; /* last frame's ids, back to front */
+  uint8_t slot[DLIST_MAX_IDS];         /* entry of an id while sorting */
+};
+
+/* Empty list, no order kept */
+void dlist_init(struct DISPLAY_LIST *list);
+
+/* Start a frame: the entries are cleared, the order of the last frame
+ * stays as the starting point of the next sort */
+static inline void __not_in_flash_func(dlist_begin)(
+    struct DISPLAY_LIST *list) {
+  list->count = 0;
+}
+
+/* Add a transparent sprite at (x, y) under `id`. Returns false when it is
+ * outside the viewport or the list is full, and it will not be drawn. */
+bool __not_in_flash_func(dlist_add)(struct DISPLAY_LIST *list,
+                                    const struct SPRITE *spr, int x, int y,
+                                    uint8_t id);
+
+/* Sort the entries and draw them through the compositor */
+void __not_in_flash_func(dlist_execute)(struct DISPLAY_LIST *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_DISPLAYLIST_H_FILE
@@ -19,6 +19,21 @@
 #define VGA_STATUS_BAR_OFFSET 8
 /* Mask for packed 6-bit-per-channel (B,G,R) indices (each byte low 6 bits) */
 #define VGA_RGB6_PACK_MASK 0x3F3F3F3Fu
+/* Chunky pixel value used as the transparent color key */
+#define VGA_TRANSPARENT_PIXEL 0xCC
+/* Pixels per 32-bit word of 4-bit packed sprite data */
+#define VGA_PACKED_GROUP_PIXELS 8
+/* Palette index reserved as transparent in packed data (0xCC in chunky) */
+#define VGA_PACKED_TRANSPARENT 12
+/* 16-bit words per planar sprite block: transparency mask + 4 planes */
+#define VGA_PLANAR_BLOCK_WORDS (1 + VGA_NUM_BITPLANES)
+/* Byte marking the transparent texels of SPRITE_TEXELS */
+#define VGA_TEXEL_TRANSPARENT 0xFF
+/* Angles of a full turn of the sine table, and its fractional bits */
+#define VGA_SINE_ANGLES 1024
+#define VGA_SINE_BITS 14
+/* Angles of a full turn, for draw_affine_rotation: the sine table's */
+#define DRAW_AFFINE_ANGLES VGA_SINE_ANGLES
 
 /* Expose precomputed pixel masks table for use in font & sprite rendering.
  * Layout index: (palette_index << 4) | pixel_x (0..15)
@@ -26,36 +41,419 @@
  */
 extern uint64_t pixel_masks_flat[VGA_PIXEL_MASK_TABLE_SIZE];
 
+/* RGB6 (low 6 bits of a chunky pixel) to palette index LUT */
+extern uint16_t rgb2index[64];
+
+/* Byte bit-reversal table for the mirrored blits (the M0+ has no RBIT),
+ * defined in vga_sprite.c */
+extern const uint8_t bit_reverse8[256];
+
+/* Sine of VGA_SINE_ANGLES per turn, VGA_SINE_BITS fractional bits, for every
+ * rotation (meshes, effects, affine sprites). Defined in vga_draw.c and
+ * built by init_pixel_masks. */
+extern int16_t vga_sine[VGA_SINE_ANGLES];
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+static inline __attribute__((always_inline)) int32_t vga_sin(int angle) {
+  return vga_sine[angle & (VGA_SINE_ANGLES - 1)];
+}
+static inline __attribute__((always_inline)) int32_t vga_cos(int angle) {
+  return vga_sine[(angle + VGA_SINE_ANGLES / 4) & (VGA_SINE_ANGLES - 1)];
+}
+
+static inline __attribute__((always_inline)) uint32_t bit_reverse16(
+    uint32_t v) {
+  return ((uint32_t)bit_reverse8[v & 0xFF] << 8) |
+         bit_reverse8[(v >> 8) & 0xFF];
+}
+
+/* Merge `set` into the pixels of a block flagged in `covered` (bit 15 =
+ * leftmost pixel). Done on 32-bit halves: the M0+ has no 64-bit ops. */
+static inline __attribute__((always_inline)) void draw_merge_block(
+    uint16_t *dst, uint32_t covered, uint64_t set) {
+  uint32_t clear = covered | (covered << 16);
+  uint32_t *dst32 = (uint32_t *)dst;
+  dst32[0] = (dst32[0] & ~clear) | (uint32_t)set;
+  dst32[1] = (dst32[1] & ~clear) | (uint32_t)(set >> 32);
+}
+
+/* Pre-shifted copies of a planar sprite, one per 16-pixel alignment phase.
+ * Copy `s` holds the frame already shifted right by `s` pixels, laid out
+ * like PLANAR_SPRITE data with blocks[s] blocks per row, so drawing at any x
+ * is a run of aligned whole-block AND-NOT/OR writes.
+ */
+struct PLANAR_PRESHIFT {
+  uint8_t blocks[VGA_BLOCK_PIXELS];       /* blocks per row, per shift */
+  const uint16_t *data[VGA_BLOCK_PIXELS]; /* shifted data, per shift */
+};
+
+/* Pre-shift selection for a sprite set: frames with their bit set in
+ * frame_mask get a PLANAR_PRESHIFT, in frame order, while the total stays
+ * within budget_bytes. Frames left out keep using the shifting blitter.
+ */
+struct PLANAR_PRESHIFT_CONFIG {
+  uint64_t frame_mask;
+  unsigned int budget_bytes;
+};
+
+/* Pre-masked planar sprite: per row, `blocks` groups of 16 pixels, each
+ * stored as VGA_PLANAR_BLOCK_WORDS words (mask, plane 0..3) in ST bit order
+ * (bit 15 = leftmost pixel). Mask bits are set on opaque pixels and plane
+ * words are zero elsewhere, so blitting is one AND-NOT/OR per plane word.
+ */
+struct PLANAR_SPRITE {
+  int width;
+  int height;
+  unsigned int blocks;  /* number of 16-pixel blocks per line */
+  const uint16_t *data; /* height * blocks * VGA_PLANAR_BLOCK_WORDS words */
+  const struct PLANAR_PRESHIFT *preshift; /* optional pre-shifted cache */
+};
+
+/* Opaque planar tile: every 16-pixel block of a row is stored as the
+ * framebuffer block itself (planes 0 and 1, then 2 and 3), so a block-aligned
+ * draw is a straight word copy. Only for widths that are whole blocks.
+ */
+struct PLANAR_TILE {
+  int width;
+  int height;
+  unsigned int blocks;  /* number of 16-pixel blocks per line */
+  const uint32_t *data; /* height * blocks * 2 words */
+};
+
+/* Compiled sprite blitter: straight-line code drawing one frame at one
+ * 16-pixel phase, without clipping. dst points to the framebuffer word of the
+ * first destination block of the top row.
+ */
+typedef void (*compiled_sprite_func)(uint32_t *dst);
+
+/* Compiled frame entry, as generated by rp/sprite_compiler.py */
+struct COMPILED_SPRITE {
+  int frame;
+  const compiled_sprite_func *phases; /* VGA_BLOCK_PIXELS entries */
+};
+
+/* Opaque run of a span-encoded sprite row */
+struct SPRITE_SPAN {
+  uint8_t x;       /* first pixel, relative to the sprite origin */
+  uint8_t length;  /* run length in pixels */
+  uint16_t offset; /* first palette index of the run in `pixels` */
+};
+
+/* Span-encoded sprite: only the tight bounding box of the opaque pixels is
+ * stored, each row as a list of opaque runs. Transparent rows and gaps are
+ * never visited and the pixels are stored as palette indices.
+ */
+struct SPAN_SPRITE {
+  int width;
+  int height;
+  uint8_t bbox_x; /* bounding box of the opaque pixels */
+  uint8_t bbox_y;
+  uint8_t bbox_w;
+  uint8_t bbox_h;
+  const uint16_t *row_spans; /* bbox_h + 1 entries: first span of each row */
+  const struct SPRITE_SPAN *spans;
+  const uint8_t *pixels;
+};
+
+/* Pixel layout of SPRITE data */
+enum SPRITE_FORMAT {
+  /* One RGB6 byte per pixel, 4 pixels per word, VGA_TRANSPARENT_PIXEL key */
+  SPRITE_FORMAT_CHUNKY = 0,
+  /* One palette index per nibble, 8 pixels per word with pixel 0 in the low
+   * nibble, VGA_PACKED_TRANSPARENT key (rp/sprite_packer.py) */
+  SPRITE_FORMAT_PACKED4,
+};
+
+/* Palette remap for recolored variants of a sprite, built with
+ * sprite_remap_build. Each kernel uses the table matching its source, so
+ * chunky draws only swap the rgb2index pointer. Hot tables can go in scratch
+ * RAM next to rgb2index with section(".scratch_y.<name>").
+ */
+struct PALETTE_REMAP {
+  uint16_t rgb2index[64]; /* RGB6 -> remapped palette index (chunky) */
+  uint8_t index[16];      /* palette index -> palette index (packed, spans) */
+};
+
+/* Byte copy of a sprite for the affine draws: a palette index per texel,
+ * VGA_TEXEL_TRANSPARENT where transparent, rows 2^width_bits bytes apart so
+ * the texel lanes (vga/texel.h) address them.
+ */
+struct SPRITE_TEXELS {
+  uint8_t width_bits;
+  uint8_t height_bits;
+  const uint8_t *data; /* height rows */
+};
+
 /* Sprite descriptor: width/height in pixels, stride in 32-bit words per row.
- * Data points to packed 4-pixel (32-bit) groups; stride accounts for padding.
+ * Data points to 32-bit groups laid out as `format`; stride accounts for
+ * padding. A mirrored frame shares the data and copies of the original with
+ * flip_x set; compiled code is per frame and always drawn as generated. A
+ * recolored variant sets remap; the planar, compiled and texel copies have
+ * the colors baked in, so remapped draws skip them.
  */
 struct SPRITE {
   int width;
   int height;
   unsigned int stride;      /* number of 32-bit words per line */
   const unsigned int *data; /* immutable pixel data */
+  uint8_t format;           /* enum SPRITE_FORMAT */
+  bool flip_x;              /* draw mirrored horizontally */
+  const struct PLANAR_SPRITE *planar; /* optional pre-masked planar copy */
+  const struct PLANAR_TILE *planar_tile; /* optional opaque planar copy */
+  const compiled_sprite_func *compiled; /* optional per-phase compiled code */
+  const struct SPAN_SPRITE *spans;      /* optional span-encoded copy */
+  const struct PALETTE_REMAP *remap;    /* optional palette remap */
+  const struct SPRITE_TEXELS *texels;   /* optional copy for affine draws */
+};
+
+/* Viewport every draw primitive goes through: positions are relative to the
+ * origin and only the pixels inside the clip rectangle are drawn. The clip
+ * columns are whole blocks, so the block kernels clip exactly; the rows are
+ * free. init_pixel_masks resets it to the drawable screen (above the status
+ * bar) with the origin in its top-left corner.
+ */
+struct VGA_VIEWPORT {
+  struct VGA_RECT clip; /* screen pixels */
+  int16_t block_x0;     /* clip columns in blocks, [block_x0, block_x1) */
+  int16_t block_x1;
+  int16_t origin_x; /* screen position of the viewport (0, 0) */
+  int16_t origin_y;
 };
 
+/* Current viewport (defined in vga_draw.c) */
+extern struct VGA_VIEWPORT vga_viewport;
+
+/* Draw through `clip`, in screen pixels: limited to the screen, status bar
+ * included, and its columns rounded inwards to whole blocks. Positions are
+ * taken relative to (origin_x, origin_y) on screen. */
+void draw_set_viewport(const struct VGA_RECT *clip, int origin_x,
+                       int origin_y);
+/* Back to the drawable screen, origin at (0, 0) */
+void draw_reset_viewport(void);
+
+/* A primitive clipped to the viewport, worked out once per draw by
+ * draw_clip_box. Its rows [row_start, row_end) and columns [x_start, x_end)
+ * are visible; inside is set when nothing was cut, so the kernels can take
+ * their unclipped loops. */
+struct DRAW_CLIP {
+  int x; /* top-left corner on screen, origin applied */
+  int y;
+  int row_start;
+  int row_end;
+  int x_start;
+  int x_end;
+  bool inside;
+};
+
+/* Clip a width x height primitive at viewport position (x, y). Returns false
+ * when nothing of it is visible. */
+static inline __attribute__((always_inline)) bool draw_clip_box(
+    int x, int y, int width, int height, struct DRAW_CLIP *c) {
+  const struct VGA_VIEWPORT *vp = &vga_viewport;
+  x += vp->origin_x;
+  y += vp->origin_y;
+  c->x = x;
+  c->y = y;
+  c->row_start = vp->clip.y0 > y ? vp->clip.y0 - y : 0;
+  c->row_end = vp->clip.y1 < y + height ? vp->clip.y1 - y : height;
+  c->x_start = vp->clip.x0 > x ? vp->clip.x0 - x : 0;
+  c->x_end = vp->clip.x1 < x + width ? vp->clip.x1 - x : width;
+  c->inside = c->row_start == 0 && c->row_end == height &&
+              c->x_start == 0 && c->x_end == width;
+  return c->row_start < c->row_end && c->x_start < c->x_end;
+}
+
 void __not_in_flash_func(init_pixel_masks)(void);
 
-/* Sprite drawing core helpers (implemented in vga_draw.c) */
+/* RGB6 to palette index table for a chunky sprite, remap included */
+static inline const uint16_t *sprite_rgb2index(const struct SPRITE *spr) {
+  return spr->remap ? spr->remap->rgb2index : rgb2index;
+}
+
+/* Palette index of pixel (x, y) of a sprite in any format, or -1 when it is
+ * transparent. Per-pixel decode of the data as stored, remap not applied;
+ * meant for the init-time converters. */
+static inline int sprite_pixel_index(const struct SPRITE *spr, int x, int y) {
+  const unsigned int *row = &spr->data[spr->stride * y];
+  if (spr->format == SPRITE_FORMAT_PACKED4) {
+    int idx = (row[x / VGA_PACKED_GROUP_PIXELS] >>
+               (4 * (x % VGA_PACKED_GROUP_PIXELS))) &
+              0xF;
+    return idx == VGA_PACKED_TRANSPARENT ? -1 : idx;
+  }
+  uint8_t palv = ((const uint8_t *)row)[x];
+  return palv == VGA_TRANSPARENT_PIXEL ? -1 : rgb2index[palv & 0x3F];
+}
+
+/* sprite_pixel_index with the remap applied, for the per-pixel kernels */
+static inline __attribute__((always_inline)) int sprite_texel_index(
+    const struct SPRITE *spr, int x, int y) {
+  const unsigned int *row = &spr->data[spr->stride * y];
+  if (spr->format == SPRITE_FORMAT_PACKED4) {
+    int idx = (row[x / VGA_PACKED_GROUP_PIXELS] >>
+               (4 * (x % VGA_PACKED_GROUP_PIXELS))) &
+              0xF;
+    if (idx == VGA_PACKED_TRANSPARENT) return -1;
+    return spr->remap ? spr->remap->index[idx] : idx;
+  }
+  uint8_t palv = ((const uint8_t *)row)[x];
+  if (palv == VGA_TRANSPARENT_PIXEL) return -1;
+  return sprite_rgb2index(spr)[palv & 0x3F];
+}
+
+/* Sprite drawing core helpers (implemented in vga_draw.c). Like every draw
+ * primitive, they take viewport positions and clip to the viewport. */
 void __not_in_flash_func(draw_sprite_transparent)(const struct SPRITE *spr,
                                                   int spr_x, int spr_y);
 void __not_in_flash_func(draw_sprite_opaque)(const struct SPRITE *spr,
                                              int spr_x, int spr_y);
+void __not_in_flash_func(draw_sprite_mirrored)(const struct SPRITE *spr,
+                                               int spr_x, int spr_y,
+                                               bool transparent);
 
 void __not_in_flash_func(draw_tile)(const struct SPRITE *__restrict spr,
                                     int spr_x, int spr_y);
+/* draw_tile restricted to `rect` (screen pixels), at least: tiles without a
+ * clipped path are drawn whole, which is fine when restoring a background. */
+void __not_in_flash_func(draw_tile_rect)(const struct SPRITE *__restrict spr,
+                                         int spr_x, int spr_y,
+                                         const struct VGA_RECT *rect);
+
+/* Chunky blitter family specialized at compile time on mode geometry,
+ * transparency, clipping and source alignment (implemented in vga_blit.c).
+ * Returns false when the current mode or the sprite format has no
+ * specialized instances. */
+bool __not_in_flash_func(draw_sprite_blit)(const struct SPRITE *spr,
+                                           int spr_x, int spr_y,
+                                           bool transparent);
+
+/* 4-bit packed sprites, straight from the packed data (vga_packed.c).
+ * init_packed_planes fills the pair table; init_pixel_masks calls it. */
+void init_packed_planes(void);
+void __not_in_flash_func(draw_sprite_packed)(const struct SPRITE *spr,
+                                             int spr_x, int spr_y,
+                                             bool transparent);
+/* Opaque packed tile limited to the 16-pixel blocks and the rows of `rect`
+ * (screen pixels). Returns false for the remapped and mirrored tiles, which
+ * it does not handle. */
+bool __not_in_flash_func(draw_tile_packed_rect)(const struct SPRITE *spr,
+                                                int spr_x, int spr_y,
+                                                const struct VGA_RECT *rect);
+
+/* Planar tile bank (vga_tile.c). sprite_tile_build converts `count` tiles
+ * of any format into one allocation and links them from the sprites; tiles
+ * whose width is not whole blocks are left without a copy. draw_tile takes
+ * the copy for block-aligned x positions; draw_tile_planar only handles
+ * those, clipped to the viewport and to `clip` (screen pixels) when not
+ * NULL.
+ */
+int sprite_tile_build(struct SPRITE *tiles, struct PLANAR_TILE *planar,
+                      int count);
+void __not_in_flash_func(draw_tile_planar)(const struct PLANAR_TILE *tile,
+                                           int spr_x, int spr_y,
+                                           const struct VGA_RECT *clip);
+
+/* Planar sprite helpers (implemented in vga_sprite.c) */
+int sprite_planar_build(struct SPRITE *sprites, struct PLANAR_SPRITE *planar,
+                        int count);
+int sprite_preshift_build(struct PLANAR_SPRITE *planar, int count,
+                          const struct PLANAR_PRESHIFT_CONFIG *config);
+void sprite_preshift_report(const struct PLANAR_SPRITE *planar, int count);
+int sprite_span_build(struct SPRITE *sprites, struct SPAN_SPRITE *spans,
+                      int count);
+void sprite_span_free(struct SPAN_SPRITE *spans);
+/* Fill `remap` from a palette index -> palette index map */
+void sprite_remap_build(struct PALETTE_REMAP *remap, const uint8_t map[16]);
+void __not_in_flash_func(draw_sprite_spans)(const struct SPAN_SPRITE *spr,
+                                            int spr_x, int spr_y, bool flip_x,
+                                            const struct PALETTE_REMAP *remap);
+void __not_in_flash_func(draw_sprite_planar)(const struct PLANAR_SPRITE *spr,
+                                             int spr_x, int spr_y,
+                                             bool flip_x);
+
+/* Sprite to screen transform of draw_sprite_affine, 16.16 fixed point: a
+ * sprite offset (u, v) from the pivot lands at (a u + b v, c u + d v) from
+ * the draw position */
+struct DRAW_AFFINE {
+  int32_t a;
+  int32_t b;
+  int32_t c;
+  int32_t d;
+};
+
+/* Affine sprites (vga_affine.c). sprite_texels_build gives `count` sprites
+ * a byte copy each, in one allocation, that draw_sprite_affine walks with
+ * the texel stepper, on the interpolator when there is one. Without a copy,
+ * or remapped, the texels are decoded from the sprite data. Returns 0, or
+ * VGA_ERROR_ALLOC.
+ */
+int sprite_texels_build(struct SPRITE *sprites, struct SPRITE_TEXELS *texels,
+                        int count);
+void sprite_texels_free(struct SPRITE_TEXELS *texels);
+/* Scale by (scale_x, scale_y), 16.16, then turn clockwise on screen by
+ * `angle`, in DRAW_AFFINE_ANGLES per turn, from the sine table */
+void draw_affine_rotation(struct DRAW_AFFINE *m, int angle, int32_t scale_x,
+                          int32_t scale_y);
+/* Draw `spr` transparent through `m`, its point (pivot_x, pivot_y) at
+ * viewport position (x, y). Each pixel takes the texel under its centre
+ * through the inverse matrix; every row is first cut to the span inside the
+ * sprite and the viewport, so only those pixels are stepped. Scales beyond
+ * 256, flat matrices and shears that step texels out of 32 bits across the
+ * sprite's screen box draw nothing. */
+void __not_in_flash_func(draw_sprite_affine)(const struct SPRITE *spr, int x,
+                                             int y,
+                                             const struct DRAW_AFFINE *m,
+                                             int pivot_x, int pivot_y);
+
+#if VGA_ASM_BLITTERS
+/* Thumb-1 row loops (vga_blit_asm.S), `blocks` > 0 destination blocks.
+ * Aligned masked merge of pre-masked planar blocks: */
+void blit_asm_planar_row(uint16_t *dst, const uint16_t *src, int blocks);
+/* Opaque 4-bit packed row, 16 pixels per block, through the pair table: */
+void blit_asm_packed_row(uint16_t *dst, const uint32_t *src, int blocks,
+                         const uint32_t (*pairs)[2]);
+#endif
+
+/* Compiled sprites have no clipping: only used when fully inside the
+ * viewport, and not in surfaces since the code bakes the line length in */
+static inline bool __not_in_flash_func(draw_sprite_compiled)(
+    const struct SPRITE *__restrict sprite, int spr_x, int spr_y) {
+  struct DRAW_CLIP c;
+  if (vga_screen.offscreen) return false;
+  if (!draw_clip_box(spr_x, spr_y, sprite->width, sprite->height, &c) ||
+      !c.inside)
+    return false;
+  uint32_t *dst = (uint32_t *)vga_screen.hidden_framebuffer +
+                  c.y * (vga_screen.width / (VGA_BLOCK_PIXELS / 2)) +
+                  (c.x >> 4) * 2;
+  sprite->compiled[c.x & (VGA_BLOCK_PIXELS - 1)](dst);
+  return true;
+}
 
-/* Inline small dispatcher */
+/* Inline small dispatcher. The RAM-resident planar copy (and its preshift
+ * cache) comes first; compiled code runs from flash, past the XIP cache, so
+ * it only stands in for frames without a planar copy. */
 static inline void __not_in_flash_func(draw_sprite)(
     const struct SPRITE *__restrict sprite, int spr_x, int spr_y,
     bool transparent) {
-  if (transparent)
+  if (transparent && sprite->planar && !sprite->remap)
+    draw_sprite_planar(sprite->planar, spr_x, spr_y, sprite->flip_x);
+  else if (transparent && sprite->compiled && !sprite->remap &&
+           draw_sprite_compiled(sprite, spr_x, spr_y))
+    return;
+  else if (transparent && sprite->spans)
+    draw_sprite_spans(sprite->spans, spr_x, spr_y, sprite->flip_x,
+                      sprite->remap);
+  else if (sprite->format == SPRITE_FORMAT_PACKED4)
+    draw_sprite_packed(sprite, spr_x, spr_y, transparent);
+  else if (sprite->flip_x)
+    draw_sprite_mirrored(sprite, spr_x, spr_y, transparent);
+  else if (draw_sprite_blit(sprite, spr_x, spr_y, transparent))
+    return;
+  else if (transparent)
     draw_sprite_transparent(sprite, spr_x, spr_y);
   else
     draw_sprite_opaque(sprite, spr_x, spr_y);
@@ -0,0 +1,113 @@
+#ifndef VGA_EFFECTS_H_FILE
+#define VGA_EFFECTS_H_FILE
+
+#include "chunky.h"
+
+/* Full-frame procedural effects, drawn into a chunky frame (vga/chunky.h)
+ * eight pixels per word and converted to planar once with chunky_to_planar.
+ *
+ * The texture effects address their texels through vga/texel.h, on the
+ * interpolator when there is one:
+ * - plasma steps along rows of a periodic texture of summed sines, each row
+ *   offset by a wave, and cycles its palette with time;
+ * - rotozoom steps along rotated and scaled rows of any texture;
+ * - tunnel looks up per-cell angle and depth tables, built for one quarter
+ *   of the frame and mirrored, in 2x2 pixel cells. The tables are read by
+ *   the CPU and only the texels go through the interpolator.
+ * The starfield projects points through the hardware divider and plots
+ * them, with no texture to address.
+ *
+ * Angles are those of the sine table of vga/draw.h.
+ */
+
+/* Depth of the starfield, and the nearest a star gets before it respawns */
+#define EFFECT_STAR_DEPTH 4096
+#define EFFECT_STAR_NEAR 64
+/* Shades of the starfield, from near to far */
+#define EFFECT_STAR_SHADES 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Power-of-two texture, one byte per texel */
+struct EFFECT_TEXTURE {
+  uint8_t *texels;
+  uint8_t width_bits;
+  uint8_t height_bits;
+};
+
+/* Per-cell tunnel coordinates for the bottom-right quarter of the frame:
+ * angle in bits 0-7, depth in bits 8-15 */
+struct EFFECT_TUNNEL {
+  uint16_t *cells;
+  int width; /* cells of the quarter */
+  int height;
+};
+
+/* Star around the axis of view: the frame width spans x = -z to z */
+struct EFFECT_STAR {
+  int16_t x;
+  int16_t y;
+  int16_t z; /* [EFFECT_STAR_NEAR, EFFECT_STAR_DEPTH) */
+};
+
+struct EFFECT_STARFIELD {
+  struct EFFECT_STAR *stars;
+  int count;
+  uint32_t seed;
+};
+
+/* Texture of the palette indices of `spr` tiled over 2^width_bits x
+ * 2^height_bits texels, transparent pixels as index 0. Returns 0, or
+ * VGA_ERROR_ALLOC. */
+int effect_texture_from_sprite(struct EFFECT_TEXTURE *texture,
+                               const struct SPRITE *spr, int width_bits,
+                               int height_bits);
+/* Plasma texture: sums of sines, periodic both ways, over 0-255. Returns 0,
+ * or VGA_ERROR_ALLOC. */
+int effect_texture_plasma(struct EFFECT_TEXTURE *texture, int width_bits,
+                          int height_bits);
+void effect_texture_free(struct EFFECT_TEXTURE *texture);
+
+/* Tables for frames of width x height. Returns 0, or VGA_ERROR_ALLOC. */
+int effect_tunnel_init(struct EFFECT_TUNNEL *tunnel, int width, int height);
+void effect_tunnel_free(struct EFFECT_TUNNEL *tunnel);
+
+/* `count` stars spread over the depth. Returns 0, or VGA_ERROR_ALLOC. */
+int effect_starfield_init(struct EFFECT_STARFIELD *field, int count);
+void effect_starfield_free(struct EFFECT_STARFIELD *field);
+
+/* Plasma from a texture of effect_texture_plasma at time `t` (frames):
+ * the palette index is the texel plus the time, over 16 */
+void __not_in_flash_func(effect_plasma)(struct CHUNKY_FRAME *frame,
+                                        const struct EFFECT_TEXTURE *texture,
+                                        int t);
+
+/* `texture` turned by `angle` and scaled by `zoom` (16.16 texels per pixel)
+ * around texel (u, v) (16.16), which lands on the frame centre. The texels
+ * are palette indices. */
+void __not_in_flash_func(effect_rotozoom)(struct CHUNKY_FRAME *frame,
+                                          const struct EFFECT_TEXTURE *texture,
+                                          int angle, int32_t zoom, int32_t u,
+                                          int32_t v);
+
+/* Tunnel lined with `texture` (palette indices, sizes up to 256), turned
+ * by `angle` texels and moved forward by `depth` texels */
+void __not_in_flash_func(effect_tunnel)(struct CHUNKY_FRAME *frame,
+                                        const struct EFFECT_TUNNEL *tunnel,
+                                        const struct EFFECT_TEXTURE *texture,
+                                        int angle, int depth);
+
+/* Move the stars `speed` closer and plot them over the frame, in
+ * shades[0] when near to shades[EFFECT_STAR_SHADES - 1] when far. Stars
+ * that pass the near plane or leave the frame respawn far away. */
+void __not_in_flash_func(effect_starfield)(
+    struct CHUNKY_FRAME *frame, struct EFFECT_STARFIELD *field, int speed,
+    const uint8_t shades[EFFECT_STAR_SHADES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_EFFECTS_H_FILE
@@ -37,6 +37,9 @@ extern unsigned int font_x, font_y;
 extern enum FONT_ALIGNMENT font_alignment;
 extern unsigned char font_color;
 extern unsigned char border[2];
+/* Pixels touched by the last font_print, border included, in screen pixels
+ * clipped to the viewport */
+extern struct VGA_RECT font_last_rect;
 
 /* Inline trivial setters (kept in RAM) */
 static inline void __not_in_flash_func(font_set_font)(
@@ -65,6 +68,11 @@ void __not_in_flash_func(font_print_int)(int num);
 void __not_in_flash_func(font_print_uint)(unsigned int num);
 void __not_in_flash_func(font_print_float)(float num);
 void __not_in_flash_func(font_print)(const char *text);
+/* The layout steps of font_print, for other renderers of the same text:
+ * font_print_start applies the alignment to font_x, font_print_end sets
+ * font_last_rect for text ending at end_x and advances font_x. */
+void __not_in_flash_func(font_print_start)(const char *text);
+void __not_in_flash_func(font_print_end)(int end_x);
 
 #if VGA_FONT_USE_STDARG
 void __not_in_flash_func(font_printf)(const char *fmt, ...)
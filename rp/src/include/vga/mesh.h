@@ -0,0 +1,85 @@
+#ifndef VGA_MESH_H_FILE
+#define VGA_MESH_H_FILE
+
+#include "primitives.h"
+
+/* Fixed-point 3D pipeline for flat-shaded meshes, all in integers:
+ *
+ * - the vertices are rotated by a Q14 matrix and translated into camera
+ *   space (x right, y down, z away from the viewer), once per mesh draw;
+ * - the ones in front of the near plane are projected to 1/16 pixels,
+ *   centred on the camera's point of the viewport;
+ * - faces crossing the near plane are clipped against it, and their new
+ *   vertices projected;
+ * - back faces, the ones whose vertices do not run clockwise on screen, are
+ *   culled by the sign of their projected area;
+ * - the others go to draw_fill_polygon in their palette index.
+ *
+ * Faces are drawn in mesh order without depth sorting, which is right for
+ * convex meshes once the back faces are culled.
+ */
+
+/* Angles of a full turn */
+#define MESH_ANGLES VGA_SINE_ANGLES
+/* Fractional bits of the rotation matrix, those of the sine table */
+#define MESH_ROTATION_BITS VGA_SINE_BITS
+/* Vertices a mesh may have: indices are 8-bit */
+#define MESH_MAX_VERTICES 256
+/* Vertices a face may have */
+#define MESH_MAX_FACE_VERTICES 6
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct MESH_VERTEX {
+  int16_t x;
+  int16_t y;
+  int16_t z;
+};
+
+/* Convex planar face, clockwise seen from the front */
+struct MESH_FACE {
+  uint8_t count; /* 3 to MESH_MAX_FACE_VERTICES */
+  uint8_t color; /* palette index */
+  uint8_t index[MESH_MAX_FACE_VERTICES];
+};
+
+struct MESH {
+  const struct MESH_VERTEX *vertices;
+  const struct MESH_FACE *faces;
+  uint16_t num_vertices;
+  uint16_t num_faces;
+};
+
+/* Model to camera space: rotation, then translation in model units */
+struct MESH_POSE {
+  int16_t m[3][3]; /* Q14 */
+  int32_t x;
+  int32_t y;
+  int32_t z;
+};
+
+/* Camera space to the viewport. Camera space coordinates should stay within
+ * 16 bits and focal below 1024, or the projection takes a 64-bit path. */
+struct MESH_CAMERA {
+  int32_t focal; /* pixels per unit of x / z */
+  int32_t near;  /* clipping plane, z in model units, > 0 */
+  int16_t cx;    /* projection of the z axis, viewport coordinates */
+  int16_t cy;
+};
+
+/* Set the rotation of `pose` to the X, then Y, then Z rotations by the
+ * given angles, in MESH_ANGLES per turn, from the sine table of vga/draw.h */
+void mesh_pose_rotation(struct MESH_POSE *pose, int ax, int ay, int az);
+
+/* Transform, clip, cull and fill `mesh`. Returns the faces drawn. */
+int __not_in_flash_func(mesh_draw)(const struct MESH *mesh,
+                                   const struct MESH_POSE *pose,
+                                   const struct MESH_CAMERA *camera);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_MESH_H_FILE
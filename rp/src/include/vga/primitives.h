@@ -0,0 +1,105 @@
+#ifndef VGA_PRIMITIVES_H_FILE
+#define VGA_PRIMITIVES_H_FILE
+
+#include "draw.h"
+
+/* Solid 2D primitives in one palette index, straight into the planar
+ * framebuffer: spans, rectangles, lines, filled circles and convex polygons.
+ * Positions are in viewport coordinates and everything is clipped to the
+ * viewport.
+ *
+ * Spans are the building block. The blocks a span covers whole are written
+ * as two plane-pair words each, without reading them back; only the two end
+ * blocks merge through a mask. Lines step one bit along the row and one
+ * framebuffer line down, merging a single pixel into the four planes.
+ */
+
+/* Fractional bits of polygon vertices */
+#define DRAW_SUBPIXEL_BITS 4
+/* Vertices a polygon may have, before clipping */
+#define DRAW_MAX_POLYGON_VERTICES 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Polygon vertex in 1/16 pixels, viewport coordinates */
+struct DRAW_VERTEX {
+  int32_t x;
+  int32_t y;
+};
+
+/* The four plane words of a palette index repeated over a block, as two
+ * 32-bit halves: planes 0 and 1, then 2 and 3 */
+struct DRAW_COLOR {
+  uint32_t lo;
+  uint32_t hi;
+};
+
+static inline __attribute__((always_inline)) struct DRAW_COLOR draw_color(
+    int color) {
+  struct DRAW_COLOR c;
+  c.lo = (color & 1 ? 0x0000FFFFu : 0) | (color & 2 ? 0xFFFF0000u : 0);
+  c.hi = (color & 4 ? 0x0000FFFFu : 0) | (color & 8 ? 0xFFFF0000u : 0);
+  return c;
+}
+
+/* Fill screen pixels [x0, x1) of a framebuffer line, already clipped:
+ * x0 < x1, both within the line */
+static inline __attribute__((always_inline)) void draw_fill_span(
+    uint32_t *line, int x0, int x1, struct DRAW_COLOR c) {
+  uint32_t *dst = line + (x0 / VGA_BLOCK_PIXELS) * 2;
+  uint32_t *last = line + ((x1 - 1) / VGA_BLOCK_PIXELS) * 2;
+  uint32_t head = 0xFFFFu >> (x0 & (VGA_BLOCK_PIXELS - 1));
+  const uint32_t tail = (0xFFFF0000u >> (((x1 - 1) & 15) + 1)) & 0xFFFFu;
+  if (dst == last) head &= tail;
+  if (head != 0xFFFFu || dst == last) {
+    const uint32_t m = head | (head << 16);
+    dst[0] = (dst[0] & ~m) | (c.lo & m);
+    dst[1] = (dst[1] & ~m) | (c.hi & m);
+    if (dst == last) return;
+    dst += 2;
+  }
+  while (dst < last) {
+    dst[0] = c.lo;
+    dst[1] = c.hi;
+    dst += 2;
+  }
+  const uint32_t m = tail | (tail << 16);
+  dst[0] = (dst[0] & ~m) | (c.lo & m);
+  dst[1] = (dst[1] & ~m) | (c.hi & m);
+}
+
+/* Pixels [x0, x1) of row y */
+void __not_in_flash_func(draw_span)(int x0, int x1, int y, int color);
+
+/* Filled rectangle [x0, x1) x [y0, y1) */
+void __not_in_flash_func(draw_fill_rect)(int x0, int y0, int x1, int y1,
+                                         int color);
+
+/* One-pixel outline of the rectangle [x0, x1) x [y0, y1) */
+void __not_in_flash_func(draw_rect)(int x0, int y0, int x1, int y1,
+                                    int color);
+
+/* Bresenham line from (x0, y0) to (x1, y1), both ends drawn. Clipping picks
+ * the same pixels the whole line would have. */
+void __not_in_flash_func(draw_line)(int x0, int y0, int x1, int y1,
+                                    int color);
+
+/* Disc of radius r around (cx, cy): the pixels with dx² + dy² <= r² + r,
+ * one span per row */
+void __not_in_flash_func(draw_fill_circle)(int cx, int cy, int r, int color);
+
+/* Convex polygon of `count` vertices in either winding. A pixel is filled
+ * when its centre is inside, or on a top or left edge, so polygons sharing an
+ * edge never overlap. Polygons not inside the viewport are clipped to it
+ * first (Sutherland-Hodgman); then each row is one span between the two
+ * edge chains, stepped in 16.16 fixed point. */
+void __not_in_flash_func(draw_fill_polygon)(const struct DRAW_VERTEX *v,
+                                            int count, int color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_PRIMITIVES_H_FILE
@@ -0,0 +1,63 @@
+#ifndef VGA_SURFACE_H_FILE
+#define VGA_SURFACE_H_FILE
+
+#include "draw.h"
+
+/* Offscreen planar surface: a render target laid out like the framebuffer,
+ * four interleaved plane words per 16-pixel block, so the draw_* and font_*
+ * functions draw into it while it is bound with surface_begin.
+ *
+ * surface_end caches what was drawn as a pre-masked planar sprite, the
+ * pixels of the key index left out, and `sprite` refers to it. The surface
+ * is then blitted at any position like any planar sprite: with surface_draw,
+ * compose_sprite or a display list. Objects made of several primitives that
+ * rarely change (a character with its speech bubble, a HUD panel, a logo)
+ * are rendered once and blitted every frame.
+ */
+
+/* surface_init key: every pixel of the surface is opaque */
+#define SURFACE_KEY_NONE (-1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct VGA_SURFACE {
+  int width; /* whole blocks */
+  int height;
+  int key;        /* palette index left out of the blit, or SURFACE_KEY_NONE */
+  uint32_t *data; /* height rows of width / 8 words, as the framebuffer */
+  struct PLANAR_SPRITE planar; /* the cached blit */
+  struct SPRITE sprite; /* the cached blit, for transparent draws only */
+};
+
+/* Allocate a surface of `width` (rounded up to whole blocks) x `height`
+ * pixels and its blit cache, cleared. Returns 0, or VGA_ERROR_ALLOC. */
+int surface_init(struct VGA_SURFACE *surface, int width, int height,
+                 int key);
+void surface_free(struct VGA_SURFACE *surface);
+
+/* Fill the surface with the key index, index 0 when there is none */
+void surface_clear(struct VGA_SURFACE *surface);
+
+/* Draw into the surface until surface_end, through a viewport over all of
+ * it. Surfaces do not nest, and while one is bound the compositor, the
+ * tilemap view, draw_reset_viewport and vga_swap_framebuffers are off
+ * limits: they work on the screen. */
+void surface_begin(struct VGA_SURFACE *surface);
+
+/* Back to the hidden framebuffer and its viewport. The blit cache of the
+ * surface is rebuilt from what it now holds. */
+void surface_end(void);
+
+/* Blit the surface at (x, y) from its cache */
+static inline void __not_in_flash_func(surface_draw)(
+    const struct VGA_SURFACE *surface, int x, int y) {
+  draw_sprite_planar(&surface->planar, x, y, false);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_SURFACE_H_FILE
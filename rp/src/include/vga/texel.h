@@ -0,0 +1,106 @@
+#ifndef VGA_TEXEL_H_FILE
+#define VGA_TEXEL_H_FILE
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if VGA_INTERP
+#include "hardware/interp.h"
+#endif
+
+/* Texel addressing for power-of-two byte textures, one texel per byte, row
+ * after row. Built with VGA_INTERP, it runs on interp0 of the calling core:
+ * lane 0 takes u, lane 1 takes v, each shifted and masked to its field of
+ * the texel offset, and the full result adds the texture base, so a texel is
+ * a register read and a byte load. Without it, the same arithmetic runs in
+ * software on one state shared by both cores, so a single core at a time
+ * uses it (host builds and boards without the interpolators).
+ *
+ * Two configurations:
+ * - the stepper walks 16.16 coordinates (u, v) by (du, dv) per texel;
+ * - the packed lookup takes u in bits 0-7 and v in bits 8-15 of one word, for
+ *   textures of up to 256 x 256 texels.
+ * Both wrap around the texture. Whatever configured interp0 last owns it.
+ *
+ * interp1 is left alone. The only other table walked per pixel is the
+ * tunnel's angle and depth table (vga/effects.h), read in order. Its mirrored
+ * quarters need the angle negated, which the lanes cannot do, so interp1
+ * would only add register writes per cell to what the CPU does anyway.
+ */
+
+/* Fractional bits of the stepper coordinates */
+#define TEXEL_FRACTION_BITS 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !VGA_INTERP
+/* The two lanes, in software (vga_texel.c) */
+struct TEXEL_LANES {
+  uint32_t accum[2];
+  uint32_t step[2];
+  uint32_t mask[2];
+  uint8_t shift[2];
+  const uint8_t *texels;
+};
+extern struct TEXEL_LANES texel_lanes;
+#endif
+
+/* Step through `texels`, 2^width_bits x 2^height_bits, both at least 1 */
+void texel_set_stepper(const uint8_t *texels, int width_bits,
+                       int height_bits);
+/* Look up packed coordinates in `texels`, both sizes 1 to 8 bits */
+void texel_set_packed(const uint8_t *texels, int width_bits,
+                      int height_bits);
+
+/* Stepper: start at (u, v), moving (du, dv) per texel_next */
+static inline __attribute__((always_inline)) void texel_start(uint32_t u,
+                                                              uint32_t v,
+                                                              uint32_t du,
+                                                              uint32_t dv) {
+#if VGA_INTERP
+  interp0->accum[0] = u;
+  interp0->accum[1] = v;
+  interp0->base[0] = du;
+  interp0->base[1] = dv;
+#else
+  texel_lanes.accum[0] = u;
+  texel_lanes.accum[1] = v;
+  texel_lanes.step[0] = du;
+  texel_lanes.step[1] = dv;
+#endif
+}
+
+/* Stepper: the texel at the current coordinates, then step */
+static inline __attribute__((always_inline)) uint32_t texel_next(void) {
+#if VGA_INTERP
+  return *(const uint8_t *)interp0->pop[2];
+#else
+  struct TEXEL_LANES *l = &texel_lanes;
+  const uint32_t t = l->texels[((l->accum[0] >> l->shift[0]) & l->mask[0]) +
+                               ((l->accum[1] >> l->shift[1]) & l->mask[1])];
+  l->accum[0] += l->step[0];
+  l->accum[1] += l->step[1];
+  return t;
+#endif
+}
+
+/* Packed lookup: the texel at u = bits 0-7, v = bits 8-15 */
+static inline __attribute__((always_inline)) uint32_t texel_at(
+    uint32_t packed) {
+#if VGA_INTERP
+  interp0->accum[0] = packed;
+  return *(const uint8_t *)interp0->peek[2];
+#else
+  const struct TEXEL_LANES *l = &texel_lanes;
+  return l->texels[((packed >> l->shift[0]) & l->mask[0]) +
+                   ((packed >> l->shift[1]) & l->mask[1])];
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_TEXEL_H_FILE
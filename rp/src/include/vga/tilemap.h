@@ -0,0 +1,100 @@
+#ifndef VGA_TILEMAP_H_FILE
+#define VGA_TILEMAP_H_FILE
+
+#include "draw.h"
+
+/* Scrolling tilemap. A map is a grid of cells, each naming a tile of the
+ * tile set, optionally mirrored, or an animation. Maps wrap around, so any
+ * camera position is valid.
+ *
+ * A view renders the map into a ring buffer, planar, one block wider than
+ * the screen and as tall as the drawable area. Moving the camera only
+ * renders the block columns and pixel rows it exposes, and an animation
+ * step only re-renders its visible cells. Drawing the view copies the ring
+ * into the hidden framebuffer, shifted by the camera's sub-block offset.
+ */
+
+/* Cell bits: tile index (or animation index with TILEMAP_CELL_ANIM) and
+ * flips. The frames of an animation are cells themselves, without the
+ * TILEMAP_CELL_ANIM bit; the flips of the animated cell are applied on top.
+ */
+#define TILEMAP_CELL_INDEX 0x0FFF
+#define TILEMAP_CELL_ANIM 0x1000
+#define TILEMAP_CELL_FLIP_X 0x4000
+#define TILEMAP_CELL_FLIP_Y 0x8000
+
+/* Animations a map may have */
+#define TILEMAP_MAX_ANIMS 8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct TILEMAP_ANIM {
+  const uint16_t *frames; /* num_frames cells */
+  uint8_t num_frames;
+  uint8_t frame_ticks; /* view updates per frame */
+};
+
+struct TILEMAP {
+  int width; /* in cells */
+  int height;
+  const uint16_t *cells; /* width * height, row after row */
+  /* Tile set: same size for all tiles, a whole number of blocks wide, each
+   * with a planar tile copy (sprite_tile_build) */
+  const struct SPRITE *tiles;
+  int num_tiles;
+  const struct TILEMAP_ANIM *anims;
+  int num_anims;
+};
+
+struct TILEMAP_VIEW {
+  const struct TILEMAP *map;
+  uint32_t *ring;   /* ring_blocks * ring_rows planar blocks, 2 words each */
+  int ring_blocks;  /* screen blocks + 1 for the sub-block scroll */
+  int ring_rows;    /* drawable rows */
+  int cam_x;        /* world position of the top left screen pixel */
+  int cam_y;
+  int ring_block_x; /* first world block column held by the ring */
+  int ring_y;       /* first world row held by the ring */
+  bool valid;       /* the ring holds the area at ring_block_x, ring_y */
+  unsigned int tick;
+  uint8_t anim_frame[TILEMAP_MAX_ANIMS];
+};
+
+/* Set up a view at (0, 0) and allocate its ring (about 32 KB in 320x200).
+ * Returns 0, or VGA_ERROR_ALLOC when there is no memory or the tile set has
+ * no planar copies to render from. Nothing is rendered until the first
+ * tilemap_view_update. */
+int tilemap_view_init(struct TILEMAP_VIEW *view, const struct TILEMAP *map);
+void tilemap_view_free(struct TILEMAP_VIEW *view);
+
+/* Cell at (cell_x, cell_y), wrapped into the map, with the animation frame
+ * of `tick` resolved (flips combined) */
+uint16_t __not_in_flash_func(tilemap_cell)(const struct TILEMAP *map,
+                                           int cell_x, int cell_y,
+                                           unsigned int tick);
+
+/* Advance the animations by one tick and move the camera to (cam_x,
+ * cam_y), rendering into the ring only what changed */
+void __not_in_flash_func(tilemap_view_update)(struct TILEMAP_VIEW *view,
+                                              int cam_x, int cam_y);
+
+/* Copy the visible area into the drawable rows of the hidden framebuffer */
+void __not_in_flash_func(tilemap_view_draw)(const struct TILEMAP_VIEW *view);
+
+/* Copy screen row y into `dst`, a framebuffer line */
+void __not_in_flash_func(tilemap_view_draw_line)(
+    const struct TILEMAP_VIEW *view, uint32_t *dst, int y);
+
+/* Copy `rows` rows of one screen block column, from screen row y, into
+ * `dst`: two words per row, rows dst_stride words apart */
+void __not_in_flash_func(tilemap_view_draw_block)(
+    const struct TILEMAP_VIEW *view, uint32_t *dst, int dst_stride,
+    int block_x, int y, int rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VGA_TILEMAP_H_FILE
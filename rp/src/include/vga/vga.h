@@ -30,7 +30,21 @@ struct VGA_SCREEN {
   uint8_t color_bits; /* Number of bits per pixel */
   uint8_t current_framebuffer_id;
   uint8_t hidden_framebuffer_id;
-  uint8_t _pad; /* Explicit pad to keep size multiple of 4 if needed */
+  uint8_t offscreen; /* hidden_framebuffer is a surface (vga/surface.h) */
+};
+
+/* Screen rectangle in pixels, [x0, x1) x [y0, y1) */
+struct VGA_RECT {
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+};
+
+/* Screen position in pixels */
+struct VGA_POINT {
+  int16_t x;
+  int16_t y;
 };
 
 /* Global screen state (defined in vga.c) */
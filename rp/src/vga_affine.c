@@ -0,0 +1,202 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "vga/draw.h"
+#include "vga/texel.h"
+
+/* Largest matrix entry, 16.16: scale 256 */
+#define AFFINE_MAX_SCALE (256 << 16)
+/* Bound on texel offsets across the screen box, 16.16 */
+#define AFFINE_MAX_OFFSET (1 << 30)
+
+/* Bits of the smallest power of two holding n, at least 1 */
+static int affine_bits(int n) {
+  int bits = 1;
+  while ((1 << bits) < n) bits++;
+  return bits;
+}
+
+int sprite_texels_build(struct SPRITE *sprites, struct SPRITE_TEXELS *texels,
+                        int count) {
+  size_t total = 0;
+  for (int i = 0; i < count; i++) {
+    texels[i].width_bits = (uint8_t)affine_bits(sprites[i].width);
+    texels[i].height_bits = (uint8_t)affine_bits(sprites[i].height);
+    total += (size_t)sprites[i].height << texels[i].width_bits;
+  }
+  /* One allocation for the whole set, owned by the first copy */
+  uint8_t *buffer = malloc(total);
+  if (buffer == NULL) {
+    DPRINTF("Failed to allocate %u bytes for sprite texels\n",
+            (unsigned int)total);
+    return VGA_ERROR_ALLOC;
+  }
+  uint8_t *out = buffer;
+  for (int i = 0; i < count; i++) {
+    const struct SPRITE *spr = &sprites[i];
+    texels[i].data = out;
+    for (int y = 0; y < spr->height; y++) {
+      for (int x = 0; x < 1 << texels[i].width_bits; x++) {
+        const int idx = x < spr->width ? sprite_pixel_index(spr, x, y) : -1;
+        *out++ = (uint8_t)(idx < 0 ? VGA_TEXEL_TRANSPARENT : idx);
+      }
+    }
+    sprites[i].texels = &texels[i];
+  }
+  DPRINTF("Sprite texels built: %d frames, %u bytes\n", count,
+          (unsigned int)total);
+  return 0;
+}
+
+void sprite_texels_free(struct SPRITE_TEXELS *texels) {
+  free((void *)texels[0].data);
+}
+
+void draw_affine_rotation(struct DRAW_AFFINE *m, int angle, int32_t scale_x,
+                          int32_t scale_y) {
+  const int64_t s = vga_sin(angle), c = vga_cos(angle);
+  m->a = (int32_t)((c * scale_x) >> VGA_SINE_BITS);
+  m->b = (int32_t)((-s * scale_y) >> VGA_SINE_BITS);
+  m->c = (int32_t)((s * scale_x) >> VGA_SINE_BITS);
+  m->d = (int32_t)((c * scale_y) >> VGA_SINE_BITS);
+}
+
+static inline int floor_div(int32_t a, int32_t b) {
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/* Narrow [*lo, *hi) to the steps k with 0 <= p + k * dp < limit */
+static inline void affine_range(int32_t p, int32_t dp, int32_t limit,
+                                int *lo, int *hi) {
+  int first, end;
+  if (dp > 0) {
+    first = -floor_div(p, dp);
+    end = -floor_div(p - limit, dp);
+  } else if (dp < 0) {
+    first = floor_div(p - limit, -dp) + 1;
+    end = floor_div(p, -dp) + 1;
+  } else {
+    if (p < 0 || p >= limit) *hi = *lo;
+    return;
+  }
+  if (first > *lo) *lo = first;
+  if (end < *hi) *hi = end;
+}
+
+/* `count` pixels of a row from screen column dx, every texel in the sprite:
+ * stepped through the byte copy, or decoded from the sprite data. Each
+ * destination block is merged once when the row leaves it. */
+static inline __attribute__((always_inline)) void affine_row(
+    const struct SPRITE *spr, uint16_t *line, int dx, int count, uint32_t u,
+    uint32_t v, uint32_t du, uint32_t dv, const bool stepper) {
+  uint64_t set = 0;
+  uint32_t covered = 0;
+  if (stepper) texel_start(u, v, du, dv);
+  for (; count > 0; count--, dx++) {
+    int idx;
+    if (stepper) {
+      const uint32_t t = texel_next();
+      idx = t == VGA_TEXEL_TRANSPARENT ? -1 : (int)t;
+    } else {
+      idx = sprite_texel_index(spr, (int)(u >> 16), (int)(v >> 16));
+      u += du;
+      v += dv;
+    }
+    const int pos = dx & (VGA_BLOCK_PIXELS - 1);
+    if (idx >= 0) {
+      covered |= 0x8000u >> pos;
+      set |= pixel_masks_flat[(idx << 4) | pos];
+    }
+    if (pos == VGA_BLOCK_PIXELS - 1) {
+      if (covered)
+        draw_merge_block(line + (dx >> 4) * VGA_NUM_BITPLANES, covered, set);
+      set = 0;
+      covered = 0;
+    }
+  }
+  if (covered)
+    draw_merge_block(line + ((dx - 1) >> 4) * VGA_NUM_BITPLANES, covered, set);
+}
+
+void __not_in_flash_func(draw_sprite_affine)(const struct SPRITE *spr, int x,
+                                             int y,
+                                             const struct DRAW_AFFINE *m,
+                                             int pivot_x, int pivot_y) {
+  if (m->a > AFFINE_MAX_SCALE || m->a < -AFFINE_MAX_SCALE ||
+      m->b > AFFINE_MAX_SCALE || m->b < -AFFINE_MAX_SCALE ||
+      m->c > AFFINE_MAX_SCALE || m->c < -AFFINE_MAX_SCALE ||
+      m->d > AFFINE_MAX_SCALE || m->d < -AFFINE_MAX_SCALE)
+    return;
+  /* Inverse matrix, 16.16 */
+  const int64_t det = (int64_t)m->a * m->d - (int64_t)m->b * m->c;
+  if (det == 0) return;
+  const int64_t one = INT64_C(1) << 32;
+  const int64_t inv[4] = {m->d * one / det, -m->b * one / det,
+                          -m->c * one / det, m->a * one / det};
+  int64_t step = 0;
+  for (int i = 0; i < 4; i++) {
+    const int64_t magnitude = inv[i] < 0 ? -inv[i] : inv[i];
+    if (magnitude > step) step = magnitude;
+  }
+
+  /* Screen box of the four corners, from the draw position */
+  int64_t x_min = INT64_MAX, x_max = INT64_MIN;
+  int64_t y_min = INT64_MAX, y_max = INT64_MIN;
+  for (int corner = 0; corner < 4; corner++) {
+    const int64_t u = (corner & 1 ? spr->width : 0) - pivot_x;
+    const int64_t v = (corner & 2 ? spr->height : 0) - pivot_y;
+    const int64_t sx = m->a * u + m->b * v, sy = m->c * u + m->d * v;
+    if (sx < x_min) x_min = sx;
+    if (sx > x_max) x_max = sx;
+    if (sy < y_min) y_min = sy;
+    if (sy > y_max) y_max = sy;
+  }
+  const int box_x = (int)(x_min >> 16), box_y = (int)(y_min >> 16);
+  const int box_w = (int)(x_max >> 16) + 1 - box_x;
+  const int box_h = (int)(y_max >> 16) + 1 - box_y;
+  /* Texel coordinates anywhere in the box stay within 32 bits */
+  if (step * (box_w + box_h) >= AFFINE_MAX_OFFSET) return;
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(x + box_x, y + box_y, box_w, box_h, &c)) return;
+  const int32_t du_x = (int32_t)inv[0], du_y = (int32_t)inv[1];
+  const int32_t dv_x = (int32_t)inv[2], dv_y = (int32_t)inv[3];
+
+  /* Texel under the centre of the first visible pixel of the box */
+  const int64_t off_x = (int64_t)(box_x + c.x_start) * 65536 + 0x8000;
+  const int64_t off_y = (int64_t)(box_y + c.row_start) * 65536 + 0x8000;
+  const int32_t width = spr->width << 16, height = spr->height << 16;
+  int32_t row_u =
+      pivot_x * 65536 + (int32_t)((du_x * off_x + du_y * off_y) >> 16);
+  int32_t row_v =
+      pivot_y * 65536 + (int32_t)((dv_x * off_x + dv_y * off_y) >> 16);
+
+  const bool stepper = spr->texels && !spr->remap;
+  if (stepper)
+    texel_set_stepper(spr->texels->data, spr->texels->width_bits,
+                      spr->texels->height_bits);
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const int columns = c.x_end - c.x_start;
+  for (int r = c.row_start; r < c.row_end;
+       r++, row_u += du_y, row_v += dv_y) {
+    /* The columns of the row inside the sprite */
+    int lo = 0, hi = columns;
+    affine_range(row_u, du_x, width, &lo, &hi);
+    affine_range(row_v, dv_x, height, &lo, &hi);
+    if (lo >= hi) continue;
+    uint32_t u = (uint32_t)(row_u + lo * du_x);
+    uint32_t du = (uint32_t)du_x;
+    if (spr->flip_x) {
+      /* Mirrored: [0, width) read from the other end */
+      u = (uint32_t)(width - 1) - u;
+      du = 0u - du;
+    }
+    const uint32_t v = (uint32_t)(row_v + lo * dv_x);
+    uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                     (c.y + r) * line_blocks * VGA_NUM_BITPLANES;
+    const int dx = c.x + c.x_start + lo;
+    if (stepper)
+      affine_row(spr, line, dx, hi - lo, u, v, du, (uint32_t)dv_x, true);
+    else
+      affine_row(spr, line, dx, hi - lo, u, v, du, (uint32_t)dv_x, false);
+  }
+}
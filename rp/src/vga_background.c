@@ -0,0 +1,62 @@
+#include "vga/background.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/dma.h"
+
+static uint32_t *snapshot;
+static size_t snapshot_words;
+static int restore_channel = -1;
+
+/* 32-bit words of the drawable rows (the status bar is not restored) */
+static inline size_t background_words(void) {
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  return (size_t)drawable_height * vga_screen.width * vga_screen.color_bits /
+         32;
+}
+
+int background_init(void) {
+  snapshot_words = background_words();
+  snapshot = malloc(snapshot_words * sizeof(uint32_t));
+  if (snapshot == NULL) {
+    DPRINTF("Not enough memory for the background snapshot (%u bytes)\n",
+            (unsigned int)(snapshot_words * sizeof(uint32_t)));
+    return VGA_ERROR_ALLOC;
+  }
+  restore_channel = dma_claim_unused_channel(false);
+  if (restore_channel < 0) {
+    DPRINTF("No DMA channel for the background snapshot\n");
+    free(snapshot);
+    snapshot = NULL;
+    return VGA_ERROR_ALLOC;
+  }
+  /* Unpaced memory to memory copy. It shares the bus with the ROM emulation
+   * channels one transfer at a time, so their latency barely changes. */
+  dma_channel_config cfg = dma_channel_get_default_config(restore_channel);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, true);
+  dma_channel_configure(restore_channel, &cfg, NULL, snapshot, snapshot_words,
+                        false);
+  DPRINTF("Background snapshot: %u bytes, DMA channel %d\n",
+          (unsigned int)(snapshot_words * sizeof(uint32_t)), restore_channel);
+  return 0;
+}
+
+void background_capture(void) {
+  memcpy(snapshot, vga_screen.hidden_framebuffer,
+         snapshot_words * sizeof(uint32_t));
+}
+
+void __not_in_flash_func(background_restore_start)(void) {
+  /* The read address advanced during the last copy; the transfer count is
+   * reloaded by the trigger */
+  dma_channel_set_read_addr(restore_channel, snapshot, false);
+  dma_channel_set_write_addr(restore_channel, vga_screen.hidden_framebuffer,
+                             true);
+}
+
+void __not_in_flash_func(background_restore_wait)(void) {
+  dma_channel_wait_for_finish_blocking(restore_channel);
+}
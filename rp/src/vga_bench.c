@@ -0,0 +1,512 @@
+#include "vga/bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/time.h"
+#include "vga/blitter.h"
+#include "vga/chunky.h"
+#include "vga/effects.h"
+#include "vga/mesh.h"
+
+/* Draw `spr` at BENCH_DRAWS positions and return the elapsed microseconds.
+ * The walk is deterministic so every format covers the same pixels. */
+static uint32_t bench_draw_walk(const struct SPRITE *spr) {
+  const int range_x = vga_screen.width + spr->width;
+  const int range_y = vga_screen.height - VGA_STATUS_BAR_OFFSET + spr->height;
+  uint32_t start = time_us_32();
+  for (int i = 0; i < BENCH_DRAWS; i++) {
+    int x = (i * 37) % range_x - spr->width / 2;
+    int y = (i * 23) % range_y - spr->height / 2;
+    draw_sprite(spr, x, y, true);
+  }
+  return time_us_32() - start;
+}
+
+static void bench_report(const char *name, uint32_t elapsed_us, int draws) {
+  DPRINTF("  %-9s %7u us  %5u ns/draw\n", name, (unsigned int)elapsed_us,
+          (unsigned int)((uint64_t)elapsed_us * 1000u / draws));
+}
+
+/* RGB6 copy of a packed sprite in `copy`, each index as the first RGB6 value
+ * that maps to it. Returns the data to free, or NULL. */
+static unsigned int *bench_rgb6_copy(const struct SPRITE *spr,
+                                     struct SPRITE *copy) {
+  uint8_t index_rgb[16];
+  for (int idx = 0; idx < 16; idx++) {
+    index_rgb[idx] = VGA_TRANSPARENT_PIXEL;
+    for (int rgb = 63; rgb >= 0; rgb--) {
+      if (rgb2index[rgb] == idx) index_rgb[idx] = (uint8_t)(0xC0 | rgb);
+    }
+  }
+  memset(copy, 0, sizeof(*copy));
+  copy->width = spr->width;
+  copy->height = spr->height;
+  copy->stride = (unsigned int)(spr->width + VGA_GROUP_PIXELS - 1) /
+                 VGA_GROUP_PIXELS;
+  copy->flip_x = spr->flip_x;
+  unsigned int *data = malloc(copy->stride * copy->height * sizeof(*data));
+  if (data == NULL) {
+    DPRINTF("  no memory for the chunky copy\n");
+    return NULL;
+  }
+  for (int y = 0; y < spr->height; y++) {
+    uint8_t *row = (uint8_t *)&data[copy->stride * y];
+    for (int x = 0; x < spr->width; x++) {
+      int idx = sprite_pixel_index(spr, x, y);
+      row[x] = idx < 0 ? VGA_TRANSPARENT_PIXEL : index_rgb[idx];
+    }
+  }
+  copy->data = data;
+  return data;
+}
+
+void bench_sprite_formats(const struct SPRITE *spr) {
+  DPRINTF("Sprite formats, %dx%d, %d draws:\n", spr->width, spr->height,
+          BENCH_DRAWS);
+
+  /* Strip the optional copies so draw_sprite takes one path at a time */
+  struct SPRITE plain = *spr;
+  plain.planar = NULL;
+  plain.compiled = NULL;
+  plain.spans = NULL;
+  const bool packed = spr->format == SPRITE_FORMAT_PACKED4;
+  bench_report(packed ? "packed" : "chunky", bench_draw_walk(&plain),
+               BENCH_DRAWS);
+  if (packed) {
+    /* The same frame as RGB6, through the chunky blitter */
+    struct SPRITE chunky;
+    unsigned int *data = bench_rgb6_copy(spr, &chunky);
+    if (data != NULL) {
+      bench_report("chunky", bench_draw_walk(&chunky), BENCH_DRAWS);
+      free(data);
+    }
+  }
+
+  if (spr->planar) {
+    struct SPRITE planar = plain;
+    planar.planar = spr->planar;
+    bench_report("planar", bench_draw_walk(&planar), BENCH_DRAWS);
+  }
+
+  struct SPRITE spanned = plain;
+  struct SPAN_SPRITE spans;
+  if (sprite_span_build(&spanned, &spans, 1) == 0) {
+    DPRINTF("  spans: bbox %dx%d of %dx%d\n", spans.bbox_w, spans.bbox_h,
+            spans.width, spans.height);
+    bench_report("spans", bench_draw_walk(&spanned), BENCH_DRAWS);
+    sprite_span_free(&spans);
+  }
+
+  if (spr->compiled) {
+    /* Clipped positions fall back to the sprite's own format */
+    struct SPRITE compiled = plain;
+    compiled.compiled = spr->compiled;
+    bench_report("compiled", bench_draw_walk(&compiled), BENCH_DRAWS);
+  }
+
+  vga_clear_screen();
+}
+
+/* Fill the drawable screen with `tile` BENCH_TILE_SCREENS times; returns the
+ * elapsed microseconds and the number of tiles drawn */
+static uint32_t bench_tile_screens(const struct SPRITE *tile, int *draws) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  *draws = 0;
+  uint32_t start = time_us_32();
+  for (int i = 0; i < BENCH_TILE_SCREENS; i++) {
+    for (int y = 0; y < draw_height; y += tile->height) {
+      for (int x = 0; x < vga_screen.width; x += tile->width) {
+        draw_tile(tile, x, y);
+        (*draws)++;
+      }
+    }
+  }
+  return time_us_32() - start;
+}
+
+void bench_tile_formats(const struct SPRITE *tile) {
+  DPRINTF("Tile formats, %dx%d, %d screens:\n", tile->width, tile->height,
+          BENCH_TILE_SCREENS);
+  int draws;
+  uint32_t elapsed;
+  if (tile->planar_tile) {
+    elapsed = bench_tile_screens(tile, &draws);
+    bench_report("planar", elapsed, draws);
+  }
+  /* Without the planar copy, the format's own converter */
+  struct SPRITE plain = *tile;
+  plain.planar_tile = NULL;
+  elapsed = bench_tile_screens(&plain, &draws);
+  bench_report(tile->format == SPRITE_FORMAT_PACKED4 ? "packed" : "chunky",
+               elapsed, draws);
+  if (tile->format != SPRITE_FORMAT_PACKED4) {
+    vga_clear_screen();
+    return;
+  }
+
+  /* RGB6 copy of the packed tile */
+  struct SPRITE chunky;
+  unsigned int *data = bench_rgb6_copy(tile, &chunky);
+  if (data != NULL) {
+    elapsed = bench_tile_screens(&chunky, &draws);
+    bench_report("chunky", elapsed, draws);
+    free(data);
+  }
+
+  vga_clear_screen();
+}
+
+/* BENCH_COMPOSE_FRAMES frames of `count` sprites packed in a third of the
+ * screen, drawn directly (mode < 0) or composited; returns microseconds */
+static uint32_t bench_compose_frames(const struct SPRITE *spr, int count,
+                                     int mode) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int area_w = vga_screen.width / 3;
+  const int area_h = draw_height / 3;
+  const int x0 = (vga_screen.width - area_w - spr->width) / 2;
+  const int y0 = (draw_height - area_h - spr->height) / 2;
+  if (mode >= 0) compose_set_mode((enum COMPOSE_MODE)mode);
+  uint32_t start = time_us_32();
+  for (int f = 0; f < BENCH_COMPOSE_FRAMES; f++) {
+    if (mode >= 0) compose_begin(NULL);
+    for (int i = 0; i < count; i++) {
+      int x = x0 + (i * 37 + f) % area_w;
+      int y = y0 + (i * 23 + f) % area_h;
+      if (mode >= 0)
+        compose_sprite(spr, x, y);
+      else
+        draw_sprite(spr, x, y, true);
+    }
+    if (mode >= 0) compose_end();
+  }
+  return time_us_32() - start;
+}
+
+void bench_compose_modes(const struct SPRITE *spr) {
+  static const int counts[] = {16, 64, 127};
+  DPRINTF("Compositing, %dx%d sprites, %d frames:\n", spr->width,
+          spr->height, BENCH_COMPOSE_FRAMES);
+  for (unsigned int i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+    DPRINTF(" %d sprites:\n", counts[i]);
+    const int draws = counts[i] * BENCH_COMPOSE_FRAMES;
+    bench_report("direct", bench_compose_frames(spr, counts[i], -1), draws);
+    bench_report("bins", bench_compose_frames(spr, counts[i], COMPOSE_BINS),
+                 draws);
+    bench_report("scanlines",
+                 bench_compose_frames(spr, counts[i], COMPOSE_SCANLINES),
+                 draws);
+  }
+  compose_set_mode(COMPOSE_BINS);
+}
+
+/* Run `setup` over the four planes of the drawable rows,
+ * BENCH_BLITTER_SCREENS times, reading the planes of `src` from bit column
+ * src_x when it is not NULL; returns microseconds */
+static uint32_t bench_blitter_screens(const struct VGA_BLITTER *setup,
+                                      const uint16_t *src, int src_x) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  uint16_t *dst = (uint16_t *)vga_screen.hidden_framebuffer;
+  if (src) src += src_x / VGA_BLOCK_PIXELS * VGA_NUM_BITPLANES;
+  uint32_t start = time_us_32();
+  for (int i = 0; i < BENCH_BLITTER_SCREENS; i++) {
+    for (int p = 0; p < VGA_NUM_BITPLANES; p++) {
+      struct VGA_BLITTER blt = *setup;
+      blt.dst_addr = dst + p;
+      if (src) blt.src_addr = src + p;
+      blt.y_count = (uint16_t)draw_height;
+      blitter_run(&blt);
+    }
+  }
+  return time_us_32() - start;
+}
+
+void bench_blitter_ops(void) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int pitch = vga_screen.width / 2; /* bytes per row */
+  const uint16_t *front = (const uint16_t *)vga_screen.current_framebuffer;
+  DPRINTF("Blitter, %d screens:\n", BENCH_BLITTER_SCREENS);
+
+  uint32_t start = time_us_32();
+  for (int i = 0; i < BENCH_BLITTER_SCREENS; i++)
+    memset(vga_screen.hidden_framebuffer, 0, (size_t)draw_height * pitch);
+  bench_report("memset", time_us_32() - start, BENCH_BLITTER_SCREENS);
+
+  /* One plane: every fourth word */
+  struct VGA_BLITTER blt = {0};
+  for (int i = 0; i < 16; i++) blt.halftone[i] = (i & 1) ? 0xAAAAu : 0x5555u;
+  blt.src_x_inc = VGA_NUM_BITPLANES * sizeof(uint16_t);
+  blt.dst_x_inc = VGA_NUM_BITPLANES * sizeof(uint16_t);
+  blitter_set_span(&blt, 0, 0, vga_screen.width, pitch, pitch);
+  blt.hop = BLITTER_HOP_HALFTONE;
+  blt.op = BLITTER_OP_SOURCE;
+  bench_report("fill", bench_blitter_screens(&blt, NULL, 0),
+               BENCH_BLITTER_SCREENS);
+  blt.hop = BLITTER_HOP_ONES;
+  blt.op = BLITTER_OP_XOR;
+  bench_report("xor", bench_blitter_screens(&blt, NULL, 0),
+               BENCH_BLITTER_SCREENS);
+
+  /* Three pixels to the left, so every word is skewed */
+  const int src_x = 3;
+  blitter_set_span(&blt, src_x, 0, vga_screen.width - VGA_BLOCK_PIXELS,
+                   pitch, pitch);
+  blt.hop = BLITTER_HOP_SOURCE;
+  blt.op = BLITTER_OP_SOURCE;
+  bench_report("copy", bench_blitter_screens(&blt, front, src_x),
+               BENCH_BLITTER_SCREENS);
+  blt.op = BLITTER_OP_OR;
+  bench_report("or", bench_blitter_screens(&blt, front, src_x),
+               BENCH_BLITTER_SCREENS);
+
+  vga_clear_screen();
+}
+
+/* Build the benchmark cube: each side as a grid of quads, clockwise seen
+ * from outside. Returns false without memory. */
+static bool bench_mesh_build(struct MESH *mesh, int half) {
+  /* Per side: outward normal, then u and v with u x v = -normal */
+  static const int8_t sides[6][3][3] = {
+      {{0, 0, -1}, {1, 0, 0}, {0, 1, 0}},  {{0, 0, 1}, {0, 1, 0}, {1, 0, 0}},
+      {{-1, 0, 0}, {0, 1, 0}, {0, 0, 1}},  {{1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+      {{0, -1, 0}, {0, 0, 1}, {1, 0, 0}},  {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}},
+  };
+  const int n = BENCH_MESH_DIVISIONS;
+  const int side_vertices = (n + 1) * (n + 1);
+  struct MESH_VERTEX *vertices = malloc(6 * side_vertices * sizeof(*vertices));
+  struct MESH_FACE *faces = malloc(6 * n * n * sizeof(*faces));
+  if (vertices == NULL || faces == NULL) {
+    free(vertices);
+    free(faces);
+    return false;
+  }
+  struct MESH_VERTEX *v = vertices;
+  struct MESH_FACE *f = faces;
+  for (int s = 0; s < 6; s++) {
+    const int8_t(*axes)[3] = sides[s];
+    for (int j = 0; j <= n; j++) {
+      for (int i = 0; i <= n; i++) {
+        const int a = 2 * half * i / n - half, b = 2 * half * j / n - half;
+        v->x = (int16_t)(axes[0][0] * half + axes[1][0] * a + axes[2][0] * b);
+        v->y = (int16_t)(axes[0][1] * half + axes[1][1] * a + axes[2][1] * b);
+        v->z = (int16_t)(axes[0][2] * half + axes[1][2] * a + axes[2][2] * b);
+        v++;
+      }
+    }
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        const int corner = s * side_vertices + j * (n + 1) + i;
+        f->count = 4;
+        f->color = (uint8_t)(1 + (s * 2 + ((i + j) & 1)) % 15);
+        f->index[0] = (uint8_t)corner;
+        f->index[1] = (uint8_t)(corner + 1);
+        f->index[2] = (uint8_t)(corner + n + 2);
+        f->index[3] = (uint8_t)(corner + n + 1);
+        f++;
+      }
+    }
+  }
+  mesh->vertices = vertices;
+  mesh->faces = faces;
+  mesh->num_vertices = (uint16_t)(6 * side_vertices);
+  mesh->num_faces = (uint16_t)(6 * n * n);
+  return true;
+}
+
+void bench_mesh(void) {
+  static const int distances[] = {160, 320, 640};
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  struct MESH mesh;
+  if (!bench_mesh_build(&mesh, 64)) {
+    DPRINTF("Mesh: no memory for the cube\n");
+    return;
+  }
+  DPRINTF("Mesh, %d faces, %d frames:\n", mesh.num_faces, BENCH_MESH_FRAMES);
+  const struct MESH_CAMERA camera = {256, 16, (int16_t)(vga_screen.width / 2),
+                                     (int16_t)(draw_height / 2)};
+  for (unsigned int d = 0; d < sizeof(distances) / sizeof(distances[0]);
+       d++) {
+    struct MESH_POSE pose = {{{0}}, 0, 0, distances[d]};
+    int drawn = 0;
+    uint32_t start = time_us_32();
+    for (int f = 0; f < BENCH_MESH_FRAMES; f++) {
+      mesh_pose_rotation(&pose, f * 7, f * 5, f * 3);
+      drawn += mesh_draw(&mesh, &pose, &camera);
+    }
+    const uint32_t elapsed = time_us_32() - start;
+    const uint32_t frame_us = elapsed / BENCH_MESH_FRAMES;
+    DPRINTF("  z %3d: %3d faces %6u us/frame  %5u faces at 50 fps\n",
+            distances[d], drawn / BENCH_MESH_FRAMES, (unsigned int)frame_us,
+            (unsigned int)((uint64_t)drawn * 20000u / (elapsed ? elapsed : 1)));
+  }
+  free((void *)mesh.vertices);
+  free((void *)mesh.faces);
+  vga_clear_screen();
+}
+
+/* BENCH_CHUNKY_FRAMES frames of `count` sprites spread over the drawable
+ * rows, cleared first, drawn planar or into `frame` when not NULL; returns
+ * microseconds */
+static uint32_t bench_chunky_scene(const struct SPRITE *spr, int count,
+                                   struct CHUNKY_FRAME *frame) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int range_x = vga_screen.width - spr->width;
+  const int range_y = draw_height - spr->height;
+  uint32_t start = time_us_32();
+  for (int f = 0; f < BENCH_CHUNKY_FRAMES; f++) {
+    if (frame)
+      chunky_clear(frame, 0);
+    else
+      memset(vga_screen.hidden_framebuffer, 0,
+             (size_t)draw_height * vga_screen.width / 2);
+    for (int i = 0; i < count; i++) {
+      int x = (i * 37 + f * 3) % range_x;
+      int y = (i * 23 + f * 2) % range_y;
+      if (frame)
+        chunky_draw_sprite(frame, spr, x, y);
+      else
+        draw_sprite(spr, x, y, true);
+    }
+    if (frame) chunky_to_planar(frame, 0, draw_height);
+  }
+  return time_us_32() - start;
+}
+
+void bench_chunky_frames(const struct SPRITE *spr) {
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  struct CHUNKY_FRAME frame;
+  if (chunky_init(&frame, vga_screen.width, draw_height) != 0) {
+    DPRINTF("Chunky frame: no memory\n");
+    return;
+  }
+  DPRINTF("Chunky frame, %dx%d sprites, %d frames:\n", spr->width,
+          spr->height, BENCH_CHUNKY_FRAMES);
+  uint32_t start = time_us_32();
+  for (int f = 0; f < BENCH_CHUNKY_FRAMES; f++)
+    chunky_to_planar(&frame, 0, draw_height);
+  DPRINTF("  conversion %6u us/frame\n",
+          (unsigned int)((time_us_32() - start) / BENCH_CHUNKY_FRAMES));
+  int crossover = 0;
+  for (int count = 1; count <= 256; count *= 2) {
+    const uint32_t planar = bench_chunky_scene(spr, count, NULL);
+    const uint32_t chunky = bench_chunky_scene(spr, count, &frame);
+    DPRINTF("  %3d sprites: planar %6u us  chunky %6u us per frame\n", count,
+            (unsigned int)(planar / BENCH_CHUNKY_FRAMES),
+            (unsigned int)(chunky / BENCH_CHUNKY_FRAMES));
+    if (crossover == 0 && chunky < planar) crossover = count;
+  }
+  if (crossover)
+    DPRINTF("  chunky frame faster from %d sprites\n", crossover);
+  else
+    DPRINTF("  planar faster up to 256 sprites\n");
+  chunky_free(&frame);
+  vga_clear_screen();
+}
+
+static void bench_effect_report(const char *name, uint32_t elapsed_us) {
+  const uint32_t frame_us = elapsed_us / BENCH_EFFECT_FRAMES;
+  DPRINTF("  %-9s %6u us/frame  %s 50 fps\n", name, (unsigned int)frame_us,
+          frame_us <= 20000 ? "within" : "over");
+}
+
+void bench_effects(const struct SPRITE *tile) {
+  static const uint8_t shades[EFFECT_STAR_SHADES] = {15, 14, 7, 8};
+  const int draw_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  struct CHUNKY_FRAME frame;
+  struct EFFECT_TEXTURE plasma, texture;
+  struct EFFECT_TUNNEL tunnel;
+  struct EFFECT_STARFIELD field;
+  if (chunky_init(&frame, vga_screen.width, draw_height) != 0) {
+    DPRINTF("Effects: no memory for the chunky frame\n");
+    return;
+  }
+  DPRINTF("Effects, %d frames:\n", BENCH_EFFECT_FRAMES);
+
+  if (effect_texture_plasma(&plasma, 6, 6) == 0) {
+    uint32_t start = time_us_32();
+    for (int f = 0; f < BENCH_EFFECT_FRAMES; f++) {
+      effect_plasma(&frame, &plasma, f);
+      chunky_to_planar(&frame, 0, draw_height);
+    }
+    bench_effect_report("plasma", time_us_32() - start);
+    effect_texture_free(&plasma);
+  }
+
+  if (effect_texture_from_sprite(&texture, tile, 6, 6) == 0) {
+    uint32_t start = time_us_32();
+    for (int f = 0; f < BENCH_EFFECT_FRAMES; f++) {
+      effect_rotozoom(&frame, &texture, f * 9,
+                      (1 << 16) + vga_sin(f * 13) * 2, f << 16, f << 15);
+      chunky_to_planar(&frame, 0, draw_height);
+    }
+    bench_effect_report("rotozoom", time_us_32() - start);
+
+    if (effect_tunnel_init(&tunnel, vga_screen.width, draw_height) == 0) {
+      start = time_us_32();
+      for (int f = 0; f < BENCH_EFFECT_FRAMES; f++) {
+        effect_tunnel(&frame, &tunnel, &texture, f, f * 2);
+        chunky_to_planar(&frame, 0, draw_height);
+      }
+      bench_effect_report("tunnel", time_us_32() - start);
+      effect_tunnel_free(&tunnel);
+    }
+    effect_texture_free(&texture);
+  }
+
+  if (effect_starfield_init(&field, 256) == 0) {
+    uint32_t start = time_us_32();
+    for (int f = 0; f < BENCH_EFFECT_FRAMES; f++) {
+      chunky_clear(&frame, 0);
+      effect_starfield(&frame, &field, 24, shades);
+      chunky_to_planar(&frame, 0, draw_height);
+    }
+    bench_effect_report("starfield", time_us_32() - start);
+    effect_starfield_free(&field);
+  }
+
+  chunky_free(&frame);
+  vga_clear_screen();
+}
+
+/* Draw `spr` through the matrices of `poses` in turn over the same walk as
+ * bench_draw_walk, and return the elapsed microseconds */
+static uint32_t bench_affine_walk(const struct SPRITE *spr,
+                                  const struct DRAW_AFFINE *poses) {
+  const int range_x = vga_screen.width + spr->width;
+  const int range_y = vga_screen.height - VGA_STATUS_BAR_OFFSET + spr->height;
+  uint32_t start = time_us_32();
+  for (int i = 0; i < BENCH_DRAWS; i++) {
+    int x = (i * 37) % range_x - spr->width / 2;
+    int y = (i * 23) % range_y - spr->height / 2;
+    draw_sprite_affine(spr, x, y, &poses[i % BENCH_AFFINE_POSES],
+                       spr->width / 2, spr->height / 2);
+  }
+  return time_us_32() - start;
+}
+
+void bench_sprite_affine(const struct SPRITE *spr) {
+  DPRINTF("Affine sprite, %dx%d, %d draws:\n", spr->width, spr->height,
+          BENCH_DRAWS);
+  /* A full turn, the scales from 0.5 to 2 spread over it */
+  struct DRAW_AFFINE poses[BENCH_AFFINE_POSES];
+  for (int i = 0; i < BENCH_AFFINE_POSES; i++) {
+    const int step = (i * 7) % BENCH_AFFINE_POSES;
+    const int32_t scale =
+        (1 << 15) + step * (3 << 15) / (BENCH_AFFINE_POSES - 1);
+    draw_affine_rotation(&poses[i],
+                         i * (DRAW_AFFINE_ANGLES / BENCH_AFFINE_POSES), scale,
+                         scale);
+  }
+  struct SPRITE decoded = *spr;
+  decoded.texels = NULL;
+  decoded.remap = NULL;
+  bench_report("decoded", bench_affine_walk(&decoded, poses), BENCH_DRAWS);
+
+  struct SPRITE stepped = decoded;
+  struct SPRITE_TEXELS texels;
+  if (sprite_texels_build(&stepped, &texels, 1) == 0) {
+    bench_report("texels", bench_affine_walk(&stepped, poses), BENCH_DRAWS);
+    sprite_texels_free(&texels);
+  }
+  vga_clear_screen();
+}
@@ -0,0 +1,234 @@
+#include "vga/blitter.h"
+
+/* The source side of a blit: address, the 32-bit shift buffer and the reads
+ * left on the current line */
+struct BLITTER_SOURCE {
+  const uint16_t *addr;
+  uint32_t buffer;
+  int reads;
+  int x_inc; /* words */
+  int y_inc; /* words */
+  bool reverse;
+};
+
+/* Shift the buffer by a word, then read the next one into it unless `read`
+ * is false (NFSR). The last read of a line steps by the Y increment. */
+static inline __attribute__((always_inline)) void blitter_fetch(
+    struct BLITTER_SOURCE *s, const bool read) {
+  s->buffer = s->reverse ? s->buffer >> 16 : s->buffer << 16;
+  if (!read) return;
+  const uint32_t word = *s->addr;
+  s->buffer |= s->reverse ? word << 16 : word;
+  s->addr += --s->reads ? s->x_inc : s->y_inc;
+}
+
+/* Skewed source word through the HOP */
+static inline __attribute__((always_inline)) uint16_t blitter_source(
+    const struct VGA_BLITTER *blt, const struct BLITTER_SOURCE *s, int skew,
+    int hop, bool smudge, uint16_t halftone) {
+  const uint16_t word = (uint16_t)(s->buffer >> skew);
+  if (smudge) halftone = blt->halftone[word & BLITTER_CTRL_LINE_MASK];
+  if (hop == BLITTER_HOP_HALFTONE) return halftone;
+  if (hop == BLITTER_HOP_SOURCE_AND_HALFTONE) return word & halftone;
+  return word;
+}
+
+/* Logic op. `op` is a constant in every instance, so the ops that ignore
+ * the destination never read it. */
+static inline __attribute__((always_inline)) uint16_t blitter_op(
+    const int op, uint32_t s, uint32_t d) {
+  switch (op) {
+    case BLITTER_OP_ZERO:
+      return 0;
+    case BLITTER_OP_AND:
+      return (uint16_t)(s & d);
+    case BLITTER_OP_AND_NOT_DEST:
+      return (uint16_t)(s & ~d);
+    case BLITTER_OP_SOURCE:
+      return (uint16_t)s;
+    case BLITTER_OP_AND_NOT_SOURCE:
+      return (uint16_t)(~s & d);
+    case BLITTER_OP_DEST:
+      return (uint16_t)d;
+    case BLITTER_OP_XOR:
+      return (uint16_t)(s ^ d);
+    case BLITTER_OP_OR:
+      return (uint16_t)(s | d);
+    case BLITTER_OP_NOR:
+      return (uint16_t)~(s | d);
+    case BLITTER_OP_XNOR:
+      return (uint16_t)~(s ^ d);
+    case BLITTER_OP_NOT_DEST:
+      return (uint16_t)~d;
+    case BLITTER_OP_OR_NOT_DEST:
+      return (uint16_t)(s | ~d);
+    case BLITTER_OP_NOT_SOURCE:
+      return (uint16_t)~s;
+    case BLITTER_OP_OR_NOT_SOURCE:
+      return (uint16_t)(~s | d);
+    case BLITTER_OP_NAND:
+      return (uint16_t)~(s & d);
+    default:
+      return 0xFFFFu;
+  }
+}
+
+static inline __attribute__((always_inline)) void blitter_store(
+    uint16_t *dst, const int op, uint16_t s, uint16_t mask) {
+  const uint16_t d = *dst;
+  *dst = (uint16_t)((blitter_op(op, s, d) & mask) | (d & ~mask));
+}
+
+/* Template body, instantiated per logic op and with or without the source:
+ * without it the HOP value is the same for a whole line. */
+static inline __attribute__((always_inline)) void blitter_lines(
+    struct VGA_BLITTER *blt, const int op, const bool with_source) {
+  const int x_count = blt->x_count ? blt->x_count : 0x10000;
+  int y_count = blt->y_count ? blt->y_count : 0x10000;
+  const int dst_x_inc = blt->dst_x_inc >> 1;
+  const int dst_y_inc = blt->dst_y_inc >> 1;
+  const int skew = blt->skew & BLITTER_SKEW_MASK;
+  const bool fxsr = (blt->skew & BLITTER_SKEW_FXSR) != 0;
+  const bool nfsr = (blt->skew & BLITTER_SKEW_NFSR) != 0;
+  const int hop = blt->hop & 3;
+  const bool smudge = (blt->ctrl & BLITTER_CTRL_SMUDGE) != 0;
+  const int line_step = blt->dst_y_inc < 0 ? -1 : 1;
+  const int reads = x_count + fxsr - nfsr;
+  const uint16_t mask_first = blt->endmask[0];
+  const uint16_t mask_middle = blt->endmask[1];
+  const uint16_t mask_last = blt->endmask[2];
+  int line = blt->ctrl & BLITTER_CTRL_LINE_MASK;
+  uint16_t *dst = blt->dst_addr;
+  struct BLITTER_SOURCE src = {blt->src_addr, 0, 0, blt->src_x_inc >> 1,
+                               blt->src_y_inc >> 1, blt->src_x_inc < 0};
+
+  for (; y_count > 0; y_count--) {
+    const uint16_t halftone = blt->halftone[line];
+    line = (line + line_step) & BLITTER_CTRL_LINE_MASK;
+    uint16_t s = hop == BLITTER_HOP_ONES ? 0xFFFFu : halftone;
+    src.reads = reads;
+
+    /* First word */
+    if (with_source) {
+      if (fxsr) blitter_fetch(&src, true);
+      blitter_fetch(&src, x_count > 1 || !nfsr);
+      s = blitter_source(blt, &src, skew, hop, smudge, halftone);
+    }
+    blitter_store(dst, op, s, mask_first);
+    if (x_count == 1) {
+      dst += dst_y_inc;
+      continue;
+    }
+    dst += dst_x_inc;
+
+    /* Middle words, without the merge when the mask is full */
+    if (mask_middle == 0xFFFFu) {
+      for (int i = x_count - 2; i > 0; i--) {
+        if (with_source) {
+          blitter_fetch(&src, true);
+          s = blitter_source(blt, &src, skew, hop, smudge, halftone);
+        }
+        *dst = blitter_op(op, s, *dst);
+        dst += dst_x_inc;
+      }
+    } else {
+      for (int i = x_count - 2; i > 0; i--) {
+        if (with_source) {
+          blitter_fetch(&src, true);
+          s = blitter_source(blt, &src, skew, hop, smudge, halftone);
+        }
+        blitter_store(dst, op, s, mask_middle);
+        dst += dst_x_inc;
+      }
+    }
+
+    /* Last word */
+    if (with_source) {
+      blitter_fetch(&src, !nfsr);
+      s = blitter_source(blt, &src, skew, hop, smudge, halftone);
+    }
+    blitter_store(dst, op, s, mask_last);
+    dst += dst_y_inc;
+  }
+
+  blt->src_addr = src.addr;
+  blt->dst_addr = dst;
+  blt->y_count = 0;
+  blt->ctrl = (uint8_t)((blt->ctrl & ~(BLITTER_CTRL_BUSY |
+                                       BLITTER_CTRL_LINE_MASK)) |
+                        line);
+}
+
+/* Instance generator: the op without and with the source */
+#define BLITTER_DEFINE(OP)                                                  \
+  static void __not_in_flash_func(blitter_op##OP)(struct VGA_BLITTER *blt) { \
+    blitter_lines(blt, OP, false);                                          \
+  }                                                                         \
+  static void __not_in_flash_func(blitter_op##OP##_source)(                 \
+      struct VGA_BLITTER *blt) {                                            \
+    blitter_lines(blt, OP, true);                                           \
+  }
+
+BLITTER_DEFINE(0)
+BLITTER_DEFINE(1)
+BLITTER_DEFINE(2)
+BLITTER_DEFINE(3)
+BLITTER_DEFINE(4)
+BLITTER_DEFINE(5)
+BLITTER_DEFINE(6)
+BLITTER_DEFINE(7)
+BLITTER_DEFINE(8)
+BLITTER_DEFINE(9)
+BLITTER_DEFINE(10)
+BLITTER_DEFINE(11)
+BLITTER_DEFINE(12)
+BLITTER_DEFINE(13)
+BLITTER_DEFINE(14)
+BLITTER_DEFINE(15)
+
+typedef void (*blitter_func)(struct VGA_BLITTER *blt);
+
+/* Indexed [op][reads the source] */
+static const blitter_func blitter_ops[16][2] = {
+    {blitter_op0, blitter_op0_source},   {blitter_op1, blitter_op1_source},
+    {blitter_op2, blitter_op2_source},   {blitter_op3, blitter_op3_source},
+    {blitter_op4, blitter_op4_source},   {blitter_op5, blitter_op5_source},
+    {blitter_op6, blitter_op6_source},   {blitter_op7, blitter_op7_source},
+    {blitter_op8, blitter_op8_source},   {blitter_op9, blitter_op9_source},
+    {blitter_op10, blitter_op10_source}, {blitter_op11, blitter_op11_source},
+    {blitter_op12, blitter_op12_source}, {blitter_op13, blitter_op13_source},
+    {blitter_op14, blitter_op14_source}, {blitter_op15, blitter_op15_source},
+};
+
+void __not_in_flash_func(blitter_run)(struct VGA_BLITTER *blt) {
+  const int hop = blt->hop & 3;
+  /* Smudge reads the source for the halftone line */
+  const bool with_source = (hop & BLITTER_HOP_SOURCE) ||
+                           (hop == BLITTER_HOP_HALFTONE &&
+                            (blt->ctrl & BLITTER_CTRL_SMUDGE));
+  blitter_ops[blt->op & 15][with_source](blt);
+}
+
+void blitter_set_span(struct VGA_BLITTER *blt, int src_x, int dst_x,
+                      int width, int src_pitch, int dst_pitch) {
+  const int src_first = src_x & (VGA_BLOCK_PIXELS - 1);
+  const int dst_first = dst_x & (VGA_BLOCK_PIXELS - 1);
+  const int dst_last = (dst_x + width - 1) & (VGA_BLOCK_PIXELS - 1);
+  const int x_count = (dst_first + width - 1) / VGA_BLOCK_PIXELS + 1;
+  const int src_words = (src_first + width - 1) / VGA_BLOCK_PIXELS + 1;
+  /* The first destination pixel is further left in its word than the first
+   * source pixel: the source starts one word early */
+  const bool fxsr = src_first > dst_first;
+  const bool nfsr = x_count + fxsr > src_words;
+  blt->x_count = (uint16_t)x_count;
+  blt->endmask[0] = (uint16_t)(0xFFFFu >> dst_first);
+  blt->endmask[1] = 0xFFFFu;
+  blt->endmask[2] = (uint16_t)(0xFFFFu << (VGA_BLOCK_PIXELS - 1 - dst_last));
+  if (x_count == 1) blt->endmask[0] &= blt->endmask[2];
+  blt->skew = (uint8_t)((fxsr ? BLITTER_SKEW_FXSR : 0) |
+                        (nfsr ? BLITTER_SKEW_NFSR : 0) |
+                        ((dst_first - src_first) & BLITTER_SKEW_MASK));
+  blt->src_y_inc =
+      (int16_t)(src_pitch - (x_count + fxsr - nfsr - 1) * blt->src_x_inc);
+  blt->dst_y_inc = (int16_t)(dst_pitch - (x_count - 1) * blt->dst_x_inc);
+}
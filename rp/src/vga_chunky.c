@@ -0,0 +1,172 @@
+#include "vga/chunky.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Eight packed transparent pixels */
+#define CHUNKY_KEY_WORD (VGA_PACKED_TRANSPARENT * 0x11111111u)
+
+/* Planar bits of the two pixels of a chunky byte, two bits per plane: the
+ * left pixel (low nibble) in bit 1, the right one in bit 0, for plane 0 at
+ * bit 0, plane 2 at bit 8, plane 1 at bit 16 and plane 3 at bit 24. Four
+ * entries shifted by 6, 4, 2 and 0 and OR-ed fill a byte per plane, in the
+ * order the plane-pair words of a block want them. */
+static uint32_t chunky_planes[256];
+
+static void chunky_build_planes(void) {
+  static const uint8_t plane_shift[VGA_NUM_BITPLANES] = {0, 16, 8, 24};
+  for (int b = 0; b < 256; b++) {
+    uint32_t v = 0;
+    for (int p = 0; p < 2; p++) {
+      const int idx = (b >> (4 * p)) & 0xF;
+      for (int plane = 0; plane < VGA_NUM_BITPLANES; plane++) {
+        if (idx & (1 << plane)) v |= (2u >> p) << plane_shift[plane];
+      }
+    }
+    chunky_planes[b] = v;
+  }
+}
+
+int chunky_init(struct CHUNKY_FRAME *frame, int width, int height) {
+  const int blocks = (width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS;
+  const size_t bytes = (size_t)height * blocks * VGA_BLOCK_PIXELS / 2;
+  uint32_t *data = malloc(bytes);
+  if (data == NULL) {
+    DPRINTF("Failed to allocate %u bytes for a %dx%d chunky frame\n",
+            (unsigned int)bytes, width, height);
+    return VGA_ERROR_ALLOC;
+  }
+  frame->width = blocks * VGA_BLOCK_PIXELS;
+  frame->height = height;
+  frame->data = data;
+  chunky_build_planes();
+  chunky_clear(frame, 0);
+  return 0;
+}
+
+void chunky_free(struct CHUNKY_FRAME *frame) {
+  free(frame->data);
+  frame->data = NULL;
+}
+
+void chunky_clear(struct CHUNKY_FRAME *frame, int color) {
+  memset(frame->data, (color & 0xF) * 0x11,
+         (size_t)frame->height * frame->width / 2);
+}
+
+void __not_in_flash_func(chunky_fill_rect)(struct CHUNKY_FRAME *frame,
+                                           int x0, int y0, int x1, int y1,
+                                           int color) {
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > frame->width) x1 = frame->width;
+  if (y1 > frame->height) y1 = frame->height;
+  if (x0 >= x1 || y0 >= y1) return;
+  const int row_words = frame->width / VGA_PACKED_GROUP_PIXELS;
+  const int first = x0 / VGA_PACKED_GROUP_PIXELS;
+  const int last = (x1 - 1) / VGA_PACKED_GROUP_PIXELS;
+  uint32_t head = ~0u << (4 * (x0 & (VGA_PACKED_GROUP_PIXELS - 1)));
+  const uint32_t tail =
+      ~0u >> (4 * (VGA_PACKED_GROUP_PIXELS - 1 -
+                   ((x1 - 1) & (VGA_PACKED_GROUP_PIXELS - 1))));
+  if (first == last) head &= tail;
+  const uint32_t fill = (uint32_t)(color & 0xF) * 0x11111111u;
+  uint32_t *row = frame->data + y0 * row_words;
+  for (int y = y0; y < y1; y++, row += row_words) {
+    row[first] = (row[first] & ~head) | (fill & head);
+    if (first == last) continue;
+    for (int w = first + 1; w < last; w++) row[w] = fill;
+    row[last] = (row[last] & ~tail) | (fill & tail);
+  }
+}
+
+/* Nibbles of `v` other than the transparent index, as 0xF nibbles:
+ * bit 0 of each nibble ends up as the OR of the four bits of v ^ key */
+static inline __attribute__((always_inline)) uint32_t chunky_opaque(
+    uint32_t v) {
+  uint32_t t = v ^ CHUNKY_KEY_WORD;
+  t |= t >> 2;
+  t |= t >> 1;
+  return (t & 0x11111111u) * 0xF;
+}
+
+void __not_in_flash_func(chunky_draw_sprite)(struct CHUNKY_FRAME *frame,
+                                             const struct SPRITE *spr, int x,
+                                             int y) {
+  /* Visible columns and rows, in frame pixels */
+  const int cx0 = x > 0 ? x : 0;
+  const int cx1 = x + spr->width < frame->width ? x + spr->width
+                                                : frame->width;
+  const int cy0 = y > 0 ? y : 0;
+  const int cy1 = y + spr->height < frame->height ? y + spr->height
+                                                  : frame->height;
+  if (cx0 >= cx1 || cy0 >= cy1) return;
+  const int row_words = frame->width / VGA_PACKED_GROUP_PIXELS;
+
+  if (spr->format != SPRITE_FORMAT_PACKED4 || spr->flip_x || spr->remap) {
+    for (int fy = cy0; fy < cy1; fy++) {
+      for (int fx = cx0; fx < cx1; fx++) {
+        const int sx = spr->flip_x ? x + spr->width - 1 - fx : fx - x;
+        const int idx = sprite_texel_index(spr, sx, fy - y);
+        if (idx >= 0) chunky_plot(frame, fx, fy, idx);
+      }
+    }
+    return;
+  }
+
+  /* Destination word dw holds source pixels from 8 * (dw - q) - r: the top
+   * r nibbles of source word dw - q - 1, then the low ones of dw - q */
+  const int q = x >> 3; /* floor, also for negative x */
+  const int r = (x & (VGA_PACKED_GROUP_PIXELS - 1)) * 4;
+  const int first = cx0 / VGA_PACKED_GROUP_PIXELS;
+  const int last = (cx1 - 1) / VGA_PACKED_GROUP_PIXELS;
+  const uint32_t head = ~0u << (4 * (cx0 & (VGA_PACKED_GROUP_PIXELS - 1)));
+  const uint32_t tail =
+      ~0u >> (4 * (VGA_PACKED_GROUP_PIXELS - 1 -
+                   ((cx1 - 1) & (VGA_PACKED_GROUP_PIXELS - 1))));
+  const int stride = (int)spr->stride;
+  uint32_t *line = frame->data + cy0 * row_words;
+  for (int fy = cy0; fy < cy1; fy++, line += row_words) {
+    const uint32_t *row = (const uint32_t *)&spr->data[stride * (fy - y)];
+    int sw = first - q;
+    uint32_t prev = sw > 0 ? row[sw - 1] : CHUNKY_KEY_WORD;
+    for (int dw = first; dw <= last; dw++, sw++) {
+      const uint32_t cur = sw < stride ? row[sw] : CHUNKY_KEY_WORD;
+      const uint32_t v = r ? (cur << r) | (prev >> (32 - r)) : cur;
+      prev = cur;
+      uint32_t mask = chunky_opaque(v);
+      if (dw == first) mask &= head;
+      if (dw == last) mask &= tail;
+      if (mask) line[dw] = (line[dw] & ~mask) | (v & mask);
+    }
+  }
+}
+
+void __not_in_flash_func(chunky_to_planar)(const struct CHUNKY_FRAME *frame,
+                                           int y0, int y1) {
+  if (y0 < 0) y0 = 0;
+  if (y1 > frame->height) y1 = frame->height;
+  if (y1 > vga_screen.height) y1 = vga_screen.height;
+  const int blocks = (frame->width < vga_screen.width ? frame->width
+                                                      : vga_screen.width) /
+                     VGA_BLOCK_PIXELS;
+  const int src_pitch = frame->width / 2; /* bytes */
+  const int dst_pitch = vga_screen.width / (VGA_BLOCK_PIXELS / 2); /* words */
+  const uint32_t *planes = chunky_planes;
+  for (int y = y0; y < y1; y++) {
+    const uint8_t *src = (const uint8_t *)frame->data + y * src_pitch;
+    uint32_t *dst = (uint32_t *)vga_screen.hidden_framebuffer + y * dst_pitch;
+#pragma GCC unroll 2
+    for (int b = 0; b < blocks; b++) {
+      /* A byte per plane for pixels 0-7 (a) and 8-15 (c) */
+      const uint32_t a = (planes[src[0]] << 6) | (planes[src[1]] << 4) |
+                         (planes[src[2]] << 2) | planes[src[3]];
+      const uint32_t c = (planes[src[4]] << 6) | (planes[src[5]] << 4) |
+                         (planes[src[6]] << 2) | planes[src[7]];
+      dst[0] = ((a & 0x00FF00FFu) << 8) | (c & 0x00FF00FFu);
+      dst[1] = (a & 0xFF00FF00u) | ((c >> 8) & 0x00FF00FFu);
+      src += VGA_BLOCK_PIXELS / 2;
+      dst += 2;
+    }
+  }
+}
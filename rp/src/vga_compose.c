@@ -0,0 +1,553 @@
+#include "vga/compose.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* End of a bin list */
+#define COMPOSE_NONE 0xFFFF
+/* 32-bit words per framebuffer block: planes 0-1 and planes 2-3 */
+#define BLOCK_WORDS 2
+
+enum COMPOSE_KIND { COMPOSE_PLANAR, COMPOSE_TEXT };
+
+/* Planar sprite row source: logical block k (0 = leftmost on screen) lands
+ * on screen block first_block + k, shifted right by `shift` pixels. When
+ * flipped, logical block k is stored block `blocks - 1 - k`, bit-reversed.
+ */
+struct COMPOSE_PLANAR {
+  const uint16_t *data;
+  int16_t blocks;
+  int16_t first_block;
+  int16_t y;
+  int16_t height;
+  uint8_t shift;
+  bool flip;
+};
+
+struct COMPOSE_TEXT {
+  const struct VGA_FONT *font;
+  int16_t x; /* first glyph, alignment applied */
+  int16_t y;
+  uint8_t length;
+  uint8_t color;
+  uint8_t border_color;
+  bool border;
+  char text[COMPOSE_TEXT_CHARS];
+};
+
+struct COMPOSE_ITEM {
+  uint8_t kind;  /* enum COMPOSE_KIND */
+  uint16_t next; /* scanlines: next item starting on the same line */
+  int16_t bx0;   /* screen blocks [bx0, bx1) and rows [y0, y1) covered */
+  int16_t bx1;
+  int16_t y0;
+  int16_t y1;
+  union {
+    struct COMPOSE_PLANAR planar;
+    struct COMPOSE_TEXT text;
+  };
+};
+
+/* Entry of a bin list */
+struct COMPOSE_REF {
+  uint16_t item;
+  uint16_t next;
+};
+
+static struct {
+  bool ready;  /* compose_init succeeded */
+  bool active; /* between compose_begin and compose_end */
+  uint8_t mode; /* enum COMPOSE_MODE */
+  const struct TILEMAP_VIEW *background;
+  int line_blocks;
+  int bin_rows;
+  int num_items;
+  int num_refs;
+  struct COMPOSE_ITEM *items;
+  struct COMPOSE_REF *refs;
+  uint16_t *head; /* per bin, row after row */
+  uint16_t *tail;
+  uint16_t *line_first; /* scanlines: first item starting on each row */
+  uint16_t *scan;       /* scanlines: items covering the row, in order */
+  uint32_t *line;       /* scanlines: the row being built */
+} compose;
+
+int compose_init(void) {
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const int bin_rows = (drawable_height + COMPOSE_BIN_ROWS - 1) /
+                       COMPOSE_BIN_ROWS;
+  const int bins = line_blocks * bin_rows;
+  const int line_words = line_blocks * BLOCK_WORDS;
+  size_t bytes = COMPOSE_MAX_ITEMS * sizeof(struct COMPOSE_ITEM) +
+                 COMPOSE_MAX_REFS * sizeof(struct COMPOSE_REF) +
+                 line_words * sizeof(uint32_t) +
+                 (2 * bins + drawable_height + COMPOSE_MAX_ITEMS) *
+                     sizeof(uint16_t);
+  uint8_t *mem = malloc(bytes);
+  if (mem == NULL) {
+    DPRINTF("Failed to allocate %u bytes for the compositor\n",
+            (unsigned int)bytes);
+    return VGA_ERROR_ALLOC;
+  }
+  compose.items = (struct COMPOSE_ITEM *)mem;
+  compose.refs = (struct COMPOSE_REF *)(compose.items + COMPOSE_MAX_ITEMS);
+  compose.line = (uint32_t *)(compose.refs + COMPOSE_MAX_REFS);
+  compose.head = (uint16_t *)(compose.line + line_words);
+  compose.tail = compose.head + bins;
+  compose.line_first = compose.tail + bins;
+  compose.scan = compose.line_first + drawable_height;
+  compose.line_blocks = line_blocks;
+  compose.bin_rows = bin_rows;
+  memset(compose.head, 0xFF, bins * sizeof(uint16_t));
+  memset(compose.line_first, 0xFF, drawable_height * sizeof(uint16_t));
+  compose.num_items = 0;
+  compose.num_refs = 0;
+  compose.active = false;
+  compose.mode = COMPOSE_BINS;
+  compose.ready = true;
+  DPRINTF("Compositor: %dx%d bins, %u bytes\n", line_blocks, bin_rows,
+          (unsigned int)bytes);
+  return 0;
+}
+
+static inline int floor_div(int a, int b) {
+  return a >= 0 ? a / b : -((b - 1 - a) / b);
+}
+
+/* Source word `w` of a planar block, bit-reversed when mirroring */
+static inline __attribute__((always_inline)) uint32_t planar_word(
+    const uint16_t *block, int w, const bool flip) {
+  return flip ? bit_reverse16(block[w]) : block[w];
+}
+
+/* Merge the rows [y0, y0 + rows) of a planar sprite item that fall in
+ * screen block bx into the bin */
+static void __not_in_flash_func(merge_planar)(uint16_t *bin,
+                                              const struct COMPOSE_ITEM *item,
+                                              int bx, int y0, int rows) {
+  const struct COMPOSE_PLANAR *p = &item->planar;
+  int r0 = item->y0 > y0 ? item->y0 : y0;
+  int r1 = item->y1 < y0 + rows ? item->y1 : y0 + rows;
+  const int k = bx - p->first_block;
+  const bool has_cur = k < p->blocks;
+  const bool has_prev = p->shift != 0 && k > 0;
+  const int cur = (p->flip ? p->blocks - 1 - k : k) * VGA_PLANAR_BLOCK_WORDS;
+  const int prev =
+      (p->flip ? p->blocks - k : k - 1) * VGA_PLANAR_BLOCK_WORDS;
+  const int row_words = p->blocks * VGA_PLANAR_BLOCK_WORDS;
+  const uint16_t *src = p->data + (r0 - p->y) * row_words;
+  uint16_t *dst = bin + (r0 - y0) * VGA_NUM_BITPLANES;
+  for (int y = r0; y < r1; y++) {
+    /* 32-bit windows: the previous logical block in the high half */
+    uint32_t wm = 0, w0 = 0, w1 = 0, w2 = 0, w3 = 0;
+    if (has_prev) {
+      wm = planar_word(src + prev, 0, p->flip) << 16;
+      w0 = planar_word(src + prev, 1, p->flip) << 16;
+      w1 = planar_word(src + prev, 2, p->flip) << 16;
+      w2 = planar_word(src + prev, 3, p->flip) << 16;
+      w3 = planar_word(src + prev, 4, p->flip) << 16;
+    }
+    if (has_cur) {
+      wm |= planar_word(src + cur, 0, p->flip);
+      w0 |= planar_word(src + cur, 1, p->flip);
+      w1 |= planar_word(src + cur, 2, p->flip);
+      w2 |= planar_word(src + cur, 3, p->flip);
+      w3 |= planar_word(src + cur, 4, p->flip);
+    }
+    uint16_t mask = (uint16_t)(wm >> p->shift);
+    if (mask) {
+      dst[0] = (uint16_t)((dst[0] & ~mask) | (uint16_t)(w0 >> p->shift));
+      dst[1] = (uint16_t)((dst[1] & ~mask) | (uint16_t)(w1 >> p->shift));
+      dst[2] = (uint16_t)((dst[2] & ~mask) | (uint16_t)(w2 >> p->shift));
+      dst[3] = (uint16_t)((dst[3] & ~mask) | (uint16_t)(w3 >> p->shift));
+    }
+    src += row_words;
+    dst += VGA_NUM_BITPLANES;
+  }
+}
+
+/* Merge row y of a planar sprite into screen blocks [bx0, bx1) of a line:
+ * one pass along the row with the same 32-bit windows */
+static void __not_in_flash_func(merge_planar_row)(
+    uint16_t *line, const struct COMPOSE_PLANAR *p, int bx0, int bx1, int y) {
+  const int row_words = p->blocks * VGA_PLANAR_BLOCK_WORDS;
+  const int step = p->flip ? -VGA_PLANAR_BLOCK_WORDS : VGA_PLANAR_BLOCK_WORDS;
+  int k = bx0 - p->first_block;
+  const uint16_t *src =
+      p->data + (y - p->y) * row_words +
+      (p->flip ? p->blocks - 1 - k : k) * VGA_PLANAR_BLOCK_WORDS;
+  uint32_t wm = 0, w0 = 0, w1 = 0, w2 = 0, w3 = 0;
+  if (p->shift != 0 && k > 0) {
+    const uint16_t *prev = src - step;
+    wm = planar_word(prev, 0, p->flip);
+    w0 = planar_word(prev, 1, p->flip);
+    w1 = planar_word(prev, 2, p->flip);
+    w2 = planar_word(prev, 3, p->flip);
+    w3 = planar_word(prev, 4, p->flip);
+  }
+  uint16_t *dst = line + bx0 * VGA_NUM_BITPLANES;
+  for (int bx = bx0; bx < bx1; bx++, k++) {
+    if (k < p->blocks) {
+      wm = (wm << 16) | planar_word(src, 0, p->flip);
+      w0 = (w0 << 16) | planar_word(src, 1, p->flip);
+      w1 = (w1 << 16) | planar_word(src, 2, p->flip);
+      w2 = (w2 << 16) | planar_word(src, 3, p->flip);
+      w3 = (w3 << 16) | planar_word(src, 4, p->flip);
+      src += step;
+    } else {
+      wm <<= 16;
+      w0 <<= 16;
+      w1 <<= 16;
+      w2 <<= 16;
+      w3 <<= 16;
+    }
+    uint16_t mask = (uint16_t)(wm >> p->shift);
+    if (mask) {
+      dst[0] = (uint16_t)((dst[0] & ~mask) | (uint16_t)(w0 >> p->shift));
+      dst[1] = (uint16_t)((dst[1] & ~mask) | (uint16_t)(w1 >> p->shift));
+      dst[2] = (uint16_t)((dst[2] & ~mask) | (uint16_t)(w2 >> p->shift));
+      dst[3] = (uint16_t)((dst[3] & ~mask) | (uint16_t)(w3 >> p->shift));
+    }
+    dst += VGA_NUM_BITPLANES;
+  }
+}
+
+/* Pixels of glyph row `row` of the text drawn at x, within the 16 pixels
+ * from block_x0, as a block mask (bit 15 = leftmost pixel) */
+static uint32_t __not_in_flash_func(text_cover)(const struct COMPOSE_TEXT *t,
+                                                int x, int row,
+                                                int block_x0) {
+  const struct VGA_FONT *f = t->font;
+  if (row < 0 || row >= f->h) return 0;
+  int i0 = floor_div(block_x0 - x, f->w);
+  int i1 = floor_div(block_x0 + VGA_BLOCK_PIXELS - 1 - x, f->w);
+  if (i0 < 0) i0 = 0;
+  if (i1 > t->length - 1) i1 = t->length - 1;
+  uint32_t cover = 0;
+  for (int i = i0; i <= i1; i++) {
+    int ch = (unsigned char)t->text[i] - f->first_char;
+    if (ch < 0 || ch >= f->num_chars) continue;
+    uint8_t bits = f->data[ch * f->h + row] & ((1u << f->w) - 1u);
+    if (!bits) continue;
+    /* Glyph bit 0 is its leftmost pixel */
+    uint32_t glyph = (uint32_t)bit_reverse8[bits] << 8;
+    int offset = x + i * f->w - block_x0;
+    cover |= offset >= 0 ? glyph >> offset : (glyph << -offset) & 0xFFFF;
+  }
+  return cover;
+}
+
+static inline __attribute__((always_inline)) void merge_color(
+    uint16_t *dst, uint32_t cover, unsigned int color) {
+  for (int p = 0; p < VGA_NUM_BITPLANES; p++)
+    dst[p] = (uint16_t)((dst[p] & ~cover) | ((color >> p) & 1 ? cover : 0));
+}
+
+/* Merge the rows [y0, y0 + rows) of a text item, border first, within
+ * screen block bx into the bin */
+static void __not_in_flash_func(merge_text)(uint16_t *bin,
+                                            const struct COMPOSE_ITEM *item,
+                                            int bx, int y0, int rows) {
+  const struct COMPOSE_TEXT *t = &item->text;
+  const int block_x0 = bx * VGA_BLOCK_PIXELS;
+  int r0 = item->y0 > y0 ? item->y0 : y0;
+  int r1 = item->y1 < y0 + rows ? item->y1 : y0 + rows;
+  uint16_t *dst = bin + (r0 - y0) * VGA_NUM_BITPLANES;
+  for (int y = r0; y < r1; y++) {
+    if (t->border) {
+      uint32_t cover = 0;
+      for (int j = -1; j <= 1; j++) {
+        for (int i = -1; i <= 1; i++) {
+          if (i == 0 && j == 0) continue;
+          cover |= text_cover(t, t->x + i, y - t->y - j, block_x0);
+        }
+      }
+      if (cover) merge_color(dst, cover, t->border_color);
+    }
+    uint32_t cover = text_cover(t, t->x, y - t->y, block_x0);
+    if (cover) merge_color(dst, cover, t->color);
+    dst += VGA_NUM_BITPLANES;
+  }
+}
+
+/* Build every bin with items (all of them over a background) and write it
+ * to the hidden framebuffer */
+static void __not_in_flash_func(flush_bins)(void) {
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int line_words = compose.line_blocks * BLOCK_WORDS;
+  uint32_t bin[COMPOSE_BIN_ROWS * BLOCK_WORDS];
+  for (int by = 0; by < compose.bin_rows; by++) {
+    const int y0 = by * COMPOSE_BIN_ROWS;
+    int rows = drawable_height - y0;
+    if (rows > COMPOSE_BIN_ROWS) rows = COMPOSE_BIN_ROWS;
+    uint32_t *line =
+        (uint32_t *)vga_screen.hidden_framebuffer + y0 * line_words;
+    for (int bx = 0; bx < compose.line_blocks; bx++) {
+      uint16_t *head = &compose.head[by * compose.line_blocks + bx];
+      uint32_t *fb = line + bx * BLOCK_WORDS;
+      if (*head == COMPOSE_NONE) {
+        if (compose.background)
+          tilemap_view_draw_block(compose.background, fb, line_words, bx, y0,
+                                  rows);
+        continue;
+      }
+      if (compose.background) {
+        tilemap_view_draw_block(compose.background, bin, BLOCK_WORDS, bx, y0,
+                                rows);
+      } else {
+        for (int y = 0; y < rows; y++) {
+          bin[y * BLOCK_WORDS] = fb[y * line_words];
+          bin[y * BLOCK_WORDS + 1] = fb[y * line_words + 1];
+        }
+      }
+      for (int r = *head; r != COMPOSE_NONE; r = compose.refs[r].next) {
+        const struct COMPOSE_ITEM *item = &compose.items[compose.refs[r].item];
+        if (item->kind == COMPOSE_PLANAR)
+          merge_planar((uint16_t *)bin, item, bx, y0, rows);
+        else
+          merge_text((uint16_t *)bin, item, bx, y0, rows);
+      }
+      for (int y = 0; y < rows; y++) {
+        fb[y * line_words] = bin[y * BLOCK_WORDS];
+        fb[y * line_words + 1] = bin[y * BLOCK_WORDS + 1];
+      }
+      *head = COMPOSE_NONE;
+    }
+  }
+}
+
+/* Build every row with items (all of them over a background) in the line
+ * buffer and write it to the hidden framebuffer. The items covering a row
+ * are kept in drawing order: those starting on it are inserted, those that
+ * ended are dropped, so a row costs its own spans and nothing else. */
+static void __not_in_flash_func(flush_lines)(void) {
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int line_words = compose.line_blocks * BLOCK_WORDS;
+  uint16_t *const scan = compose.scan;
+  uint16_t *const line = (uint16_t *)compose.line;
+  int count = 0;
+  uint32_t *fb = (uint32_t *)vga_screen.hidden_framebuffer;
+  for (int y = 0; y < drawable_height; y++, fb += line_words) {
+    /* Drop the items that ended, then insert the new ones (ascending) */
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+      if (compose.items[scan[i]].y1 > y) scan[kept++] = scan[i];
+    }
+    count = kept;
+    for (int n = compose.line_first[y]; n != COMPOSE_NONE;
+         n = compose.items[n].next) {
+      int i = count++;
+      while (i > 0 && scan[i - 1] > n) {
+        scan[i] = scan[i - 1];
+        i--;
+      }
+      scan[i] = (uint16_t)n;
+    }
+    compose.line_first[y] = COMPOSE_NONE;
+
+    if (count == 0) {
+      if (compose.background)
+        tilemap_view_draw_line(compose.background, fb, y);
+      continue;
+    }
+    if (compose.background)
+      tilemap_view_draw_line(compose.background, compose.line, y);
+    else
+      memcpy(compose.line, fb, line_words * sizeof(uint32_t));
+    for (int i = 0; i < count; i++) {
+      const struct COMPOSE_ITEM *item = &compose.items[scan[i]];
+      if (item->kind == COMPOSE_PLANAR) {
+        merge_planar_row(line, &item->planar, item->bx0, item->bx1, y);
+      } else {
+        for (int bx = item->bx0; bx < item->bx1; bx++)
+          merge_text(line + bx * VGA_NUM_BITPLANES, item, bx, y, 1);
+      }
+    }
+    memcpy(fb, compose.line, line_words * sizeof(uint32_t));
+  }
+}
+
+/* Composite what was recorded, then start over empty on what the
+ * framebuffer now holds */
+static void __not_in_flash_func(compose_flush)(void) {
+  if (compose.mode == COMPOSE_SCANLINES)
+    flush_lines();
+  else
+    flush_bins();
+  compose.background = NULL;
+  compose.num_items = 0;
+  compose.num_refs = 0;
+}
+
+/* Add the next item over screen blocks [bx0, bx1) and rows [y0, y1),
+ * clipped to the viewport, to the bins or to the list of its first row,
+ * flushing first when it does not fit. Returns it to fill in, or NULL when
+ * it is outside the viewport. */
+static struct COMPOSE_ITEM *__not_in_flash_func(compose_add)(int bx0, int bx1,
+                                                             int y0, int y1) {
+  const struct VGA_VIEWPORT *vp = &vga_viewport;
+  /* The bins stop at the status bar, a viewport over it included */
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  const int clip_y1 = vp->clip.y1 < drawable_height ? vp->clip.y1
+                                                    : drawable_height;
+  if (bx0 < vp->block_x0) bx0 = vp->block_x0;
+  if (bx1 > vp->block_x1) bx1 = vp->block_x1;
+  if (y0 < vp->clip.y0) y0 = vp->clip.y0;
+  if (y1 > clip_y1) y1 = clip_y1;
+  if (bx0 >= bx1 || y0 >= y1) return NULL;
+
+  const int by0 = y0 / COMPOSE_BIN_ROWS;
+  const int by1 = (y1 - 1) / COMPOSE_BIN_ROWS + 1;
+  const int refs = compose.mode == COMPOSE_BINS ? (bx1 - bx0) * (by1 - by0)
+                                                : 0;
+  if (compose.num_items == COMPOSE_MAX_ITEMS ||
+      compose.num_refs + refs > COMPOSE_MAX_REFS)
+    compose_flush();
+
+  const uint16_t item = (uint16_t)compose.num_items++;
+  struct COMPOSE_ITEM *it = &compose.items[item];
+  it->bx0 = (int16_t)bx0;
+  it->bx1 = (int16_t)bx1;
+  it->y0 = (int16_t)y0;
+  it->y1 = (int16_t)y1;
+  if (compose.mode == COMPOSE_SCANLINES) {
+    /* Pushed in front: the list of a row holds the later items first */
+    it->next = compose.line_first[y0];
+    compose.line_first[y0] = item;
+    return it;
+  }
+  for (int by = by0; by < by1; by++) {
+    for (int bx = bx0; bx < bx1; bx++) {
+      const int bin = by * compose.line_blocks + bx;
+      const uint16_t ref = (uint16_t)compose.num_refs++;
+      compose.refs[ref].item = item;
+      compose.refs[ref].next = COMPOSE_NONE;
+      if (compose.head[bin] == COMPOSE_NONE)
+        compose.head[bin] = ref;
+      else
+        compose.refs[compose.tail[bin]].next = ref;
+      compose.tail[bin] = ref;
+    }
+  }
+  return it;
+}
+
+void compose_set_mode(enum COMPOSE_MODE mode) {
+  if (compose.ready && !compose.active) compose.mode = (uint8_t)mode;
+}
+
+void __not_in_flash_func(compose_begin)(
+    const struct TILEMAP_VIEW *background) {
+  if (!compose.ready) {
+    if (background) tilemap_view_draw(background);
+    return;
+  }
+  compose.background = background;
+  compose.num_items = 0;
+  compose.num_refs = 0;
+  compose.active = true;
+}
+
+void __not_in_flash_func(compose_sprites)(const struct SPRITE *spr,
+                                          const struct VGA_POINT *at,
+                                          int count) {
+  const struct PLANAR_SPRITE *planar = spr->planar;
+  if (!compose.active || !planar || spr->remap) {
+    if (compose.active) compose_flush();
+    for (int i = 0; i < count; i++) draw_sprite(spr, at[i].x, at[i].y, true);
+    return;
+  }
+
+  const bool flip = spr->flip_x;
+  const int flip_offset =
+      flip ? (int)planar->blocks * VGA_BLOCK_PIXELS - planar->width : 0;
+  /* The pre-shifted copies are not mirrored */
+  const struct PLANAR_PRESHIFT *preshift = flip ? NULL : planar->preshift;
+  const int origin_x = vga_viewport.origin_x - flip_offset;
+  const int origin_y = vga_viewport.origin_y;
+  for (int i = 0; i < count; i++) {
+    const int x = at[i].x + origin_x, y = at[i].y + origin_y;
+    struct COMPOSE_PLANAR p;
+    p.flip = flip;
+    p.y = (int16_t)y;
+    p.height = (int16_t)planar->height;
+    p.first_block = (int16_t)(x >> 4); /* floor, also for negative x */
+    p.shift = (uint8_t)(x & (VGA_BLOCK_PIXELS - 1));
+    if (preshift) {
+      p.data = preshift->data[p.shift];
+      p.blocks = preshift->blocks[p.shift];
+      p.shift = 0;
+    } else {
+      p.data = planar->data;
+      p.blocks = (int16_t)planar->blocks;
+    }
+    /* A shifted sprite spills into one extra block */
+    struct COMPOSE_ITEM *item = compose_add(
+        p.first_block, p.first_block + p.blocks + (p.shift ? 1 : 0), y,
+        y + planar->height);
+    if (item == NULL) continue;
+    item->kind = COMPOSE_PLANAR;
+    item->planar = p;
+  }
+}
+
+void __not_in_flash_func(compose_sprite)(const struct SPRITE *spr, int x,
+                                         int y) {
+  const struct VGA_POINT at = {(int16_t)x, (int16_t)y};
+  compose_sprites(spr, &at, 1);
+}
+
+void __not_in_flash_func(compose_print)(const char *text) {
+  if (text == NULL) return;
+  size_t length = strlen(text);
+  if (!compose.active || length >= COMPOSE_TEXT_CHARS) {
+    if (compose.active) compose_flush();
+    font_print(text);
+    return;
+  }
+
+  font_print_start(text);
+  const int x = (int)font_x + vga_viewport.origin_x;
+  const int y = (int)font_y + vga_viewport.origin_y;
+  const int end_x = x + (int)length * font->w;
+  const int edge = border[0] ? 1 : 0;
+  struct COMPOSE_ITEM *item =
+      compose_add(floor_div(x - edge, VGA_BLOCK_PIXELS),
+                  floor_div(end_x + edge - 1, VGA_BLOCK_PIXELS) + 1, y - edge,
+                  y + font->h + edge);
+  if (item) {
+    struct COMPOSE_TEXT *t = &item->text;
+    item->kind = COMPOSE_TEXT;
+    t->font = font;
+    t->x = (int16_t)x;
+    t->y = (int16_t)y;
+    t->length = (uint8_t)length;
+    t->color = font_color;
+    t->border = border[0];
+    t->border_color = (uint8_t)(border[1] & font_active_color_mask());
+    memcpy(t->text, text, length + 1);
+  }
+  font_print_end(end_x - vga_viewport.origin_x);
+}
+
+#if VGA_FONT_USE_STDARG
+#include <stdarg.h>
+#include <stdio.h>
+
+void __not_in_flash_func(compose_printf)(const char *fmt, ...) {
+  char buf[COMPOSE_TEXT_CHARS];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+
+  compose_print(buf);
+}
+#endif
+
+void __not_in_flash_func(compose_end)(void) {
+  if (!compose.active) return;
+  compose_flush();
+  compose.active = false;
+}
@@ -0,0 +1,66 @@
+#include "vga/dirty.h"
+
+/* Recorded per framebuffer id, and the list handed out for restoring */
+static struct DIRTY_LIST dirty_lists[2];
+static struct DIRTY_LIST dirty_restore;
+
+void dirty_reset(void) {
+  for (int i = 0; i < 2; i++) {
+    dirty_lists[i].count = 0;
+    dirty_lists[i].full = true;
+  }
+}
+
+const struct DIRTY_LIST *__not_in_flash_func(dirty_begin_frame)(void) {
+  struct DIRTY_LIST *list = &dirty_lists[vga_screen.hidden_framebuffer_id & 1];
+  dirty_restore.full = list->full;
+  dirty_restore.count = list->count;
+  for (int i = 0; i < list->count; i++) dirty_restore.rects[i] = list->rects[i];
+  list->count = 0;
+  list->full = false;
+  return &dirty_restore;
+}
+
+static inline bool rects_overlap(const struct VGA_RECT *a,
+                                 const struct VGA_RECT *b) {
+  return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+void __not_in_flash_func(dirty_add)(int x0, int y0, int x1, int y1) {
+  struct DIRTY_LIST *list = &dirty_lists[vga_screen.hidden_framebuffer_id & 1];
+  if (list->full) return;
+
+  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > vga_screen.width) x1 = vga_screen.width;
+  if (y1 > drawable_height) y1 = drawable_height;
+  if (x0 >= x1 || y0 >= y1) return;
+
+  struct VGA_RECT rect = {
+      .x0 = (int16_t)(x0 & ~(VGA_BLOCK_PIXELS - 1)),
+      .y0 = (int16_t)y0,
+      .x1 = (int16_t)((x1 + VGA_BLOCK_PIXELS - 1) & ~(VGA_BLOCK_PIXELS - 1)),
+      .y1 = (int16_t)y1,
+  };
+  /* Merge with every rectangle it overlaps; the union may then overlap
+   * others, so scan again until it does not */
+  for (int i = 0; i < list->count;) {
+    struct VGA_RECT *other = &list->rects[i];
+    if (!rects_overlap(&rect, other)) {
+      i++;
+      continue;
+    }
+    if (other->x0 < rect.x0) rect.x0 = other->x0;
+    if (other->y0 < rect.y0) rect.y0 = other->y0;
+    if (other->x1 > rect.x1) rect.x1 = other->x1;
+    if (other->y1 > rect.y1) rect.y1 = other->y1;
+    *other = list->rects[--list->count];
+    i = 0;
+  }
+  if (list->count == DIRTY_MAX_RECTS) {
+    list->full = true;
+    return;
+  }
+  list->rects[list->count++] = rect;
+}
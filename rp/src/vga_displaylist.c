@@ -0,0 +1,84 @@
+#include "vga/displaylist.h"
+
+#include <string.h>
+
+void dlist_init(struct DISPLAY_LIST *list) {
+  list->count = 0;
+  list->last_count = 0;
+  memset(list->slot, DLIST_NO_ENTRY, sizeof(list->slot));
+}
+
+bool __not_in_flash_func(dlist_add)(struct DISPLAY_LIST *list,
+                                    const struct SPRITE *spr, int x, int y,
+                                    uint8_t id) {
+  struct DRAW_CLIP clip;
+  if (!draw_clip_box(x, y, spr->width, spr->height, &clip)) return false;
+  if (list->count == DLIST_MAX_ENTRIES) return false;
+  struct DLIST_ENTRY *entry = &list->entries[list->count++];
+  entry->sprite = spr;
+  entry->at.x = (int16_t)x;
+  entry->at.y = (int16_t)y;
+  entry->depth = (int16_t)(y + spr->height);
+  entry->id = id;
+  return true;
+}
+
+/* Drawing order: depth, then insertion order */
+static inline bool entry_before(const struct DISPLAY_LIST *list, int a,
+                                int b) {
+  const int16_t da = list->entries[a].depth, db = list->entries[b].depth;
+  return da != db ? da < db : a < b;
+}
+
+/* Start `order` from the last frame's, by id, and sort it by insertion */
+static void __not_in_flash_func(dlist_sort)(struct DISPLAY_LIST *list) {
+  uint8_t *order = list->order;
+  uint8_t *slot = list->slot;
+  bool placed[DLIST_MAX_ENTRIES];
+  for (int i = 0; i < list->count; i++) {
+    placed[i] = false;
+    if (slot[list->entries[i].id] == DLIST_NO_ENTRY)
+      slot[list->entries[i].id] = (uint8_t)i;
+  }
+  /* The ids still there in their last order, then the new entries */
+  int n = 0;
+  for (int i = 0; i < list->last_count; i++) {
+    const uint8_t e = slot[list->last_ids[i]];
+    if (e != DLIST_NO_ENTRY && !placed[e]) {
+      order[n++] = e;
+      placed[e] = true;
+    }
+  }
+  for (int i = 0; i < list->count; i++) {
+    slot[list->entries[i].id] = DLIST_NO_ENTRY;
+    if (!placed[i]) order[n++] = (uint8_t)i;
+  }
+  for (int i = 1; i < list->count; i++) {
+    const uint8_t e = order[i];
+    int j = i;
+    while (j > 0 && entry_before(list, e, order[j - 1])) {
+      order[j] = order[j - 1];
+      j--;
+    }
+    order[j] = e;
+  }
+  for (int i = 0; i < list->count; i++)
+    list->last_ids[i] = list->entries[order[i]].id;
+  list->last_count = list->count;
+}
+
+void __not_in_flash_func(dlist_execute)(struct DISPLAY_LIST *list) {
+  dlist_sort(list);
+  struct VGA_POINT batch[DLIST_MAX_BATCH];
+  int i = 0;
+  while (i < list->count) {
+    const struct SPRITE *spr = list->entries[list->order[i]].sprite;
+    int n = 0;
+    while (i < list->count && n < DLIST_MAX_BATCH &&
+           list->entries[list->order[i]].sprite == spr) {
+      batch[n++] = list->entries[list->order[i]].at;
+      i++;
+    }
+    compose_sprites(spr, batch, n);
+  }
+}
@@ -1,20 +1,54 @@
+#include <math.h>
 #include <stdlib.h>
 
 #include "vga/draw.h"
 
-#ifndef likely
-#define likely(x) __builtin_expect(!!(x), 1)
-#endif
-#ifndef unlikely
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#endif
-
 // plane 0 | plane 1 | plane 2 | plane 3
 // Place in scratch X bank to reduce contention with rgb2index in scratch Y.
 uint64_t pixel_masks_flat[256] __attribute__((
     aligned(8),
     section(".scratch_x.pixel_masks")));  // flattened [palette<<4 | pixel_x]
 
+struct VGA_VIEWPORT vga_viewport;
+
+int16_t vga_sine[VGA_SINE_ANGLES];
+
+static void init_sine_table(void) {
+  const float turn = 6.28318531f / VGA_SINE_ANGLES;
+  for (int a = 0; a < VGA_SINE_ANGLES; a++)
+    vga_sine[a] = (int16_t)lroundf(sinf(a * turn) * (1 << VGA_SINE_BITS));
+}
+
+static inline int clamp_int(int v, int lo, int hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void draw_set_viewport(const struct VGA_RECT *clip, int origin_x,
+                       int origin_y) {
+  int y0 = clamp_int(clip->y0, 0, vga_screen.height);
+  int y1 = clamp_int(clip->y1, y0, vga_screen.height);
+  /* Whole blocks only, rounded inwards */
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  int bx0 = clamp_int((clip->x0 + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS, 0,
+                      line_blocks);
+  int bx1 = clamp_int(clip->x1 / VGA_BLOCK_PIXELS, bx0, line_blocks);
+  vga_viewport.clip.x0 = (int16_t)(bx0 * VGA_BLOCK_PIXELS);
+  vga_viewport.clip.y0 = (int16_t)y0;
+  vga_viewport.clip.x1 = (int16_t)(bx1 * VGA_BLOCK_PIXELS);
+  vga_viewport.clip.y1 = (int16_t)y1;
+  vga_viewport.block_x0 = (int16_t)bx0;
+  vga_viewport.block_x1 = (int16_t)bx1;
+  vga_viewport.origin_x = (int16_t)origin_x;
+  vga_viewport.origin_y = (int16_t)origin_y;
+}
+
+void draw_reset_viewport(void) {
+  const struct VGA_RECT drawable = {
+      0, 0, (int16_t)vga_screen.width,
+      (int16_t)(vga_screen.height - VGA_STATUS_BAR_OFFSET)};
+  draw_set_viewport(&drawable, 0, 0);
+}
+
 void __not_in_flash_func(init_pixel_masks)(void) {
   for (int index = 0; index < 16; ++index) {
     for (int x = 0; x < 16; ++x) {
@@ -29,10 +63,13 @@ void __not_in_flash_func(init_pixel_masks)(void) {
       // DPRINTF("pixel_masks[%d] = 0x%016llX\n", flat, mask);
     }
   }
+  init_packed_planes();
+  init_sine_table();
+  draw_reset_viewport();
 }
 
 /* rgb2index LUT in opposite scratch bank (Y) to pixel_masks_flat (X) */
-static uint16_t rgb2index[64]
+uint16_t rgb2index[64]
     __attribute__((aligned(2), section(".scratch_y.rgb2index"))) = {
         0,   // BGR: 0b00000000 -> Index: 0
         1,   // BGR: 0b00000001 -> Index: 1
@@ -155,305 +192,166 @@ void __not_in_flash_func(draw_show_color_index)(unsigned int data[],
   free(unique);
 }
 
-/* Transparent path (honors 0xCC sentinel) */
-void __not_in_flash_func(draw_sprite_transparent)(const struct SPRITE *spr,
-                                                  int spr_x, int spr_y) {
-  const unsigned int *image_start = spr->data;
-  int height = spr->height;
-  if (spr_y < 0) {
-    image_start += spr->stride * (-spr_y);
-    height += spr_y;
-    spr_y = 0;
-  }
-  if (height > (vga_screen.height - 8) - spr_y)
-    height = (vga_screen.height - 8) - spr_y;
-  if (height <= 0) return;
-  int width = spr->width;
-  if (spr_x < 0) {
-    image_start += (-spr_x) / 4;
-    width += spr_x;
-    spr_x = ((unsigned int)spr_x) % 4;
+/* Merge the pixels of a chunky group flagged in `valid` (bit p = pixel p)
+ * into the row `line`, the first one at screen column pix. The group spans
+ * at most two blocks; one without a pixel to write is not touched, so a group
+ * hanging over the left edge of the viewport stays in bounds. Opaque, the
+ * 0xCC pixels are drawn in their color like any other. */
+static inline __attribute__((always_inline)) void draw_chunky_group(
+    uint16_t *line, int pix, uint32_t packed, unsigned valid,
+    const uint16_t *lut, const bool transparent) {
+  const unsigned pos0 = (unsigned)pix & (VGA_BLOCK_PIXELS - 1);
+  uint64_t set0 = 0, set1 = 0;
+  uint32_t covered0 = 0, covered1 = 0;
+#pragma GCC unroll 4
+  for (unsigned p = 0; p < VGA_GROUP_PIXELS; p++) {
+    uint8_t palv = (uint8_t)(packed >> (8 * p));
+    if (!(valid & (1u << p))) continue;
+    if (transparent && palv == VGA_TRANSPARENT_PIXEL) continue;
+    unsigned pos = pos0 + p;
+    uint64_t set = pixel_masks_flat[(lut[palv & 0x3F] << 4) |
+                                    (pos & (VGA_BLOCK_PIXELS - 1))];
+    if (pos < VGA_BLOCK_PIXELS) {
+      covered0 |= 0x8000u >> pos;
+      set0 |= set;
+    } else {
+      covered1 |= 0x8000u >> (pos - VGA_BLOCK_PIXELS);
+      set1 |= set;
+    }
   }
-  if (width > vga_screen.width - spr_x) width = vga_screen.width - spr_x;
-  if (width <= 0) return;
-  int row_bytes = vga_screen.width / (VGA_BLOCK_PIXELS / 2);
-  int size_stride = sizeof(*image_start);
-  for (int y = 0; y < height; y++) {
-    uint8_t *line =
-        (uint8_t *)&vga_screen.hidden_framebuffer[(y + spr_y) * row_bytes];
-    if ((line - (uint8_t *)vga_screen.hidden_framebuffer) <
-        ((vga_screen.height - 8) * vga_screen.width / 2)) {
-      uint8_t *sprite_row_ptr = (uint8_t *)&image_start[spr->stride * y];
-      for (int x = 0; x < spr->stride - 1; x++) {
-        uint8_t *sprite_pixel_ptr = sprite_row_ptr + x * size_stride;
-        int pix = (x * VGA_GROUP_PIXELS) + spr_x; /* start pixel */
-        uint32_t packed = *(uint32_t *)sprite_pixel_ptr;
-        if (packed == 0xCCCCCCCC) continue; /* skip fully transparent group */
-        uint8_t *pal_ptr = (uint8_t *)&packed;
-        unsigned pos0 = (unsigned)pix & 0xF; /* first pixel position */
-        uint block_ofs = (unsigned)pix >> 4;
-        uint8_t *block = line + (block_ofs * (VGA_NUM_BITPLANES * 2));
-        if (pos0 <= 12) {
-          /* Entirely inside one block */
-          uint64_t cur = *(uint64_t *)block;
-          uint64_t clear_mask = 0, set_mask = 0;
-          for (int p = 0; p < 4; ++p) {
-            uint8_t palv = pal_ptr[p];
-            if (palv == 0xCC) continue;
-            int rel = pix + p - spr_x;
-            if (rel >= width) break;
-            unsigned pos = (pos0 + (unsigned)p) & 0xF;
-            clear_mask |= pixel_masks_flat[(0xF << 4) | pos];
-            uint8_t idx = rgb2index[palv & 0x3F];
-            set_mask |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          cur = (cur & ~clear_mask) | set_mask;
-          ((uint32_t *)block)[0] = (uint32_t)cur;
-          ((uint32_t *)block)[1] = (uint32_t)(cur >> 32);
-        } else {
-          /* Cross-block split */
-          uint8_t *block_next = block + (VGA_NUM_BITPLANES * 2);
-          uint64_t cur0 = *(uint64_t *)block;
-          uint64_t cur1 = *(uint64_t *)block_next;
-          uint64_t clear0 = 0, set0 = 0, clear1 = 0, set1 = 0;
-          unsigned first_count = 16u - pos0; /* pixels in first block (1..3) */
-          for (unsigned p = 0; p < first_count; ++p) {
-            uint8_t palv = pal_ptr[p];
-            if (palv == 0xCC) continue;
-            int rel = pix + (int)p - spr_x;
-            if (rel >= width) break;
-            unsigned pos = (pos0 + p) & 0xF;
-            clear0 |= pixel_masks_flat[(0xF << 4) | pos];
-            uint8_t idx = rgb2index[palv & 0x3F];
-            set0 |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          for (unsigned p = first_count; p < 4u; ++p) {
-            uint8_t palv = pal_ptr[p];
-            if (palv == 0xCC) continue;
-            int rel = pix + (int)p - spr_x;
-            if (rel >= width) break;
-            unsigned pos = (unsigned)(p - first_count); /* next block start */
-            clear1 |= pixel_masks_flat[(0xF << 4) | pos];
-            uint8_t idx = rgb2index[palv & 0x3F];
-            set1 |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          cur0 = (cur0 & ~clear0) | set0;
-          cur1 = (cur1 & ~clear1) | set1;
-          ((uint32_t *)block)[0] = (uint32_t)cur0;
-          ((uint32_t *)block)[1] = (uint32_t)(cur0 >> 32);
-          ((uint32_t *)block_next)[0] = (uint32_t)cur1;
-          ((uint32_t *)block_next)[1] = (uint32_t)(cur1 >> 32);
-        }
-      }
+  uint16_t *block = line + (pix >> 4) * VGA_NUM_BITPLANES;
+  if (covered0) draw_merge_block(block, covered0, set0);
+  if (covered1) draw_merge_block(block + VGA_NUM_BITPLANES, covered1, set1);
+}
+
+/* Generic chunky blit, for the modes without a draw_sprite_blit instance.
+ * The clip is worked out once: only the first and last groups of the
+ * visible columns are masked per pixel, the ones between are whole. */
+static inline __attribute__((always_inline)) void draw_chunky(
+    const struct SPRITE *spr, int spr_x, int spr_y, const bool transparent) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, spr->width, spr->height, &c)) return;
+  const uint16_t *lut = sprite_rgb2index(spr);
+  const int line_words = vga_screen.width / VGA_BLOCK_PIXELS *
+                         VGA_NUM_BITPLANES;
+  /* First and last groups touched, with their visible pixels */
+  const int head = c.x_start / VGA_GROUP_PIXELS;
+  const int tail = (c.x_end - 1) / VGA_GROUP_PIXELS;
+  unsigned head_valid = (0xFu << (c.x_start & (VGA_GROUP_PIXELS - 1))) & 0xFu;
+  const unsigned tail_valid =
+      0xFu >> (VGA_GROUP_PIXELS - 1 - ((c.x_end - 1) & (VGA_GROUP_PIXELS - 1)));
+  if (head == tail) head_valid &= tail_valid;
+
+  uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                   (c.y + c.row_start) * line_words;
+  for (int y = c.row_start; y < c.row_end; y++, line += line_words) {
+    const uint32_t *row = (const uint32_t *)&spr->data[spr->stride * y];
+    int pix = c.x + head * VGA_GROUP_PIXELS;
+    draw_chunky_group(line, pix, row[head], head_valid, lut, transparent);
+    for (int g = head + 1; g < tail; g++) {
+      pix += VGA_GROUP_PIXELS;
+      uint32_t packed = row[g];
+      /* Skip fully transparent groups */
+      if (transparent && packed == 0xCCCCCCCCu) continue;
+      draw_chunky_group(line, pix, packed, 0xFu, lut, transparent);
     }
+    if (tail > head)
+      draw_chunky_group(line, c.x + tail * VGA_GROUP_PIXELS, row[tail],
+                        tail_valid, lut, transparent);
   }
 }
 
-/* Opaque path (assumes no 0xCC transparent pixels present) */
+/* Transparent path (honors 0xCC sentinel) */
+void __not_in_flash_func(draw_sprite_transparent)(const struct SPRITE *spr,
+                                                  int spr_x, int spr_y) {
+  draw_chunky(spr, spr_x, spr_y, true);
+}
+
+/* Opaque path: every pixel is drawn, 0xCC included */
 void __not_in_flash_func(draw_sprite_opaque)(const struct SPRITE *spr,
                                              int spr_x, int spr_y) {
-  const unsigned int *image_start = spr->data;
-  int height = spr->height;
-  if (spr_y < 0) {
-    image_start += spr->stride * (-spr_y);
-    height += spr_y;
-    spr_y = 0;
-  }
-  if (height > (vga_screen.height - 8) - spr_y)
-    height = (vga_screen.height - 8) - spr_y;
-  if (height <= 0) return;
-  int width = spr->width;
-  if (spr_x < 0) {
-    image_start += (-spr_x) / 4;
-    width += spr_x;
-    spr_x = ((unsigned int)spr_x) % 4;
-  }
-  if (width > vga_screen.width - spr_x) width = vga_screen.width - spr_x;
-  if (width <= 0) return;
-  int row_bytes = vga_screen.width / (VGA_BLOCK_PIXELS / 2);
-  int size_stride = sizeof(*image_start);
-  for (int y = 0; y < height; y++) {
-    uint8_t *line =
-        (uint8_t *)&vga_screen.hidden_framebuffer[(y + spr_y) * row_bytes];
-    if ((line - (uint8_t *)vga_screen.hidden_framebuffer) <
-        ((vga_screen.height - 8) * vga_screen.width / 2)) {
-      uint8_t *sprite_row_ptr = (uint8_t *)&image_start[spr->stride * y];
-      for (int x = 0; x < spr->stride - 1; x++) {
-        uint8_t *sprite_pixel_ptr = sprite_row_ptr + x * size_stride;
-        int pix = (x * VGA_GROUP_PIXELS) + spr_x; /* start pixel of group */
-        if (pix - spr_x >= width) break;          /* beyond clipped width */
-        uint32_t packed = *(uint32_t *)sprite_pixel_ptr;
-        uint8_t *pal_ptr = (uint8_t *)&packed;
-        unsigned pos0 = (unsigned)pix & 0xF;
-        uint block_start = (unsigned)pix >> 4;
-        uint8_t *block = line + (block_start * (VGA_NUM_BITPLANES * 2));
-        if (pos0 <= 12) {
-          /* Fast single-block path: accumulate set bits only */
-          uint64_t set_mask = 0;
-          for (int p = 0; p < VGA_GROUP_PIXELS; ++p) {
-            int abs_pix = pix + p;
-            if (abs_pix - spr_x >= width) break; /* tail clip */
-            unsigned pos = (pos0 + (unsigned)p) & 0xF;
-            uint8_t idx = rgb2index[pal_ptr[p] & 0x3F];
-            set_mask |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          if (set_mask) {
-            uint64_t cur = *(uint64_t *)block;
-            cur |= set_mask; /* overwrite by OR (opaque assumption) */
-            ((uint32_t *)block)[0] = (uint32_t)cur;
-            ((uint32_t *)block)[1] = (uint32_t)(cur >> 32);
-          }
-        } else {
-          /* Crosses into next block */
-          uint8_t *block_next = block + (VGA_NUM_BITPLANES * 2);
-          uint64_t set0 = 0, set1 = 0;
-          unsigned first_count = 16u - pos0; /* pixels in first block */
-          for (unsigned p = 0; p < first_count; ++p) {
-            int abs_pix = pix + (int)p;
-            if (abs_pix - spr_x >= width) break;
-            unsigned pos = (pos0 + p) & 0xF;
-            uint8_t idx = rgb2index[pal_ptr[p] & 0x3F];
-            set0 |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          for (unsigned p = first_count; p < VGA_GROUP_PIXELS; ++p) {
-            int abs_pix = pix + (int)p;
-            if (abs_pix - spr_x >= width) break;
-            unsigned pos = (unsigned)(p - first_count); /* new block pos */
-            uint8_t idx = rgb2index[pal_ptr[p] & 0x3F];
-            set1 |= pixel_masks_flat[(idx << 4) | pos];
-          }
-          if (set0) {
-            uint64_t cur0 = *(uint64_t *)block;
-            cur0 |= set0;
-            ((uint32_t *)block)[0] = (uint32_t)cur0;
-            ((uint32_t *)block)[1] = (uint32_t)(cur0 >> 32);
-          }
-          if (set1) {
-            uint64_t cur1 = *(uint64_t *)block_next;
-            cur1 |= set1;
-            ((uint32_t *)block_next)[0] = (uint32_t)cur1;
-            ((uint32_t *)block_next)[1] = (uint32_t)(cur1 >> 32);
-          }
-        }
+  draw_chunky(spr, spr_x, spr_y, false);
+}
+
+/* Mirrored path for chunky sprites: rows are read right to left one pixel
+ * at a time and merged block by block. Slow, packed and planar sprites
+ * mirror in their own kernels. */
+void __not_in_flash_func(draw_sprite_mirrored)(const struct SPRITE *spr,
+                                               int spr_x, int spr_y,
+                                               bool transparent) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, spr->width, spr->height, &c)) return;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const int x_start = c.x_start, x_end = c.x_end;
+
+  for (int y = c.row_start; y < c.row_end; y++) {
+    uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                     (c.y + y) * line_blocks * VGA_NUM_BITPLANES;
+    uint64_t set = 0;
+    uint32_t covered = 0;
+    int dx = c.x + x_start;
+    for (int x = x_start; x < x_end; x++, dx++) {
+      int idx = sprite_pixel_index(spr, spr->width - 1 - x, y);
+      int pos = dx & (VGA_BLOCK_PIXELS - 1);
+      if (idx < 0 && !transparent)
+        idx = rgb2index[VGA_TRANSPARENT_PIXEL & 0x3F];
+      if (idx >= 0 && spr->remap) idx = spr->remap->index[idx];
+      if (idx >= 0) {
+        covered |= 0x8000u >> pos;
+        set |= pixel_masks_flat[(idx << 4) | pos];
+      }
+      if (pos == VGA_BLOCK_PIXELS - 1) {
+        if (covered)
+          draw_merge_block(line + (dx >> 4) * VGA_NUM_BITPLANES, covered, set);
+        set = 0;
+        covered = 0;
       }
     }
+    if (covered)
+      draw_merge_block(line + ((dx - 1) >> 4) * VGA_NUM_BITPLANES, covered,
+                       set);
   }
 }
 
+/* Block-aligned draw of a tile with a planar copy (the copy has no remap
+ * or mirroring applied) */
+static inline bool tile_takes_planar(const struct SPRITE *spr, int spr_x) {
+  return spr->planar_tile && !spr->flip_x && !spr->remap &&
+         ((spr_x + vga_viewport.origin_x) & (VGA_BLOCK_PIXELS - 1)) == 0;
+}
+
 void __not_in_flash_func(draw_tile)(const struct SPRITE *__restrict spr,
                                     int spr_x, int spr_y) {
-  const unsigned int *image_start = spr->data;
-  int width = spr->width;
-  int height = spr->height;
-
-  const int drawable_height = vga_screen.height - VGA_STATUS_BAR_OFFSET;
-
-  /* Trivial reject if completely off-screen before clipping */
-  if (spr_x >= vga_screen.width || spr_y >= drawable_height) return;
-  if (spr_x + width <= 0 || spr_y + height <= 0) return;
-
-  /* Vertical clipping */
-  if (spr_y < 0) {
-    int skip_rows = -spr_y;
-    image_start += spr->stride * skip_rows;
-    height -= skip_rows;
-    spr_y = 0;
+  if (tile_takes_planar(spr, spr_x)) {
+    draw_tile_planar(spr->planar_tile, spr_x, spr_y, NULL);
+    return;
   }
-  if (height > drawable_height - spr_y) height = drawable_height - spr_y;
-  if (height <= 0) return;
-
-  /* Horizontal clipping */
-  unsigned shift = 0;  // NEW: carry leftover pixels
-  if (spr_x < 0) {
-    int skip_pixels = -spr_x;
-    image_start +=
-        (unsigned)skip_pixels / VGA_GROUP_PIXELS; /* advance whole words */
-    width -= skip_pixels;
-    shift = (unsigned)skip_pixels &
-            (VGA_GROUP_PIXELS - 1); /* NEW: leftover within word */
-    spr_x = 0; /* NEW: we’ve consumed the negative offset */
+  if (spr->format == SPRITE_FORMAT_PACKED4) {
+    draw_sprite_packed(spr, spr_x, spr_y, false);
+    return;
   }
-  if (width > vga_screen.width - spr_x) width = vga_screen.width - spr_x;
-  if (width <= 0) return;
-
-  const int row_bytes =
-      vga_screen.width / (VGA_BLOCK_PIXELS / 2); /* 16 px -> 8 bytes */
-  const unsigned int *__restrict row_src_base =
-      image_start; /* starting word pointer */
-  row_src_base =
-      (const unsigned int *__restrict)__builtin_assume_aligned(row_src_base, 4);
-
-  // NEW: number of 32-bit words actually needed to cover 'width'
-  const unsigned words_per_row =
-      (unsigned)((width + (VGA_GROUP_PIXELS - 1)) / VGA_GROUP_PIXELS);
-
-  for (unsigned row = 0; row < (unsigned)height; ++row) {
-    uint8_t *line =
-        (uint8_t *)&vga_screen.hidden_framebuffer[(spr_y + row) * row_bytes];
-
-    const uint32_t *wp =
-        (const uint32_t *)(row_src_base + (size_t)row * spr->stride);
-
-    unsigned pix =
-        (unsigned)spr_x + shift; /* include leftover shift from left-clip */
-    const unsigned block_mask = VGA_BLOCK_PIXELS - 1u;
-    const unsigned block_byte_shift = 3; /* (VGA_NUM_BITPLANES*2)==8 bytes */
-
-    // NEW: counted loop over only the visible words (keeps your unroll-by-2)
-    unsigned i = 0;
-    while (i < words_per_row) {
-      /* First iteration */
-      uint32_t packed0 = *wp & VGA_RGB6_PACK_MASK;
-      uint8_t *pal0 = (uint8_t *)&packed0;
-      uint8_t idx0a = rgb2index[pal0[0]];
-      uint8_t idx1a = rgb2index[pal0[1]];
-      uint8_t idx2a = rgb2index[pal0[2]];
-      uint8_t idx3a = rgb2index[pal0[3]];
-      unsigned pos0a = pix & block_mask;
-      unsigned pos1a = (pix + 1u) & block_mask;
-      unsigned pos2a = (pix + 2u) & block_mask;
-      unsigned pos3a = (pix + 3u) & block_mask;
-      uint64_t mask_a = pixel_masks_flat[(idx0a << 4) | pos0a] |
-                        pixel_masks_flat[(idx1a << 4) | pos1a] |
-                        pixel_masks_flat[(idx2a << 4) | pos2a] |
-                        pixel_masks_flat[(idx3a << 4) | pos3a];
-      uint64_t *block64_a =
-          (uint64_t *)(line + (((pix >> 4) << block_byte_shift)));
-      if (likely(pos0a == 0)) {
-        *block64_a = mask_a; /* overwrite whole 16px block */
-      } else {
-        *block64_a |= mask_a; /* merge into existing block */
-      }
-      ++wp;
-      pix += VGA_GROUP_PIXELS;
-      ++i;
+  if (spr->flip_x) {
+    draw_sprite_mirrored(spr, spr_x, spr_y, false);
+    return;
+  }
+  if (draw_sprite_blit(spr, spr_x, spr_y, false)) return;
+  draw_chunky(spr, spr_x, spr_y, false);
+}
 
-      /* Second unrolled iteration */
-      if (i >= words_per_row) break;
-      uint32_t packed1 = *wp & VGA_RGB6_PACK_MASK;
-      uint8_t *pal1 = (uint8_t *)&packed1;
-      uint8_t idx0b = rgb2index[pal1[0]];
-      uint8_t idx1b = rgb2index[pal1[1]];
-      uint8_t idx2b = rgb2index[pal1[2]];
-      uint8_t idx3b = rgb2index[pal1[3]];
-      unsigned pos0b = pix & block_mask;
-      unsigned pos1b = (pix + 1u) & block_mask;
-      unsigned pos2b = (pix + 2u) & block_mask;
-      unsigned pos3b = (pix + 3u) & block_mask;
-      uint64_t mask_b = pixel_masks_flat[(idx0b << 4) | pos0b] |
-                        pixel_masks_flat[(idx1b << 4) | pos1b] |
-                        pixel_masks_flat[(idx2b << 4) | pos2b] |
-                        pixel_masks_flat[(idx3b << 4) | pos3b];
-      uint64_t *block64_b =
-          (uint64_t *)(line + (((pix >> 4) << block_byte_shift)));
-      if (pos0b == 0) {
-        *block64_b = mask_b;
-      } else {
-        *block64_b |= mask_b;
-      }
-      ++wp;
-      pix += VGA_GROUP_PIXELS;
-      ++i;
-    }
+void __not_in_flash_func(draw_tile_rect)(const struct SPRITE *__restrict spr,
+                                         int spr_x, int spr_y,
+                                         const struct VGA_RECT *rect) {
+  const int x = spr_x + vga_viewport.origin_x;
+  const int y = spr_y + vga_viewport.origin_y;
+  if (x >= rect->x1 || y >= rect->y1 || x + spr->width <= rect->x0 ||
+      y + spr->height <= rect->y0)
+    return;
+  if (tile_takes_planar(spr, spr_x)) {
+    draw_tile_planar(spr->planar_tile, spr_x, spr_y, rect);
+    return;
   }
+  if (spr->format == SPRITE_FORMAT_PACKED4 &&
+      draw_tile_packed_rect(spr, spr_x, spr_y, rect))
+    return;
+  draw_tile(spr, spr_x, spr_y);
 }
\ No newline at end of file
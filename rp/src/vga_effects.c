@@ -0,0 +1,265 @@
+#include "vga/effects.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga/texel.h"
+
+/* Depth of a tunnel cell at distance r from the centre, in cells */
+#define EFFECT_TUNNEL_DEPTH 2048.0f
+
+static uint8_t *effect_texture_alloc(struct EFFECT_TEXTURE *texture,
+                                     int width_bits, int height_bits) {
+  const size_t bytes = (size_t)1 << (width_bits + height_bits);
+  texture->texels = malloc(bytes);
+  if (texture->texels == NULL) {
+    DPRINTF("Failed to allocate %u bytes for a texture\n",
+            (unsigned int)bytes);
+    return NULL;
+  }
+  texture->width_bits = (uint8_t)width_bits;
+  texture->height_bits = (uint8_t)height_bits;
+  return texture->texels;
+}
+
+int effect_texture_from_sprite(struct EFFECT_TEXTURE *texture,
+                               const struct SPRITE *spr, int width_bits,
+                               int height_bits) {
+  uint8_t *texels = effect_texture_alloc(texture, width_bits, height_bits);
+  if (texels == NULL) return VGA_ERROR_ALLOC;
+  for (int y = 0; y < 1 << height_bits; y++) {
+    for (int x = 0; x < 1 << width_bits; x++) {
+      const int idx = sprite_pixel_index(spr, x % spr->width, y % spr->height);
+      *texels++ = (uint8_t)(idx < 0 ? 0 : idx);
+    }
+  }
+  return 0;
+}
+
+int effect_texture_plasma(struct EFFECT_TEXTURE *texture, int width_bits,
+                          int height_bits) {
+  uint8_t *texels = effect_texture_alloc(texture, width_bits, height_bits);
+  if (texels == NULL) return VGA_ERROR_ALLOC;
+  const float fu = 6.28318531f / (1 << width_bits);
+  const float fv = 6.28318531f / (1 << height_bits);
+  for (int y = 0; y < 1 << height_bits; y++) {
+    for (int x = 0; x < 1 << width_bits; x++) {
+      /* Whole periods both ways, so the texture wraps without a seam */
+      const float s = sinf(x * fu) + sinf(y * fv) + sinf(x * fu + y * fv) +
+                      sinf(2 * x * fu - y * fv);
+      *texels++ = (uint8_t)lroundf(127.5f + s * 31.8f);
+    }
+  }
+  return 0;
+}
+
+void effect_texture_free(struct EFFECT_TEXTURE *texture) {
+  free(texture->texels);
+  texture->texels = NULL;
+}
+
+int effect_tunnel_init(struct EFFECT_TUNNEL *tunnel, int width, int height) {
+  const int cells_x = (width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS *
+                      VGA_BLOCK_PIXELS / 2;
+  const int cells_y = height / 2;
+  tunnel->width = cells_x - cells_x / 2;
+  tunnel->height = cells_y - cells_y / 2;
+  const size_t bytes =
+      (size_t)tunnel->width * tunnel->height * sizeof(*tunnel->cells);
+  tunnel->cells = malloc(bytes);
+  if (tunnel->cells == NULL) {
+    DPRINTF("Failed to allocate %u bytes for the tunnel\n",
+            (unsigned int)bytes);
+    return VGA_ERROR_ALLOC;
+  }
+  uint16_t *cell = tunnel->cells;
+  for (int j = 0; j < tunnel->height; j++) {
+    for (int i = 0; i < tunnel->width; i++) {
+      const float dx = i + 0.5f, dy = j + 0.5f;
+      const int angle = (int)(atan2f(dy, dx) * (256 / 6.28318531f));
+      const int depth = (int)(EFFECT_TUNNEL_DEPTH / sqrtf(dx * dx + dy * dy));
+      *cell++ = (uint16_t)(((depth & 0xFF) << 8) | (angle & 0xFF));
+    }
+  }
+  return 0;
+}
+
+void effect_tunnel_free(struct EFFECT_TUNNEL *tunnel) {
+  free(tunnel->cells);
+  tunnel->cells = NULL;
+}
+
+static inline uint32_t effect_random(uint32_t *seed) {
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed >> 8;
+}
+
+/* A star anywhere across the far plane, at depth z */
+static void effect_star_spawn(struct EFFECT_STARFIELD *field,
+                              struct EFFECT_STAR *star, int z) {
+  star->x = (int16_t)((int)(effect_random(&field->seed) %
+                            (2 * EFFECT_STAR_DEPTH)) -
+                      EFFECT_STAR_DEPTH);
+  star->y = (int16_t)((int)(effect_random(&field->seed) %
+                            (2 * EFFECT_STAR_DEPTH)) -
+                      EFFECT_STAR_DEPTH);
+  star->z = (int16_t)z;
+}
+
+int effect_starfield_init(struct EFFECT_STARFIELD *field, int count) {
+  field->stars = malloc((size_t)count * sizeof(*field->stars));
+  if (field->stars == NULL) {
+    DPRINTF("Failed to allocate %d stars\n", count);
+    return VGA_ERROR_ALLOC;
+  }
+  field->count = count;
+  field->seed = 0x2545F491u;
+  for (int i = 0; i < count; i++) {
+    const int z = EFFECT_STAR_NEAR +
+                  (int)(effect_random(&field->seed) %
+                        (EFFECT_STAR_DEPTH - EFFECT_STAR_NEAR));
+    effect_star_spawn(field, &field->stars[i], z);
+  }
+  return 0;
+}
+
+void effect_starfield_free(struct EFFECT_STARFIELD *field) {
+  free(field->stars);
+  field->stars = NULL;
+}
+
+/* `words` words of stepper texels, eight pixels each: the palette index is
+ * (texel + add) >> shift */
+static inline __attribute__((always_inline)) void effect_span(
+    uint32_t *dst, int words, uint32_t add, const int shift) {
+  for (int w = 0; w < words; w++) {
+    uint32_t word = 0;
+#pragma GCC unroll 8
+    for (int k = 0; k < VGA_PACKED_GROUP_PIXELS; k++)
+      word |= (((texel_next() + add) >> shift) & 0xF) << (4 * k);
+    dst[w] = word;
+  }
+}
+
+void __not_in_flash_func(effect_plasma)(struct CHUNKY_FRAME *frame,
+                                        const struct EFFECT_TEXTURE *texture,
+                                        int t) {
+  const int row_words = frame->width / VGA_PACKED_GROUP_PIXELS;
+  /* Half a texel per pixel, the rows slanted as time goes */
+  const uint32_t du = 1u << (TEXEL_FRACTION_BITS - 1);
+  const uint32_t dv = (uint32_t)(vga_sin(t * 3) >> 4);
+  const uint32_t add = (uint32_t)(t * 2) & 0xFF;
+  texel_set_stepper(texture->texels, texture->width_bits,
+                    texture->height_bits);
+  uint32_t *line = frame->data;
+  for (int y = 0; y < frame->height; y++, line += row_words) {
+    /* Rows waving by up to 8 texels */
+    const uint32_t u = (uint32_t)(vga_sin(y * 6 + t * 5) *
+                                  (8 << (TEXEL_FRACTION_BITS -
+                                         VGA_SINE_BITS)));
+    const uint32_t v = (uint32_t)(y << (TEXEL_FRACTION_BITS - 1)) +
+                       (uint32_t)(t << (TEXEL_FRACTION_BITS - 2));
+    texel_start(u, v, du, dv);
+    effect_span(line, row_words, add, 4);
+  }
+}
+
+void __not_in_flash_func(effect_rotozoom)(struct CHUNKY_FRAME *frame,
+                                          const struct EFFECT_TEXTURE *texture,
+                                          int angle, int32_t zoom, int32_t u,
+                                          int32_t v) {
+  const int row_words = frame->width / VGA_PACKED_GROUP_PIXELS;
+  /* Texture steps along a row and down a column, 16.16 */
+  const int32_t cos_zoom =
+      (int32_t)(((int64_t)zoom * vga_cos(angle)) >> VGA_SINE_BITS);
+  const int32_t sin_zoom =
+      (int32_t)(((int64_t)zoom * vga_sin(angle)) >> VGA_SINE_BITS);
+  const int cx = frame->width / 2, cy = frame->height / 2;
+  uint32_t row_u = (uint32_t)u - (uint32_t)(cx * cos_zoom) +
+                   (uint32_t)(cy * sin_zoom);
+  uint32_t row_v = (uint32_t)v - (uint32_t)(cx * sin_zoom) -
+                   (uint32_t)(cy * cos_zoom);
+  texel_set_stepper(texture->texels, texture->width_bits,
+                    texture->height_bits);
+  uint32_t *line = frame->data;
+  for (int y = 0; y < frame->height; y++, line += row_words) {
+    texel_start(row_u, row_v, (uint32_t)cos_zoom, (uint32_t)sin_zoom);
+    effect_span(line, row_words, 0, 0);
+    row_u -= (uint32_t)sin_zoom;
+    row_v += (uint32_t)cos_zoom;
+  }
+}
+
+/* Four tunnel cells per word, two pixels each. The angle of a cell is
+ * u_base + a, or u_base - a when `negate`; `step` walks the table row. */
+static inline __attribute__((always_inline)) void effect_tunnel_cells(
+    uint32_t *dst, const uint16_t *cells, const int step, int words,
+    uint32_t u_base, const bool negate, uint32_t v_offset) {
+  for (int w = 0; w < words; w++) {
+    uint32_t word = 0;
+#pragma GCC unroll 4
+    for (int k = 0; k < 4; k++) {
+      const uint32_t e = *cells;
+      cells += step;
+      const uint32_t u = (negate ? u_base - e : u_base + e) & 0xFF;
+      word |= (texel_at((e & 0xFF00) + v_offset + u) * 0x11) << (8 * k);
+    }
+    dst[w] = word;
+  }
+}
+
+void __not_in_flash_func(effect_tunnel)(struct CHUNKY_FRAME *frame,
+                                        const struct EFFECT_TUNNEL *tunnel,
+                                        const struct EFFECT_TEXTURE *texture,
+                                        int angle, int depth) {
+  const int row_words = frame->width / VGA_PACKED_GROUP_PIXELS;
+  const int cells_x = frame->width / 2, cells_y = frame->height / 2;
+  /* Cells left of and above the centre */
+  const int left = cells_x / 2, top = cells_y / 2;
+  if (cells_x - left > tunnel->width || cells_y - top > tunnel->height) return;
+  const uint32_t u_offset = (uint32_t)angle & 0xFF;
+  const uint32_t v_offset = ((uint32_t)depth & 0xFF) << 8;
+  texel_set_packed(texture->texels, texture->width_bits, texture->height_bits);
+  for (int cy = 0; cy < cells_y; cy++) {
+    /* Mirrored across the axes: a cell at angle a above the centre is at
+     * -a, left of it at 128 - a, and both at 128 + a */
+    const bool above = cy < top;
+    const uint16_t *cells =
+        tunnel->cells + (above ? top - 1 - cy : cy - top) * tunnel->width;
+    uint32_t *line = frame->data + 2 * cy * row_words;
+    const int left_words = left / 4;
+    effect_tunnel_cells(line, cells + left - 1, -1, left_words,
+                        128 + u_offset, !above, v_offset);
+    effect_tunnel_cells(line + left_words, cells, 1,
+                        (cells_x - left) / 4, u_offset, above, v_offset);
+    memcpy(line + row_words, line, row_words * sizeof(*line));
+  }
+  if (frame->height & 1) {
+    uint32_t *last = frame->data + (frame->height - 1) * row_words;
+    memcpy(last, last - row_words, row_words * sizeof(*last));
+  }
+}
+
+void __not_in_flash_func(effect_starfield)(
+    struct CHUNKY_FRAME *frame, struct EFFECT_STARFIELD *field, int speed,
+    const uint8_t shades[EFFECT_STAR_SHADES]) {
+  const int cx = frame->width / 2, cy = frame->height / 2;
+  for (int i = 0; i < field->count; i++) {
+    struct EFFECT_STAR *star = &field->stars[i];
+    int z = star->z - speed;
+    if (z < EFFECT_STAR_NEAR) {
+      effect_star_spawn(field, star, EFFECT_STAR_DEPTH - 1);
+      continue;
+    }
+    star->z = (int16_t)z;
+    const int x = cx + star->x * cx / z;
+    const int y = cy + star->y * cx / z;
+    if (x < 0 || x >= frame->width || y < 0 || y >= frame->height) {
+      effect_star_spawn(field, star, EFFECT_STAR_DEPTH - 1);
+      continue;
+    }
+    chunky_plot(frame, x, y,
+                shades[z * EFFECT_STAR_SHADES / EFFECT_STAR_DEPTH]);
+  }
+}
@@ -11,6 +11,7 @@ unsigned int font_x, font_y;
 enum FONT_ALIGNMENT font_alignment;
 unsigned char font_color;
 unsigned char border[2];
+struct VGA_RECT font_last_rect;
 
 #if VGA_FONT_USE_STDARG
 #include <stdarg.h>
@@ -47,7 +48,11 @@ static int __not_in_flash_func(render_text)(const char *text, int x, int y,
   if (!text || !*text) return x;
 
   const int screen_width = vga_screen.width;
-  const int screen_height = vga_screen.height;
+  /* Viewport clip, and the origin to apply to x and y */
+  const int clip_x0 = vga_viewport.clip.x0, clip_x1 = vga_viewport.clip.x1;
+  const int clip_y0 = vga_viewport.clip.y0, clip_y1 = vga_viewport.clip.y1;
+  const int origin_x = vga_viewport.origin_x;
+  y += vga_viewport.origin_y;
   const int glyph_w = font->w;
   const int glyph_h = font->h;
   const int first_char = font->first_char;
@@ -63,18 +68,18 @@ static int __not_in_flash_func(render_text)(const char *text, int x, int y,
       continue;
     }
 
-    /* Fast reject if entirely offscreen horizontally */
-    int gx0 = x;
-    int gx1 = x + glyph_w; /* exclusive */
-    if (gx1 <= 0 || gx0 >= screen_width) {
+    /* Fast reject if entirely outside the viewport horizontally */
+    int gx0 = x + origin_x;
+    int gx1 = gx0 + glyph_w; /* exclusive */
+    if (gx1 <= clip_x0 || gx0 >= clip_x1) {
       x += glyph_w;
       continue;
     }
 
-    /* Fast reject if entirely offscreen vertically */
+    /* Fast reject if entirely outside the viewport vertically */
     int gy0 = y;
     int gy1 = y + glyph_h; /* exclusive */
-    if (gy1 <= 0 || gy0 >= screen_height) {
+    if (gy1 <= clip_y0 || gy0 >= clip_y1) {
       x += glyph_w;
       continue;
     }
@@ -84,14 +89,14 @@ static int __not_in_flash_func(render_text)(const char *text, int x, int y,
     const uint8_t *glyph_rows = &font->data[glyph_offset];
 
     /* Horizontal visible span (clip) */
-    int vis_x0 = gx0 < 0 ? 0 : gx0;
-    int vis_x1 = gx1 > screen_width ? screen_width : gx1;
+    int vis_x0 = gx0 < clip_x0 ? clip_x0 : gx0;
+    int vis_x1 = gx1 > clip_x1 ? clip_x1 : gx1;
     int vis_local_start = vis_x0 - gx0; /* first local pixel column */
     int vis_local_end = vis_x1 - gx0;   /* one past last local column */
 
     for (int row = 0; row < glyph_h; ++row) {
       int py = y + row;
-      if (py < 0 || py >= screen_height) continue; /* vertical clip */
+      if (py < clip_y0 || py >= clip_y1) continue; /* vertical clip */
       uint8_t bits = glyph_rows[row];
       if (!bits) continue; /* empty row */
 
@@ -129,9 +134,7 @@ static int __not_in_flash_func(render_text)(const char *text, int x, int y,
   return x;
 }
 
-void __not_in_flash_func(font_print)(const char *text) {
-  if (text == NULL) return;
-
+void __not_in_flash_func(font_print_start)(const char *text) {
   switch (font_alignment) {
     case FONT_ALIGN_LEFT: /* nothing to do */
       break;
@@ -142,7 +145,28 @@ void __not_in_flash_func(font_print)(const char *text) {
       font_x -= strlen(text) * font->w;
       break;
   }
+}
+
+void __not_in_flash_func(font_print_end)(int end_x) {
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  const int edge = border[0] ? 1 : 0;
+  const int x = (int)font_x + vga_viewport.origin_x;
+  const int y = (int)font_y + vga_viewport.origin_y;
+  int x0 = x - edge, y0 = y - edge;
+  int x1 = end_x + vga_viewport.origin_x + edge, y1 = y + font->h + edge;
+  font_last_rect.x0 = (int16_t)(x0 < clip->x0 ? clip->x0 : x0);
+  font_last_rect.y0 = (int16_t)(y0 < clip->y0 ? clip->y0 : y0);
+  font_last_rect.x1 = (int16_t)(x1 > clip->x1 ? clip->x1 : x1);
+  font_last_rect.y1 = (int16_t)(y1 > clip->y1 ? clip->y1 : y1);
+  if (font_alignment != FONT_ALIGN_RIGHT) {
+    font_x = end_x;
+  }
+}
+
+void __not_in_flash_func(font_print)(const char *text) {
+  if (text == NULL) return;
 
+  font_print_start(text);
   if (border[0]) {
     for (int i = -1; i <= 1; i++) {
       for (int j = -1; j <= 1; j++) {
@@ -151,8 +175,5 @@ void __not_in_flash_func(font_print)(const char *text) {
       }
     }
   }
-  int new_x = render_text(text, font_x, font_y, font_color);
-  if (font_alignment != FONT_ALIGN_RIGHT) {
-    font_x = new_x;
-  }
-}
\ No newline at end of file
+  font_print_end(render_text(text, font_x, font_y, font_color));
+}
@@ -0,0 +1,154 @@
+#include "vga/mesh.h"
+
+/* Camera space vertex */
+struct MESH_POINT {
+  int32_t x;
+  int32_t y;
+  int32_t z;
+};
+
+/* The mesh being drawn, in camera space and projected (when in front) */
+static struct MESH_POINT camera_points[MESH_MAX_VERTICES];
+static struct DRAW_VERTEX projected[MESH_MAX_VERTICES];
+
+/* Camera space x and y projected with 32-bit products */
+#define MESH_PROJECT_LIMIT 32767
+#define MESH_FOCAL_LIMIT 1024
+/* Projections are clamped here, well inside what polygon clipping takes */
+#define MESH_SCREEN_LIMIT (1 << 27)
+
+/* Rounded product of two Q14 values */
+static inline int32_t mul_q14(int32_t a, int32_t b) {
+  return (a * b + (1 << (MESH_ROTATION_BITS - 1))) >> MESH_ROTATION_BITS;
+}
+
+void mesh_pose_rotation(struct MESH_POSE *pose, int ax, int ay, int az) {
+  const int32_t sx = vga_sin(ax), cx = vga_cos(ax);
+  const int32_t sy = vga_sin(ay), cy = vga_cos(ay);
+  const int32_t sz = vga_sin(az), cz = vga_cos(az);
+  const int32_t czsy = mul_q14(cz, sy), szsy = mul_q14(sz, sy);
+  /* Rz * Ry * Rx */
+  const int32_t m[3][3] = {
+      {mul_q14(cz, cy), mul_q14(czsy, sx) - mul_q14(sz, cx),
+       mul_q14(czsy, cx) + mul_q14(sz, sx)},
+      {mul_q14(sz, cy), mul_q14(szsy, sx) + mul_q14(cz, cx),
+       mul_q14(szsy, cx) - mul_q14(cz, sx)},
+      {-sy, mul_q14(cy, sx), mul_q14(cy, cx)},
+  };
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) pose->m[i][j] = (int16_t)m[i][j];
+  }
+}
+
+static inline int32_t clamp_screen(int64_t v) {
+  if (v > MESH_SCREEN_LIMIT) return MESH_SCREEN_LIMIT;
+  if (v < -MESH_SCREEN_LIMIT) return -MESH_SCREEN_LIMIT;
+  return (int32_t)v;
+}
+
+/* Project a point in front of the near plane to 1/16 pixels */
+static inline __attribute__((always_inline)) struct DRAW_VERTEX project(
+    const struct MESH_POINT *p, const struct MESH_CAMERA *camera) {
+  const int32_t scale = camera->focal * (1 << DRAW_SUBPIXEL_BITS);
+  struct DRAW_VERTEX v;
+  v.x = camera->cx * (1 << DRAW_SUBPIXEL_BITS);
+  v.y = camera->cy * (1 << DRAW_SUBPIXEL_BITS);
+  if (p->x >= -MESH_PROJECT_LIMIT && p->x <= MESH_PROJECT_LIMIT &&
+      p->y >= -MESH_PROJECT_LIMIT && p->y <= MESH_PROJECT_LIMIT &&
+      camera->focal < MESH_FOCAL_LIMIT) {
+    v.x += p->x * scale / p->z;
+    v.y += p->y * scale / p->z;
+  } else {
+    v.x = clamp_screen(v.x + (int64_t)p->x * scale / p->z);
+    v.y = clamp_screen(v.y + (int64_t)p->y * scale / p->z);
+  }
+  return v;
+}
+
+/* Sutherland-Hodgman against z >= near. New vertices are interpolated from
+ * the end in front, so faces sharing the edge get the same one. */
+static int clip_near(const struct MESH_POINT *in, int count,
+                     struct MESH_POINT *out, int32_t near) {
+  int n = 0;
+  const struct MESH_POINT *a = &in[count - 1];
+  for (int i = 0; i < count; i++) {
+    const struct MESH_POINT *b = &in[i];
+    const bool a_in = a->z >= near, b_in = b->z >= near;
+    if (a_in != b_in) {
+      const struct MESH_POINT *p = a_in ? a : b, *q = a_in ? b : a;
+      const int32_t t = near - p->z, span = q->z - p->z;
+      out[n].x = p->x + (int32_t)((int64_t)(q->x - p->x) * t / span);
+      out[n].y = p->y + (int32_t)((int64_t)(q->y - p->y) * t / span);
+      out[n].z = near;
+      n++;
+    }
+    if (b_in) out[n++] = *b;
+    a = b;
+  }
+  return n;
+}
+
+/* Clockwise on screen, y down: positive area */
+static inline bool front_facing(const struct DRAW_VERTEX *v, int count) {
+  int64_t area = 0;
+  for (int i = 0, j = count - 1; i < count; j = i++)
+    area += (int64_t)v[j].x * v[i].y - (int64_t)v[i].x * v[j].y;
+  return area > 0;
+}
+
+int __not_in_flash_func(mesh_draw)(const struct MESH *mesh,
+                                   const struct MESH_POSE *pose,
+                                   const struct MESH_CAMERA *camera) {
+  const int num_vertices = mesh->num_vertices < MESH_MAX_VERTICES
+                               ? mesh->num_vertices
+                               : MESH_MAX_VERTICES;
+  for (int i = 0; i < num_vertices; i++) {
+    const struct MESH_VERTEX *v = &mesh->vertices[i];
+    struct MESH_POINT *p = &camera_points[i];
+    p->x = ((pose->m[0][0] * v->x + pose->m[0][1] * v->y +
+             pose->m[0][2] * v->z) >>
+            MESH_ROTATION_BITS) +
+           pose->x;
+    p->y = ((pose->m[1][0] * v->x + pose->m[1][1] * v->y +
+             pose->m[1][2] * v->z) >>
+            MESH_ROTATION_BITS) +
+           pose->y;
+    p->z = ((pose->m[2][0] * v->x + pose->m[2][1] * v->y +
+             pose->m[2][2] * v->z) >>
+            MESH_ROTATION_BITS) +
+           pose->z;
+    if (p->z >= camera->near) projected[i] = project(p, camera);
+  }
+
+  int drawn = 0;
+  for (int f = 0; f < mesh->num_faces; f++) {
+    const struct MESH_FACE *face = &mesh->faces[f];
+    int count = face->count;
+    if (count < 3 || count > MESH_MAX_FACE_VERTICES) continue;
+    bool valid = true, in_front = true;
+    for (int k = 0; k < count; k++) {
+      if (face->index[k] >= num_vertices)
+        valid = false;
+      else if (camera_points[face->index[k]].z < camera->near)
+        in_front = false;
+    }
+    if (!valid) continue;
+
+    /* Clipping against the near plane adds one vertex at most */
+    struct DRAW_VERTEX poly[MESH_MAX_FACE_VERTICES + 1];
+    if (in_front) {
+      for (int k = 0; k < count; k++) poly[k] = projected[face->index[k]];
+    } else {
+      struct MESH_POINT in[MESH_MAX_FACE_VERTICES];
+      struct MESH_POINT out[MESH_MAX_FACE_VERTICES + 1];
+      for (int k = 0; k < count; k++) in[k] = camera_points[face->index[k]];
+      count = clip_near(in, count, out, camera->near);
+      if (count < 3) continue;
+      for (int k = 0; k < count; k++) poly[k] = project(&out[k], camera);
+    }
+    if (!front_facing(poly, count)) continue;
+    draw_fill_polygon(poly, count, face->color);
+    drawn++;
+  }
+  return drawn;
+}
@@ -0,0 +1,237 @@
+#include "vga/draw.h"
+
+/* Planar bits of the two pixels of one packed byte, placed at positions 0
+ * and 1 of a block: [0] holds planes 0 (low half) and 1, [1] planes 2 and 3.
+ * Pair k of a block is the entry shifted right by 2 * k, so a 4-pixel group
+ * converts with two 64-bit loads. 2 KB, in main RAM: both scratch banks
+ * also hold a core stack.
+ */
+static uint32_t packed_pair_planes[256][2];
+
+void init_packed_planes(void) {
+  for (int b = 0; b < 256; b++) {
+    uint32_t lo = 0, hi = 0;
+    for (int p = 0; p < 2; p++) {
+      int idx = (b >> (4 * p)) & 0xF;
+      uint32_t bit = 0x8000u >> p;
+      if (idx & 1) lo |= bit;
+      if (idx & 2) lo |= bit << 16;
+      if (idx & 4) hi |= bit;
+      if (idx & 8) hi |= bit << 16;
+    }
+    packed_pair_planes[b][0] = lo;
+    packed_pair_planes[b][1] = hi;
+  }
+}
+
+/* Add the 8 pixels of packed word `w` to a block, starting at pair `pair` */
+static inline __attribute__((always_inline)) void packed_word_planes(
+    uint32_t w, const int pair, uint32_t *lo, uint32_t *hi) {
+#pragma GCC unroll 4
+  for (int k = 0; k < 4; k++) {
+    const uint32_t *e = packed_pair_planes[(w >> (8 * k)) & 0xFF];
+    *lo |= e[0] >> (2 * (pair + k));
+    *hi |= e[1] >> (2 * (pair + k));
+  }
+}
+
+/* Planar block `sb` of a packed row: mask and four plane words, with
+ * transparent and out-of-sprite pixels cleared. Index 12 is 0b1100, so the
+ * transparent pixels are the ones with planes 2 and 3 set and 0 and 1 clear.
+ */
+static inline __attribute__((always_inline)) void packed_block(
+    const uint32_t *row, int sb, const struct SPRITE *spr, uint32_t last_mask,
+    const bool transparent, uint32_t out[VGA_PLANAR_BLOCK_WORDS]) {
+  const int words = 2 * sb;
+  uint32_t lo = 0, hi = 0;
+  packed_word_planes(row[words], 0, &lo, &hi);
+  if (words + 1 < (int)spr->stride)
+    packed_word_planes(row[words + 1], 4, &lo, &hi);
+  uint32_t mask = (sb + 1) * VGA_BLOCK_PIXELS > spr->width ? last_mask
+                                                           : 0xFFFFu;
+  if (transparent) mask &= lo | (lo >> 16) | ~hi | ~(hi >> 16);
+  mask &= 0xFFFFu;
+  out[0] = mask;
+  out[1] = lo & mask;
+  out[2] = (lo >> 16) & mask;
+  out[3] = hi & mask;
+  out[4] = (hi >> 16) & mask;
+}
+
+/* Pair-table blit: each 16-pixel source block is converted to a planar
+ * block with 8 table loads, then shifted into (at most) two destination
+ * blocks through 32-bit windows, like the planar blitter. Clipping is done
+ * in whole destination blocks, to the viewport and to `clip` (screen pixels)
+ * when not NULL.
+ */
+static inline __attribute__((always_inline)) void draw_packed_blocks(
+    const struct SPRITE *spr, int spr_x, int spr_y, const bool transparent,
+    const struct VGA_RECT *clip) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, spr->width, spr->height, &c)) return;
+  spr_x = c.x;
+  spr_y = c.y;
+  int row_start = c.row_start;
+  int row_end = c.row_end;
+  if (clip) {
+    if (clip->y0 - spr_y > row_start) row_start = clip->y0 - spr_y;
+    if (clip->y1 - spr_y < row_end) row_end = clip->y1 - spr_y;
+  }
+  if (row_start >= row_end) return;
+
+  const int blocks = (spr->width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS;
+  const uint32_t last_mask =
+      0xFFFFu << (blocks * VGA_BLOCK_PIXELS - spr->width);
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const unsigned shift = (unsigned)spr_x & (VGA_BLOCK_PIXELS - 1);
+  const int first_block = spr_x >> 4; /* floor, also for negative x */
+  /* A shifted sprite spills into one extra destination block */
+  int last_block = first_block + blocks - (shift == 0 ? 1 : 0);
+  int block_start = first_block;
+  if (block_start < vga_viewport.block_x0) block_start = vga_viewport.block_x0;
+  if (last_block >= vga_viewport.block_x1)
+    last_block = vga_viewport.block_x1 - 1;
+  if (clip) {
+    if (clip->x0 >> 4 > block_start) block_start = clip->x0 >> 4;
+    if ((clip->x1 - 1) >> 4 < last_block) last_block = (clip->x1 - 1) >> 4;
+  }
+  if (block_start > last_block) return;
+  const int src_start = block_start - first_block;
+  const int src_end = src_start + (last_block - block_start);
+
+#if VGA_ASM_BLITTERS
+  /* Opaque, block-aligned and whole blocks wide (the tiles): no windows */
+  const bool asm_rows = !transparent && shift == 0 &&
+                        (spr->width & (VGA_BLOCK_PIXELS - 1)) == 0;
+#endif
+  for (int y = row_start; y < row_end; y++) {
+    const uint32_t *row = (const uint32_t *)&spr->data[spr->stride * y];
+    uint16_t *dst = (uint16_t *)vga_screen.hidden_framebuffer +
+                    ((spr_y + y) * line_blocks + block_start) *
+                        VGA_NUM_BITPLANES;
+#if VGA_ASM_BLITTERS
+    if (asm_rows) {
+      blit_asm_packed_row(dst, row + 2 * src_start, src_end - src_start + 1,
+                          packed_pair_planes);
+      continue;
+    }
+#endif
+    /* 32-bit windows: previous source word in the high half */
+    uint32_t win[VGA_PLANAR_BLOCK_WORDS] = {0};
+    if (src_start > 0)
+      packed_block(row, src_start - 1, spr, last_mask, transparent, win);
+    for (int sb = src_start; sb <= src_end; sb++) {
+      uint32_t cur[VGA_PLANAR_BLOCK_WORDS] = {0};
+      if (sb < blocks) packed_block(row, sb, spr, last_mask, transparent, cur);
+#pragma GCC unroll 5
+      for (int w = 0; w < VGA_PLANAR_BLOCK_WORDS; w++)
+        win[w] = (win[w] << 16) | cur[w];
+      uint16_t mask = (uint16_t)(win[0] >> shift);
+      if (mask == 0xFFFFu) {
+        /* Fully covered: no need to read the block back */
+        dst[0] = (uint16_t)(win[1] >> shift);
+        dst[1] = (uint16_t)(win[2] >> shift);
+        dst[2] = (uint16_t)(win[3] >> shift);
+        dst[3] = (uint16_t)(win[4] >> shift);
+      } else if (mask) {
+        dst[0] = (uint16_t)((dst[0] & ~mask) | (uint16_t)(win[1] >> shift));
+        dst[1] = (uint16_t)((dst[1] & ~mask) | (uint16_t)(win[2] >> shift));
+        dst[2] = (uint16_t)((dst[2] & ~mask) | (uint16_t)(win[3] >> shift));
+        dst[3] = (uint16_t)((dst[3] & ~mask) | (uint16_t)(win[4] >> shift));
+      }
+      dst += VGA_NUM_BITPLANES;
+    }
+  }
+}
+
+/* Pixel-walk blit for mirrored and remapped draws: the nibbles already are
+ * palette indices, so there is no rgb2index lookup. Source pixels are
+ * walked one 32-bit load per 8 pixels, and each destination block is merged
+ * once when the walk leaves it. Mirrored, the source row is walked right to
+ * left with the next pixel kept in the top nibble of the word. A remap costs
+ * one byte load per pixel, and only in the remapped instances.
+ */
+static inline __attribute__((always_inline)) void draw_packed_pixels(
+    const struct SPRITE *spr, int spr_x, int spr_y, const bool transparent,
+    const bool flip, const bool remapped) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, spr->width, spr->height, &c)) return;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  /* Visible columns, relative to the sprite origin on screen */
+  const int x_start = c.x_start, x_end = c.x_end;
+  const int sx_start = flip ? spr->width - 1 - x_start : x_start;
+
+  for (int y = c.row_start; y < c.row_end; y++) {
+    const uint32_t *src = (const uint32_t *)&spr->data[spr->stride * y];
+    uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                     (c.y + y) * line_blocks * VGA_NUM_BITPLANES;
+    uint32_t word = src[sx_start / VGA_PACKED_GROUP_PIXELS];
+    if (flip)
+      word <<= 4 * (VGA_PACKED_GROUP_PIXELS - 1 -
+                    sx_start % VGA_PACKED_GROUP_PIXELS);
+    else
+      word >>= 4 * (sx_start % VGA_PACKED_GROUP_PIXELS);
+    uint64_t set = 0;
+    uint32_t covered = 0;
+    int sx = sx_start;
+    int dx = c.x + x_start;
+    for (int x = x_start; x < x_end; x++, dx++) {
+      uint32_t idx;
+      if (flip) {
+        if ((sx & (VGA_PACKED_GROUP_PIXELS - 1)) ==
+            VGA_PACKED_GROUP_PIXELS - 1)
+          word = src[sx / VGA_PACKED_GROUP_PIXELS];
+        idx = word >> 28;
+        word <<= 4;
+        sx--;
+      } else {
+        if ((sx & (VGA_PACKED_GROUP_PIXELS - 1)) == 0)
+          word = src[sx / VGA_PACKED_GROUP_PIXELS];
+        idx = word & 0xF;
+        word >>= 4;
+        sx++;
+      }
+      int pos = dx & (VGA_BLOCK_PIXELS - 1);
+      if (!transparent || idx != VGA_PACKED_TRANSPARENT) {
+        if (remapped) idx = spr->remap->index[idx];
+        covered |= 0x8000u >> pos;
+        set |= pixel_masks_flat[(idx << 4) | pos];
+      }
+      if (pos == VGA_BLOCK_PIXELS - 1) {
+        if (covered)
+          draw_merge_block(line + (dx >> 4) * VGA_NUM_BITPLANES, covered, set);
+        set = 0;
+        covered = 0;
+      }
+    }
+    /* Last block when the sprite ends inside it */
+    if (covered)
+      draw_merge_block(line + ((dx - 1) >> 4) * VGA_NUM_BITPLANES, covered,
+                       set);
+  }
+}
+
+void __not_in_flash_func(draw_sprite_packed)(const struct SPRITE *spr,
+                                             int spr_x, int spr_y,
+                                             bool transparent) {
+  if (spr->remap) {
+    if (spr->flip_x)
+      draw_packed_pixels(spr, spr_x, spr_y, transparent, true, true);
+    else
+      draw_packed_pixels(spr, spr_x, spr_y, transparent, false, true);
+  } else if (spr->flip_x) {
+    draw_packed_pixels(spr, spr_x, spr_y, transparent, true, false);
+  } else if (transparent) {
+    draw_packed_blocks(spr, spr_x, spr_y, true, NULL);
+  } else {
+    draw_packed_blocks(spr, spr_x, spr_y, false, NULL);
+  }
+}
+
+bool __not_in_flash_func(draw_tile_packed_rect)(const struct SPRITE *spr,
+                                                int spr_x, int spr_y,
+                                                const struct VGA_RECT *rect) {
+  if (spr->remap || spr->flip_x) return false;
+  draw_packed_blocks(spr, spr_x, spr_y, false, rect);
+  return true;
+}
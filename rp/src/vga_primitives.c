@@ -0,0 +1,338 @@
+#include "vga/primitives.h"
+
+static inline __attribute__((always_inline)) uint32_t *line_words(int y) {
+  return (uint32_t *)vga_screen.hidden_framebuffer +
+         y * (vga_screen.width / VGA_BLOCK_PIXELS) * 2;
+}
+
+/* draw_span with the color already expanded */
+static inline __attribute__((always_inline)) void span(int x0, int x1, int y,
+                                                       struct DRAW_COLOR c) {
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  y += vga_viewport.origin_y;
+  if (y < clip->y0 || y >= clip->y1) return;
+  x0 += vga_viewport.origin_x;
+  x1 += vga_viewport.origin_x;
+  if (x0 < clip->x0) x0 = clip->x0;
+  if (x1 > clip->x1) x1 = clip->x1;
+  if (x0 >= x1) return;
+  draw_fill_span(line_words(y), x0, x1, c);
+}
+
+void __not_in_flash_func(draw_span)(int x0, int x1, int y, int color) {
+  span(x0, x1, y, draw_color(color));
+}
+
+void __not_in_flash_func(draw_fill_rect)(int x0, int y0, int x1, int y1,
+                                         int color) {
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  x0 += vga_viewport.origin_x;
+  x1 += vga_viewport.origin_x;
+  y0 += vga_viewport.origin_y;
+  y1 += vga_viewport.origin_y;
+  if (x0 < clip->x0) x0 = clip->x0;
+  if (x1 > clip->x1) x1 = clip->x1;
+  if (y0 < clip->y0) y0 = clip->y0;
+  if (y1 > clip->y1) y1 = clip->y1;
+  if (x0 >= x1 || y0 >= y1) return;
+  const struct DRAW_COLOR c = draw_color(color);
+  const int stride = (vga_screen.width / VGA_BLOCK_PIXELS) * 2;
+  uint32_t *line = line_words(y0);
+  for (int y = y0; y < y1; y++, line += stride)
+    draw_fill_span(line, x0, x1, c);
+}
+
+void __not_in_flash_func(draw_rect)(int x0, int y0, int x1, int y1,
+                                    int color) {
+  if (x0 >= x1 || y0 >= y1) return;
+  draw_fill_rect(x0, y0, x1, y0 + 1, color);
+  if (y1 - y0 > 1) draw_fill_rect(x0, y1 - 1, x1, y1, color);
+  draw_fill_rect(x0, y0 + 1, x0 + 1, y1 - 1, color);
+  if (x1 - x0 > 1) draw_fill_rect(x1 - 1, y0 + 1, x1, y1 - 1, color);
+}
+
+/* Merge one pixel, `bit` of the block at `block`, into the four planes */
+static inline __attribute__((always_inline)) void plot(uint32_t *block,
+                                                       uint32_t bit,
+                                                       struct DRAW_COLOR c) {
+  const uint32_t m = bit | (bit << 16);
+  block[0] = (block[0] & ~m) | (c.lo & m);
+  block[1] = (block[1] & ~m) | (c.hi & m);
+}
+
+static inline int ceil_div64(int64_t n, int64_t d) {
+  return (int)((n + d - 1) / d);
+}
+
+/* Step i of a line `major` steps long moves floor((2 i minor + major) /
+ * (2 major)) steps along the minor axis. Narrow [*first, *last] to the steps
+ * whose major offset is in [major_lo, major_hi] and minor offset in
+ * [minor_lo, minor_hi]; false when none is. */
+static bool line_steps(int major, int minor, int major_lo, int major_hi,
+                       int minor_lo, int minor_hi, int *first, int *last) {
+  int i0 = major_lo > 0 ? major_lo : 0;
+  int i1 = major_hi < major ? major_hi : major;
+  if (minor_lo > minor_hi || minor_hi < 0) return false;
+  if (minor == 0) {
+    if (minor_lo > 0) return false;
+  } else {
+    const int64_t step = 2 * (int64_t)minor;
+    if (minor_lo > 0) {
+      const int i = ceil_div64(2 * (int64_t)major * minor_lo - major, step);
+      if (i > i0) i0 = i;
+    }
+    const int i =
+        ceil_div64(2 * (int64_t)major * (minor_hi + 1) - major, step) - 1;
+    if (i < i1) i1 = i;
+  }
+  *first = i0;
+  *last = i1;
+  return i0 <= i1;
+}
+
+void __not_in_flash_func(draw_line)(int x0, int y0, int x1, int y1,
+                                    int color) {
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  x0 += vga_viewport.origin_x;
+  x1 += vga_viewport.origin_x;
+  y0 += vga_viewport.origin_y;
+  y1 += vga_viewport.origin_y;
+  const int dx = x1 - x0, dy = y1 - y0;
+  const int adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+  const struct DRAW_COLOR c = draw_color(color);
+  const int stride = (vga_screen.width / VGA_BLOCK_PIXELS) * 2;
+  int first, last;
+
+  if (adx == 0 && ady == 0) {
+    if (x0 >= clip->x0 && x0 < clip->x1 && y0 >= clip->y0 && y0 < clip->y1)
+      plot(line_words(y0) + (x0 / VGA_BLOCK_PIXELS) * 2,
+           0x8000u >> (x0 & (VGA_BLOCK_PIXELS - 1)), c);
+  } else if (adx >= ady) {
+    /* X-major, drawn left to right */
+    if (dx < 0) {
+      x0 = x1;
+      y0 = y1;
+    }
+    const int sy = (dx < 0 ? -dy : dy) < 0 ? -1 : 1;
+    const int minor_lo = sy > 0 ? clip->y0 - y0 : y0 - (clip->y1 - 1);
+    const int minor_hi = sy > 0 ? clip->y1 - 1 - y0 : y0 - clip->y0;
+    if (!line_steps(adx, ady, clip->x0 - x0, clip->x1 - 1 - x0, minor_lo,
+                    minor_hi, &first, &last))
+      return;
+    const int64_t num = 2 * (int64_t)first * ady + adx;
+    const int x = x0 + first;
+    const int y = y0 + sy * (int)(num / (2 * adx));
+    int err = (int)(num % (2 * adx));
+    uint32_t *block = line_words(y) + (x / VGA_BLOCK_PIXELS) * 2;
+    uint32_t bit = 0x8000u >> (x & (VGA_BLOCK_PIXELS - 1));
+    const int row_step = sy * stride;
+    for (int i = first; i <= last; i++) {
+      plot(block, bit, c);
+      err += 2 * ady;
+      if (err >= 2 * adx) {
+        err -= 2 * adx;
+        block += row_step;
+      }
+      bit >>= 1;
+      if (bit == 0) {
+        bit = 0x8000u;
+        block += 2;
+      }
+    }
+  } else {
+    /* Y-major, drawn top to bottom */
+    if (dy < 0) {
+      x0 = x1;
+      y0 = y1;
+    }
+    const int sx = (dy < 0 ? -dx : dx) < 0 ? -1 : 1;
+    const int minor_lo = sx > 0 ? clip->x0 - x0 : x0 - (clip->x1 - 1);
+    const int minor_hi = sx > 0 ? clip->x1 - 1 - x0 : x0 - clip->x0;
+    if (!line_steps(ady, adx, clip->y0 - y0, clip->y1 - 1 - y0, minor_lo,
+                    minor_hi, &first, &last))
+      return;
+    const int64_t num = 2 * (int64_t)first * adx + ady;
+    const int x = x0 + sx * (int)(num / (2 * ady));
+    const int y = y0 + first;
+    int err = (int)(num % (2 * ady));
+    uint32_t *block = line_words(y) + (x / VGA_BLOCK_PIXELS) * 2;
+    uint32_t bit = 0x8000u >> (x & (VGA_BLOCK_PIXELS - 1));
+    for (int i = first; i <= last; i++) {
+      plot(block, bit, c);
+      block += stride;
+      err += 2 * adx;
+      if (err >= 2 * ady) {
+        err -= 2 * ady;
+        if (sx > 0) {
+          bit >>= 1;
+          if (bit == 0) {
+            bit = 0x8000u;
+            block += 2;
+          }
+        } else {
+          bit <<= 1;
+          if (bit > 0x8000u) {
+            bit = 1;
+            block -= 2;
+          }
+        }
+      }
+    }
+  }
+}
+
+void __not_in_flash_func(draw_fill_circle)(int cx, int cy, int r, int color) {
+  if (r < 0) return;
+  const struct DRAW_COLOR c = draw_color(color);
+  const int r2 = r * r + r;
+  int w = r;
+  for (int dy = 0; dy <= r; dy++) {
+    while (w * w + dy * dy > r2) w--;
+    span(cx - w, cx + w + 1, cy + dy, c);
+    if (dy) span(cx - w, cx + w + 1, cy - dy, c);
+  }
+}
+
+/* Coordinate `axis` of a vertex: 0 for x, 1 for y */
+static inline int32_t vertex_coord(const struct DRAW_VERTEX *v, int axis) {
+  return axis ? v->y : v->x;
+}
+
+/* One Sutherland-Hodgman pass: keep the part of the polygon where
+ * sign * (coordinate `axis` - bound) >= 0. Returns the vertices in `out`. */
+static int clip_polygon(const struct DRAW_VERTEX *in, int count,
+                        struct DRAW_VERTEX *out, int axis, int32_t bound,
+                        int sign) {
+  if (count == 0) return 0;
+  int n = 0;
+  const struct DRAW_VERTEX *a = &in[count - 1];
+  int32_t da = sign * (vertex_coord(a, axis) - bound);
+  for (int i = 0; i < count; i++) {
+    const struct DRAW_VERTEX *b = &in[i];
+    const int32_t db = sign * (vertex_coord(b, axis) - bound);
+    if ((da >= 0) != (db >= 0)) {
+      /* Interpolated from the inside end, so that polygons sharing the edge
+       * get the same vertex */
+      const struct DRAW_VERTEX *p = da >= 0 ? a : b, *q = da >= 0 ? b : a;
+      const int32_t dp = da >= 0 ? da : db, dq = da >= 0 ? db : da;
+      const int32_t p_other = vertex_coord(p, !axis);
+      const int32_t other =
+          p_other + (int32_t)((int64_t)(vertex_coord(q, !axis) - p_other) *
+                              dp / (dp - dq));
+      out[n].x = axis ? other : bound;
+      out[n].y = axis ? bound : other;
+      n++;
+    }
+    if (db >= 0) out[n++] = *b;
+    a = b;
+    da = db;
+  }
+  return n;
+}
+
+/* First pixel row or column whose centre is at or past a 1/16 coordinate */
+static inline int subpixel_ceil(int32_t v) {
+  return (v + (1 << (DRAW_SUBPIXEL_BITS - 1)) - 1) >> DRAW_SUBPIXEL_BITS;
+}
+
+/* One chain of polygon edges, walked from the top vertex to the bottom */
+struct POLY_EDGE {
+  int32_t x;    /* 16.16, at the centre of the current row */
+  int32_t step; /* per row */
+  int y_end;    /* first row past the edge */
+  int vertex;   /* lower end of the edge */
+};
+
+/* Move the chain in direction `dir` to its edge covering row y, with x at
+ * that row. False when the chain reaches the bottom vertex first. The
+ * polygon is clipped, so x * 65536 fits in 32 bits. */
+static inline __attribute__((always_inline)) bool edge_advance(
+    struct POLY_EDGE *e, const struct DRAW_VERTEX *v, int count, int dir,
+    int bottom, int y) {
+  while (e->vertex != bottom) {
+    const struct DRAW_VERTEX *a = &v[e->vertex];
+    e->vertex += dir;
+    if (e->vertex < 0) e->vertex += count;
+    if (e->vertex >= count) e->vertex -= count;
+    const struct DRAW_VERTEX *b = &v[e->vertex];
+    e->y_end = subpixel_ceil(b->y);
+    if (e->y_end <= y) continue;
+    const int32_t dx = b->x - a->x, dy = b->y - a->y;
+    const int32_t offset = (y << DRAW_SUBPIXEL_BITS) +
+                           (1 << (DRAW_SUBPIXEL_BITS - 1)) - a->y;
+    e->step = dx * 65536 / dy;
+    e->x = a->x * (65536 >> DRAW_SUBPIXEL_BITS) +
+           dx * offset * (65536 >> DRAW_SUBPIXEL_BITS) / dy;
+    return true;
+  }
+  return false;
+}
+
+/* Fill a polygon inside the clip rectangle, screen coordinates */
+static void __not_in_flash_func(fill_convex)(const struct DRAW_VERTEX *v,
+                                             int count,
+                                             struct DRAW_COLOR c) {
+  int top = 0, bottom = 0;
+  for (int i = 1; i < count; i++) {
+    if (v[i].y < v[top].y) top = i;
+    if (v[i].y > v[bottom].y) bottom = i;
+  }
+  int y = subpixel_ceil(v[top].y);
+  const int y_end = subpixel_ceil(v[bottom].y);
+  if (y >= y_end) return;
+  struct POLY_EDGE left = {0, 0, 0, top}, right = {0, 0, 0, top};
+  if (!edge_advance(&left, v, count, 1, bottom, y) ||
+      !edge_advance(&right, v, count, -1, bottom, y))
+    return;
+
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  const int stride = (vga_screen.width / VGA_BLOCK_PIXELS) * 2;
+  uint32_t *line = line_words(y);
+  for (; y < y_end; y++, line += stride) {
+    if (y >= left.y_end && !edge_advance(&left, v, count, 1, bottom, y))
+      break;
+    if (y >= right.y_end && !edge_advance(&right, v, count, -1, bottom, y))
+      break;
+    int32_t xa = left.x, xb = right.x;
+    if (xa > xb) {
+      xa = right.x;
+      xb = left.x;
+    }
+    /* Pixels whose centre is in [xa, xb) */
+    int x0 = (xa + 0x7FFF) >> 16, x1 = (xb + 0x7FFF) >> 16;
+    if (x0 < clip->x0) x0 = clip->x0;
+    if (x1 > clip->x1) x1 = clip->x1;
+    if (x0 < x1) draw_fill_span(line, x0, x1, c);
+    left.x += left.step;
+    right.x += right.step;
+  }
+}
+
+void __not_in_flash_func(draw_fill_polygon)(const struct DRAW_VERTEX *v,
+                                            int count, int color) {
+  if (count < 3 || count > DRAW_MAX_POLYGON_VERTICES) return;
+  const struct VGA_RECT *clip = &vga_viewport.clip;
+  const int32_t ox = vga_viewport.origin_x * (1 << DRAW_SUBPIXEL_BITS);
+  const int32_t oy = vga_viewport.origin_y * (1 << DRAW_SUBPIXEL_BITS);
+  const int32_t x0 = clip->x0 * (1 << DRAW_SUBPIXEL_BITS);
+  const int32_t y0 = clip->y0 * (1 << DRAW_SUBPIXEL_BITS);
+  const int32_t x1 = clip->x1 * (1 << DRAW_SUBPIXEL_BITS);
+  const int32_t y1 = clip->y1 * (1 << DRAW_SUBPIXEL_BITS);
+  /* Each clipping pass adds one vertex at most */
+  struct DRAW_VERTEX poly[2][DRAW_MAX_POLYGON_VERTICES + 4];
+  bool inside = true;
+  for (int i = 0; i < count; i++) {
+    poly[0][i].x = v[i].x + ox;
+    poly[0][i].y = v[i].y + oy;
+    inside = inside && poly[0][i].x >= x0 && poly[0][i].x <= x1 &&
+             poly[0][i].y >= y0 && poly[0][i].y <= y1;
+  }
+  if (!inside) {
+    count = clip_polygon(poly[0], count, poly[1], 0, x0, 1);
+    count = clip_polygon(poly[1], count, poly[0], 0, x1, -1);
+    count = clip_polygon(poly[0], count, poly[1], 1, y0, 1);
+    count = clip_polygon(poly[1], count, poly[0], 1, y1, -1);
+    if (count < 3) return;
+  }
+  fill_convex(poly[0], count, draw_color(color));
+}
@@ -0,0 +1,494 @@
+#include <stdlib.h>
+
+#include "vga/draw.h"
+
+/* Number of 16-bit words needed by one planar sprite frame */
+static inline size_t planar_frame_words(const struct SPRITE *spr) {
+  unsigned int blocks =
+      (unsigned int)(spr->width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS;
+  return (size_t)spr->height * blocks * VGA_PLANAR_BLOCK_WORDS;
+}
+
+/* Convert one sprite frame into the pre-masked planar layout */
+static void planar_convert(const struct SPRITE *src, struct PLANAR_SPRITE *dst,
+                           uint16_t *out) {
+  dst->width = src->width;
+  dst->height = src->height;
+  dst->blocks =
+      (unsigned int)(src->width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS;
+  dst->data = out;
+
+  for (int y = 0; y < src->height; y++) {
+    for (unsigned int b = 0; b < dst->blocks; b++) {
+      uint16_t mask = 0;
+      uint16_t planes[VGA_NUM_BITPLANES] = {0};
+      for (int p = 0; p < VGA_BLOCK_PIXELS; p++) {
+        int sx = (int)b * VGA_BLOCK_PIXELS + p;
+        if (sx >= src->width) break;
+        int idx = sprite_pixel_index(src, sx, y);
+        if (idx < 0) continue;
+        uint16_t bit = (uint16_t)(0x8000u >> p);
+        mask |= bit;
+        for (int plane = 0; plane < VGA_NUM_BITPLANES; plane++) {
+          if (idx & (1u << plane)) planes[plane] |= bit;
+        }
+      }
+      *out++ = mask;
+      for (int plane = 0; plane < VGA_NUM_BITPLANES; plane++) {
+        *out++ = planes[plane];
+      }
+    }
+  }
+}
+
+/* Blocks per row of the copy shifted right by `shift` pixels */
+static inline unsigned int preshift_blocks(const struct PLANAR_SPRITE *spr,
+                                           unsigned int shift) {
+  return (unsigned int)(spr->width + (int)shift + VGA_BLOCK_PIXELS - 1) /
+         VGA_BLOCK_PIXELS;
+}
+
+/* Bytes taken by the cache of one frame, descriptor included */
+static unsigned int preshift_frame_bytes(const struct PLANAR_SPRITE *spr) {
+  unsigned int words = 0;
+  for (unsigned int shift = 0; shift < VGA_BLOCK_PIXELS; shift++) {
+    words += preshift_blocks(spr, shift) * (unsigned int)spr->height *
+             VGA_PLANAR_BLOCK_WORDS;
+  }
+  return sizeof(struct PLANAR_PRESHIFT) + words * sizeof(uint16_t);
+}
+
+/* Write the copy of `spr` shifted right by `shift` pixels; returns the end */
+static uint16_t *preshift_convert(const struct PLANAR_SPRITE *spr,
+                                  unsigned int shift, uint16_t *out) {
+  const unsigned int out_blocks = preshift_blocks(spr, shift);
+  for (int y = 0; y < spr->height; y++) {
+    const uint16_t *row =
+        spr->data + (size_t)spr->blocks * VGA_PLANAR_BLOCK_WORDS * y;
+    for (unsigned int b = 0; b < out_blocks; b++) {
+      for (int w = 0; w < VGA_PLANAR_BLOCK_WORDS; w++) {
+        uint32_t prev = b > 0 ? row[(b - 1) * VGA_PLANAR_BLOCK_WORDS + w] : 0;
+        uint32_t cur =
+            b < spr->blocks ? row[b * VGA_PLANAR_BLOCK_WORDS + w] : 0;
+        *out++ = (uint16_t)(((prev << 16) | cur) >> shift);
+      }
+    }
+  }
+  return out;
+}
+
+int sprite_planar_build(struct SPRITE *sprites, struct PLANAR_SPRITE *planar,
+                        int count) {
+  size_t total_words = 0;
+  for (int i = 0; i < count; i++) {
+    total_words += planar_frame_words(&sprites[i]);
+  }
+  /* One allocation for the whole set; it lives as long as the sprites do */
+  uint16_t *buffer = malloc(total_words * sizeof(uint16_t));
+  if (buffer == NULL) {
+    DPRINTF("Failed to allocate %u bytes for planar sprites\n",
+            (unsigned int)(total_words * sizeof(uint16_t)));
+    return VGA_ERROR_ALLOC;
+  }
+  uint16_t *out = buffer;
+  for (int i = 0; i < count; i++) {
+    planar_convert(&sprites[i], &planar[i], out);
+    out += planar_frame_words(&sprites[i]);
+    sprites[i].planar = &planar[i];
+  }
+  DPRINTF("Planar sprites built: %d frames, %u bytes\n", count,
+          (unsigned int)(total_words * sizeof(uint16_t)));
+  return 0;
+}
+
+int sprite_preshift_build(struct PLANAR_SPRITE *planar, int count,
+                          const struct PLANAR_PRESHIFT_CONFIG *config) {
+  unsigned int used = 0;
+  int built = 0;
+  for (int i = 0; i < count && i < 64; i++) {
+    if (!(config->frame_mask & (1ull << i))) continue;
+    unsigned int bytes = preshift_frame_bytes(&planar[i]);
+    if (used + bytes > config->budget_bytes) {
+      DPRINTF("Pre-shift budget exceeded, frame %d not cached\n", i);
+      continue;
+    }
+    struct PLANAR_PRESHIFT *cache = malloc(bytes);
+    if (cache == NULL) {
+      DPRINTF("Failed to allocate %u bytes for pre-shifted frame %d\n", bytes,
+              i);
+      return VGA_ERROR_ALLOC;
+    }
+    uint16_t *out = (uint16_t *)(cache + 1);
+    for (unsigned int shift = 0; shift < VGA_BLOCK_PIXELS; shift++) {
+      cache->blocks[shift] = (uint8_t)preshift_blocks(&planar[i], shift);
+      cache->data[shift] = out;
+      out = preshift_convert(&planar[i], shift, out);
+    }
+    planar[i].preshift = cache;
+    used += bytes;
+    built++;
+  }
+  DPRINTF("Pre-shifted %d frames, %u bytes\n", built, used);
+  return built;
+}
+
+void sprite_preshift_report(const struct PLANAR_SPRITE *planar, int count) {
+  unsigned int planar_total = 0, cached_total = 0, all_total = 0;
+  DPRINTF("Sprite memory report (%d frames):\n", count);
+  for (int i = 0; i < count; i++) {
+    unsigned int planar_bytes = planar[i].height * planar[i].blocks *
+                                VGA_PLANAR_BLOCK_WORDS * sizeof(uint16_t);
+    unsigned int preshift_bytes = preshift_frame_bytes(&planar[i]);
+    DPRINTFRAW("  frame %2d: planar %5u bytes, pre-shift %6u bytes%s\n", i,
+               planar_bytes, preshift_bytes,
+               planar[i].preshift ? " (cached)" : "");
+    planar_total += planar_bytes;
+    all_total += preshift_bytes;
+    if (planar[i].preshift) cached_total += preshift_bytes;
+  }
+  DPRINTFRAW("  total: planar %u, pre-shift cached %u of %u bytes\n",
+             planar_total, cached_total, all_total);
+}
+
+/* Aligned blit of pre-shifted rows starting at destination block block_x,
+ * the rows of the clip */
+static void __not_in_flash_func(draw_planar_aligned)(
+    const uint16_t *data, int blocks, int block_x,
+    const struct DRAW_CLIP *c) {
+  const int row_words = blocks * VGA_PLANAR_BLOCK_WORDS;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  int block_start = block_x;
+  int block_end = block_x + blocks;
+  if (block_start < vga_viewport.block_x0) block_start = vga_viewport.block_x0;
+  if (block_end > vga_viewport.block_x1) block_end = vga_viewport.block_x1;
+  if (block_start >= block_end) return;
+
+  data += c->row_start * row_words +
+          (block_start - block_x) * VGA_PLANAR_BLOCK_WORDS;
+  uint16_t *line =
+      (uint16_t *)vga_screen.hidden_framebuffer +
+      ((c->y + c->row_start) * line_blocks + block_start) * VGA_NUM_BITPLANES;
+  const int count = block_end - block_start;
+  for (int y = c->row_start; y < c->row_end; y++) {
+#if VGA_ASM_BLITTERS
+    blit_asm_planar_row(line, data, count);
+#else
+    const uint16_t *src = data;
+    uint16_t *dst = line;
+    for (int b = 0; b < count; b++) {
+      uint16_t mask = src[0];
+      if (mask) {
+        dst[0] = (uint16_t)((dst[0] & ~mask) | src[1]);
+        dst[1] = (uint16_t)((dst[1] & ~mask) | src[2]);
+        dst[2] = (uint16_t)((dst[2] & ~mask) | src[3]);
+        dst[3] = (uint16_t)((dst[3] & ~mask) | src[4]);
+      }
+      src += VGA_PLANAR_BLOCK_WORDS;
+      dst += VGA_NUM_BITPLANES;
+    }
+#endif
+    data += row_words;
+    line += line_blocks * VGA_NUM_BITPLANES;
+  }
+}
+
+/* Byte bit-reversal table for the mirrored blits (the M0+ has no RBIT) */
+#define BIT_REVERSE2(n) n, n + 2 * 64, n + 1 * 64, n + 3 * 64
+#define BIT_REVERSE4(n)                                           \
+  BIT_REVERSE2(n), BIT_REVERSE2(n + 2 * 16), BIT_REVERSE2(n + 1 * 16), \
+      BIT_REVERSE2(n + 3 * 16)
+#define BIT_REVERSE6(n)                                       \
+  BIT_REVERSE4(n), BIT_REVERSE4(n + 2 * 4), BIT_REVERSE4(n + 1 * 4), \
+      BIT_REVERSE4(n + 3 * 4)
+const uint8_t bit_reverse8[256] __not_in_flash("bit_reverse8") = {
+    BIT_REVERSE6(0), BIT_REVERSE6(2), BIT_REVERSE6(1), BIT_REVERSE6(3)};
+
+/* Source word `w` of a planar block, bit-reversed when mirroring */
+static inline __attribute__((always_inline)) uint32_t planar_word(
+    const uint16_t *block, int w, const bool flip) {
+  return flip ? bit_reverse16(block[w]) : block[w];
+}
+
+/* Masked planar blit: each source block is shifted into (at most) two
+ * destination blocks through a 32-bit window per word, so any x position is
+ * handled with one AND-NOT/OR per plane and destination block. Clipping is
+ * done in whole blocks, which is exact because the viewport columns are
+ * whole blocks.
+ *
+ * Mirrored, the row is read from its last block backwards with every word
+ * bit-reversed. That is the row of a sprite `blocks` * 16 pixels wide, so it
+ * is drawn further left by the right padding of the last block.
+ */
+static inline __attribute__((always_inline)) void draw_planar_shifted(
+    const struct PLANAR_SPRITE *spr, const struct DRAW_CLIP *c,
+    const bool flip) {
+  const unsigned int row_words = spr->blocks * VGA_PLANAR_BLOCK_WORDS;
+  const uint16_t *image_start = spr->data + row_words * c->row_start;
+  const int height = c->row_end - c->row_start;
+
+  int spr_x = c->x;
+  if (flip) spr_x -= (int)spr->blocks * VGA_BLOCK_PIXELS - spr->width;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const unsigned shift = (unsigned)spr_x & (VGA_BLOCK_PIXELS - 1);
+  const int first_block = spr_x >> 4; /* floor, also for negative x */
+  /* A shifted sprite spills into one extra destination block */
+  int last_block = first_block + (int)spr->blocks - (shift == 0 ? 1 : 0);
+  int block_start = first_block;
+  if (block_start < vga_viewport.block_x0) block_start = vga_viewport.block_x0;
+  if (last_block >= vga_viewport.block_x1)
+    last_block = vga_viewport.block_x1 - 1;
+  if (block_start > last_block) return;
+  const int src_start = block_start - first_block;
+  const int step = flip ? -VGA_PLANAR_BLOCK_WORDS : VGA_PLANAR_BLOCK_WORDS;
+  const int src_block = flip ? (int)spr->blocks - 1 - src_start : src_start;
+
+  uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                   (c->y + c->row_start) * line_blocks * VGA_NUM_BITPLANES;
+  for (int y = 0; y < height; y++) {
+    const uint16_t *src = image_start + (size_t)row_words * y +
+                          src_block * VGA_PLANAR_BLOCK_WORDS;
+    uint16_t *dst = line + block_start * VGA_NUM_BITPLANES;
+    /* 32-bit windows: previous source word in the high half */
+    uint32_t wm = 0, w0 = 0, w1 = 0, w2 = 0, w3 = 0;
+    if (src_start > 0) {
+      const uint16_t *prev = src - step;
+      wm = planar_word(prev, 0, flip);
+      w0 = planar_word(prev, 1, flip);
+      w1 = planar_word(prev, 2, flip);
+      w2 = planar_word(prev, 3, flip);
+      w3 = planar_word(prev, 4, flip);
+    }
+    for (int sb = src_start; sb <= src_start + (last_block - block_start);
+         sb++) {
+      if (sb < (int)spr->blocks) {
+        wm = (wm << 16) | planar_word(src, 0, flip);
+        w0 = (w0 << 16) | planar_word(src, 1, flip);
+        w1 = (w1 << 16) | planar_word(src, 2, flip);
+        w2 = (w2 << 16) | planar_word(src, 3, flip);
+        w3 = (w3 << 16) | planar_word(src, 4, flip);
+        src += step;
+      } else {
+        wm <<= 16;
+        w0 <<= 16;
+        w1 <<= 16;
+        w2 <<= 16;
+        w3 <<= 16;
+      }
+      uint16_t mask = (uint16_t)(wm >> shift);
+      if (mask) {
+        dst[0] = (uint16_t)((dst[0] & ~mask) | (uint16_t)(w0 >> shift));
+        dst[1] = (uint16_t)((dst[1] & ~mask) | (uint16_t)(w1 >> shift));
+        dst[2] = (uint16_t)((dst[2] & ~mask) | (uint16_t)(w2 >> shift));
+        dst[3] = (uint16_t)((dst[3] & ~mask) | (uint16_t)(w3 >> shift));
+      }
+      dst += VGA_NUM_BITPLANES;
+    }
+    line += line_blocks * VGA_NUM_BITPLANES;
+  }
+}
+
+void __not_in_flash_func(draw_sprite_planar)(const struct PLANAR_SPRITE *spr,
+                                             int spr_x, int spr_y,
+                                             bool flip_x) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, spr->width, spr->height, &c)) return;
+  const unsigned shift = (unsigned)c.x & (VGA_BLOCK_PIXELS - 1);
+  if (flip_x) {
+    /* The pre-shifted copies are not mirrored */
+    draw_planar_shifted(spr, &c, true);
+  } else if (spr->preshift) {
+    draw_planar_aligned(spr->preshift->data[shift],
+                        spr->preshift->blocks[shift], c.x >> 4, &c);
+  } else if (shift == 0) {
+    /* Block-aligned: the frame itself is the shift 0 copy */
+    draw_planar_aligned(spr->data, spr->blocks, c.x >> 4, &c);
+  } else {
+    draw_planar_shifted(spr, &c, false);
+  }
+}
+
+/* Tight bounding box of the opaque pixels of a frame */
+static void span_bbox(const struct SPRITE *src, struct SPAN_SPRITE *spr) {
+  int min_x = src->width, max_x = -1, min_y = src->height, max_y = -1;
+  for (int y = 0; y < src->height; y++) {
+    for (int x = 0; x < src->width; x++) {
+      if (sprite_pixel_index(src, x, y) < 0) continue;
+      if (x < min_x) min_x = x;
+      if (x > max_x) max_x = x;
+      if (y < min_y) min_y = y;
+      max_y = y;
+    }
+  }
+  spr->width = src->width;
+  spr->height = src->height;
+  if (max_x < 0) {
+    spr->bbox_x = spr->bbox_y = spr->bbox_w = spr->bbox_h = 0;
+    return;
+  }
+  spr->bbox_x = (uint8_t)min_x;
+  spr->bbox_y = (uint8_t)min_y;
+  spr->bbox_w = (uint8_t)(max_x - min_x + 1);
+  spr->bbox_h = (uint8_t)(max_y - min_y + 1);
+}
+
+/* Walk the opaque runs inside the bounding box and count them. The row
+ * index, spans and pixels are also written when the pointers are set. */
+static void span_scan(const struct SPRITE *src, const struct SPAN_SPRITE *spr,
+                      uint16_t *row_spans, struct SPRITE_SPAN *spans,
+                      uint8_t *pixels, unsigned int *span_count,
+                      unsigned int *pixel_count) {
+  const int x_end = spr->bbox_x + spr->bbox_w;
+  unsigned int nspans = 0, npixels = 0;
+  for (int r = 0; r < spr->bbox_h; r++) {
+    const int y = spr->bbox_y + r;
+    if (row_spans) row_spans[r] = (uint16_t)nspans;
+    int x = spr->bbox_x;
+    while (x < x_end) {
+      if (sprite_pixel_index(src, x, y) < 0) {
+        x++;
+        continue;
+      }
+      int start = x;
+      int idx;
+      while (x < x_end && (idx = sprite_pixel_index(src, x, y)) >= 0 &&
+             x - start < UINT8_MAX) {
+        if (pixels) pixels[npixels] = (uint8_t)idx;
+        npixels++;
+        x++;
+      }
+      if (spans) {
+        spans[nspans].x = (uint8_t)start;
+        spans[nspans].length = (uint8_t)(x - start);
+        spans[nspans].offset = (uint16_t)(npixels - (unsigned int)(x - start));
+      }
+      nspans++;
+    }
+  }
+  if (row_spans) row_spans[spr->bbox_h] = (uint16_t)nspans;
+  *span_count = nspans;
+  *pixel_count = npixels;
+}
+
+/* Bytes for the row index of a span frame, padded for the span array */
+static inline size_t span_index_bytes(const struct SPAN_SPRITE *spr) {
+  return ((spr->bbox_h + 1u) * sizeof(uint16_t) + 3u) & ~(size_t)3u;
+}
+
+int sprite_span_build(struct SPRITE *sprites, struct SPAN_SPRITE *spans,
+                      int count) {
+  size_t total = 0;
+  for (int i = 0; i < count; i++) {
+    unsigned int span_count, pixel_count;
+    span_bbox(&sprites[i], &spans[i]);
+    span_scan(&sprites[i], &spans[i], NULL, NULL, NULL, &span_count,
+              &pixel_count);
+    total += span_index_bytes(&spans[i]) +
+             span_count * sizeof(struct SPRITE_SPAN) +
+             ((pixel_count + 3u) & ~3u);
+  }
+  /* One allocation for the whole set, owned by the first row index */
+  uint8_t *buffer = malloc(total);
+  if (buffer == NULL) {
+    DPRINTF("Failed to allocate %u bytes for span sprites\n",
+            (unsigned int)total);
+    return VGA_ERROR_ALLOC;
+  }
+  uint8_t *out = buffer;
+  for (int i = 0; i < count; i++) {
+    unsigned int span_count, pixel_count;
+    span_scan(&sprites[i], &spans[i], NULL, NULL, NULL, &span_count,
+              &pixel_count);
+    uint16_t *row_spans = (uint16_t *)out;
+    out += span_index_bytes(&spans[i]);
+    struct SPRITE_SPAN *span_data = (struct SPRITE_SPAN *)out;
+    out += span_count * sizeof(struct SPRITE_SPAN);
+    uint8_t *pixels = out;
+    out += (pixel_count + 3u) & ~3u;
+    span_scan(&sprites[i], &spans[i], row_spans, span_data, pixels,
+              &span_count, &pixel_count);
+    spans[i].row_spans = row_spans;
+    spans[i].spans = span_data;
+    spans[i].pixels = pixels;
+    sprites[i].spans = &spans[i];
+  }
+  DPRINTF("Span sprites built: %d frames, %u bytes\n", count,
+          (unsigned int)total);
+  return 0;
+}
+
+void sprite_span_free(struct SPAN_SPRITE *spans) {
+  free((void *)spans[0].row_spans);
+}
+
+/* Span blit: only rows of the bounding box and opaque runs are visited.
+ * Each run is merged block by block with a contiguous coverage mask. The
+ * clip is that of the bounding box: when it is inside the viewport, the runs
+ * are not clipped. */
+static inline __attribute__((always_inline)) void draw_spans(
+    const struct SPAN_SPRITE *spr, int spr_x, int spr_y, bool flip_x,
+    const uint8_t *remap) {
+  const int left = flip_x ? spr->width - spr->bbox_x - spr->bbox_w
+                          : spr->bbox_x;
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x + left, spr_y + spr->bbox_y, spr->bbox_w,
+                     spr->bbox_h, &c))
+    return;
+  spr_x = c.x - left;
+  const int clip_x0 = vga_viewport.clip.x0, clip_x1 = vga_viewport.clip.x1;
+
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  /* Mirrored, a run starts at its mirrored end and is read backwards */
+  const int step = flip_x ? -1 : 1;
+  for (int r = c.row_start; r < c.row_end; r++) {
+    uint16_t *line = (uint16_t *)vga_screen.hidden_framebuffer +
+                     (c.y + r) * line_blocks * VGA_NUM_BITPLANES;
+    for (unsigned int s = spr->row_spans[r]; s < spr->row_spans[r + 1]; s++) {
+      const struct SPRITE_SPAN *span = &spr->spans[s];
+      const uint8_t *pix = spr->pixels + span->offset;
+      int x0 = spr_x + span->x;
+      if (flip_x) {
+        pix += span->length - 1;
+        x0 = spr_x + spr->width - span->x - span->length;
+      }
+      int x1 = x0 + span->length;
+      if (!c.inside) {
+        if (x0 < clip_x0) {
+          pix += (clip_x0 - x0) * step;
+          x0 = clip_x0;
+        }
+        if (x1 > clip_x1) x1 = clip_x1;
+      }
+      while (x0 < x1) {
+        int block_x = x0 & ~(VGA_BLOCK_PIXELS - 1);
+        int end = block_x + VGA_BLOCK_PIXELS < x1 ? block_x + VGA_BLOCK_PIXELS
+                                                  : x1;
+        uint32_t covered = (0xFFFFu >> (x0 - block_x)) &
+                           ~(0xFFFFu >> (end - block_x));
+        uint64_t set = 0;
+        for (int x = x0; x < end; x++) {
+          uint32_t idx = remap ? remap[*pix] : *pix;
+          set |= pixel_masks_flat[(idx << 4) | (x & (VGA_BLOCK_PIXELS - 1))];
+          pix += step;
+        }
+        draw_merge_block(line + (block_x >> 4) * VGA_NUM_BITPLANES, covered,
+                         set);
+        x0 = end;
+      }
+    }
+  }
+}
+
+void __not_in_flash_func(draw_sprite_spans)(
+    const struct SPAN_SPRITE *spr, int spr_x, int spr_y, bool flip_x,
+    const struct PALETTE_REMAP *remap) {
+  /* Separate instance so plain draws keep a bare index load per pixel */
+  if (remap)
+    draw_spans(spr, spr_x, spr_y, flip_x, remap->index);
+  else
+    draw_spans(spr, spr_x, spr_y, flip_x, NULL);
+}
+
+void sprite_remap_build(struct PALETTE_REMAP *remap, const uint8_t map[16]) {
+  for (int i = 0; i < 16; i++) remap->index[i] = map[i] & 0xF;
+  for (int i = 0; i < 64; i++) remap->rgb2index[i] = remap->index[rgb2index[i]];
+}
@@ -0,0 +1,119 @@
+#include "vga/surface.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* The screen, while a surface is bound */
+static struct {
+  struct VGA_SURFACE *surface;
+  unsigned int *framebuffer;
+  uint16_t width;
+  uint16_t height;
+  struct VGA_VIEWPORT viewport;
+} bound;
+
+static inline size_t surface_words(const struct VGA_SURFACE *surface) {
+  return (size_t)surface->height * surface->planar.blocks *
+         VGA_NUM_BITPLANES / 2;
+}
+
+/* Rebuild the pre-masked copy: a pixel is opaque unless its four plane
+ * bits spell the key index */
+static void __not_in_flash_func(surface_cache)(struct VGA_SURFACE *surface) {
+  const uint16_t *src = (const uint16_t *)surface->data;
+  uint16_t *dst = (uint16_t *)(surface->data + surface_words(surface));
+  const int key = surface->key;
+  const int count = surface->height * (int)surface->planar.blocks;
+  for (int i = 0; i < count; i++) {
+    uint16_t mask = 0xFFFFu;
+    if (key >= 0) {
+      uint16_t keyed = (uint16_t)((key & 1 ? src[0] : ~src[0]) &
+                                  (key & 2 ? src[1] : ~src[1]) &
+                                  (key & 4 ? src[2] : ~src[2]) &
+                                  (key & 8 ? src[3] : ~src[3]));
+      mask = (uint16_t)~keyed;
+    }
+    dst[0] = mask;
+    dst[1] = src[0] & mask;
+    dst[2] = src[1] & mask;
+    dst[3] = src[2] & mask;
+    dst[4] = src[3] & mask;
+    src += VGA_NUM_BITPLANES;
+    dst += VGA_PLANAR_BLOCK_WORDS;
+  }
+}
+
+int surface_init(struct VGA_SURFACE *surface, int width, int height,
+                 int key) {
+  const int blocks = (width + VGA_BLOCK_PIXELS - 1) / VGA_BLOCK_PIXELS;
+  const size_t bytes = (size_t)height * blocks *
+                       (VGA_NUM_BITPLANES + VGA_PLANAR_BLOCK_WORDS) *
+                       sizeof(uint16_t);
+  uint32_t *buffer = malloc(bytes);
+  if (buffer == NULL) {
+    DPRINTF("Failed to allocate %u bytes for a %dx%d surface\n",
+            (unsigned int)bytes, width, height);
+    return VGA_ERROR_ALLOC;
+  }
+  surface->width = blocks * VGA_BLOCK_PIXELS;
+  surface->height = height;
+  surface->key = key;
+  surface->data = buffer;
+  surface->planar.width = surface->width;
+  surface->planar.height = height;
+  surface->planar.blocks = (unsigned int)blocks;
+  surface->planar.data = (const uint16_t *)(buffer + surface_words(surface));
+  surface->planar.preshift = NULL;
+  memset(&surface->sprite, 0, sizeof(surface->sprite));
+  surface->sprite.width = surface->width;
+  surface->sprite.height = height;
+  surface->sprite.planar = &surface->planar;
+  surface_clear(surface);
+  surface_cache(surface);
+  return 0;
+}
+
+void surface_free(struct VGA_SURFACE *surface) {
+  free(surface->data);
+  surface->data = NULL;
+}
+
+void surface_clear(struct VGA_SURFACE *surface) {
+  const int index = surface->key < 0 ? 0 : surface->key;
+  const uint32_t lo = (index & 1 ? 0x0000FFFFu : 0) |
+                      (index & 2 ? 0xFFFF0000u : 0);
+  const uint32_t hi = (index & 4 ? 0x0000FFFFu : 0) |
+                      (index & 8 ? 0xFFFF0000u : 0);
+  uint32_t *dst = surface->data;
+  for (size_t i = 0; i < surface_words(surface); i += 2) {
+    dst[i] = lo;
+    dst[i + 1] = hi;
+  }
+}
+
+void surface_begin(struct VGA_SURFACE *surface) {
+  if (bound.surface) surface_end();
+  bound.surface = surface;
+  bound.framebuffer = vga_screen.hidden_framebuffer;
+  bound.width = vga_screen.width;
+  bound.height = vga_screen.height;
+  bound.viewport = vga_viewport;
+  vga_screen.hidden_framebuffer = (unsigned int *)surface->data;
+  vga_screen.width = (uint16_t)surface->width;
+  vga_screen.height = (uint16_t)surface->height;
+  vga_screen.offscreen = 1;
+  const struct VGA_RECT all = {0, 0, (int16_t)surface->width,
+                               (int16_t)surface->height};
+  draw_set_viewport(&all, 0, 0);
+}
+
+void surface_end(void) {
+  if (bound.surface == NULL) return;
+  surface_cache(bound.surface);
+  vga_screen.hidden_framebuffer = bound.framebuffer;
+  vga_screen.width = bound.width;
+  vga_screen.height = bound.height;
+  vga_screen.offscreen = 0;
+  vga_viewport = bound.viewport;
+  bound.surface = NULL;
+}
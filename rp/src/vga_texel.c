@@ -0,0 +1,49 @@
+#include "vga/texel.h"
+
+#if !VGA_INTERP
+struct TEXEL_LANES texel_lanes;
+#endif
+
+/* Lane 0 puts u at bits [0, width_bits), lane 1 puts v at bits
+ * [width_bits, width_bits + height_bits): both read `shift` bits lower */
+static void texel_configure(const uint8_t *texels, int width_bits,
+                            int height_bits, int u_shift, int v_shift,
+                            bool packed) {
+#if VGA_INTERP
+  interp_config lane0 = interp_default_config();
+  interp_config_set_shift(&lane0, u_shift);
+  interp_config_set_mask(&lane0, 0, width_bits - 1);
+  interp_config lane1 = interp_default_config();
+  interp_config_set_shift(&lane1, v_shift);
+  interp_config_set_mask(&lane1, width_bits, width_bits + height_bits - 1);
+  if (packed) {
+    /* Lane 1 reads accumulator 0 too */
+    interp_config_set_cross_input(&lane1, true);
+  } else {
+    /* Popping adds the steps to the raw accumulators */
+    interp_config_set_add_raw(&lane0, true);
+    interp_config_set_add_raw(&lane1, true);
+  }
+  interp_set_config(interp0, 0, &lane0);
+  interp_set_config(interp0, 1, &lane1);
+  interp0->base[2] = (uintptr_t)texels;
+#else
+  (void)packed;
+  texel_lanes.texels = texels;
+  texel_lanes.shift[0] = (uint8_t)u_shift;
+  texel_lanes.shift[1] = (uint8_t)v_shift;
+  texel_lanes.mask[0] = (1u << width_bits) - 1;
+  texel_lanes.mask[1] = ((1u << height_bits) - 1) << width_bits;
+#endif
+}
+
+void texel_set_stepper(const uint8_t *texels, int width_bits,
+                       int height_bits) {
+  texel_configure(texels, width_bits, height_bits, TEXEL_FRACTION_BITS,
+                  TEXEL_FRACTION_BITS - width_bits, false);
+}
+
+void texel_set_packed(const uint8_t *texels, int width_bits,
+                      int height_bits) {
+  texel_configure(texels, width_bits, height_bits, 0, 8 - width_bits, true);
+}
@@ -0,0 +1,112 @@
+#include <stdlib.h>
+
+#include "vga/draw.h"
+
+/* 32-bit words per tile block: planes 0-1 and planes 2-3 */
+#define TILE_BLOCK_WORDS 2
+
+static inline size_t tile_words(const struct SPRITE *spr) {
+  return (size_t)spr->height * (spr->width / VGA_BLOCK_PIXELS) *
+         TILE_BLOCK_WORDS;
+}
+
+static inline bool tile_convertible(const struct SPRITE *spr) {
+  return spr->width > 0 && (spr->width & (VGA_BLOCK_PIXELS - 1)) == 0;
+}
+
+/* Convert one tile. Transparent pixels keep the palette index an opaque
+ * draw_tile gives them, the one the color key maps to. */
+static void tile_convert(const struct SPRITE *src, struct PLANAR_TILE *dst,
+                         uint32_t *out) {
+  dst->width = src->width;
+  dst->height = src->height;
+  dst->blocks = (unsigned int)src->width / VGA_BLOCK_PIXELS;
+  dst->data = out;
+
+  for (int y = 0; y < src->height; y++) {
+    for (unsigned int b = 0; b < dst->blocks; b++) {
+      uint32_t lo = 0, hi = 0;
+      for (int p = 0; p < VGA_BLOCK_PIXELS; p++) {
+        int idx = sprite_pixel_index(src, (int)b * VGA_BLOCK_PIXELS + p, y);
+        if (idx < 0) idx = VGA_PACKED_TRANSPARENT;
+        uint32_t bit = 0x8000u >> p;
+        if (idx & 1) lo |= bit;
+        if (idx & 2) lo |= bit << 16;
+        if (idx & 4) hi |= bit;
+        if (idx & 8) hi |= bit << 16;
+      }
+      *out++ = lo;
+      *out++ = hi;
+    }
+  }
+}
+
+int sprite_tile_build(struct SPRITE *tiles, struct PLANAR_TILE *planar,
+                      int count) {
+  size_t total_words = 0;
+  for (int i = 0; i < count; i++) {
+    if (tile_convertible(&tiles[i])) total_words += tile_words(&tiles[i]);
+  }
+  /* One allocation for the whole bank; it lives as long as the tiles do */
+  uint32_t *buffer = malloc(total_words * sizeof(uint32_t));
+  if (buffer == NULL) {
+    DPRINTF("Failed to allocate %u bytes for planar tiles\n",
+            (unsigned int)(total_words * sizeof(uint32_t)));
+    return VGA_ERROR_ALLOC;
+  }
+  uint32_t *out = buffer;
+  int built = 0;
+  for (int i = 0; i < count; i++) {
+    if (!tile_convertible(&tiles[i])) continue;
+    tile_convert(&tiles[i], &planar[i], out);
+    out += tile_words(&tiles[i]);
+    tiles[i].planar_tile = &planar[i];
+    built++;
+  }
+  DPRINTF("Planar tiles built: %d of %d tiles, %u bytes\n", built, count,
+          (unsigned int)(total_words * sizeof(uint32_t)));
+  return 0;
+}
+
+/* Word copy of whole blocks: the destination x is a multiple of 16, so each
+ * source block lands on exactly one framebuffer block. */
+void __not_in_flash_func(draw_tile_planar)(const struct PLANAR_TILE *tile,
+                                           int spr_x, int spr_y,
+                                           const struct VGA_RECT *clip) {
+  struct DRAW_CLIP c;
+  if (!draw_clip_box(spr_x, spr_y, tile->width, tile->height, &c)) return;
+  spr_y = c.y;
+  int row_start = c.row_start;
+  int row_end = c.row_end;
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  const int first_block = c.x >> 4;
+  /* The viewport columns and the tile are whole blocks */
+  int block_start = first_block + c.x_start / VGA_BLOCK_PIXELS;
+  int block_end = first_block + c.x_end / VGA_BLOCK_PIXELS;
+  if (clip) {
+    if (clip->y0 - spr_y > row_start) row_start = clip->y0 - spr_y;
+    if (clip->y1 - spr_y < row_end) row_end = clip->y1 - spr_y;
+    if (clip->x0 >> 4 > block_start) block_start = clip->x0 >> 4;
+    if ((clip->x1 + VGA_BLOCK_PIXELS - 1) >> 4 < block_end)
+      block_end = (clip->x1 + VGA_BLOCK_PIXELS - 1) >> 4;
+  }
+  if (row_start >= row_end || block_start >= block_end) return;
+
+  const int row_words = (int)tile->blocks * TILE_BLOCK_WORDS;
+  const int line_words = line_blocks * TILE_BLOCK_WORDS;
+  const int count = (block_end - block_start) * TILE_BLOCK_WORDS;
+  const uint32_t *src =
+      tile->data + row_start * row_words +
+      (block_start - first_block) * TILE_BLOCK_WORDS;
+  uint32_t *dst = (uint32_t *)vga_screen.hidden_framebuffer +
+                  (spr_y + row_start) * line_words +
+                  block_start * TILE_BLOCK_WORDS;
+  for (int y = row_start; y < row_end; y++) {
+    for (int w = 0; w < count; w += TILE_BLOCK_WORDS) {
+      dst[w] = src[w];
+      dst[w + 1] = src[w + 1];
+    }
+    src += row_words;
+    dst += line_words;
+  }
+}
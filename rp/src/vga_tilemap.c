@@ -0,0 +1,290 @@
+#include "vga/tilemap.h"
+
+#include <stdlib.h>
+
+/* 32-bit words per ring block: planes 0-1 and planes 2-3 */
+#define RING_BLOCK_WORDS 2
+
+/* Floor division and modulo, also for negative world coordinates */
+static inline int floor_div(int a, int b) {
+  return a >= 0 ? a / b : -((b - 1 - a) / b);
+}
+static inline int floor_mod(int a, int b) { return a - floor_div(a, b) * b; }
+
+/* Reverse the bits of both 16-bit halves: a mirrored pair of plane words */
+static inline uint32_t reverse_halves(uint32_t v) {
+  v = ((v >> 1) & 0x55555555u) | ((v & 0x55555555u) << 1);
+  v = ((v >> 2) & 0x33333333u) | ((v & 0x33333333u) << 2);
+  v = ((v >> 4) & 0x0F0F0F0Fu) | ((v & 0x0F0F0F0Fu) << 4);
+  return ((v >> 8) & 0x00FF00FFu) | ((v & 0x00FF00FFu) << 8);
+}
+
+int tilemap_view_init(struct TILEMAP_VIEW *view, const struct TILEMAP *map) {
+  for (int i = 0; i < map->num_tiles; i++) {
+    if (map->tiles[i].planar_tile == NULL) {
+      DPRINTF("Tilemap tile %d has no planar copy\n", i);
+      return VGA_ERROR_ALLOC;
+    }
+  }
+  if (map->num_anims > TILEMAP_MAX_ANIMS) {
+    DPRINTF("Tilemap has %d animations, %d supported\n", map->num_anims,
+            TILEMAP_MAX_ANIMS);
+    return VGA_ERROR_ALLOC;
+  }
+  view->map = map;
+  view->ring_blocks = vga_screen.width / VGA_BLOCK_PIXELS + 1;
+  view->ring_rows = vga_screen.height - VGA_STATUS_BAR_OFFSET;
+  size_t bytes = (size_t)view->ring_blocks * view->ring_rows *
+                 RING_BLOCK_WORDS * sizeof(uint32_t);
+  view->ring = malloc(bytes);
+  if (view->ring == NULL) {
+    DPRINTF("Failed to allocate %u bytes for the tilemap view\n",
+            (unsigned int)bytes);
+    return VGA_ERROR_ALLOC;
+  }
+  view->cam_x = 0;
+  view->cam_y = 0;
+  view->ring_block_x = 0;
+  view->ring_y = 0;
+  view->valid = false;
+  view->tick = 0;
+  for (int i = 0; i < TILEMAP_MAX_ANIMS; i++) view->anim_frame[i] = 0;
+  DPRINTF("Tilemap view: %dx%d cells, ring %u bytes\n", map->width,
+          map->height, (unsigned int)bytes);
+  return 0;
+}
+
+void tilemap_view_free(struct TILEMAP_VIEW *view) {
+  free(view->ring);
+  view->ring = NULL;
+  view->valid = false;
+}
+
+static inline int anim_frame(const struct TILEMAP_ANIM *anim,
+                             unsigned int tick) {
+  return (int)((tick / anim->frame_ticks) % anim->num_frames);
+}
+
+uint16_t __not_in_flash_func(tilemap_cell)(const struct TILEMAP *map,
+                                           int cell_x, int cell_y,
+                                           unsigned int tick) {
+  uint16_t cell = map->cells[floor_mod(cell_y, map->height) * map->width +
+                             floor_mod(cell_x, map->width)];
+  if (cell & TILEMAP_CELL_ANIM) {
+    const struct TILEMAP_ANIM *anim = &map->anims[cell & TILEMAP_CELL_INDEX];
+    cell = (uint16_t)(anim->frames[anim_frame(anim, tick)] ^
+                      (cell & (TILEMAP_CELL_FLIP_X | TILEMAP_CELL_FLIP_Y)));
+  }
+  return cell;
+}
+
+/* Render world block columns [bx0, bx1) and rows [y0, y1) into the ring.
+ * The area must fit in the ring. */
+static void __not_in_flash_func(tilemap_render)(struct TILEMAP_VIEW *view,
+                                                int bx0, int bx1, int y0,
+                                                int y1) {
+  const struct TILEMAP *map = view->map;
+  const int tile_w = map->tiles[0].width;
+  const int tile_h = map->tiles[0].height;
+  const int tile_blocks = tile_w / VGA_BLOCK_PIXELS;
+  const int ring_words = view->ring_blocks * RING_BLOCK_WORDS;
+
+  for (int y = y0; y < y1; y++) {
+    const int cell_y = floor_div(y, tile_h);
+    const int tile_y = y - cell_y * tile_h;
+    uint32_t *ring_row =
+        view->ring + floor_mod(y, view->ring_rows) * ring_words;
+    int ring_b = floor_mod(bx0, view->ring_blocks);
+    int bx = bx0;
+    while (bx < bx1) {
+      const int cell_x = floor_div(bx, tile_blocks);
+      const int tile_b = bx - cell_x * tile_blocks;
+      const uint16_t cell = tilemap_cell(map, cell_x, cell_y, view->tick);
+      const struct PLANAR_TILE *tile =
+          map->tiles[cell & TILEMAP_CELL_INDEX].planar_tile;
+      const int row =
+          (cell & TILEMAP_CELL_FLIP_Y) ? tile_h - 1 - tile_y : tile_y;
+      const uint32_t *src = tile->data + row * tile_blocks * RING_BLOCK_WORDS;
+      int run = tile_blocks - tile_b;
+      if (run > bx1 - bx) run = bx1 - bx;
+      for (int k = 0; k < run; k++) {
+        uint32_t *dst = ring_row + ring_b * RING_BLOCK_WORDS;
+        if (cell & TILEMAP_CELL_FLIP_X) {
+          const uint32_t *sb =
+              src + (tile_blocks - 1 - (tile_b + k)) * RING_BLOCK_WORDS;
+          dst[0] = reverse_halves(sb[0]);
+          dst[1] = reverse_halves(sb[1]);
+        } else {
+          const uint32_t *sb = src + (tile_b + k) * RING_BLOCK_WORDS;
+          dst[0] = sb[0];
+          dst[1] = sb[1];
+        }
+        if (++ring_b == view->ring_blocks) ring_b = 0;
+      }
+      bx += run;
+    }
+  }
+}
+
+/* Re-render the visible cells of the animations that changed frame */
+static void __not_in_flash_func(tilemap_render_anims)(
+    struct TILEMAP_VIEW *view) {
+  const struct TILEMAP *map = view->map;
+  uint32_t changed = 0;
+  for (int i = 0; i < map->num_anims; i++) {
+    uint8_t frame = (uint8_t)anim_frame(&map->anims[i], view->tick);
+    if (frame != view->anim_frame[i]) changed |= 1u << i;
+    view->anim_frame[i] = frame;
+  }
+  if (!changed) return;
+
+  const int tile_w = map->tiles[0].width;
+  const int tile_h = map->tiles[0].height;
+  const int tile_blocks = tile_w / VGA_BLOCK_PIXELS;
+  const int bx_end = view->ring_block_x + view->ring_blocks;
+  const int y_end = view->ring_y + view->ring_rows;
+  for (int cy = floor_div(view->ring_y, tile_h); cy * tile_h < y_end; cy++) {
+    for (int cx = floor_div(view->ring_block_x, tile_blocks);
+         cx * tile_blocks < bx_end; cx++) {
+      uint16_t cell = map->cells[floor_mod(cy, map->height) * map->width +
+                                 floor_mod(cx, map->width)];
+      if (!(cell & TILEMAP_CELL_ANIM) ||
+          !(changed & (1u << (cell & TILEMAP_CELL_INDEX))))
+        continue;
+      int bx0 = cx * tile_blocks, bx1 = bx0 + tile_blocks;
+      int y0 = cy * tile_h, y1 = y0 + tile_h;
+      if (bx0 < view->ring_block_x) bx0 = view->ring_block_x;
+      if (bx1 > bx_end) bx1 = bx_end;
+      if (y0 < view->ring_y) y0 = view->ring_y;
+      if (y1 > y_end) y1 = y_end;
+      tilemap_render(view, bx0, bx1, y0, y1);
+    }
+  }
+}
+
+void __not_in_flash_func(tilemap_view_update)(struct TILEMAP_VIEW *view,
+                                              int cam_x, int cam_y) {
+  view->tick++;
+  const int block_x = floor_div(cam_x, VGA_BLOCK_PIXELS);
+  const int dx = block_x - view->ring_block_x;
+  const int dy = cam_y - view->ring_y;
+  view->cam_x = cam_x;
+  view->cam_y = cam_y;
+
+  if (!view->valid || abs(dx) >= view->ring_blocks ||
+      abs(dy) >= view->ring_rows) {
+    /* Too far to scroll: render the whole ring */
+    view->ring_block_x = block_x;
+    view->ring_y = cam_y;
+    for (int i = 0; i < view->map->num_anims; i++)
+      view->anim_frame[i] =
+          (uint8_t)anim_frame(&view->map->anims[i], view->tick);
+    tilemap_render(view, block_x, block_x + view->ring_blocks, cam_y,
+                   cam_y + view->ring_rows);
+    view->valid = true;
+    return;
+  }
+
+  /* Exposed block columns, over the rows the ring holds now */
+  if (dx > 0) {
+    tilemap_render(view, view->ring_block_x + view->ring_blocks,
+                   block_x + view->ring_blocks, view->ring_y,
+                   view->ring_y + view->ring_rows);
+  } else if (dx < 0) {
+    tilemap_render(view, block_x, view->ring_block_x, view->ring_y,
+                   view->ring_y + view->ring_rows);
+  }
+  view->ring_block_x = block_x;
+  /* Exposed rows, over the new block columns */
+  if (dy > 0) {
+    tilemap_render(view, block_x, block_x + view->ring_blocks,
+                   view->ring_y + view->ring_rows, cam_y + view->ring_rows);
+  } else if (dy < 0) {
+    tilemap_render(view, block_x, block_x + view->ring_blocks, cam_y,
+                   view->ring_y);
+  }
+  view->ring_y = cam_y;
+
+  tilemap_render_anims(view);
+}
+
+/* Plane words of a block moved left by `shift` pixels, the next block
+ * filling in from the right: both halves at once, masked per half by
+ * `keep` */
+static inline __attribute__((always_inline)) uint32_t funnel_shift(
+    uint32_t word, uint32_t next, unsigned shift, uint32_t keep) {
+  return ((word << shift) & keep) |
+         ((next >> (VGA_BLOCK_PIXELS - shift)) & ~keep);
+}
+
+static inline uint32_t funnel_keep(unsigned shift) {
+  return ((0xFFFFu << shift) & 0xFFFFu) * 0x10001u;
+}
+
+/* Screen row y of the view into `dst`, line_blocks blocks */
+static inline __attribute__((always_inline)) void view_line(
+    const struct TILEMAP_VIEW *view, uint32_t *dst, int line_blocks, int y) {
+  const unsigned shift = (unsigned)view->cam_x & (VGA_BLOCK_PIXELS - 1);
+  const uint32_t keep = funnel_keep(shift);
+  const uint32_t *ring_row =
+      view->ring + floor_mod(view->ring_y + y, view->ring_rows) *
+                       view->ring_blocks * RING_BLOCK_WORDS;
+  int b = floor_mod(view->ring_block_x, view->ring_blocks);
+  uint32_t lo = ring_row[b * RING_BLOCK_WORDS];
+  uint32_t hi = ring_row[b * RING_BLOCK_WORDS + 1];
+  for (int i = 0; i < line_blocks; i++) {
+    if (++b == view->ring_blocks) b = 0;
+    const uint32_t next_lo = ring_row[b * RING_BLOCK_WORDS];
+    const uint32_t next_hi = ring_row[b * RING_BLOCK_WORDS + 1];
+    if (shift == 0) {
+      dst[0] = lo;
+      dst[1] = hi;
+    } else {
+      dst[0] = funnel_shift(lo, next_lo, shift, keep);
+      dst[1] = funnel_shift(hi, next_hi, shift, keep);
+    }
+    lo = next_lo;
+    hi = next_hi;
+    dst += RING_BLOCK_WORDS;
+  }
+}
+
+void __not_in_flash_func(tilemap_view_draw)(const struct TILEMAP_VIEW *view) {
+  const int line_blocks = vga_screen.width / VGA_BLOCK_PIXELS;
+  uint32_t *dst = (uint32_t *)vga_screen.hidden_framebuffer;
+  for (int y = 0; y < view->ring_rows; y++) {
+    view_line(view, dst, line_blocks, y);
+    dst += line_blocks * RING_BLOCK_WORDS;
+  }
+}
+
+void __not_in_flash_func(tilemap_view_draw_line)(
+    const struct TILEMAP_VIEW *view, uint32_t *dst, int y) {
+  view_line(view, dst, vga_screen.width / VGA_BLOCK_PIXELS, y);
+}
+
+void __not_in_flash_func(tilemap_view_draw_block)(
+    const struct TILEMAP_VIEW *view, uint32_t *dst, int dst_stride,
+    int block_x, int y, int rows) {
+  const int ring_words = view->ring_blocks * RING_BLOCK_WORDS;
+  const unsigned shift = (unsigned)view->cam_x & (VGA_BLOCK_PIXELS - 1);
+  const int b = floor_mod(view->ring_block_x + block_x, view->ring_blocks);
+  const int next_b = b + 1 == view->ring_blocks ? 0 : b + 1;
+  int ring_y = floor_mod(view->ring_y + y, view->ring_rows);
+
+  const uint32_t keep = funnel_keep(shift);
+  for (int i = 0; i < rows; i++) {
+    const uint32_t *ring_row = view->ring + ring_y * ring_words;
+    const uint32_t *src = ring_row + b * RING_BLOCK_WORDS;
+    if (shift == 0) {
+      dst[0] = src[0];
+      dst[1] = src[1];
+    } else {
+      const uint32_t *next = ring_row + next_b * RING_BLOCK_WORDS;
+      dst[0] = funnel_shift(src[0], next[0], shift, keep);
+      dst[1] = funnel_shift(src[1], next[1], shift, keep);
+    }
+    dst += dst_stride;
+    if (++ring_y == view->ring_rows) ring_y = 0;
+  }
+}